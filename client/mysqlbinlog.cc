@@ -3486,10 +3486,11 @@ void Transaction_payload_log_event::print(FILE *,
       event_len += BINLOG_CHECKSUM_LEN;
     }
 
-    // now deserialize the event
+    // now deserialize the event; the checksum was computed just above, so
+    // there is nothing to verify
     Binlog_read_error read_error =
         binlog_event_deserialize((const unsigned char *)buffer, event_len,
-                                 &glob_description_event, true, &ev);
+                                 &glob_description_event, false, &ev);
     if (read_error.has_error()) {
       head->error = -1;
       error("Error decoding Payload_log_event: %s.", read_error.get_str());
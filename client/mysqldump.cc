@@ -4028,7 +4028,7 @@ static void dump_table(char *table, char *db) {
       bool first_column = true;
       rownr++;
       if (!extended_insert && !opt_xml) {
-        fputs(insert_pat.str, md_result_file);
+        fwrite(insert_pat.str, 1, insert_pat.length, md_result_file);
         check_io(md_result_file);
       }
       mysql_field_seek(res, 0);
@@ -4120,10 +4120,10 @@ static void dump_table(char *table, char *db) {
                   if (field->type == MYSQL_TYPE_DECIMAL) {
                     /* add " signs around */
                     dynstr_append_checked(&extended_row, "'");
-                    dynstr_append_checked(&extended_row, ptr);
+                    dynstr_append_mem_checked(&extended_row, ptr, length);
                     dynstr_append_checked(&extended_row, "'");
                   } else
-                    dynstr_append_checked(&extended_row, ptr);
+                    dynstr_append_mem_checked(&extended_row, ptr, length);
                 }
               }
             } else
@@ -4175,10 +4175,10 @@ static void dump_table(char *table, char *db) {
               else if (field->type == MYSQL_TYPE_DECIMAL) {
                 /* add " signs around */
                 fputc('\'', md_result_file);
-                fputs(ptr, md_result_file);
+                fwrite(ptr, 1, length, md_result_file);
                 fputc('\'', md_result_file);
               } else
-                fputs(ptr, md_result_file);
+                fwrite(ptr, 1, length, md_result_file);
             }
           } else {
             /* The field value is NULL */
@@ -4204,13 +4204,13 @@ static void dump_table(char *table, char *db) {
         if (total_length + row_length < opt_net_buffer_length) {
           total_length += row_length;
           fputc(',', md_result_file); /* Always row break */
-          fputs(extended_row.str, md_result_file);
+          fwrite(extended_row.str, 1, extended_row.length, md_result_file);
         } else {
           if (row_break) fputs(";\n", md_result_file);
           row_break = 1; /* This is first row */
 
-          fputs(insert_pat.str, md_result_file);
-          fputs(extended_row.str, md_result_file);
+          fwrite(insert_pat.str, 1, insert_pat.length, md_result_file);
+          fwrite(extended_row.str, 1, extended_row.length, md_result_file);
           total_length = row_length + init_length;
         }
         check_io(md_result_file);
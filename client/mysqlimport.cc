@@ -67,7 +67,8 @@ static char *add_load_option(char *ptr, const char *object,
 
 static bool verbose = false, lock_tables = false, ignore_errors = false,
             opt_delete = false, replace = false, silent = false, ignore = false,
-            opt_compress = false, opt_low_priority = false;
+            opt_compress = false, opt_low_priority = false,
+            opt_disable_redo_log = false;
 static bool debug_info_flag = false, debug_check_flag = false;
 static uint opt_use_threads = 0, opt_local_file = 0, my_end_arg = 0;
 static char *current_user = nullptr, *current_host = nullptr,
@@ -137,6 +138,14 @@ static struct my_option my_long_options[] = {
      nullptr},
     {"delete", 'd', "First delete all rows from table.", &opt_delete,
      &opt_delete, nullptr, GET_BOOL, NO_ARG, 0, 0, 0, nullptr, 0, nullptr},
+    {"disable-redo-log", 0,
+     "Disable InnoDB redo logging on the server while the files are loaded, "
+     "and enable it again afterwards. This is only meant for loading data "
+     "into a new instance: if the server stops while redo logging is "
+     "disabled, the instance cannot be recovered. Requires the "
+     "INNODB_REDO_LOG_ENABLE privilege.",
+     &opt_disable_redo_log, &opt_disable_redo_log, nullptr, GET_BOOL, NO_ARG,
+     0, 0, 0, nullptr, 0, nullptr},
     {"enable_cleartext_plugin", OPT_ENABLE_CLEARTEXT_PLUGIN,
      "Enable/disable the clear text authentication plugin.",
      &opt_enable_cleartext_plugin, &opt_enable_cleartext_plugin, nullptr,
@@ -495,6 +504,25 @@ static MYSQL *db_connect(char *host, char *database, char *user, char *) {
   return mysql;
 }
 
+/**
+  Enables or disables InnoDB redo logging for the whole instance.
+
+  @retval true  Success
+  @retval false The statement failed. The error has been printed.
+*/
+static bool set_redo_log(MYSQL *mysql, bool enable) {
+  if (verbose)
+    fprintf(stdout, "%s InnoDB redo logging\n",
+            enable ? "Enabling" : "Disabling");
+  if (mysql_query(mysql, enable ? "ALTER INSTANCE ENABLE INNODB REDO_LOG"
+                                : "ALTER INSTANCE DISABLE INNODB REDO_LOG")) {
+    my_printf_error(0, "Error: %d %s", MYF(0), mysql_errno(mysql),
+                    mysql_error(mysql));
+    return false;
+  }
+  return true;
+}
+
 static void db_disconnect(char *host, MYSQL *mysql) {
   if (verbose)
     fprintf(stdout, "Disconnecting from %s\n", host ? host : "localhost");
@@ -606,6 +634,7 @@ int main(int argc, char **argv) {
   int error = 0;
   MY_INIT(argv[0]);
   MYSQL *mysql = nullptr;
+  bool redo_log_disabled = false;
   my_getopt_use_args_separator = true;
   MEM_ROOT alloc{PSI_NOT_INSTRUMENTED, 512};
   if (load_defaults("my", load_default_groups, &argc, &argv, &alloc)) return 1;
@@ -627,6 +656,19 @@ int main(int argc, char **argv) {
     native_mutex_init(&counter_mutex, nullptr);
     native_cond_init(&count_threshold);
 
+    /* The workers connect on their own, use a separate connection here. */
+    if (opt_disable_redo_log) {
+      if (!(mysql = db_connect(current_host, current_db, current_user,
+                               opt_password[0]))) {
+        exitcode = 1;
+        goto end;
+      }
+      if (!(redo_log_disabled = set_redo_log(mysql, false))) {
+        exitcode = 1;
+        goto end;
+      }
+    }
+
     /* Count the number of tables. This number denotes the total number
        of threads spawn.
     */
@@ -702,6 +744,12 @@ int main(int argc, char **argv) {
       goto end;
     }
 
+    if (opt_disable_redo_log &&
+        !(redo_log_disabled = set_redo_log(mysql, false))) {
+      exitcode = 1;
+      goto end;
+    }
+
     if (lock_tables && (error = lock_table(mysql, argc, argv))) {
       if (exitcode == 0) exitcode = error;
       goto end;
@@ -713,6 +761,11 @@ int main(int argc, char **argv) {
       }
   }
 end:
+  if (redo_log_disabled) {
+    /* ALTER INSTANCE is not allowed while holding table locks. */
+    if (lock_tables) mysql_query(mysql, "UNLOCK TABLES");
+    if (!set_redo_log(mysql, true) && exitcode == 0) exitcode = 1;
+  }
   db_disconnect(current_host, mysql);
   free_passwords();
 #if defined(_WIN32)
@@ -94,6 +94,7 @@ TODO:
 #include <stdarg.h>
 #include <stdlib.h>
 #include <sys/types.h>
+#include <algorithm>
 
 #include "caching_sha2_passwordopt-vars.h"
 #include "my_dir.h"
@@ -143,6 +144,18 @@ uint master_wakeup;
 native_mutex_t sleeper_mutex;
 native_cond_t sleep_threshold;
 
+/*
+  Latency histogram of all queries run by the clients, in microseconds.
+  Values below 16 have a bucket each. Above that, every power of two is
+  split into 8 buckets, so a bucket is at most 12.5% wide. Clients fill
+  a local copy and add it to this one, under counter_mutex, when they
+  finish.
+*/
+#define LATENCY_LINEAR_BUCKETS 16
+#define LATENCY_SUB_BUCKETS 8
+#define LATENCY_BUCKETS (LATENCY_LINEAR_BUCKETS + 60 * LATENCY_SUB_BUCKETS)
+static unsigned long long latency_histogram[LATENCY_BUCKETS];
+
 char **primary_keys;
 unsigned long long primary_keys_number_of;
 
@@ -258,6 +271,11 @@ struct conclusions {
   long int min_timing;
   uint users;
   unsigned long long avg_rows;
+  /* Query latency percentiles in microseconds, 0 if nothing was run */
+  unsigned long long latency_p50;
+  unsigned long long latency_p95;
+  unsigned long long latency_p99;
+  unsigned long long latency_max;
   /* The following are not used yet */
   unsigned long long max_rows;
   unsigned long long min_rows;
@@ -295,6 +313,9 @@ void concurrency_loop(MYSQL *mysql, uint current, option_string *eptr);
 static int run_statements(MYSQL *mysql, statement *stmt);
 int slap_connect(MYSQL *mysql);
 static int run_query(MYSQL *mysql, const char *query, size_t len);
+static void add_latency(unsigned long long *histogram,
+                        unsigned long long usecs);
+static unsigned long long latency_percentile(double fraction);
 
 static const char ALPHANUMERICS[] =
     "0123456789ABCDEFGHIJKLMNOPQRSTWXYZabcdefghijklmnopqrstuvwxyz";
@@ -471,6 +492,7 @@ void concurrency_loop(MYSQL *mysql, uint current, option_string *eptr) {
                          MYF(MY_ZEROFILL | MY_FAE | MY_WME));
 
   memset(&conclusion, 0, sizeof(conclusions));
+  memset(latency_histogram, 0, sizeof(latency_histogram));
 
   if (auto_actual_queries)
     client_limit = auto_actual_queries;
@@ -1682,6 +1704,7 @@ extern "C" void *run_task(void *p) {
   MYSQL_RES *result;
   statement *ptr;
   thread_context *con = (thread_context *)p;
+  unsigned long long histogram[LATENCY_BUCKETS] = {};
 
   {
     DBUG_TRACE;
@@ -1736,6 +1759,8 @@ extern "C" void *run_task(void *p) {
         if (slap_connect(mysql)) goto end;
       }
 
+      const unsigned long long query_start = my_getsystime();
+
       /*
         We have to execute differently based on query type. This should become a
         function.
@@ -1792,6 +1817,9 @@ extern "C" void *run_task(void *p) {
       } while (mysql_next_result(mysql) == 0);
       queries++;
 
+      /* my_getsystime() counts in units of 100 nanoseconds. */
+      add_latency(histogram, (my_getsystime() - query_start) / 10);
+
       if (commit_rate && (++commit_counter == commit_rate)) {
         commit_counter = 0;
         run_query(mysql, "COMMIT", strlen("COMMIT"));
@@ -1810,6 +1838,8 @@ extern "C" void *run_task(void *p) {
     mysql_thread_end();
 
     native_mutex_lock(&counter_mutex);
+    for (int i = 0; i < LATENCY_BUCKETS; i++)
+      latency_histogram[i] += histogram[i];
     thread_counter--;
     native_cond_signal(&count_threshold);
     native_mutex_unlock(&counter_mutex);
@@ -1974,6 +2004,12 @@ void print_conclusions(conclusions *con) {
          con->max_timing / 1000, con->max_timing % 1000);
   printf("\tNumber of clients running queries: %d\n", con->users);
   printf("\tAverage number of queries per client: %llu\n", con->avg_rows);
+  if (con->latency_max)
+    printf(
+        "\tQuery latency percentiles: 50%%: %llu us, 95%%: %llu us, "
+        "99%%: %llu us, max: %llu us\n",
+        con->latency_p50, con->latency_p95, con->latency_p99,
+        con->latency_max);
   printf("\n");
 }
 
@@ -2015,12 +2051,60 @@ void generate_stats(conclusions *con, option_string *eng, stats *sptr) {
   }
   con->avg_timing = con->avg_timing / iterations;
 
+  con->latency_p50 = latency_percentile(0.50);
+  con->latency_p95 = latency_percentile(0.95);
+  con->latency_p99 = latency_percentile(0.99);
+  con->latency_max = latency_percentile(1.0);
+
   if (eng && eng->string)
     con->engine = eng->string;
   else
     con->engine = nullptr;
 }
 
+static void add_latency(unsigned long long *histogram,
+                        unsigned long long usecs) {
+  uint bucket;
+  if (usecs < LATENCY_LINEAR_BUCKETS) {
+    bucket = static_cast<uint>(usecs);
+  } else {
+    /* 2^exp <= usecs < 2^(exp + 1), with exp >= 4 */
+    uint exp = 4;
+    while (exp < 63 && (usecs >> (exp + 1)) != 0) exp++;
+    const uint sub = static_cast<uint>(usecs >> (exp - 3)) &
+                     (LATENCY_SUB_BUCKETS - 1);
+    bucket = LATENCY_LINEAR_BUCKETS + (exp - 4) * LATENCY_SUB_BUCKETS + sub;
+    bucket = std::min(bucket, static_cast<uint>(LATENCY_BUCKETS - 1));
+  }
+  histogram[bucket]++;
+}
+
+/**
+  Returns the upper bound, in microseconds, of the latency histogram
+  bucket holding the given fraction of all queries, or 0 if none ran.
+*/
+static unsigned long long latency_percentile(double fraction) {
+  unsigned long long total = 0;
+  for (int i = 0; i < LATENCY_BUCKETS; i++) total += latency_histogram[i];
+  if (total == 0) return 0;
+
+  unsigned long long rank =
+      static_cast<unsigned long long>(fraction * static_cast<double>(total));
+  rank = std::max(rank, 1ULL);
+
+  unsigned long long seen = 0;
+  int bucket = 0;
+  for (; bucket < LATENCY_BUCKETS - 1; bucket++) {
+    seen += latency_histogram[bucket];
+    if (seen >= rank) break;
+  }
+
+  if (bucket < LATENCY_LINEAR_BUCKETS) return bucket;
+  const uint exp = (bucket - LATENCY_LINEAR_BUCKETS) / LATENCY_SUB_BUCKETS + 4;
+  const uint sub = (bucket - LATENCY_LINEAR_BUCKETS) % LATENCY_SUB_BUCKETS;
+  return ((LATENCY_SUB_BUCKETS + sub + 1ULL) << (exp - 3)) - 1;
+}
+
 void option_cleanup(option_string *stmt) {
   option_string *ptr, *nptr;
   if (!stmt) return;
@@ -200,6 +200,7 @@ CHECK_INCLUDE_FILES (netinet/in.h HAVE_NETINET_IN_H)
 CHECK_INCLUDE_FILES (poll.h HAVE_POLL_H)
 CHECK_INCLUDE_FILES (pwd.h HAVE_PWD_H)
 CHECK_INCLUDE_FILES (strings.h HAVE_STRINGS_H) # Used by NDB
+CHECK_INCLUDE_FILES (sys/epoll.h HAVE_SYS_EPOLL_H)
 CHECK_INCLUDE_FILES (sys/ioctl.h HAVE_SYS_IOCTL_H)
 CHECK_INCLUDE_FILES (sys/mman.h HAVE_SYS_MMAN_H)
 CHECK_INCLUDE_FILES (sys/prctl.h HAVE_SYS_PRCTL_H)
@@ -692,6 +693,50 @@ IF(HAVE_LIBNUMA AND NOT WITH_NUMA)
   MESSAGE(STATUS "Disabling NUMA on user's request")
 ENDIF()
 
+# liburing, used by InnoDB as an alternative to libaio
+IF(LINUX)
+  CHECK_INCLUDE_FILES(liburing.h HAVE_LIBURING_H)
+ENDIF()
+
+IF(HAVE_LIBURING_H)
+  SET(SAVE_CMAKE_REQUIRED_LIBRARIES ${CMAKE_REQUIRED_LIBRARIES})
+  SET(CMAKE_REQUIRED_LIBRARIES ${CMAKE_REQUIRED_LIBRARIES} uring)
+  CHECK_C_SOURCE_COMPILES(
+    "
+    #include <liburing.h>
+    int main()
+    {
+       struct io_uring ring;
+       struct __kernel_timespec ts = {0, 0};
+       struct io_uring_cqe *cqe;
+       if (io_uring_queue_init(1, &ring, 0) != 0) return 1;
+       io_uring_wait_cqe_timeout(&ring, &cqe, &ts);
+       io_uring_queue_exit(&ring);
+       return (ring.features & IORING_FEAT_EXT_ARG) == 0;
+    }"
+    HAVE_LIBURING)
+  SET(CMAKE_REQUIRED_LIBRARIES ${SAVE_CMAKE_REQUIRED_LIBRARIES})
+ELSE()
+  SET(HAVE_LIBURING 0)
+ENDIF()
+
+IF(HAVE_LIBURING)
+  OPTION(WITH_LIBURING "Allow InnoDB to use io_uring for asynchronous IO" ON)
+ELSE()
+  OPTION(WITH_LIBURING "Allow InnoDB to use io_uring for asynchronous IO" OFF)
+ENDIF()
+
+IF(WITH_LIBURING AND NOT HAVE_LIBURING)
+  # Forget it in cache, abort the build.
+  UNSET(WITH_LIBURING CACHE)
+  MESSAGE(FATAL_ERROR "Could not find liburing headers/libraries")
+ENDIF()
+
+IF(HAVE_LIBURING AND NOT WITH_LIBURING)
+  SET(HAVE_LIBURING 0)
+  MESSAGE(STATUS "Disabling liburing on user's request")
+ENDIF()
+
 # Check for intrinsic crc32 support on arm
 IF(LINUX)
   IF (CMAKE_SYSTEM_PROCESSOR MATCHES "aarch64")
@@ -224,6 +224,15 @@ struct MEM_ROOT {
    */
   void ClearForReuse();
 
+  /**
+   * Similar to ClearForReuse(), but keeps the largest block which can hold no
+   * more than max_retained_length bytes, and frees all the others. This
+   * bounds how much memory is held on to after one big burst of allocations,
+   * while still giving the next user a reasonably sized block. If no block is
+   * small enough, this is the same as Clear().
+   */
+  void ClearForReuse(size_t max_retained_length);
+
   /**
     Whether the constructor has run or not.
 
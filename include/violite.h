@@ -168,6 +168,12 @@ int vio_set_blocking_flag(Vio *vio, bool set_blocking_flag);
 size_t vio_read(MYSQL_VIO vio, uchar *buf, size_t size);
 size_t vio_read_buff(MYSQL_VIO vio, uchar *buf, size_t size);
 size_t vio_write(MYSQL_VIO vio, const uchar *buf, size_t size);
+/*
+  Write head_size bytes from head, then size bytes of file starting at offset,
+  without copying the file data to user space. Plain sockets on Linux only.
+*/
+size_t vio_sendfile(MYSQL_VIO vio, const uchar *head, size_t head_size,
+                    File file, my_off_t offset, size_t size);
 /* setsockopt TCP_NODELAY at IPPROTO_TCP level, when possible */
 int vio_fastsend(MYSQL_VIO vio);
 /* setsockopt SO_KEEPALIVE at SOL_SOCKET level, when possible */
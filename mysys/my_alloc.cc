@@ -208,6 +208,52 @@ void MEM_ROOT::ClearForReuse() {
   FreeBlocks(start);
 }
 
+void MEM_ROOT::ClearForReuse(size_t max_retained_length) {
+  DBUG_TRACE;
+
+  if (MEM_ROOT_SINGLE_CHUNKS) {
+    Clear();
+    return;
+  }
+
+  // Already cleared, or memset() to zero, so just ignore.
+  if (m_current_block == nullptr) return;
+
+  // Find the largest block which is small enough to keep.
+  Block **retained_link = nullptr;
+  size_t retained_length = 0;
+  for (Block **link = &m_current_block; *link != nullptr;
+       link = &(*link)->prev) {
+    const size_t length = (*link)->end - pointer_cast<char *>(*link) -
+                          ALIGN_SIZE(sizeof(**link));
+    if (length <= max_retained_length && length > retained_length) {
+      retained_link = link;
+      retained_length = length;
+    }
+  }
+
+  if (retained_link == nullptr) {
+    Clear();
+    return;
+  }
+
+  // Unlink the retained block, and free the rest.
+  Block *retained = *retained_link;
+  *retained_link = retained->prev;
+  Block *start = m_current_block;
+
+  retained->prev = nullptr;
+  m_current_block = retained;
+  m_current_free_start =
+      pointer_cast<char *>(retained) + ALIGN_SIZE(sizeof(*retained));
+  m_current_free_end = retained->end;
+  m_allocated_size = retained_length;
+  m_block_size = std::max(m_orig_block_size, retained_length);
+  TRASH(m_current_free_start, m_allocated_size);
+
+  FreeBlocks(start);
+}
+
 void MEM_ROOT::FreeBlocks(Block *start) {
   // The MEM_ROOT might be allocated on itself, so make sure we don't
   // touch it after we've started freeing.
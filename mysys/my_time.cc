@@ -303,6 +303,78 @@ bool time_zone_displacement_to_seconds(const char *str, size_t length,
   return false;
 }
 
+/**
+  Parse the canonical 'YYYY-MM-DD hh:mm:ss[.f...]' form, with one to six
+  fractional digits, without the general scanner in str_to_datetime().
+  This is the form every DATETIME and TIMESTAMP value is printed in, so it
+  is what bulk loads and replication mostly see.
+
+  @param str           String to parse
+  @param length        Length of string
+  @param[out] l_time   Date is stored here
+  @param flags         As for str_to_datetime()
+  @param status        As for str_to_datetime()
+  @param[out] error    The result of str_to_datetime(), if handled
+
+  @retval true  The string was in canonical form and has been handled
+  @retval false The string needs the general parser. Nothing is changed.
+*/
+static bool str_to_datetime_canonical(const char *str, std::size_t length,
+                                      MYSQL_TIME *l_time,
+                                      my_time_flags_t flags,
+                                      MYSQL_TIME_STATUS *status, bool *error) {
+  if (length != 19 && (length < 21 || length > 26 || str[19] != '.'))
+    return false;
+  if (str[4] != '-' || str[7] != '-' || str[10] != ' ' || str[13] != ':' ||
+      str[16] != ':')
+    return false;
+
+  static constexpr int digit_pos[] = {0,  1,  2,  3,  5,  6,  8,
+                                      9,  11, 12, 14, 15, 17, 18};
+  for (int pos : digit_pos)
+    if (!isdigit_char(str[pos])) return false;
+  for (std::size_t pos = 20; pos < length; pos++)
+    if (!isdigit_char(str[pos])) return false;
+
+  const auto two_digits = [str](int pos) {
+    return static_cast<uint>((str[pos] - '0') * 10 + (str[pos + 1] - '0'));
+  };
+  l_time->year = two_digits(0) * 100 + two_digits(2);
+  l_time->month = two_digits(5);
+  l_time->day = two_digits(8);
+  l_time->hour = two_digits(11);
+  l_time->minute = two_digits(14);
+  l_time->second = two_digits(17);
+
+  const uint frac_len = length == 19 ? 0 : static_cast<uint>(length - 20);
+  ulong second_part = 0;
+  for (std::size_t pos = 20; pos < length; pos++)
+    second_part = second_part * 10 + static_cast<ulong>(str[pos] - '0');
+  l_time->second_part =
+      second_part * log_10_int[DATETIME_MAX_DECIMALS - frac_len];
+  status->fractional_digits = frac_len;
+
+  l_time->time_zone_displacement = 0;
+  l_time->neg = false;
+  l_time->time_type = MYSQL_TIMESTAMP_DATETIME;
+
+  const bool not_zero_date = l_time->year || l_time->month || l_time->day ||
+                             l_time->hour || l_time->minute ||
+                             l_time->second || second_part;
+  if (check_datetime_range(*l_time)) {
+    status->warnings |=
+        not_zero_date ? MYSQL_TIME_WARN_TRUNCATED : MYSQL_TIME_WARN_ZERO_DATE;
+    set_zero_time(l_time, MYSQL_TIMESTAMP_ERROR);
+    *error = true;
+  } else if (check_date(*l_time, not_zero_date, flags, &status->warnings)) {
+    set_zero_time(l_time, MYSQL_TIMESTAMP_ERROR);
+    *error = true;
+  } else {
+    *error = false;
+  }
+  return true;
+}
+
 /**
    Convert a timestamp string to a MYSQL_TIME value.
 
@@ -394,6 +466,10 @@ bool str_to_datetime(const char *const str_arg, std::size_t length,
   assert(status->warnings == 0 && status->fractional_digits == 0 &&
          status->nanoseconds == 0);
 
+  bool error;
+  if (str_to_datetime_canonical(str_arg, length, l_time, flags, status, &error))
+    return error;
+
   /* Skip space at start */
   for (; str != end && isspace_char(*str); str++)
     status->set_deprecation(MYSQL_TIME_STATUS::DEPRECATION::DP_SUPERFLUOUS,
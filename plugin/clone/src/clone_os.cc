@@ -35,6 +35,7 @@ Clone Plugin: OS specific routines for IO and network
 #include <string.h>
 
 #ifdef __linux__
+#include <fcntl.h>
 #include <sys/sendfile.h>
 #endif
 
@@ -180,6 +181,21 @@ int clone_os_copy_file_to_buf(Ha_clone_file from_file, uchar *to_buffer,
     to_buffer += ret_length;
   }
 
+#ifdef __linux__
+  /* Clone reads a file sequentially in chunks, and the caller sends or writes
+  the chunk before reading the next one. Ask the kernel to read the next chunk
+  in the meantime. Skip it for O_DIRECT files, which bypass the page cache. */
+  auto flags = fcntl(from_file.file_desc, F_GETFL);
+
+  if (flags != -1 && (flags & O_DIRECT) == 0) {
+    auto offset = lseek(from_file.file_desc, 0, SEEK_CUR);
+
+    if (offset != -1) {
+      posix_fadvise(from_file.file_desc, offset, length, POSIX_FADV_WILLNEED);
+    }
+  }
+#endif
+
   return (0);
 }
 
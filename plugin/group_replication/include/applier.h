@@ -39,6 +39,7 @@
 #include "plugin/group_replication/include/pipeline_stats.h"
 #include "plugin/group_replication/include/plugin_handlers/stage_monitor_handler.h"
 #include "plugin/group_replication/include/plugin_utils.h"
+#include "plugin/group_replication/include/transaction_decoder_pool.h"
 #include "plugin/group_replication/libmysqlgcs/include/mysql/gcs/gcs_member_identifier.h"
 #include "sql/sql_class.h"
 
@@ -374,6 +375,9 @@ class Applier_module : public Applier_module_interface {
     @param[in] stop_timeout               the timeout when waiting on shutdown
     @param[in] group_sidno                the group configured sidno
     @param[in] gtid_assignment_block_size the group gtid assignment block size
+    @param[in] decoder_threads            the number of threads decoding
+                                          transaction contexts ahead of the
+                                          applier, 0 for none
 
     @return the operation status
       @retval 0      OK
@@ -381,7 +385,8 @@ class Applier_module : public Applier_module_interface {
   */
   int setup_applier_module(Handler_pipeline_type pipeline_type, bool reset_logs,
                            ulong stop_timeout, rpl_sidno group_sidno,
-                           ulonglong gtid_assignment_block_size);
+                           ulonglong gtid_assignment_block_size,
+                           ulong decoder_threads);
 
   /**
     Configure the applier pipeline handlers
@@ -431,8 +436,10 @@ class Applier_module : public Applier_module_interface {
              enum_group_replication_consistency_level consistency_level,
              std::list<Gcs_member_identifier> *online_members,
              PSI_memory_key key) override {
-    this->incoming->push(
-        new Data_packet(data, len, key, consistency_level, online_members));
+    Data_packet *packet =
+        new Data_packet(data, len, key, consistency_level, online_members);
+    decoder_pool.submit(packet);
+    this->incoming->push(packet);
     return 0;
   }
 
@@ -962,6 +969,9 @@ class Applier_module : public Applier_module_interface {
   /* The incoming event queue */
   Synchronized_queue<Packet *> *incoming;
 
+  // Decodes the transaction contexts of the incoming data packets
+  Transaction_decoder_pool decoder_pool;
+
   /* The applier pipeline for event execution */
   Event_handler *pipeline;
 
@@ -830,6 +830,12 @@ class Certifier : public Certifier_interface {
    */
   void garbage_collect();
 
+  /**
+    The number of certification info entries garbage_collect() checks
+    before it lets other threads take LOCK_certification_info.
+  */
+  static const size_t GARBAGE_COLLECT_BATCH_SIZE = 10000;
+
   /**
     Clear incoming queue.
   */
@@ -100,12 +100,21 @@ class Data_packet : public Packet {
   ~Data_packet() override {
     my_free(payload);
     delete m_online_members;
+    delete m_transaction_context_event;
   }
 
   uchar *payload;
   ulong len;
   const enum_group_replication_consistency_level m_consistency_level;
   std::list<Gcs_member_identifier> *m_online_members;
+  /**
+    The Transaction_context_log_event in payload, if it was decoded ahead
+    by Transaction_decoder_pool, and its offset in payload.
+  */
+  Log_event *m_transaction_context_event{nullptr};
+  ulong m_transaction_context_offset{0};
+  /** True while Transaction_decoder_pool has the packet or will decode it. */
+  bool m_decoding{false};
 };
 
 /**
@@ -296,6 +305,19 @@ class Pipeline_event {
     return m_processing_event_type;
   }
 
+  /**
+    Takes away the log event of a pipeline event which holds both a packet
+    and the log event decoded from it, leaving only the packet.
+
+    @return the log event, or nullptr if there is none or no packet
+  */
+  Log_event *release_LogEvent() {
+    if (packet == nullptr) return nullptr;
+    Log_event *event = log_event;
+    log_event = nullptr;
+    return event;
+  }
+
   /**
     Sets the pipeline event's log event.
 
@@ -607,6 +607,11 @@ typedef std::map<std::string, Pipeline_member_stats> Flow_control_module_info;
 class Flow_control_module {
  public:
   static const int64 MAXTPS;
+  /*
+    Shortest wait, in microseconds, that do_wait() does to pace
+    transactions over the flow control period.
+  */
+  static const ulonglong MIN_PACING_WAIT;
 
   /**
     Default constructor.
@@ -681,6 +686,11 @@ class Flow_control_module {
   */
   std::atomic<int64> m_quota_used;
   std::atomic<int64> m_quota_size;
+  /*
+    When the current quota was set, in microseconds. do_wait() paces
+    the quota over the flow control period starting here.
+  */
+  std::atomic<ulonglong> m_quota_period_start;
 
   /*
     Counter incremented on every flow control step.
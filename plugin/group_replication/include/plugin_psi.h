@@ -75,6 +75,7 @@ void register_all_group_replication_psi_keys();
 
 extern PSI_mutex_key key_GR_LOCK_applier_module_run,
     key_GR_LOCK_applier_module_suspend,
+    key_GR_LOCK_applier_decoder_pool,
     key_GR_LOCK_autorejoin_module,
     key_GR_LOCK_cert_broadcast_run,
     key_GR_LOCK_cert_broadcast_dispatcher_run,
@@ -138,6 +139,7 @@ extern PSI_mutex_key key_GR_LOCK_applier_module_run,
 extern PSI_cond_key key_GR_COND_applier_module_run,
     key_GR_COND_applier_module_suspend,
     key_GR_COND_applier_module_wait,
+    key_GR_COND_applier_decoder_pool,
     key_GR_COND_autorejoin_module,
     key_GR_COND_cert_broadcast_dispatcher_run,
     key_GR_COND_cert_broadcast_run,
@@ -178,6 +180,7 @@ extern PSI_cond_key key_GR_COND_applier_module_run,
     key_GR_COND_mysql_thread_handler_read_only_mode_dispatcher_run;
 
 extern PSI_thread_key key_GR_THD_applier_module_receiver,
+    key_GR_THD_applier_decoder,
     key_GR_THD_autorejoin,
     key_GR_THD_transaction_monitor,
     key_GR_THD_cert_broadcast,
@@ -199,6 +199,11 @@ struct plugin_options_variables {
 #define MIN_COMPRESSION_THRESHOLD 0
   ulong compression_threshold_var;
 
+#define DEFAULT_APPLIER_DECODER_THREADS 0
+#define MAX_APPLIER_DECODER_THREADS 64
+#define MIN_APPLIER_DECODER_THREADS 0
+  ulong applier_decoder_threads_var;
+
 #define DEFAULT_GTID_ASSIGNMENT_BLOCK_SIZE 1000000
 #define MIN_GTID_ASSIGNMENT_BLOCK_SIZE 1
 #define MAX_GTID_ASSIGNMENT_BLOCK_SIZE GNO_END
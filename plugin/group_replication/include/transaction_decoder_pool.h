@@ -0,0 +1,110 @@
+/* Copyright (c) 2023, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+
+#ifndef TRANSACTION_DECODER_POOL_INCLUDED
+#define TRANSACTION_DECODER_POOL_INCLUDED
+
+#include <deque>
+#include <vector>
+
+#include "my_inttypes.h"
+#include "my_thread.h"
+#include "mysql/psi/mysql_cond.h"
+#include "mysql/psi/mysql_mutex.h"
+#include "plugin/group_replication/include/pipeline_interfaces.h"
+
+/**
+  @class Transaction_decoder_pool
+
+  Worker threads that decode the Transaction_context_log_event, i.e. the
+  write set and the snapshot version, of the transactions queued to the
+  applier module, while the applier module thread is still busy with the
+  transactions queued before them.
+
+  Certification stays in the applier module thread, in delivery order. It
+  finds the transaction context already decoded in the Data_packet, see
+  Data_packet::m_transaction_context_event.
+
+  The packets are owned by the applier module queue all along. The applier
+  module waits for a packet to be decoded before applying it, and the pool
+  is terminated before the queue is cleared.
+*/
+class Transaction_decoder_pool {
+ public:
+  Transaction_decoder_pool();
+  ~Transaction_decoder_pool();
+
+  /**
+    Starts the worker threads.
+
+    @param[in] workers  the number of worker threads, 0 disables the pool
+
+    @return the operation status
+      @retval false  OK
+      @retval true   Error
+  */
+  bool initialize(uint workers);
+
+  /**
+    Stops the worker threads. The packets not decoded yet are left as they
+    are, and later packets are not decoded.
+  */
+  void terminate();
+
+  /**
+    Queues a packet for decoding, if the pool is running.
+
+    @param[in] packet  the packet received from the group
+  */
+  void submit(Data_packet *packet);
+
+  /**
+    Waits until the given packet is not being decoded.
+
+    @param[in] packet  a packet given to submit()
+  */
+  void wait(Data_packet *packet);
+
+  /**
+    The worker thread loop.
+  */
+  void worker();
+
+ private:
+  /**
+    Decodes the Transaction_context_log_event of a packet, if it has one,
+    into Data_packet::m_transaction_context_event. Errors are left for the
+    applier module to report.
+  */
+  void decode(Data_packet *packet, Format_description_log_event *fde);
+
+  mysql_mutex_t m_lock;
+  /** Signaled when a packet is queued, decoded, or the pool terminated. */
+  mysql_cond_t m_cond;
+  std::deque<Data_packet *> m_queue;
+  std::vector<my_thread_handle> m_threads;
+  /** True unless the worker threads are running. */
+  bool m_aborted{true};
+};
+
+#endif /* TRANSACTION_DECODER_POOL_INCLUDED */
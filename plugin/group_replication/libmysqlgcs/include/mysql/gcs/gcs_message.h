@@ -144,6 +144,23 @@ class Gcs_message_data {
 
   bool encode(uchar *buffer, uint64_t *buffer_len) const;
 
+  /**
+   Encodes the header and payload lengths into the internal buffer, so that
+   it holds the encoded data, and returns it. Unlike the other encode
+   methods, nothing is copied nor is the buffer's ownership released.
+
+   This is only possible when the header fills the capacity reserved for it,
+   as otherwise the header and payload are not contiguous.
+
+   @param[out] buffer Variable that will point to the encoded data, which is
+   valid as long as this object is
+   @param[out] buffer_len Variable that will hold the encoded data's size
+
+   @return true if the encoded data is not contiguous, false otherwise.
+   */
+
+  bool encode_in_place(const uchar **buffer, uint64_t *buffer_len) const;
+
   /**
     Decodes data received via GCS and that belongs to a message. After
     decoding, all the fields will be filled. The data MUST be in little endian
@@ -125,6 +125,15 @@ class Gcs_statistics_interface {
    */
   virtual uint64_t get_all_messages_sent() const = 0;
 
+  /**
+   * @brief The number of proposals that this node made which carried more
+   * than one of the messages counted by get_all_messages_sent. Together
+   * with get_all_messages_sent it tells how effective batching is.
+   *
+   * @return uint64_t the value for all batched proposals
+   */
+  virtual uint64_t get_all_batched_proposals() const = 0;
+
   /**
    * @brief The sum of all socket-level bytes that were received to from group
    * nodes having as a destination this node.
@@ -66,46 +66,54 @@ std::unique_ptr<Gcs_stage_metadata> Gcs_message_stage_lz4::get_stage_header() {
 std::pair<bool, std::vector<Gcs_packet>>
 Gcs_message_stage_lz4::apply_transformation(Gcs_packet &&packet) {
   bool constexpr ERROR = true;
-  bool constexpr OK = false;
   auto result = std::make_pair(ERROR, std::vector<Gcs_packet>());
-  char *new_payload_pointer = nullptr;
-  int compressed_len = 0;
-  std::vector<Gcs_packet> packets_out;
 
   /* Get the original payload information. */
-  int original_payload_length = packet.get_payload_length();
-  char const *original_payload_pointer =
-      reinterpret_cast<char const *>(packet.get_payload_pointer());
+  unsigned long long original_payload_length = packet.get_payload_length();
+  unsigned char const *original_payload_pointer = packet.get_payload_pointer();
 
   /* Get an upper-bound on the transformed payload size and create a packet big
      enough to hold it. */
-  unsigned long long new_payload_length =
-      LZ4_compressBound(original_payload_length);
   bool packet_ok;
   Gcs_packet new_packet;
-  std::tie(packet_ok, new_packet) =
-      Gcs_packet::make_from_existing_packet(packet, new_payload_length);
+  std::tie(packet_ok, new_packet) = Gcs_packet::make_from_existing_packet(
+      packet, get_payload_capacity(original_payload_length));
   if (!packet_ok) goto end;
 
-  /* Compress the old payload into the new packet. */
-  new_payload_pointer =
-      reinterpret_cast<char *>(new_packet.get_payload_pointer());
-  compressed_len =
-      LZ4_compress_default(original_payload_pointer, new_payload_pointer,
-                           original_payload_length, new_payload_length);
+  result = apply_transformation(std::move(new_packet), original_payload_pointer,
+                                original_payload_length);
+
+end:
+  return result;
+}
+
+std::pair<bool, std::vector<Gcs_packet>>
+Gcs_message_stage_lz4::apply_transformation(Gcs_packet &&packet,
+                                            unsigned char const *payload,
+                                            unsigned long long payload_length) {
+  bool constexpr OK = false;
+  std::vector<Gcs_packet> packets_out;
+
+  /* Compress the payload into the packet, which is big enough to hold it. */
+  int original_payload_length = static_cast<int>(payload_length);
+  int new_payload_length = static_cast<int>(packet.get_payload_length());
+  assert(packet.get_payload_length() ==
+         get_payload_capacity(original_payload_length));
+  char *new_payload_pointer =
+      reinterpret_cast<char *>(packet.get_payload_pointer());
+  int compressed_len = LZ4_compress_default(
+      reinterpret_cast<char const *>(payload), new_payload_pointer,
+      original_payload_length, new_payload_length);
   MYSQL_GCS_LOG_TRACE("Compressing payload from size %llu to output %llu.",
                       static_cast<unsigned long long>(original_payload_length),
                       static_cast<unsigned long long>(compressed_len))
 
   /* Since the actual compressed payload size may be smaller than the estimate
      given by LZ4_compressBound, update the packet information accordingly. */
-  new_packet.set_payload_length(compressed_len);
-
-  packets_out.push_back(std::move(new_packet));
-  result = std::make_pair(OK, std::move(packets_out));
+  packet.set_payload_length(compressed_len);
 
-end:
-  return result;
+  packets_out.push_back(std::move(packet));
+  return std::make_pair(OK, std::move(packets_out));
 }
 
 std::pair<Gcs_pipeline_incoming_result, Gcs_packet>
@@ -44,10 +44,21 @@ class Gcs_message_stage_lz4 : public Gcs_message_stage {
 
   std::unique_ptr<Gcs_stage_metadata> get_stage_header() override;
 
+  bool can_apply_from_buffer() const override { return true; }
+
+  unsigned long long get_payload_capacity(
+      unsigned long long payload_length) const override {
+    return LZ4_compressBound(static_cast<int>(payload_length));
+  }
+
  protected:
   std::pair<bool, std::vector<Gcs_packet>> apply_transformation(
       Gcs_packet &&packet) override;
 
+  std::pair<bool, std::vector<Gcs_packet>> apply_transformation(
+      Gcs_packet &&packet, unsigned char const *payload,
+      unsigned long long payload_length) override;
+
   std::pair<Gcs_pipeline_incoming_result, Gcs_packet> revert_transformation(
       Gcs_packet &&packet) override;
 
@@ -72,6 +72,46 @@ end:
   return result;
 }
 
+std::pair<bool, std::vector<Gcs_packet>> Gcs_message_stage::apply(
+    Gcs_packet &&packet, unsigned char const *payload,
+    unsigned long long payload_length) {
+  assert(can_apply_from_buffer());
+  bool constexpr ERROR = true;
+  bool constexpr OK = false;
+  auto result = std::make_pair(ERROR, std::vector<Gcs_packet>());
+
+  /* Save the payload size before this stage is applied. */
+  auto &dynamic_header = packet.get_current_dynamic_header();
+  assert(dynamic_header.get_stage_code() == get_stage_code());
+  dynamic_header.set_payload_length(payload_length);
+
+  /* Transform the payload according to the specific stage logic. */
+  bool failure;
+  std::vector<Gcs_packet> packets_out;
+  std::tie(failure, packets_out) =
+      apply_transformation(std::move(packet), payload, payload_length);
+  if (failure) goto end;
+
+  /* Prepare the packets for the next stage. */
+  for (auto &packet_out : packets_out) {
+    packet_out.prepare_for_next_outgoing_stage();
+  }
+
+  result = std::make_pair(OK, std::move(packets_out));
+
+end:
+  return result;
+}
+
+std::pair<bool, std::vector<Gcs_packet>>
+Gcs_message_stage::apply_transformation(Gcs_packet &&, unsigned char const *,
+                                        unsigned long long) {
+  /* purecov: begin deadcode */
+  assert(false);
+  return std::make_pair(true, std::vector<Gcs_packet>());
+  /* purecov: end */
+}
+
 std::pair<Gcs_pipeline_incoming_result, Gcs_packet> Gcs_message_stage::revert(
     Gcs_packet &&packet) {
   assert(packet.get_current_dynamic_header().get_stage_code() ==
@@ -120,6 +160,8 @@ std::pair<bool, std::vector<Gcs_packet>> Gcs_message_pipeline::process_outgoing(
   auto const original_payload_size = payload.get_encode_size();
   Gcs_packet packet;
   uint64_t buffer_size = 0;
+  Gcs_message_stage *first_stage = nullptr;
+  unsigned char const *encoded_payload = nullptr;
 
   Gcs_protocol_version current_version =
       m_pipeline_version.load(std::memory_order_relaxed);
@@ -179,6 +221,28 @@ std::pair<bool, std::vector<Gcs_packet>> Gcs_message_pipeline::process_outgoing(
       get_stages_to_apply(pipeline_version, original_payload_size);
   if (failure) goto end;
 
+  /*
+   If the first stage replaces the payload, e.g. compression, let it read the
+   payload straight from the application's buffer instead of copying it into
+   the packet first.
+   */
+  if (!stages_to_apply.empty()) {
+    first_stage = retrieve_stage(stages_to_apply.front());
+  }
+  if (first_stage != nullptr && first_stage->can_apply_from_buffer() &&
+      !payload.encode_in_place(&encoded_payload, &buffer_size)) {
+    assert(original_payload_size == buffer_size);
+    std::tie(failure, packet) = create_packet(
+        cargo, current_version,
+        first_stage->get_payload_capacity(original_payload_size),
+        stages_to_apply);
+    if (failure) goto end;
+
+    result = apply_stages(std::move(packet), encoded_payload, buffer_size,
+                          stages_to_apply);
+    goto end;
+  }
+
   /*
    Prepare the packet.
 
@@ -308,6 +372,36 @@ end:
   return result;
 }
 
+std::pair<bool, std::vector<Gcs_packet>> Gcs_message_pipeline::apply_stages(
+    Gcs_packet &&packet, unsigned char const *payload,
+    unsigned long long payload_length,
+    std::vector<Stage_code> const &stages) const {
+  bool constexpr ERROR = true;
+  bool constexpr OK = false;
+  auto result = std::make_pair(ERROR, std::vector<Gcs_packet>());
+  std::vector<Gcs_packet> packets_out;
+  bool failure;
+
+  assert(!stages.empty() && retrieve_stage(stages.front()) != nullptr);
+  std::tie(failure, packets_out) = retrieve_stage(stages.front())
+                                       ->apply(std::move(packet), payload,
+                                               payload_length);
+  if (failure) goto end;
+
+  for (auto it = std::next(stages.begin()); it != stages.end(); ++it) {
+    assert(retrieve_stage(*it) != nullptr);
+    Gcs_message_stage &stage = *retrieve_stage(*it);
+
+    std::tie(failure, packets_out) = apply_stage(std::move(packets_out), stage);
+    if (failure) goto end;
+  }
+
+  result = std::make_pair(OK, std::move(packets_out));
+
+end:
+  return result;
+}
+
 std::pair<bool, std::vector<Gcs_packet>> Gcs_message_pipeline::apply_stage(
     std::vector<Gcs_packet> &&packets, Gcs_message_stage &stage) const {
   bool constexpr ERROR = true;
@@ -77,6 +77,10 @@ enum class Gcs_pipeline_incoming_result {
  but we may revisit this design if it becomes a problem. Note that a quick,
  but maybe not so simple way to overcome this limitation, is through the
  redefinition of the apply and revert methods.
+
+ A stage that replaces the payload, e.g. compression, may also read it from
+ the application's buffer when it is the first stage applied, which spares
+ the copy of the payload into the packet. See can_apply_from_buffer().
  */
 class Gcs_message_stage {
  public:
@@ -135,6 +139,24 @@ class Gcs_message_stage {
   virtual std::pair<bool, std::vector<Gcs_packet>> apply_transformation(
       Gcs_packet &&packet) = 0;
 
+  /**
+   Implements the logic of this stage's transformation when the payload was
+   not copied into the packet, and returns a set of one, or more, transformed
+   packets. It is only called on stages that can_apply_from_buffer().
+
+   @param[in] packet The packet that will hold the transformed payload, with
+              room for get_payload_capacity(payload_length) bytes
+   @param[in] payload The payload upon which the transformation should be
+              applied
+   @param[in] payload_length The length of the payload
+   @retval {true, _} If there was an error applying the transformation
+   @retval {false, P} If the transformation was successful, and produced the
+           set of transformed packets P
+   */
+  virtual std::pair<bool, std::vector<Gcs_packet>> apply_transformation(
+      Gcs_packet &&packet, unsigned char const *payload,
+      unsigned long long payload_length);
+
   /**
    Implements the logic to revert this stage's transformation to the packet,
    and returns one, or none, transformed packet.
@@ -173,6 +195,41 @@ class Gcs_message_stage {
    */
   std::pair<bool, std::vector<Gcs_packet>> apply(Gcs_packet &&packet);
 
+  /**
+   Return whether the stage can transform a payload that is not in the
+   packet. A stage that replaces the payload, e.g. compression, reads it only
+   once, so when it is the first stage applied the pipeline gives it the
+   application's buffer and spares copying the payload into the packet.
+   */
+  virtual bool can_apply_from_buffer() const { return false; }
+
+  /**
+   Return the payload capacity of the packet that apply(packet, payload,
+   payload_length) needs.
+
+   @param payload_length The length of the payload to transform
+   */
+  virtual unsigned long long get_payload_capacity(
+      unsigned long long payload_length) const {
+    return payload_length;
+  }
+
+  /**
+   Apply some transformation to a payload that was not copied into the
+   outgoing packet, and return a set of one, or more, transformed packets.
+
+   @param[in] packet The packet that will hold the transformed payload
+   @param[in] payload The payload upon which the transformation should be
+              applied
+   @param[in] payload_length The length of the payload
+   @retval {true, _} If there was an error applying the transformation
+   @retval {false, P} If the transformation was successful, and produced the
+           set of transformed packets P
+   */
+  std::pair<bool, std::vector<Gcs_packet>> apply(
+      Gcs_packet &&packet, unsigned char const *payload,
+      unsigned long long payload_length);
+
   /**
    Revert some transformation from the incoming packet, and return one, or
    none, transformed packet.
@@ -611,6 +668,24 @@ class Gcs_message_pipeline {
   std::pair<bool, std::vector<Gcs_packet>> apply_stages(
       Gcs_packet &&packet, std::vector<Stage_code> const &stages) const;
 
+  /**
+   Apply the given stages to a payload that was not copied into the given
+   outgoing packet. The first stage must be able to apply from a buffer.
+
+   @param packet The packet that will hold the payload transformed by the
+          first stage
+   @param payload The payload to transform
+   @param payload_length The length of the payload
+   @param stages The stages to apply
+   @retval {true, _} If there was an error applying the stages
+   @retval {false, P} If the stages were successfully applied, and produced
+           the set of transformed packets P
+   */
+  std::pair<bool, std::vector<Gcs_packet>> apply_stages(
+      Gcs_packet &&packet, unsigned char const *payload,
+      unsigned long long payload_length,
+      std::vector<Stage_code> const &stages) const;
+
   /**
    Apply the given stage to the given outgoing packet.
 
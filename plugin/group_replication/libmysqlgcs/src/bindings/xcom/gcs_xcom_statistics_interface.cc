@@ -57,6 +57,10 @@ uint64_t Gcs_xcom_statistics::get_all_messages_sent() const {
   return m_stats_mgr->get_count_var_value(kMessagesSent);
 }
 
+uint64_t Gcs_xcom_statistics::get_all_batched_proposals() const {
+  return m_stats_mgr->get_count_var_value(kBatchedProposals);
+}
+
 uint64_t Gcs_xcom_statistics::get_all_message_bytes_received() const {
   return m_stats_mgr->get_sum_var_value(kMessageBytesReceived);
 }
@@ -77,6 +77,11 @@ class Gcs_xcom_statistics : public Gcs_statistics_interface {
    */
   uint64_t get_all_messages_sent() const override;
 
+  /**
+   * @see Gcs_statistics_interface::get_all_batched_proposals
+   */
+  uint64_t get_all_batched_proposals() const override;
+
   /**
    * @see Gcs_statistics_interface::get_all_message_bytes_received
    */
@@ -36,6 +36,7 @@ enum Gcs_counter_statistics_enum : int {
   kEmptyProposalRounds,          // get_all_empty_proposal_rounds
   kFullProposalCount,            // get_all_full_proposal_count
   kMessagesSent,                 // get_all_messages_sent
+  kBatchedProposals,             // get_all_batched_proposals
   kGcsCounterStatisticsEnumEnd
 };
 
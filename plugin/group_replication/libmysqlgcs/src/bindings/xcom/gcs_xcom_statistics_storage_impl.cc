@@ -48,6 +48,10 @@ void Gcs_xcom_statistics_storage_impl::add_message() {
   m_stats_manager_interface->set_count_var_value(kMessagesSent);
 }
 
+void Gcs_xcom_statistics_storage_impl::add_batched_proposal() {
+  m_stats_manager_interface->set_count_var_value(kBatchedProposals);
+}
+
 void Gcs_xcom_statistics_storage_impl::add_bytes_received(
     uint64_t bytes_received) {
   m_stats_manager_interface->set_sum_var_value(kMessageBytesReceived,
@@ -44,6 +44,7 @@ class Gcs_xcom_statistics_storage_impl
   void add_proposal_time(unsigned long long proposal_time) override;
   void add_three_phase_paxos() override;
   void add_message() override;
+  void add_batched_proposal() override;
   void add_bytes_received(uint64_t bytes_received) override;
   void set_last_proposal_time(unsigned long long proposal_time) override;
 
@@ -71,6 +71,12 @@ class Xcom_statistics_storage_interface {
    */
   virtual void add_message() = 0;
 
+  /**
+   * @brief Adds one proposal that carries more than one message.
+   *
+   */
+  virtual void add_batched_proposal() = 0;
+
   /**
    * @brief Adds to bytes received in this member
    */
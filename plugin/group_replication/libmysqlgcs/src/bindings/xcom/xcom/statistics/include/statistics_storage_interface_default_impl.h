@@ -40,6 +40,7 @@ class Xcom_statistics_storage_interface_default_impl
       [maybe_unused]] unsigned long long proposal_time) override {}
   void add_three_phase_paxos() override {}
   void add_message() override {}
+  void add_batched_proposal() override {}
   void add_bytes_received([[maybe_unused]] uint64_t bytes_received) override {}
   void set_last_proposal_time([
       [maybe_unused]] unsigned long long proposal_time) override {}
@@ -2169,6 +2169,13 @@ static int wait_for_cache(pax_machine **pm, synode_no synode, double timeout);
 static int prop_started = 0;
 static int prop_finished = 0;
 
+/* When other proposals are in flight and the input queue is empty, the
+   proposer waits this long (in seconds) before proposing a single message, so
+   that messages arriving meanwhile are batched into the same Paxos instance.
+   It is small compared to a Paxos round trip, so it only adds latency when the
+   pipeline is busy anyway. */
+static constexpr double BATCH_LINGER_TIME = 0.0002;
+
 /* Find a free slot locally.
    Note that we will happily increment past the event horizon.
    The caller is thus responsible for checking the validity of the
@@ -2407,6 +2414,12 @@ static int proposer_task(task_arg arg) {
      * call stack overflow. */
     if (!is_config(ep->client_msg->p->a->body.c_t) &&
         !is_view(ep->client_msg->p->a->body.c_t)) {
+      /* Under load, give other messages a chance to join this batch */
+      if (AUTOBATCH && prop_started - prop_finished > 1 &&
+          link_empty(&prop_input_queue.data)) {
+        TASK_DELAY(BATCH_LINGER_TIME);
+      }
+
       ep->size = app_data_size(ep->client_msg->p->a);
       ep->nr_batched_app_data = 1;
 
@@ -2447,6 +2460,10 @@ static int proposer_task(task_arg arg) {
         IFDBG(D_NONE, FN; PTREXP(ep->client_msg->p->a); STRLIT("extracted ");
               SYCEXP(ep->client_msg->p->a->app_key));
       }
+
+      if (ep->client_msg->p->a->next != nullptr) {
+        cfg_app_get_storage_statistics()->add_batched_proposal();
+      }
     } else {
       // Add an extra message in statistics for control messages like
       // Views and COnfigurations.
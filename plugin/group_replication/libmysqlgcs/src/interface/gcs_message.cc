@@ -262,6 +262,24 @@ bool Gcs_message_data::encode(uchar *buffer, uint64_t *buffer_len) const {
   return false;
 }
 
+bool Gcs_message_data::encode_in_place(const uchar **buffer,
+                                       uint64_t *buffer_len) const {
+  uint32_t header_len_enc = htole32(m_header_len);
+  uint64_t payload_len_enc = htole64(m_payload_len);
+
+  if (m_buffer == nullptr || m_header_len != m_header_capacity) return true;
+
+  memcpy(m_buffer, &header_len_enc, WIRE_HEADER_LEN_SIZE);
+  memcpy(m_buffer + WIRE_HEADER_LEN_SIZE, &payload_len_enc,
+         WIRE_PAYLOAD_LEN_SIZE);
+  assert(m_buffer + get_encode_header_size() + m_header_len == m_payload);
+
+  *buffer = m_buffer;
+  *buffer_len = get_encode_size();
+
+  return false;
+}
+
 bool Gcs_message_data::decode(const uchar *data, uint64_t data_len) {
   uchar *slider = m_buffer;
 
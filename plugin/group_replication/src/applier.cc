@@ -74,6 +74,7 @@ Applier_module::Applier_module()
 }
 
 Applier_module::~Applier_module() {
+  decoder_pool.terminate();
   if (this->incoming) {
     while (!this->incoming->empty()) {
       Packet *packet = nullptr;
@@ -94,7 +95,8 @@ Applier_module::~Applier_module() {
 int Applier_module::setup_applier_module(Handler_pipeline_type pipeline_type,
                                          bool reset_logs, ulong stop_timeout,
                                          rpl_sidno group_sidno,
-                                         ulonglong gtid_assignment_block_size) {
+                                         ulonglong gtid_assignment_block_size,
+                                         ulong decoder_threads) {
   DBUG_TRACE;
 
   int error = 0;
@@ -102,6 +104,10 @@ int Applier_module::setup_applier_module(Handler_pipeline_type pipeline_type,
   // create the receiver queue
   this->incoming = new Synchronized_queue<Packet *>(key_transaction_data);
 
+  if (decoder_pool.initialize(decoder_threads)) {
+    return 1; /* purecov: inspected */
+  }
+
   stop_wait_timeout = stop_timeout;
 
   pipeline = nullptr;
@@ -373,8 +379,11 @@ int Applier_module::apply_data_packet(Data_packet *data_packet,
     assert(!debug_sync_set_action(current_thd, STRING_WITH_LEN(act)));
   });
 
+  decoder_pool.wait(data_packet);
+
   while ((payload != payload_end) && !error) {
     uint event_len = uint4korr(((uchar *)payload) + EVENT_LEN_OFFSET);
+    ulong offset = payload - data_packet->payload;
 
     Data_packet *new_packet =
         new Data_packet(payload, event_len, key_transaction_data);
@@ -392,6 +401,12 @@ int Applier_module::apply_data_packet(Data_packet *data_packet,
     Pipeline_event *pevent =
         new Pipeline_event(new_packet, fde_evt, UNDEFINED_EVENT_MODIFIER,
                            data_packet->m_consistency_level, online_members);
+    // Hand over the transaction context if it was already decoded
+    if (data_packet->m_transaction_context_event != nullptr &&
+        data_packet->m_transaction_context_offset == offset) {
+      pevent->set_LogEvent(data_packet->m_transaction_context_event);
+      data_packet->m_transaction_context_event = nullptr;
+    }
     error = inject_event_into_pipeline(pevent, cont);
 
     DBUG_EXECUTE_IF("group_replication_apply_data_packet_after_inject", {
@@ -815,6 +830,8 @@ delete_pipeline:
   // The thread ended properly so we can terminate the pipeline
   terminate_applier_pipeline();
 
+  decoder_pool.terminate();
+
   while (!applier_thread_is_exiting) {
     /* Check if applier thread is exiting per microsecond. */
     my_sleep(1);
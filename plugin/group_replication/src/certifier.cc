@@ -1081,32 +1081,58 @@ void Certifier::garbage_collect() {
   DBUG_EXECUTE_IF("group_replication_do_not_clear_certification_database",
                   { return; };);
 
-  mysql_mutex_lock(&LOCK_certification_info);
-
   /*
     When a transaction "t" is applied to all group members and for all
     ongoing, i.e., not yet committed or aborted transactions,
     "t" was already committed when they executed (thus "t"
     precedes them), then "t" is stable and can be removed from
     the certification info.
+
+    The certification info is walked in batches of buckets, and
+    LOCK_certification_info is released between batches so that
+    certification of new transactions does not wait for the whole walk.
+    Entries moved by a rehash in between may be skipped; they are
+    removed by the next round.
   */
-  Certification_info::iterator it = certification_info.begin();
-  stable_gtid_set_lock->wrlock();
-  while (it != certification_info.end()) {
-    if (it->second->is_subset_not_equals(stable_gtid_set)) {
+  std::vector<std::string> stable_write_sets;
+  bool incremented = false;
+  size_t bucket = 0;
+  while (true) {
+    mysql_mutex_lock(&LOCK_certification_info);
+    const size_t bucket_count = certification_info.bucket_count();
+    size_t visited = 0;
+    stable_gtid_set_lock->wrlock();
+    for (; bucket < bucket_count && visited < GARBAGE_COLLECT_BATCH_SIZE;
+         bucket++) {
+      for (auto it = certification_info.begin(bucket);
+           it != certification_info.end(bucket); ++it, ++visited) {
+        if (it->second->is_subset_not_equals(stable_gtid_set))
+          stable_write_sets.push_back(it->first);
+      }
+    }
+    stable_gtid_set_lock->unlock();
+
+    for (const std::string &write_set : stable_write_sets) {
+      auto it = certification_info.find(write_set);
       if (it->second->unlink() == 0) delete it->second;
-      certification_info.erase(it++);
-    } else
-      ++it;
-  }
-  stable_gtid_set_lock->unlock();
+      certification_info.erase(it);
+    }
 
-  /*
-    We need to update parallel applier indexes since we do not know
-    what write sets were purged, which may cause transactions
-    last committed to be incorrectly computed.
-  */
-  increment_parallel_applier_sequence_number(true);
+    /*
+      We need to update parallel applier indexes since we do not know
+      what write sets were purged, which may cause transactions
+      last committed to be incorrectly computed.
+    */
+    bool last_batch = bucket >= bucket_count;
+    if (!stable_write_sets.empty() || (last_batch && !incremented)) {
+      increment_parallel_applier_sequence_number(true);
+      incremented = true;
+    }
+    stable_write_sets.clear();
+
+    if (last_batch) break;
+    mysql_mutex_unlock(&LOCK_certification_info);
+  }
 
 #if !defined(NDEBUG)
   /*
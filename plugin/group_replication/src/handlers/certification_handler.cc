@@ -285,16 +285,27 @@ int Certification_handler::set_transaction_context(Pipeline_event *pevent) {
   assert(transaction_context_packet == nullptr);
   assert(transaction_context_pevent == nullptr);
 
-  Data_packet *packet = nullptr;
-  error = pevent->get_Packet(&packet);
-  if (error || (packet == nullptr)) {
-    /* purecov: begin inspected */
-    LogPluginErr(ERROR_LEVEL, ER_GRP_RPL_FETCH_TRANS_CONTEXT_FAILED);
-    return 1;
-    /* purecov: end */
+  /*
+    If the Transaction_decoder_pool did already decode the event, keep it,
+    the packet is enough for the next handlers.
+  */
+  Log_event *decoded_event = pevent->release_LogEvent();
+  if (decoded_event != nullptr) {
+    Format_description_log_event *fdle = nullptr;
+    pevent->get_FormatDescription(&fdle);
+    transaction_context_pevent = new Pipeline_event(decoded_event, fdle);
+  } else {
+    Data_packet *packet = nullptr;
+    error = pevent->get_Packet(&packet);
+    if (error || (packet == nullptr)) {
+      /* purecov: begin inspected */
+      LogPluginErr(ERROR_LEVEL, ER_GRP_RPL_FETCH_TRANS_CONTEXT_FAILED);
+      return 1;
+      /* purecov: end */
+    }
+    transaction_context_packet =
+        new Data_packet(packet->payload, packet->len, key_certification_data);
   }
-  transaction_context_packet =
-      new Data_packet(packet->payload, packet->len, key_certification_data);
 
   DBUG_EXECUTE_IF(
       "group_replication_certification_handler_set_transaction_context", {
@@ -316,8 +327,20 @@ int Certification_handler::get_transaction_context(
   DBUG_TRACE;
   int error = 0;
 
+  if (transaction_context_pevent != nullptr) {
+    /*
+      Decoded by the Transaction_decoder_pool, which did also read the
+      snapshot version.
+    */
+    assert(transaction_context_packet == nullptr);
+    Log_event *transaction_context_event = nullptr;
+    transaction_context_pevent->get_LogEvent(&transaction_context_event);
+    *tcle =
+        static_cast<Transaction_context_log_event *>(transaction_context_event);
+    return error;
+  }
+
   assert(transaction_context_packet != nullptr);
-  assert(transaction_context_pevent == nullptr);
 
   Format_description_log_event *fdle = nullptr;
   if (pevent->get_FormatDescription(&fdle) && (fdle == nullptr)) {
@@ -23,6 +23,7 @@
 #include "plugin/group_replication/include/pipeline_stats.h"
 
 #include <time.h>
+#include <algorithm>
 
 #include <mysql/components/services/log_builtins.h>
 #include "my_byteorder.h"
@@ -63,6 +64,7 @@
        capacity.
 */
 const int64 Flow_control_module::MAXTPS = INT_MAX32;
+const ulonglong Flow_control_module::MIN_PACING_WAIT = 1000;
 
 Pipeline_stats_member_message::Pipeline_stats_member_message(
     int32 transactions_waiting_certification, int32 transactions_waiting_apply,
@@ -726,6 +728,7 @@ Flow_control_module::Flow_control_module()
     : m_holds_in_period(0),
       m_quota_used(0),
       m_quota_size(0),
+      m_quota_period_start(0),
       m_stamp(0),
       seconds_to_skip(1) {
   mysql_mutex_init(key_GR_LOCK_pipeline_stats_flow_control,
@@ -917,6 +920,7 @@ void Flow_control_module::flow_control_step(
         quota_size =
             std::min(quota_size > 0 ? quota_size : max_quota, max_quota);
 
+      m_quota_period_start.store(my_micro_time());
       m_quota_size.store(quota_size);
       m_quota_used.store(0);
       break;
@@ -1010,6 +1014,29 @@ int32 Flow_control_module::do_wait() {
     mysql_mutex_lock(&m_flow_control_lock);
     mysql_cond_timedwait(&m_flow_control_cond, &m_flow_control_lock, &delay);
     mysql_mutex_unlock(&m_flow_control_lock);
+  } else if (quota_size > 1) {
+    /*
+      Spread the quota evenly over the period instead of letting the
+      writers use it up in a burst at the start of the period and then
+      hold them all until the next one: a transaction that is ahead of
+      the pace waits until its share of the period has elapsed.
+    */
+    const ulonglong period =
+        static_cast<ulonglong>(get_flow_control_period_var()) * 1000000ULL;
+    const ulonglong due =
+        m_quota_period_start.load() +
+        period * static_cast<ulonglong>(quota_used - 1) /
+            static_cast<ulonglong>(quota_size);
+    const ulonglong now = my_micro_time();
+
+    if (due > now + MIN_PACING_WAIT) {
+      struct timespec delay;
+      set_timespec_nsec(&delay, std::min(due - now, period) * 1000ULL);
+
+      mysql_mutex_lock(&m_flow_control_lock);
+      mysql_cond_timedwait(&m_flow_control_cond, &m_flow_control_lock, &delay);
+      mysql_mutex_unlock(&m_flow_control_lock);
+    }
   }
 
   return 0;
@@ -2453,7 +2453,7 @@ int configure_and_start_applier_module() {
   error = applier_module->setup_applier_module(
       STANDARD_GROUP_REPLICATION_PIPELINE, lv.known_server_reset,
       ov.components_stop_timeout_var, lv.group_sidno,
-      ov.gtid_assignment_block_size_var);
+      ov.gtid_assignment_block_size_var, ov.applier_decoder_threads_var);
   if (error) {
     // Delete the possible existing pipeline
     applier_module->terminate_applier_pipeline();
@@ -3642,6 +3642,41 @@ static int check_compression_threshold(MYSQL_THD, SYS_VAR *, void *save,
   return 0;
 }
 
+static int check_applier_decoder_threads(MYSQL_THD, SYS_VAR *, void *save,
+                                         struct st_mysql_value *value) {
+  DBUG_TRACE;
+
+  Checkable_rwlock::Guard g(*lv.plugin_running_lock,
+                            Checkable_rwlock::TRY_READ_LOCK);
+  if (!plugin_running_lock_is_rdlocked(g)) return 1;
+
+  longlong in_val;
+  value->val_int(value, &in_val);
+
+  if (plugin_is_group_replication_running()) {
+    my_message(
+        ER_GROUP_REPLICATION_RUNNING,
+        "The group_replication_applier_decoder_threads cannot be set while "
+        "Group Replication is running",
+        MYF(0));
+    return 1;
+  }
+
+  if (in_val > MAX_APPLIER_DECODER_THREADS || in_val < 0) {
+    std::stringstream ss;
+    ss << "The value " << in_val
+       << " is not within the range of "
+          "accepted values for the option "
+          "group_replication_applier_decoder_threads!";
+    my_message(ER_WRONG_VALUE_FOR_VAR, ss.str().c_str(), MYF(0));
+    return 1;
+  }
+
+  *(longlong *)save = in_val;
+
+  return 0;
+}
+
 static int check_communication_max_message_size(MYSQL_THD, SYS_VAR *,
                                                 void *save,
                                                 struct st_mysql_value *value) {
@@ -4767,6 +4802,22 @@ static MYSQL_SYSVAR_ULONG(
     0                              /* block */
 );
 
+static MYSQL_SYSVAR_ULONG(
+    applier_decoder_threads,        /* name */
+    ov.applier_decoder_threads_var, /* var */
+    PLUGIN_VAR_OPCMDARG | PLUGIN_VAR_PERSIST_AS_READ_ONLY, /* optional var */
+    "The number of threads that decode the write sets of the transactions "
+    "received from the group ahead of the applier, so that only the "
+    "certification itself is done in the applier module thread. When set to "
+    "zero, the applier module thread decodes them. Default: 0.",
+    check_applier_decoder_threads,   /* check func. */
+    nullptr,                         /* update func. */
+    DEFAULT_APPLIER_DECODER_THREADS, /* default */
+    MIN_APPLIER_DECODER_THREADS,     /* min */
+    MAX_APPLIER_DECODER_THREADS,     /* max */
+    0                                /* block */
+);
+
 static MYSQL_SYSVAR_ULONG(
     communication_max_message_size,                        /* name */
     ov.communication_max_message_size_var,                 /* var */
@@ -5334,6 +5385,7 @@ static SYS_VAR *group_replication_system_vars[] = {
     MYSQL_SYSVAR(allow_local_lower_version_join),
     MYSQL_SYSVAR(auto_increment_increment),
     MYSQL_SYSVAR(compression_threshold),
+    MYSQL_SYSVAR(applier_decoder_threads),
     MYSQL_SYSVAR(communication_max_message_size),
     MYSQL_SYSVAR(gtid_assignment_block_size),
     MYSQL_SYSVAR(ssl_mode),
@@ -30,6 +30,7 @@
 /* clang-format off */
 PSI_mutex_key key_GR_LOCK_applier_module_run,
     key_GR_LOCK_applier_module_suspend,
+    key_GR_LOCK_applier_decoder_pool,
     key_GR_LOCK_autorejoin_module,
     key_GR_LOCK_cert_broadcast_run,
     key_GR_LOCK_cert_broadcast_dispatcher_run,
@@ -93,6 +94,7 @@ PSI_mutex_key key_GR_LOCK_applier_module_run,
 PSI_cond_key key_GR_COND_applier_module_run,
     key_GR_COND_applier_module_suspend,
     key_GR_COND_applier_module_wait,
+    key_GR_COND_applier_decoder_pool,
     key_GR_COND_autorejoin_module,
     key_GR_COND_cert_broadcast_dispatcher_run,
     key_GR_COND_cert_broadcast_run,
@@ -134,6 +136,7 @@ PSI_cond_key key_GR_COND_applier_module_run,
 
 
 PSI_thread_key key_GR_THD_applier_module_receiver,
+    key_GR_THD_applier_decoder,
     key_GR_THD_autorejoin,
     key_GR_THD_transaction_monitor,
     key_GR_THD_cert_broadcast,
@@ -260,6 +263,8 @@ static PSI_mutex_info all_group_replication_psi_mutex_keys[] = {
      PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
     {&key_GR_LOCK_applier_module_suspend, "LOCK_applier_module_suspend",
      PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
+    {&key_GR_LOCK_applier_decoder_pool, "LOCK_applier_decoder_pool",
+     PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
     {&key_GR_LOCK_autorejoin_module, "LOCK_autorejoin_module",
      PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
     {&key_GR_LOCK_cert_broadcast_run, "LOCK_certifier_broadcast_run",
@@ -408,6 +413,8 @@ static PSI_cond_info all_group_replication_psi_condition_keys[] = {
      PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
     {&key_GR_COND_applier_module_suspend, "COND_applier_module_suspend",
      PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
+    {&key_GR_COND_applier_decoder_pool, "COND_applier_decoder_pool",
+     PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
     {&key_GR_COND_applier_module_wait, "COND_applier_module_wait",
      PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
     {&key_GR_COND_cert_broadcast_run, "COND_certifier_broadcast_run",
@@ -506,6 +513,8 @@ static PSI_thread_info all_group_replication_psi_thread_keys[] = {
     {&key_GR_THD_applier_module_receiver, "THD_applier_module_receiver",
      "gr_apply", PSI_FLAG_SINGLETON | PSI_FLAG_THREAD_SYSTEM, 0,
      PSI_DOCUMENT_ME},
+    {&key_GR_THD_applier_decoder, "THD_applier_decoder", "gr_decode",
+     PSI_FLAG_THREAD_SYSTEM, 0, PSI_DOCUMENT_ME},
     {&key_GR_THD_cert_broadcast, "THD_certifier_broadcast", "gr_certif",
      PSI_FLAG_SINGLETON | PSI_FLAG_THREAD_SYSTEM, 0, PSI_DOCUMENT_ME},
     {&key_GR_THD_clone_thd, "THD_clone_process", "gr_clone",
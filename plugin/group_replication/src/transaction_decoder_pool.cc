@@ -0,0 +1,153 @@
+/* Copyright (c) 2023, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+
+#include "plugin/group_replication/include/transaction_decoder_pool.h"
+
+#include "my_byteorder.h"
+#include "my_dbug.h"
+#include "plugin/group_replication/include/plugin_psi.h"
+#include "plugin/group_replication/include/plugin_server_include.h"
+
+static void *launch_decoder_thread(void *arg) {
+  Transaction_decoder_pool *pool = static_cast<Transaction_decoder_pool *>(arg);
+  pool->worker();
+  return nullptr;
+}
+
+Transaction_decoder_pool::Transaction_decoder_pool() {
+  mysql_mutex_init(key_GR_LOCK_applier_decoder_pool, &m_lock,
+                   MY_MUTEX_INIT_FAST);
+  mysql_cond_init(key_GR_COND_applier_decoder_pool, &m_cond);
+}
+
+Transaction_decoder_pool::~Transaction_decoder_pool() {
+  terminate();
+  mysql_mutex_destroy(&m_lock);
+  mysql_cond_destroy(&m_cond);
+}
+
+bool Transaction_decoder_pool::initialize(uint workers) {
+  DBUG_TRACE;
+  assert(m_threads.empty());
+  if (workers == 0) return false;
+
+  mysql_mutex_lock(&m_lock);
+  m_aborted = false;
+  mysql_mutex_unlock(&m_lock);
+
+  for (uint i = 0; i < workers; i++) {
+    my_thread_handle thread;
+    if (mysql_thread_create(key_GR_THD_applier_decoder, &thread,
+                            get_connection_attrib(), launch_decoder_thread,
+                            (void *)this)) {
+      terminate(); /* purecov: inspected */
+      return true; /* purecov: inspected */
+    }
+    m_threads.push_back(thread);
+  }
+  return false;
+}
+
+void Transaction_decoder_pool::terminate() {
+  DBUG_TRACE;
+  mysql_mutex_lock(&m_lock);
+  m_aborted = true;
+  for (Data_packet *packet : m_queue) packet->m_decoding = false;
+  m_queue.clear();
+  mysql_cond_broadcast(&m_cond);
+  mysql_mutex_unlock(&m_lock);
+
+  for (my_thread_handle &thread : m_threads) my_thread_join(&thread, nullptr);
+  m_threads.clear();
+}
+
+void Transaction_decoder_pool::submit(Data_packet *packet) {
+  mysql_mutex_lock(&m_lock);
+  if (!m_aborted) {
+    packet->m_decoding = true;
+    m_queue.push_back(packet);
+    mysql_cond_broadcast(&m_cond);
+  }
+  mysql_mutex_unlock(&m_lock);
+}
+
+void Transaction_decoder_pool::wait(Data_packet *packet) {
+  mysql_mutex_lock(&m_lock);
+  while (packet->m_decoding) mysql_cond_wait(&m_cond, &m_lock);
+  mysql_mutex_unlock(&m_lock);
+}
+
+void Transaction_decoder_pool::worker() {
+  my_thread_init();
+  Format_description_log_event fde;
+
+  mysql_mutex_lock(&m_lock);
+  while (true) {
+    while (m_queue.empty() && !m_aborted) mysql_cond_wait(&m_cond, &m_lock);
+    if (m_queue.empty()) break;
+
+    Data_packet *packet = m_queue.front();
+    m_queue.pop_front();
+    mysql_mutex_unlock(&m_lock);
+
+    decode(packet, &fde);
+
+    mysql_mutex_lock(&m_lock);
+    packet->m_decoding = false;
+    mysql_cond_broadcast(&m_cond);
+  }
+  mysql_mutex_unlock(&m_lock);
+
+  my_thread_end();
+}
+
+void Transaction_decoder_pool::decode(Data_packet *packet,
+                                      Format_description_log_event *fde) {
+  uchar *payload = packet->payload;
+  uchar *payload_end = packet->payload + packet->len;
+
+  while (payload + LOG_EVENT_MINIMAL_HEADER_LEN <= payload_end) {
+    uint event_len = uint4korr(payload + EVENT_LEN_OFFSET);
+    if (event_len < LOG_EVENT_MINIMAL_HEADER_LEN ||
+        event_len > static_cast<ulong>(payload_end - payload))
+      return;
+
+    if (payload[EVENT_TYPE_OFFSET] ==
+        mysql::binlog::event::TRANSACTION_CONTEXT_EVENT) {
+      Log_event *event = nullptr;
+      Binlog_read_error binlog_read_error =
+          binlog_event_deserialize(payload, event_len, fde, true, &event);
+      if (binlog_read_error.has_error()) return;
+
+      if (static_cast<Transaction_context_log_event *>(event)
+              ->read_snapshot_version()) {
+        delete event;
+        return;
+      }
+      packet->m_transaction_context_event = event;
+      packet->m_transaction_context_offset = payload - packet->payload;
+      return;
+    }
+    payload += event_len;
+  }
+}
@@ -25,6 +25,7 @@
 #include "my_config.h"
 
 #include <errno.h>
+#include <string.h>
 
 #include "my_compiler.h"
 #include "my_dbug.h"
@@ -242,6 +243,7 @@ static void init_net(NET *net, unsigned char *buff, unsigned int buff_len) {
 void Ack_receiver::run() {
   NET net;
   unsigned char net_buff[REPLY_MESSAGE_MAX_LENGTH];
+  unsigned char last_reply[REPLY_MESSAGE_MAX_LENGTH];
   uint i;
   Socket_listener listener;
 
@@ -304,17 +306,37 @@ void Ack_receiver::run() {
             (server_extension->compress_ctx.algorithm == MYSQL_ZLIB) ||
             (server_extension->compress_ctx.algorithm == MYSQL_ZSTD);
 
+        /*
+          A replica acknowledges positions in binary log order, so when
+          several replies from it are ready only the last one matters.
+          Report just that one, taking LOCK_binlog_ once per replica and
+          batch instead of once per reply.
+        */
+        ulong last_reply_len = 0;
         do {
           net_clear(&net, false);
 
           len = my_net_read(&net);
-          if (likely(len != packet_error))
-            repl_semisync->reportReplyPacket(slave_obj.server_id, net.read_pos,
-                                             len);
-          else if (net.last_errno == ER_NET_READ_ERROR) {
+          if (likely(len != packet_error)) {
+            if (likely(len > REPLY_MAGIC_NUM_OFFSET &&
+                       len <= sizeof(last_reply) &&
+                       net.read_pos[REPLY_MAGIC_NUM_OFFSET] ==
+                           ReplSemiSyncMaster::kPacketMagicNum)) {
+              memcpy(last_reply, net.read_pos, len);
+              last_reply_len = len;
+            } else {
+              /* Let it report the malformed packet. */
+              repl_semisync->reportReplyPacket(slave_obj.server_id,
+                                               net.read_pos, len);
+            }
+          } else if (net.last_errno == ER_NET_READ_ERROR) {
             listener.clear_socket_info(i);
           }
         } while (net.vio->has_data(net.vio) && m_status == ST_UP);
+
+        if (last_reply_len > 0)
+          repl_semisync->reportReplyPacket(slave_obj.server_id, last_reply,
+                                           last_reply_len);
       }
       i++;
     }
@@ -258,33 +258,91 @@ class XRow_encoder_base {
 
   void field_decimal(const char *value, const size_t length) {
     ++m_fields;
-    std::string dec_str(value, length);
-    xcl::Decimal dec(dec_str);
-    std::string dec_bytes = dec.to_bytes();
+    if (length > k_max_decimal_string_length) {
+      std::string dec_str(value, length);
+      xcl::Decimal dec(dec_str);
+      std::string dec_bytes = dec.to_bytes();
+
+      encode_packed_decimal(
+          reinterpret_cast<const uint8_t *>(dec_bytes.c_str()),
+          dec_bytes.length());
+      return;
+    }
 
-    m_encoder->template ensure_buffer_size<30>();
-    m_encoder->template encode_field_delimited_header<tags::Row::field>();
-    m_encoder->encode_var_uint32(static_cast<uint32_t>(dec_bytes.length()));
-    m_encoder->encode_raw(reinterpret_cast<const uint8_t *>(dec_bytes.c_str()),
-                          (static_cast<uint32_t>(dec_bytes.length())));
+    uint8_t packed[k_max_packed_decimal_length];
+    encode_packed_decimal(packed, pack_decimal(value, length, packed));
   }
 
   void field_decimal(const decimal_t *value) {
     ++m_fields;
-    std::string str_buf;
-    int str_len = 200;
-    str_buf.resize(str_len);
-    decimal2string(value, &(str_buf)[0], &str_len);
-    str_buf.resize(str_len);
+    char str_buf[k_max_decimal_string_length];
+    int str_len = sizeof(str_buf);
+    decimal2string(value, str_buf, &str_len);
+
+    uint8_t packed[k_max_packed_decimal_length];
+    encode_packed_decimal(packed, pack_decimal(str_buf, str_len, packed));
+  }
+
+ private:
+  static constexpr size_t k_max_decimal_string_length = 200;
+  static constexpr size_t k_max_packed_decimal_length =
+      k_max_decimal_string_length / 2 + 3;
+
+  /**
+    Pack a decimal string the same way as xcl::Decimal: one byte with the
+    scale, followed by the digits in BCD and the sign nibble. Writes into
+    the given buffer instead of building intermediate strings.
+
+    @return length of the packed value, 0 if the string isn't a decimal
+  */
+  static size_t pack_decimal(const char *value, const size_t length,
+                             uint8_t *out) {
+    const char *end = value + length;
+    const char *dot = static_cast<const char *>(memchr(value, '.', length));
+    size_t out_len = 0;
+
+    out[out_len++] = static_cast<uint8_t>(dot ? end - dot - 1 : 0);
+    if (value == end) return out_len;
+
+    const char *c = value;
+    uint8_t sign = 0xc;
+    if (*c == '-' || *c == '+') {
+      if (*c == '-') sign = 0xd;
+      ++c;
+    }
 
-    xcl::Decimal dec(str_buf);
-    std::string dec_bytes = dec.to_bytes();
+    bool dot_skipped = false;
+    bool high_nibble = true;
+    for (; c != end; ++c) {
+      if (*c == '.') {
+        if (dot_skipped) return 0;
+        dot_skipped = true;
+        continue;
+      }
+      if (*c < '0' || *c > '9') return 0;
+
+      const uint8_t digit = static_cast<uint8_t>(*c - '0');
+      if (high_nibble)
+        out[out_len] = static_cast<uint8_t>(digit << 4);
+      else
+        out[out_len++] |= digit;
+      high_nibble = !high_nibble;
+    }
+
+    if (high_nibble) {
+      if (out_len <= 1) return 0;
+      out[out_len++] = static_cast<uint8_t>(sign << 4);
+    } else {
+      out[out_len++] |= sign;
+    }
+    return out_len;
+  }
 
+  void encode_packed_decimal(const uint8_t *packed, const size_t length) {
     m_encoder->template ensure_buffer_size<30>();
     m_encoder->template encode_field_delimited_header<tags::Row::field>();
-    m_encoder->encode_var_uint32(static_cast<uint32_t>(dec_bytes.length()));
-    m_encoder->encode_raw(reinterpret_cast<const uint8_t *>(dec_bytes.c_str()),
-                          (static_cast<uint32_t>(dec_bytes.length())));
+    m_encoder->encode_var_uint32(static_cast<uint32_t>(length));
+    m_encoder->encode_raw(packed, static_cast<uint32_t>(length));
   }
 };
 
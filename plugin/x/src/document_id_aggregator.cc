@@ -34,9 +34,28 @@ std::string Document_id_aggregator::generate_id(const Variables &vars) {
   return id;
 }
 
+std::string Document_id_aggregator::generate_id() {
+  if (!m_variables_loaded) {
+    const ngs::Error_code error = load_variables();
+    if (error) throw error;
+  }
+  return generate_id(m_variables);
+}
+
 ngs::Error_code Document_id_aggregator::configue(
     iface::Sql_session *data_context) {
-  Sql_data_result result(data_context);
+  // Most inserts either go into tables or carry their own _id, so the
+  // variables are only read once an id has to be generated.
+  m_data_context = data_context;
+  m_variables_loaded = false;
+  return ngs::Success();
+}
+
+ngs::Error_code Document_id_aggregator::load_variables() {
+  m_variables_loaded = true;
+  if (m_data_context == nullptr) return ngs::Success();
+
+  Sql_data_result result(m_data_context);
   try {
     result.query(
         "SELECT @@mysqlx_document_id_unique_prefix,"
@@ -35,7 +35,7 @@ class Document_id_aggregator : public iface::Document_id_aggregator {
  public:
   explicit Document_id_aggregator(iface::Document_id_generator *gen)
       : m_id_generator(gen) {}
-  std::string generate_id() override { return generate_id(m_variables); }
+  std::string generate_id() override;
   std::string generate_id(const Variables &vars) override;
   void clear_ids() override { m_document_ids.clear(); }
   const Document_id_list &get_ids() const override { return m_document_ids; }
@@ -45,8 +45,12 @@ class Document_id_aggregator : public iface::Document_id_aggregator {
   }
 
  private:
+  ngs::Error_code load_variables();
+
   iface::Document_id_generator *m_id_generator;
   iface::Document_id_generator::Variables m_variables;
+  iface::Sql_session *m_data_context{nullptr};
+  bool m_variables_loaded{false};
   Document_id_list m_document_ids;
   bool m_id_retention_state{false};
 };
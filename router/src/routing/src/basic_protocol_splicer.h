@@ -157,6 +157,33 @@ class BasicConnection : public ConnectionBase {
   void async_recv(recv_buffer_type &buf,
                   std::function<void(std::error_code ec, size_t transferred)>
                       completion) override {
+    if (sock_.native_non_blocking()) {
+      // if the socket is non-blocking try to read directly as, while
+      // forwarding larger resultsets, the next bytes are usually already
+      // there. Saves the round-trip through the io-context.
+      auto read_res = net::read(sock_, net::dynamic_buffer(buf),
+                                net::transfer_at_least(1));
+      if (read_res) {
+        net::defer(sock_.get_executor(), [completion = std::move(completion),
+                                          transferred = *read_res]() {
+          completion({}, transferred);
+        });
+        return;
+      }
+
+      const auto ec = read_res.error();
+
+      if (ec != make_error_condition(std::errc::operation_would_block) &&
+          ec !=
+              make_error_condition(std::errc::resource_unavailable_try_again)) {
+        net::defer(sock_.get_executor(), [completion = std::move(completion),
+                                          ec]() { completion(ec, 0); });
+        return;
+      }
+
+      // if it would-block, use the normal async-read.
+    }
+
     net::async_read(sock_, net::dynamic_buffer(buf), net::transfer_at_least(1),
                     std::move(completion));
   }
@@ -32,8 +32,7 @@
 #include <sys/types.h>
 #include <algorithm>  // std::min, std::max
 #include <array>
-#include <cmath>       // std::isfinite
-#include <functional>  // std::function
+#include <cmath>  // std::isfinite
 #include <new>
 #include <utility>
 
@@ -444,7 +443,7 @@ class Rapid_json_handler {
       case expect_object_value: {
         m_state = expect_object_key;
         auto object = down_cast<Json_object *>(m_current_element);
-        return !object->add_alias(m_key, std::move(value));
+        return !object->add_alias(std::move(m_key), std::move(value));
       }
       default:
         /* purecov: begin inspected */
@@ -816,6 +815,22 @@ bool Json_object::add_alias(const std::string &key, Json_dom_ptr value) {
   return false;
 }
 
+bool Json_object::add_alias(std::string &&key, Json_dom_ptr value) {
+  if (!value) return true; /* purecov: inspected */
+
+  // We have taken over the ownership of this value.
+  value->set_parent(this);
+
+  // Same as above, but move the key into a new node instead of copying it.
+  auto it = m_map.lower_bound(key);
+  if (it != m_map.end() && !m_map.key_comp()(key, it->first)) {
+    it->second = std::move(value);
+  } else {
+    m_map.emplace_hint(it, std::move(key), std::move(value));
+  }
+  return false;
+}
+
 #ifdef MYSQL_SERVER
 bool Json_object::consume(Json_object_ptr other) {
   for (auto &other_member : other->m_map) {
@@ -1950,12 +1965,16 @@ struct Json_seek_params {
 
 }  // namespace
 
+/// Type of the helper functions of #seek_no_dup_elimination.
+using Json_seek_func = bool (*)(const json_binary::Value &,
+                                const Json_path_iterator &,
+                                const Json_seek_params &);
+
 static bool seek_no_dup_elimination(const json_binary::Value &value,
                                     const Json_path_iterator &current_leg,
                                     const Json_seek_params &params);
-static std::function<bool(const json_binary::Value &,
-                          const Json_path_iterator &, const Json_seek_params &)>
-get_seek_func(const Json_path_iterator &it, const Json_seek_params &params);
+static Json_seek_func get_seek_func(const Json_path_iterator &it,
+                                    const Json_seek_params &params);
 
 /**
   Helper function for #seek_no_dup_elimination which handles
@@ -2107,33 +2126,29 @@ static bool seek_no_dup_elimination(const json_binary::Value &value,
 
 /**
   Get which helper function of #seek_no_dup_elimination() should be
-  used for this path leg.
+  used for this path leg. A plain function pointer is returned, so that
+  walking wildcards and ranges does not go through std::function for
+  every element.
 */
-static std::function<bool(const json_binary::Value &,
-                          const Json_path_iterator &, const Json_seek_params &)>
-get_seek_func(const Json_path_iterator &it, const Json_seek_params &params) {
-  using Val = const json_binary::Value &;
-  using It = const Json_path_iterator &;
-  using Param = const Json_seek_params &;
-
+static Json_seek_func get_seek_func(const Json_path_iterator &it,
+                                    const Json_seek_params &params) {
   if (it != params.m_last_leg) {
     switch ((*it)->get_type()) {
       case jpl_member:
-        return [](Val v, It i, Param p) { return seek_member(v, i, p); };
+        return seek_member;
       case jpl_array_cell:
-        return [](Val v, It i, Param p) { return seek_array_cell(v, i, p); };
+        return seek_array_cell;
       case jpl_array_range:
       case jpl_array_cell_wildcard:
-        return [](Val v, It i, Param p) { return seek_array_range(v, i, p); };
+        return seek_array_range;
       case jpl_member_wildcard:
-        return
-            [](Val v, It i, Param p) { return seek_member_wildcard(v, i, p); };
+        return seek_member_wildcard;
       case jpl_ellipsis:
-        return [](Val v, It i, Param p) { return seek_ellipsis(v, i, p); };
+        return seek_ellipsis;
     }
   }
 
-  return [](Val v, It i, Param p) { return seek_end(v, i, p); };
+  return seek_end;
 }
 
 bool Json_wrapper::seek(const Json_seekable_path &path, size_t legs,
@@ -422,6 +422,17 @@ class Json_object final : public Json_container {
   */
   bool add_alias(const std::string &key, Json_dom_ptr value);
 
+  /**
+    Insert the value into the object, taking over the key string as well.
+    Used when building objects from parsed text, where the key is a
+    temporary which is not needed afterwards.
+
+    @param[in] key    the key of the value to be added
+    @param[in] value  the value to add
+    @return false on success, true on failure
+  */
+  bool add_alias(std::string &&key, Json_dom_ptr value);
+
   /**
     Transfer all of the key/value pairs in the other object into this
     object. The other object is deleted. If this object and the other
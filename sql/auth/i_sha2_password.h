@@ -150,10 +150,24 @@ class Caching_sha2_password {
   unsigned int m_fast_digest_rounds;
   /** Digest type */
   Digest_info m_digest_type;
-  /** Lock to protect @c m_cache */
-  mysql_rwlock_t m_cache_lock;
-  /** user=>password cache */
-  SHA2_password_cache m_cache;
+  /**
+    The user=>password cache is split in shards, each with its own lock, so
+    that the connections of different users do not contend on one lock.
+  */
+  struct Cache_shard {
+    /** Lock to protect @c cache */
+    mysql_rwlock_t lock;
+    /** user=>password cache */
+    SHA2_password_cache cache;
+  };
+  static const size_t CACHE_SHARDS = 16;
+  Cache_shard m_cache_shards[CACHE_SHARDS];
+
+  /** Returns the shard which caches the entry of an authorization ID */
+  Cache_shard &get_cache_shard(const std::string &authorization_id) {
+    return m_cache_shards[std::hash<std::string>()(authorization_id) %
+                          CACHE_SHARDS];
+  }
 };
 }  // namespace sha2_password
 
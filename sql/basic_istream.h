@@ -79,6 +79,11 @@ class Basic_seekable_istream : public Basic_istream {
      The total length of the stream.
    */
   virtual my_off_t length() = 0;
+  /**
+     The file that holds the stream, if its bytes are stored in it unchanged,
+     at the same offsets. Otherwise -1, e.g. if the data is encrypted.
+  */
+  virtual File raw_file() const { return -1; }
   ~Basic_seekable_istream() override = default;
 };
 
@@ -122,6 +127,8 @@ class IO_CACHE_istream : public Basic_seekable_istream {
   */
   my_off_t length() override;
 
+  File raw_file() const override { return m_io_cache.file; }
+
  private:
   IO_CACHE m_io_cache;
 };
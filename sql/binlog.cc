@@ -499,6 +499,17 @@ class MYSQL_BIN_LOG::Binlog_ofile : public Basic_ostream {
     m_pipeline_head.reset(nullptr);
     m_position = 0;
     m_encrypted_header_size = 0;
+    m_tail_cache = nullptr;
+  }
+
+  /**
+     Makes all data written from now on be added to the given tail cache
+     as well. It is only used by the active binlog of mysql_bin_log.
+
+     @param[in] tail_cache  The cache, already reset for this file.
+  */
+  void set_tail_cache(Binlog_tail_cache *tail_cache) {
+    m_tail_cache = tail_cache;
   }
 
   /**
@@ -513,8 +524,13 @@ class MYSQL_BIN_LOG::Binlog_ofile : public Basic_ostream {
   bool write(const unsigned char *buffer, my_off_t length) override {
     assert(m_pipeline_head != nullptr);
 
-    if (m_pipeline_head->write(buffer, length)) return true;
+    if (m_pipeline_head->write(buffer, length)) {
+      if (m_tail_cache != nullptr) m_tail_cache->invalidate();
+      return true;
+    }
 
+    if (m_tail_cache != nullptr)
+      m_tail_cache->append(m_position, buffer, length);
     m_position += length;
     return false;
   }
@@ -532,6 +548,7 @@ class MYSQL_BIN_LOG::Binlog_ofile : public Basic_ostream {
   */
   bool update(const unsigned char *buffer, my_off_t length, my_off_t offset) {
     assert(m_pipeline_head != nullptr);
+    if (m_tail_cache != nullptr) m_tail_cache->invalidate();
     return m_pipeline_head->seek(offset) ||
            m_pipeline_head->write(buffer, length);
   }
@@ -548,6 +565,7 @@ class MYSQL_BIN_LOG::Binlog_ofile : public Basic_ostream {
     assert(m_pipeline_head != nullptr);
 
     if (m_pipeline_head->truncate(offset)) return true;
+    if (m_tail_cache != nullptr) m_tail_cache->truncate(offset);
     m_position = offset;
     return false;
   }
@@ -600,6 +618,7 @@ class MYSQL_BIN_LOG::Binlog_ofile : public Basic_ostream {
   int m_encrypted_header_size = 0;
   std::unique_ptr<Truncatable_ostream> m_pipeline_head;
   bool m_encrypted = false;
+  Binlog_tail_cache *m_tail_cache = nullptr;
 };
 
 /**
@@ -713,6 +732,15 @@ class binlog_cache_data {
   }
 
   Binlog_cache_storage *get_cache() { return &m_cache; }
+
+  /**
+    The CRC32 of each event in the cache, not counting the common header,
+    or an empty vector if they have not been computed; see finalize().
+  */
+  const std::vector<ha_checksum> &event_body_checksums() const {
+    return m_event_body_checksums;
+  }
+
   int finalize(THD *thd, Log_event *end_event);
   int finalize(THD *thd, Log_event *end_event, XID_STATE *xs);
   int flush(THD *thd, my_off_t *bytes, bool *wrote_xid);
@@ -834,6 +862,7 @@ class binlog_cache_data {
       variable after truncating the cache.
     */
     cache_state_map.clear();
+    m_event_body_checksums.clear();
     m_event_counter = 0;
     m_compressed_size = 0;
     m_decompressed_size = 0;
@@ -1039,6 +1068,14 @@ class binlog_cache_data {
   /// failed and left the uncompressed transaction intact.
   [[NODISCARD]] bool compress(THD *thd);
 
+  /**
+    Compute event_body_checksums(), in the committing session, so that the
+    flush stage leader only has to checksum the event headers it rewrites.
+    This is skipped if the cache has been spilled to disk, since reading
+    it twice would then cost more than it saves.
+  */
+  void compute_event_body_checksums();
+
  private:
   /*
     Storage for byte data. This binlog_cache_data will serialize
@@ -1046,6 +1083,9 @@ class binlog_cache_data {
   */
   Binlog_cache_storage m_cache;
 
+  /** See event_body_checksums(). */
+  std::vector<ha_checksum> m_event_body_checksums;
+
   /*
     Pending binrows event. This event is the event where the rows are currently
     written.
@@ -1386,6 +1426,16 @@ class Binlog_event_writer : public Basic_ostream {
   uchar header[LOG_EVENT_HEADER_LEN];
   my_off_t header_len = 0;
   uint32 event_len = 0;
+  /**
+    Checksums of the event bodies computed in advance, see
+    binlog_cache_data::event_body_checksums(), and the next one to use.
+  */
+  const std::vector<ha_checksum> *m_body_checksums = nullptr;
+  size_t m_next_body_checksum = 0;
+  /** Whether the body of the current event has a checksum computed in
+  advance, and its length. */
+  bool m_use_body_checksum = false;
+  uint32 m_body_len = 0;
 
  public:
   /**
@@ -1406,9 +1456,23 @@ class Binlog_event_writer : public Basic_ostream {
     if (DBUG_EVALUATE_IF("fault_injection_crc_value", 1, 0)) checksum--;
   }
 
+  /**
+    Use the given checksums of the event bodies for the events that
+    follow, instead of computing them. Call with nullptr after the events.
+  */
+  void set_event_body_checksums(const std::vector<ha_checksum> *checksums) {
+    m_body_checksums =
+        checksums != nullptr && !checksums->empty() ? checksums : nullptr;
+    m_next_body_checksum = 0;
+  }
+
   void update_header() {
     event_len = uint4korr(header + EVENT_LEN_OFFSET);
 
+    m_use_body_checksum = have_checksum && m_body_checksums != nullptr &&
+                          m_next_body_checksum < m_body_checksums->size();
+    m_body_len = event_len - LOG_EVENT_HEADER_LEN;
+
     // Increase end_log_pos
     end_log_pos += event_len;
 
@@ -1452,7 +1516,7 @@ class Binlog_event_writer : public Basic_ostream {
         if (m_binlog_file->write(buffer, write_bytes)) return true;
 
         // update the checksum
-        if (have_checksum)
+        if (have_checksum && !m_use_body_checksum)
           checksum = my_checksum(checksum, buffer, write_bytes);
 
         event_len -= write_bytes;
@@ -1463,6 +1527,11 @@ class Binlog_event_writer : public Basic_ostream {
         if (have_checksum && event_len == 0) {
           uchar checksum_buf[BINLOG_CHECKSUM_LEN];
 
+          if (m_use_body_checksum)
+            checksum = static_cast<ha_checksum>(crc32_combine(
+                checksum, (*m_body_checksums)[m_next_body_checksum++],
+                static_cast<z_off_t>(m_body_len)));
+
           int4store(checksum_buf, checksum);
           if (m_binlog_file->write(checksum_buf, BINLOG_CHECKSUM_LEN))
             return true;
@@ -1478,6 +1547,64 @@ class Binlog_event_writer : public Basic_ostream {
   bool is_checksum_enabled() { return have_checksum; }
 };
 
+/**
+  Computes the CRC32 of the body of each event written to it, that is, of
+  everything but the common header, which is rewritten when the event is
+  flushed to the binary log. See binlog_cache_data::event_body_checksums().
+*/
+class Binlog_event_body_checksummer : public Basic_ostream {
+  std::vector<ha_checksum> *m_checksums;
+  uchar header[LOG_EVENT_HEADER_LEN];
+  my_off_t header_len = 0;
+  uint32 event_len = 0;
+  ha_checksum checksum = 0;
+
+ public:
+  explicit Binlog_event_body_checksummer(std::vector<ha_checksum> *checksums)
+      : m_checksums(checksums) {}
+
+  bool write(const unsigned char *buffer, my_off_t length) override {
+    while (length > 0) {
+      if (event_len == 0) {
+        uint32 header_incr =
+            std::min<uint32>(LOG_EVENT_HEADER_LEN - header_len, length);
+
+        memcpy(header + header_len, buffer, header_incr);
+        header_len += header_incr;
+        buffer += header_incr;
+        length -= header_incr;
+
+        if (header_len == LOG_EVENT_HEADER_LEN) {
+          event_len = uint4korr(header + EVENT_LEN_OFFSET) - header_len;
+          header_len = 0;
+          checksum = my_checksum(0L, nullptr, 0);
+        }
+      } else {
+        my_off_t bytes = std::min<uint64>(length, event_len);
+
+        checksum = my_checksum(checksum, buffer, bytes);
+        event_len -= bytes;
+        length -= bytes;
+        buffer += bytes;
+
+        if (event_len == 0) m_checksums->push_back(checksum);
+      }
+    }
+    return false;
+  }
+};
+
+void binlog_cache_data::compute_event_body_checksums() {
+  m_event_body_checksums.clear();
+  if (binlog_checksum_options ==
+          mysql::binlog::event::BINLOG_CHECKSUM_ALG_OFF ||
+      m_cache.is_empty() || m_cache.disk_writes() != 0)
+    return;
+
+  Binlog_event_body_checksummer checksummer(&m_event_body_checksums);
+  if (m_cache.copy_to(&checksummer)) m_event_body_checksums.clear();
+}
+
 /*
   this function is mostly a placeholder.
   conceptually, binlog initialization (now mostly done in MYSQL_BIN_LOG::open)
@@ -2261,6 +2388,7 @@ int binlog_cache_data::finalize(THD *thd, Log_event *end_event) {
     if (int error = flush_pending_event(thd)) return error;
     if (int error = write_event(end_event)) return error;
     if (int error = this->compress(thd)) return error;
+    compute_event_body_checksums();
     DBUG_PRINT("debug", ("flags.finalized: %s", YESNO(flags.finalized)));
     flags.finalized = true;
   }
@@ -3566,6 +3694,7 @@ void MYSQL_BIN_LOG::cleanup() {
     mysql_mutex_destroy(&LOCK_log_info);
     mysql_cond_destroy(&update_cond);
     mysql_cond_destroy(&m_prep_xids_cond);
+    m_relay_log_tail_cache.deinit();
     if (!is_relay_log) {
       Commit_stage_manager::get_instance().deinit();
     }
@@ -3836,6 +3965,15 @@ bool MYSQL_BIN_LOG::open(PSI_file_key log_file_key, const char *log_name,
 
   ret = m_binlog_file->open(log_file_key, log_file_name, flags);
 
+  if (!ret && is_relay_log && !m_relay_log_tail_cache.is_enabled() &&
+      m_relay_log_tail_cache.init(opt_relay_log_tail_cache_size))
+    ret = true;
+
+  if (!ret && get_tail_cache() != nullptr) {
+    get_tail_cache()->reset(log_file_name);
+    m_binlog_file->set_tail_cache(get_tail_cache());
+  }
+
   if (!is_relay_log) mysql_mutex_unlock(&LOCK_sync);
 
   if (ret) goto err;
@@ -4465,6 +4603,44 @@ bool MYSQL_BIN_LOG::find_first_log(std::string &binlog_file_name,
   return false;
 }
 
+std::optional<bool> MYSQL_BIN_LOG::get_cached_gtid_header(
+    const char *filename, Gtid_set *prev_gtids, Gtid *first_gtid) {
+  Gtid_header header;
+  {
+    MUTEX_LOCK(lock, &LOCK_index);
+    auto it = m_gtid_header_cache.find(filename);
+    if (it == m_gtid_header_cache.end()) return std::nullopt;
+    header = it->second;
+  }
+
+  if (prev_gtids->add_gtid_encoding(
+          reinterpret_cast<const uchar *>(header.previous_gtids.data()),
+          header.previous_gtids.size()) != RETURN_STATUS_OK)
+    return std::nullopt;
+  if (header.first_gno == 0) return false;
+
+  rpl_sidno sidno = prev_gtids->get_tsid_map()->add_tsid(header.first_tsid);
+  if (sidno <= 0) return std::nullopt;
+  first_gtid->set(sidno, header.first_gno);
+  return true;
+}
+
+void MYSQL_BIN_LOG::cache_gtid_header(const char *filename,
+                                      const Gtid_set *prev_gtids,
+                                      const Gtid *first_gtid) {
+  Gtid_header header;
+  header.previous_gtids.resize(prev_gtids->get_encoded_length());
+  prev_gtids->encode(reinterpret_cast<uchar *>(header.previous_gtids.data()));
+  if (first_gtid != nullptr) {
+    header.first_tsid =
+        prev_gtids->get_tsid_map()->sidno_to_tsid(first_gtid->sidno);
+    header.first_gno = first_gtid->gno;
+  }
+
+  MUTEX_LOCK(lock, &LOCK_index);
+  m_gtid_header_cache[filename] = std::move(header);
+}
+
 bool MYSQL_BIN_LOG::find_first_log_not_in_gtid_set(char *binlog_file_name,
                                                    const Gtid_set *gtid_set,
                                                    Gtid *first_gtid,
@@ -4507,17 +4683,49 @@ bool MYSQL_BIN_LOG::find_first_log_not_in_gtid_set(char *binlog_file_name,
   DBUG_PRINT("info", ("Iterating backwards through binary logs, and reading "
                       "only the Previous_gtids_log_event, to find the first "
                       "one, that is the subset of the given gtid set."));
+  if (!is_relay_log) {
+    /* Forget the headers of purged files. */
+    MUTEX_LOCK(lock, &LOCK_index);
+    std::map<std::string, Gtid_header> headers;
+    for (const auto &filename : filename_list) {
+      auto it = m_gtid_header_cache.find(filename);
+      if (it != m_gtid_header_cache.end())
+        headers.insert(m_gtid_header_cache.extract(it));
+    }
+    m_gtid_header_cache.swap(headers);
+  }
+
   rit = filename_list.rbegin();
   error = 0;
   while (rit != filename_list.rend()) {
     binlog_previous_gtid_set.clear();
     const char *filename = rit->c_str();
-    DBUG_PRINT("info",
-               ("Read Previous_gtids_log_event from filename='%s'", filename));
-    switch (read_gtids_from_binlog(filename, nullptr, &binlog_previous_gtid_set,
-                                   first_gtid,
-                                   binlog_previous_gtid_set.get_tsid_map(),
-                                   opt_source_verify_checksum, is_relay_log)) {
+    /*
+      Only the last file can still be written to, the headers of the others
+      are cached.
+    */
+    bool cacheable =
+        !is_relay_log && first_gtid != nullptr && rit != filename_list.rbegin();
+    std::optional<bool> cached;
+    if (cacheable)
+      cached = get_cached_gtid_header(filename, &binlog_previous_gtid_set,
+                                      first_gtid);
+    enum_read_gtids_from_binlog_status status;
+    if (cached.has_value()) {
+      status = cached.value() ? GOT_GTIDS : GOT_PREVIOUS_GTIDS;
+    } else {
+      DBUG_PRINT("info", ("Read Previous_gtids_log_event from filename='%s'",
+                          filename));
+      binlog_previous_gtid_set.clear();
+      status = read_gtids_from_binlog(
+          filename, nullptr, &binlog_previous_gtid_set, first_gtid,
+          binlog_previous_gtid_set.get_tsid_map(), opt_source_verify_checksum,
+          is_relay_log);
+      if (cacheable && (status == GOT_GTIDS || status == GOT_PREVIOUS_GTIDS))
+        cache_gtid_header(filename, &binlog_previous_gtid_set,
+                          status == GOT_GTIDS ? first_gtid : nullptr);
+    }
+    switch (status) {
       case ERROR:
         errmsg.assign(
             "Error reading header of binary log while looking for "
@@ -5659,6 +5867,8 @@ bool MYSQL_BIN_LOG::reset_logs(THD *thd, bool delete_only) {
   */
   mysql_mutex_lock(&LOCK_log);
   mysql_mutex_lock(&LOCK_index);
+  /* The file names are going to be reused. */
+  m_gtid_header_cache.clear();
 
   if (is_relay_log)
     tsid_lock = previous_gtid_set_relaylog->get_tsid_map()->get_tsid_lock();
@@ -7728,7 +7938,10 @@ bool MYSQL_BIN_LOG::write_cache(THD *thd, binlog_cache_data *cache_data,
         DBUG_PRINT("info", ("crashing before writing xid"));
         DBUG_SUICIDE();
       });
-      if (do_write_cache(cache, writer)) goto err;
+      writer->set_event_body_checksums(&cache_data->event_body_checksums());
+      const bool write_failed = do_write_cache(cache, writer);
+      writer->set_event_body_checksums(nullptr);
+      if (write_failed) goto err;
 
       const char *err_msg =
           "Non-transactional changes did not get into "
@@ -9106,6 +9319,25 @@ int MYSQL_BIN_LOG::ordered_commit(THD *thd, bool all, bool skip_commit) {
     }
   }
 
+  /*
+    Every session in the queue that wrote an XID is now durably committed as
+    far as recovery is concerned, and with binlog_error_action=ABORT_SERVER
+    nothing can roll it back any more. Tell the engines, so that they can
+    release row locks before the commit stage, and the after_sync hook which
+    may wait for replicas, keep other sessions waiting on them.
+  */
+  if (flush_error == 0 && sync_error == 0 && total_bytes > 0 &&
+      get_sync_period() == 1 && binlog_error_action == ABORT_SERVER) {
+    for (THD *head = final_queue; head != nullptr;
+         head = head->next_to_commit) {
+      if (head->commit_error != THD::CE_NONE ||
+          !head->get_transaction()->m_flags.xid_written)
+        continue;
+      Thd_backup_and_restore switch_thd(thd, head);
+      ha_commit_decided(head, head->get_transaction()->m_flags.real_commit);
+    }
+  }
+
   DEBUG_SYNC(thd, "bgc_after_sync_stage_before_commit_stage");
 
   leave_mutex_before_commit_stage = &LOCK_sync;
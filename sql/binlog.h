@@ -27,6 +27,9 @@
 #include <sys/types.h>
 #include <time.h>
 #include <atomic>
+#include <map>
+#include <optional>
+#include <string>
 #include <utility>
 
 #include "my_dbug.h"
@@ -41,11 +44,14 @@
 #include "mysql/components/services/bits/psi_cond_bits.h"
 #include "mysql/components/services/bits/psi_file_bits.h"
 #include "mysql/components/services/bits/psi_mutex_bits.h"
+#include "mysql/gtid/global.h"
+#include "mysql/gtid/tsid.h"
 #include "mysql/psi/mysql_cond.h"
 #include "mysql/psi/mysql_mutex.h"
 #include "mysql/udf_registration_types.h"
 #include "mysql_com.h"          // Item_result
 #include "sql/binlog_reader.h"  // Binlog_file_reader
+#include "sql/rpl_binlog_tail_cache.h"
 #include "sql/rpl_commit_stage_manager.h"
 #include "sql/rpl_trx_tracking.h"
 #include "sql/tc_log.h"            // TC_LOG
@@ -149,6 +155,12 @@ class MYSQL_BIN_LOG : public TC_LOG {
   char db[NAME_LEN + 1];
   bool write_error, inited;
   Binlog_ofile *m_binlog_file;
+  /**
+    The bytes most recently written to the active relay log, which the
+    applier reads instead of the file (see relay_log_tail_cache_size). Only
+    used by relay logs. The binary log uses binlog_tail_cache.
+  */
+  Binlog_tail_cache m_relay_log_tail_cache;
 
   /** Instrumentation key to use for file io in @c log_file */
   PSI_file_key m_log_file_key;
@@ -201,6 +213,49 @@ class MYSQL_BIN_LOG : public TC_LOG {
 
   /* POSIX thread objects are inited by init_pthread_objects() */
   mysql_mutex_t LOCK_index;
+  /**
+    The GTID header of a binary log file that is no longer written to: the
+    set of its Previous_gtids_log_event and its first GTID, if any.
+  */
+  struct Gtid_header {
+    /** The previous GTIDs, encoded with Gtid_set::encode(). */
+    std::string previous_gtids;
+    /** The TSID of the first GTID, if first_gno is not 0. */
+    mysql::gtid::Tsid first_tsid;
+    /** The GNO of the first GTID, or 0 if the file has no GTIDs. */
+    mysql::gtid::gno_t first_gno{0};
+  };
+  /**
+    The GTID headers read by find_first_log_not_in_gtid_set(), by file name,
+    so that dump threads reconnecting with auto-positioning do not read the
+    same files again. Protected by LOCK_index.
+  */
+  std::map<std::string, Gtid_header> m_gtid_header_cache;
+
+  /**
+    Reads the GTID header of a file from m_gtid_header_cache.
+
+    @param filename The binary log file.
+    @param[out] prev_gtids The set of the Previous_gtids_log_event is added
+                to it.
+    @param[out] first_gtid The first GTID of the file, if it has any.
+
+    @retval true  The header was cached, and the file has GTIDs.
+    @retval false The header was cached, and the file has no GTIDs.
+    @retval std::nullopt The header was not cached.
+  */
+  std::optional<bool> get_cached_gtid_header(const char *filename,
+                                             Gtid_set *prev_gtids,
+                                             Gtid *first_gtid);
+  /**
+    Adds the GTID header of a file to m_gtid_header_cache.
+
+    @param filename The binary log file.
+    @param prev_gtids The set of its Previous_gtids_log_event.
+    @param first_gtid Its first GTID, or nullptr if it has none.
+  */
+  void cache_gtid_header(const char *filename, const Gtid_set *prev_gtids,
+                         const Gtid *first_gtid);
   mysql_mutex_t LOCK_commit;
   mysql_mutex_t LOCK_after_commit;
   mysql_mutex_t LOCK_sync;
@@ -1002,6 +1057,16 @@ class MYSQL_BIN_LOG : public TC_LOG {
     return atomic_binlog_end_pos;
   }
   mysql_mutex_t *get_binlog_end_pos_lock() { return &LOCK_binlog_end_pos; }
+
+  /**
+    The cache of the bytes most recently written to the active log file, or
+    nullptr if it is disabled.
+  */
+  Binlog_tail_cache *get_tail_cache() {
+    Binlog_tail_cache *cache =
+        is_relay_log ? &m_relay_log_tail_cache : &binlog_tail_cache;
+    return cache->is_enabled() ? cache : nullptr;
+  }
   void lock_binlog_end_pos() { mysql_mutex_lock(&LOCK_binlog_end_pos); }
   void unlock_binlog_end_pos() { mysql_mutex_unlock(&LOCK_binlog_end_pos); }
 
@@ -192,6 +192,14 @@ class Basic_binlog_ifile : public Basic_seekable_istream {
   */
   my_off_t length() override;
 
+  /**
+     The system file of the binlog, if the logical binlog positions are also
+     positions in it (the file is not encrypted). Otherwise -1.
+  */
+  File raw_file() const override {
+    return m_istream != nullptr ? m_istream->raw_file() : -1;
+  }
+
  protected:
   /**
      Open the system layer file. It is the entry of the stream pipeline.
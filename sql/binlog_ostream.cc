@@ -21,6 +21,7 @@
    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
 
 #include "sql/binlog_ostream.h"
+#include <string.h>
 #include <algorithm>
 #include "my_aes.h"
 #include "my_inttypes.h"
@@ -282,6 +283,7 @@ bool Binlog_encryption_ostream::open(
   m_header = Rpl_encryption_header::get_new_default_header();
   const Key_string password_str = m_header->generate_new_file_password();
   if (password_str.empty()) return true;
+  m_buffer_length = 0;
   m_encryptor.reset(nullptr);
   m_encryptor = m_header->get_encryptor();
   if (m_encryptor->open(password_str, m_header->get_header_size())) {
@@ -300,6 +302,7 @@ bool Binlog_encryption_ostream::open(
 
   m_down_ostream = std::move(down_ostream);
   m_header = std::move(header);
+  m_buffer_length = 0;
   m_encryptor.reset(nullptr);
   m_encryptor = m_header->get_encryptor();
   if (m_encryptor->open(m_header->decrypt_file_password(),
@@ -360,52 +363,67 @@ std::pair<bool, std::string> Binlog_encryption_ostream::reencrypt() {
 }
 
 void Binlog_encryption_ostream::close() {
+  if (m_down_ostream != nullptr && m_encryptor != nullptr) flush_buffer();
+  m_buffer_length = 0;
   m_encryptor.reset(nullptr);
   m_header.reset(nullptr);
   m_down_ostream.reset(nullptr);
 }
 
+bool Binlog_encryption_ostream::flush_buffer() {
+  if (m_buffer_length == 0) return false;
+
+  const int encrypt_len = static_cast<int>(m_buffer_length);
+  m_buffer_length = 0;
+
+  if (m_encryptor->encrypt(m_buffer, m_buffer, encrypt_len)) {
+    THROW_RPL_ENCRYPTION_FAILED_TO_ENCRYPT_ERROR;
+    return true;
+  }
+  return m_down_ostream->write(m_buffer, encrypt_len);
+}
+
 bool Binlog_encryption_ostream::write(const unsigned char *buffer,
                                       my_off_t length) {
-  const int ENCRYPT_BUFFER_SIZE = 2048;
-  unsigned char encrypt_buffer[ENCRYPT_BUFFER_SIZE];
   const unsigned char *ptr = buffer;
 
   /*
-    Split the data in 'buffer' to ENCRYPT_BUFFER_SIZE bytes chunks and
-    encrypt them one by one.
+    Gather the data in m_buffer and encrypt it ENCRYPT_BUFFER_SIZE bytes
+    at a time.
   */
   while (length > 0) {
-    int encrypt_len =
-        std::min(length, static_cast<my_off_t>(ENCRYPT_BUFFER_SIZE));
-
-    if (m_encryptor->encrypt(encrypt_buffer, ptr, encrypt_len)) {
-      THROW_RPL_ENCRYPTION_FAILED_TO_ENCRYPT_ERROR;
-      return true;
-    }
+    my_off_t copy_len = std::min(length, ENCRYPT_BUFFER_SIZE - m_buffer_length);
 
-    if (m_down_ostream->write(encrypt_buffer, encrypt_len)) return true;
+    memcpy(m_buffer + m_buffer_length, ptr, copy_len);
+    m_buffer_length += copy_len;
+    if (m_buffer_length == ENCRYPT_BUFFER_SIZE && flush_buffer()) return true;
 
-    ptr += encrypt_len;
-    length -= encrypt_len;
+    ptr += copy_len;
+    length -= copy_len;
   }
   return false;
 }
 
 bool Binlog_encryption_ostream::seek(my_off_t offset) {
+  if (flush_buffer()) return true;
   if (m_down_ostream->seek(m_header->get_header_size() + offset)) return true;
   return m_encryptor->set_stream_offset(offset);
 }
 
 bool Binlog_encryption_ostream::truncate(my_off_t offset) {
+  if (flush_buffer()) return true;
   if (m_down_ostream->truncate(m_header->get_header_size() + offset))
     return true;
   return m_encryptor->set_stream_offset(offset);
 }
 
-bool Binlog_encryption_ostream::flush() { return m_down_ostream->flush(); }
+bool Binlog_encryption_ostream::flush() {
+  return flush_buffer() || m_down_ostream->flush();
+}
 
-bool Binlog_encryption_ostream::sync() { return m_down_ostream->sync(); }
+bool Binlog_encryption_ostream::sync() {
+  return flush_buffer() || m_down_ostream->sync();
+}
 
 int Binlog_encryption_ostream::get_header_size() {
   return m_header->get_header_size();
@@ -296,8 +296,25 @@ class Binlog_encryption_ostream : public Truncatable_ostream {
   int get_header_size();
 
  private:
+  /**
+    Encrypts the buffered data in place and writes it into down stream.
+
+    @retval false Success
+    @retval true Error.
+  */
+  bool flush_buffer();
+
   std::unique_ptr<Truncatable_ostream> m_down_ostream;
   std::unique_ptr<Rpl_encryption_header> m_header;
   std::unique_ptr<Stream_cipher> m_encryptor;
+  /*
+    Binlog_event_writer writes every event as a few small pieces. They are
+    gathered here and encrypted together, as the cost of a cipher call
+    barely depends on its length for such small pieces. The buffer is
+    emptied whenever it is full, and before flush, seek, truncate and close.
+  */
+  static constexpr my_off_t ENCRYPT_BUFFER_SIZE = 16384;
+  unsigned char m_buffer[ENCRYPT_BUFFER_SIZE];
+  my_off_t m_buffer_length = 0;
 };
 #endif  // BINLOG_OSTREAM_INCLUDED
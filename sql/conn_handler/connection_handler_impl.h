@@ -123,4 +123,56 @@ class One_thread_connection_handler : public Connection_handler {
   uint get_max_threads() const override { return 1; }
 };
 
+struct THD_event_functions;
+struct Thread_pool_group;
+
+/**
+  This class represents the connection handling functionality of a pool of
+  threads shared by all connections.
+
+  Connections are spread over thread_pool_size thread groups. Each group
+  waits for requests on its connections with epoll and queues the connections
+  that have one, those in a transaction ahead of the others, for its worker
+  threads. A group runs thread_pool_oversubscribe + 1 workers at a time, and
+  starts another one when a worker waits for a lock or IO, or when its queue
+  did not move for thread_pool_stall_limit milliseconds.
+*/
+class Thread_pool_connection_handler : public Connection_handler {
+  Thread_pool_connection_handler(const Thread_pool_connection_handler &);
+  Thread_pool_connection_handler &operator=(
+      const Thread_pool_connection_handler &);
+
+  Thread_pool_group *m_groups{nullptr};
+  // The group the next connection is assigned to.
+  uint m_next_group{0};
+
+ public:
+  // System variables
+  static uint pool_size;
+  static uint stall_limit;
+  static uint oversubscribe;
+  static uint max_pool_threads;
+
+  /**
+    Return the functions through which the server reports that a connection
+    waits, so that the pool can run another one meanwhile.
+  */
+  static THD_event_functions *get_event_functions();
+
+  Thread_pool_connection_handler() = default;
+  ~Thread_pool_connection_handler() override;
+
+  /**
+    Set up the thread groups. Their threads are started on demand.
+
+    @retval false on success, true on failure.
+  */
+  bool init();
+
+ protected:
+  bool add_connection(Channel_info *channel_info) override;
+
+  uint get_max_threads() const override;
+};
+
 #endif  // CONNECTION_HANDLER_IMPL_INCLUDED
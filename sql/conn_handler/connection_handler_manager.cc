@@ -156,6 +156,17 @@ bool Connection_handler_manager::init() {
     case SCHEDULER_NO_THREADS:
       connection_handler = new (std::nothrow) One_thread_connection_handler();
       break;
+    case SCHEDULER_THREAD_POOL: {
+      Thread_pool_connection_handler *pool =
+          new (std::nothrow) Thread_pool_connection_handler();
+      if (pool != nullptr && pool->init()) {
+        delete pool;
+        pool = nullptr;
+      }
+      connection_handler = pool;
+      event_functions = Thread_pool_connection_handler::get_event_functions();
+      break;
+    }
     default:
       assert(false);
   }
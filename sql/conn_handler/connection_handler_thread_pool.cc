@@ -0,0 +1,700 @@
+/*
+   Copyright (c) 2023, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
+*/
+
+#include "my_config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#ifdef HAVE_SYS_EPOLL_H
+#include <sys/epoll.h>
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <new>
+#include <unordered_set>
+
+#include "my_dbug.h"
+#include "my_inttypes.h"
+#include "my_psi_config.h"
+#include "my_systime.h"  // my_micro_time
+#include "my_thread.h"
+#include "mysql/components/services/log_builtins.h"
+#include "mysql/psi/mysql_cond.h"
+#include "mysql/psi/mysql_mutex.h"
+#include "mysql/psi/mysql_socket.h"
+#include "mysql/psi/mysql_thread.h"
+#include "mysql_com.h"
+#include "mysqld_error.h"                   // ER_*
+#include "sql/conn_handler/channel_info.h"  // Channel_info
+#include "sql/conn_handler/connection_handler_impl.h"
+#include "sql/conn_handler/connection_handler_manager.h"  // Connection_handler_manager
+#include "sql/mysqld.h"              // connection_attrib
+#include "sql/mysqld_thd_manager.h"  // Global_THD_manager
+#include "sql/protocol_classic.h"
+#include "sql/sql_class.h"             // THD
+#include "sql/sql_connect.h"           // close_connection
+#include "sql/sql_parse.h"             // do_command
+#include "sql/sql_thd_internal_api.h"  // thd_set_thread_stack
+#include "violite.h"
+
+// System variables
+uint Thread_pool_connection_handler::pool_size = 16;
+uint Thread_pool_connection_handler::stall_limit = 500;
+uint Thread_pool_connection_handler::oversubscribe = 3;
+uint Thread_pool_connection_handler::max_pool_threads = 100000;
+
+#ifdef HAVE_SYS_EPOLL_H
+
+#ifdef HAVE_PSI_INTERFACE
+static PSI_mutex_key key_thread_pool_LOCK_group;
+static PSI_cond_key key_thread_pool_COND_group;
+static PSI_thread_key key_thread_pool_listener;
+static PSI_thread_key key_thread_pool_worker;
+
+static PSI_mutex_info all_thread_pool_mutexes[] = {
+    {&key_thread_pool_LOCK_group, "Thread_pool_group::LOCK_group", 0, 0,
+     PSI_DOCUMENT_ME}};
+
+static PSI_cond_info all_thread_pool_conds[] = {
+    {&key_thread_pool_COND_group, "Thread_pool_group::COND_group", 0, 0,
+     PSI_DOCUMENT_ME}};
+
+static PSI_thread_info all_thread_pool_threads[] = {
+    {&key_thread_pool_listener, "thread_pool_listener", "tp_listener",
+     PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
+    {&key_thread_pool_worker, "thread_pool_worker", "tp_worker", 0, 0,
+     PSI_DOCUMENT_ME}};
+#endif /* HAVE_PSI_INTERFACE */
+
+/** The number of events the listener of a group takes at once. */
+static const int MAX_EVENTS = 64;
+/** How long, in seconds, a worker without work waits before it exits. */
+static const int WORKER_IDLE_TIMEOUT = 60;
+
+/** The number of worker threads of all groups. */
+static std::atomic<uint> pool_thread_count{0};
+
+/**
+  A client connection handled by the pool. Unless it waits for a request in
+  the epoll set of its group, or in its queue, one worker owns it.
+*/
+struct Thread_pool_connection {
+  /* Until the first worker picks it, the connection only has a channel. */
+  Channel_info *channel_info{nullptr};
+  THD *thd{nullptr};
+  Thread_pool_group *group{nullptr};
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  PSI_thread *psi{nullptr};
+#endif
+  /* The time, in microseconds, when the connection is closed as idle. */
+  ulonglong idle_deadline{0};
+  /* Whether the connection is in the epoll set. Protected by LOCK_group. */
+  bool waiting_for_request{false};
+  /* Whether the connection waited longer than its wait_timeout. */
+  bool timed_out{false};
+  /* Whether its worker waits for a lock or IO. Protected by LOCK_group. */
+  bool blocked{false};
+};
+
+/**
+  A group of connections, which waits for their requests with epoll and
+  executes them with a few workers.
+*/
+struct Thread_pool_group {
+  mysql_mutex_t LOCK_group;
+  /* Idle workers wait on it, and the pool waits for the threads to end. */
+  mysql_cond_t COND_group;
+  int epoll_fd{-1};
+  /* Connections in a transaction, which are executed first. */
+  std::deque<Thread_pool_connection *> high_queue;
+  std::deque<Thread_pool_connection *> queue;
+  std::unordered_set<Thread_pool_connection *> connections;
+  /* The workers of the group. */
+  uint thread_count{0};
+  /* The workers that execute a connection and do not wait. */
+  uint active_thread_count{0};
+  /* The workers that wait for work on COND_group. */
+  uint idle_thread_count{0};
+  /* The idle workers that were woken up but did not notice yet. */
+  uint wakeup_count{0};
+  /* The number of connections taken from the queues, for stall detection. */
+  ulonglong dequeue_count{0};
+  ulonglong last_dequeue_count{0};
+  ulonglong next_idle_check{0};
+  bool listener_running{false};
+  bool shutdown{false};
+};
+
+static void *listener_thread(void *arg);
+static void *worker_thread(void *arg);
+
+/** The number of workers a group runs at a time. */
+static uint active_thread_limit() {
+  return Thread_pool_connection_handler::oversubscribe + 1;
+}
+
+static bool is_queue_empty(Thread_pool_group *group) {
+  return group->high_queue.empty() && group->queue.empty();
+}
+
+/**
+  Wake up an idle worker of the group, or start one.
+
+  @retval false on success, true if no worker could be started.
+*/
+static bool wake_or_create_worker(Thread_pool_group *group) {
+  mysql_mutex_assert_owner(&group->LOCK_group);
+
+  if (group->idle_thread_count > 0) {
+    group->idle_thread_count--;
+    group->wakeup_count++;
+    group->active_thread_count++;
+    mysql_cond_signal(&group->COND_group);
+    return false;
+  }
+
+  if (pool_thread_count.fetch_add(1) >=
+      Thread_pool_connection_handler::max_pool_threads) {
+    pool_thread_count--;
+    return true;
+  }
+
+  my_thread_handle id;
+  int error = mysql_thread_create(key_thread_pool_worker, &id,
+                                  &connection_attrib, worker_thread, group);
+  if (error) {
+    pool_thread_count--;
+    connection_errors_internal++;
+    LogErr(ERROR_LEVEL, ER_CONN_PER_THREAD_NO_THREAD, error);
+    return true;
+  }
+
+  Global_THD_manager::get_instance()->inc_thread_created();
+  group->thread_count++;
+  group->active_thread_count++;
+  return false;
+}
+
+/** Queue a connection with a request, or a new one, for the workers. */
+static void enqueue(Thread_pool_group *group, Thread_pool_connection *conn) {
+  mysql_mutex_assert_owner(&group->LOCK_group);
+
+  if (conn->thd != nullptr && conn->thd->in_active_multi_stmt_transaction())
+    group->high_queue.push_back(conn);
+  else
+    group->queue.push_back(conn);
+
+  if (group->active_thread_count < active_thread_limit())
+    wake_or_create_worker(group);
+}
+
+static Thread_pool_connection *dequeue(Thread_pool_group *group) {
+  mysql_mutex_assert_owner(&group->LOCK_group);
+
+  std::deque<Thread_pool_connection *> &from =
+      group->high_queue.empty() ? group->queue : group->high_queue;
+  if (from.empty()) return nullptr;
+
+  Thread_pool_connection *conn = from.front();
+  from.pop_front();
+  group->dequeue_count++;
+  return conn;
+}
+
+/**
+  Put the connection in the epoll set of its group, to wait for its next
+  request.
+
+  @retval false on success, true on failure.
+*/
+static bool wait_for_request(Thread_pool_connection *conn, int op) {
+  Thread_pool_group *group = conn->group;
+  THD *thd = conn->thd;
+
+  epoll_event event;
+  event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+  event.data.ptr = conn;
+
+  mysql_mutex_lock(&group->LOCK_group);
+  conn->idle_deadline =
+      my_micro_time() + thd->variables.net_wait_timeout * 1000000ULL;
+  conn->waiting_for_request = true;
+  int res = epoll_ctl(group->epoll_fd, op,
+                      thd->get_protocol_classic()->get_socket(), &event);
+  if (res) conn->waiting_for_request = false;
+  mysql_mutex_unlock(&group->LOCK_group);
+
+  return res != 0;
+}
+
+/**
+  Make the current thread execute the connection.
+
+  @param conn         The connection
+  @param stack_start  The start of the stack of the current thread
+*/
+static void attach(Thread_pool_connection *conn, const char *stack_start) {
+  THD *thd = conn->thd;
+
+  thd_set_thread_stack(thd, stack_start);
+  thd->store_globals();
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  PSI_THREAD_CALL(set_thread)(conn->psi);
+#endif
+  mysql_socket_set_thread_owner(
+      thd->get_protocol_classic()->get_vio()->mysql_socket);
+}
+
+static void detach(Thread_pool_connection *conn, PSI_thread *worker_psi
+                   [[maybe_unused]]) {
+  THD *thd = conn->thd;
+
+  thd->restore_globals();
+  thd->set_is_killable(false);
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  PSI_THREAD_CALL(set_thread)(worker_psi);
+#endif
+}
+
+/** Close the connection attached to the current thread and free it. */
+static void close_pool_connection(Thread_pool_connection *conn,
+                                  bool logged_in,
+                                  PSI_thread *worker_psi [[maybe_unused]]) {
+  Thread_pool_group *group = conn->group;
+  THD *thd = conn->thd;
+
+  mysql_mutex_lock(&group->LOCK_group);
+  epoll_ctl(group->epoll_fd, EPOLL_CTL_DEL,
+            thd->get_protocol_classic()->get_socket(), nullptr);
+  group->connections.erase(conn);
+  mysql_mutex_unlock(&group->LOCK_group);
+
+  if (logged_in) end_connection(thd);
+  close_connection(thd, 0, false, false);
+
+  thd->get_stmt_da()->reset_diagnostics_area();
+  thd->release_resources();
+  Global_THD_manager::get_instance()->remove_thd(thd);
+  Connection_handler_manager::dec_connection_count();
+
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  /* Stop telemetry, while THD is still available. */
+  if (conn->psi != nullptr) PSI_THREAD_CALL(abort_telemetry)(conn->psi);
+
+  thd->set_psi(nullptr);
+  mysql_thread_set_psi_THD(nullptr);
+  PSI_THREAD_CALL(delete_current_thread)();
+  PSI_THREAD_CALL(set_thread)(worker_psi);
+#endif /* HAVE_PSI_THREAD_INTERFACE */
+
+  thd->restore_globals();
+  delete thd;
+  delete conn;
+}
+
+/** Create the THD of a new connection and authenticate the client. */
+static void start_connection(Thread_pool_connection *conn,
+                             const char *stack_start,
+                             PSI_thread *worker_psi) {
+  Thread_pool_group *group = conn->group;
+  Channel_info *channel_info = conn->channel_info;
+  conn->channel_info = nullptr;
+
+  THD *thd = channel_info->create_thd();
+  if (thd == nullptr) {
+    connection_errors_internal++;
+    channel_info->send_error_and_close_channel(ER_OUT_OF_RESOURCES, 0, false);
+    Connection_handler_manager::get_instance()->inc_aborted_connects();
+    Connection_handler_manager::dec_connection_count();
+    delete channel_info;
+
+    mysql_mutex_lock(&group->LOCK_group);
+    group->connections.erase(conn);
+    mysql_mutex_unlock(&group->LOCK_group);
+    delete conn;
+    return;
+  }
+  delete channel_info;
+
+  thd->set_new_thread_id();
+  thd->scheduler.data = conn;
+  conn->thd = thd;
+
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  conn->psi = PSI_THREAD_CALL(new_thread)(key_thread_one_connection, 0, thd,
+                                          thd->thread_id());
+  thd->set_psi(conn->psi);
+#endif
+  attach(conn, stack_start);
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  PSI_THREAD_CALL(set_thread_os_id)(conn->psi);
+#endif
+  mysql_thread_set_psi_id(thd->thread_id());
+  mysql_thread_set_psi_THD(thd);
+  Global_THD_manager::get_instance()->add_thd(thd);
+
+  if (thd_prepare_connection(thd)) {
+    Connection_handler_manager::get_instance()->inc_aborted_connects();
+    close_pool_connection(conn, false, worker_psi);
+    return;
+  }
+
+  if (!thd_connection_alive(thd) || wait_for_request(conn, EPOLL_CTL_ADD)) {
+    close_pool_connection(conn, true, worker_psi);
+    return;
+  }
+  detach(conn, worker_psi);
+}
+
+/** Execute the requests a connection has, then wait for the next one. */
+static void handle_connection(Thread_pool_connection *conn,
+                              const char *stack_start,
+                              PSI_thread *worker_psi) {
+  if (conn->thd == nullptr) {
+    start_connection(conn, stack_start, worker_psi);
+    return;
+  }
+
+  THD *thd = conn->thd;
+  attach(conn, stack_start);
+
+  bool error = conn->timed_out;
+  if (error) thd->killed = THD::KILL_CONNECTION;
+
+  /*
+    Execute the request that woke the connection up, and those the client
+    sent after it which are already buffered, e.g. by SSL.
+  */
+  while (!error) {
+    error = do_command(thd) || !thd_connection_alive(thd);
+
+    Vio *vio = thd->get_protocol_classic()->get_vio();
+    if (error || vio == nullptr || !vio->has_data(vio)) break;
+  }
+
+  if (error || wait_for_request(conn, EPOLL_CTL_MOD)) {
+    close_pool_connection(conn, true, worker_psi);
+    return;
+  }
+  detach(conn, worker_psi);
+}
+
+static void *worker_thread(void *arg) {
+  Thread_pool_group *group = static_cast<Thread_pool_group *>(arg);
+
+  if (my_thread_init()) {
+    mysql_mutex_lock(&group->LOCK_group);
+    group->thread_count--;
+    group->active_thread_count--;
+    pool_thread_count--;
+    mysql_cond_broadcast(&group->COND_group);
+    mysql_mutex_unlock(&group->LOCK_group);
+    my_thread_exit(nullptr);
+    return nullptr;
+  }
+
+  PSI_thread *worker_psi = nullptr;
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  worker_psi = PSI_THREAD_CALL(get_thread)();
+#endif
+
+  /*
+    Connections are executed on top of this stack, which starts at the
+    address of this variable.
+  */
+  const char *stack_start = reinterpret_cast<const char *>(&group);
+
+  mysql_mutex_lock(&group->LOCK_group);
+  for (;;) {
+    /* Leave the queues to other workers when too many are running. */
+    Thread_pool_connection *conn =
+        group->active_thread_count <= active_thread_limit() ? dequeue(group)
+                                                            : nullptr;
+    if (conn != nullptr) {
+      mysql_mutex_unlock(&group->LOCK_group);
+      handle_connection(conn, stack_start, worker_psi);
+      mysql_mutex_lock(&group->LOCK_group);
+      continue;
+    }
+
+    if (group->shutdown) break;
+
+    group->active_thread_count--;
+    group->idle_thread_count++;
+
+    struct timespec abstime;
+    set_timespec(&abstime, WORKER_IDLE_TIMEOUT);
+    int res = 0;
+    while (group->wakeup_count == 0 && !group->shutdown && res == 0)
+      res = mysql_cond_timedwait(&group->COND_group, &group->LOCK_group,
+                                 &abstime);
+
+    if (group->wakeup_count > 0) {
+      /* The waker moved this worker from idle to active. */
+      group->wakeup_count--;
+      continue;
+    }
+
+    group->idle_thread_count--;
+    group->active_thread_count++;
+    /* Keep one worker in each group, unless the pool ends. */
+    if (!group->shutdown && group->thread_count > 1 && is_queue_empty(group))
+      break;
+  }
+
+  group->thread_count--;
+  group->active_thread_count--;
+  pool_thread_count--;
+  mysql_cond_broadcast(&group->COND_group);
+  mysql_mutex_unlock(&group->LOCK_group);
+
+  my_thread_end();
+  my_thread_exit(nullptr);
+  return nullptr;
+}
+
+/**
+  Close the connections of the group which waited for a request longer than
+  their wait_timeout.
+*/
+static void check_idle_connections(Thread_pool_group *group, ulonglong now) {
+  mysql_mutex_assert_owner(&group->LOCK_group);
+
+  for (Thread_pool_connection *conn : group->connections) {
+    if (!conn->waiting_for_request || conn->idle_deadline > now) continue;
+
+    epoll_ctl(group->epoll_fd, EPOLL_CTL_DEL,
+              conn->thd->get_protocol_classic()->get_socket(), nullptr);
+    conn->waiting_for_request = false;
+    conn->timed_out = true;
+    enqueue(group, conn);
+  }
+}
+
+static void *listener_thread(void *arg) {
+  Thread_pool_group *group = static_cast<Thread_pool_group *>(arg);
+  epoll_event events[MAX_EVENTS];
+
+  my_thread_init();
+
+  mysql_mutex_lock(&group->LOCK_group);
+  while (!group->shutdown) {
+    mysql_mutex_unlock(&group->LOCK_group);
+    int count =
+        epoll_wait(group->epoll_fd, events, MAX_EVENTS,
+                   static_cast<int>(Thread_pool_connection_handler::stall_limit));
+    mysql_mutex_lock(&group->LOCK_group);
+
+    for (int i = 0; i < count; i++) {
+      Thread_pool_connection *conn =
+          static_cast<Thread_pool_connection *>(events[i].data.ptr);
+      conn->waiting_for_request = false;
+      enqueue(group, conn);
+    }
+
+    /*
+      If no connection left the queues since the last check, all the running
+      workers are busy with long requests. Start one more.
+    */
+    if (!is_queue_empty(group) &&
+        group->dequeue_count == group->last_dequeue_count)
+      wake_or_create_worker(group);
+    group->last_dequeue_count = group->dequeue_count;
+
+    ulonglong now = my_micro_time();
+    if (now >= group->next_idle_check) {
+      check_idle_connections(group, now);
+      group->next_idle_check = now + 1000000ULL;
+    }
+  }
+  group->listener_running = false;
+  mysql_cond_broadcast(&group->COND_group);
+  mysql_mutex_unlock(&group->LOCK_group);
+
+  my_thread_end();
+  my_thread_exit(nullptr);
+  return nullptr;
+}
+
+/** Called when the worker executing the connection waits. */
+static void thread_pool_wait_begin(THD *thd, int) {
+  if (thd == nullptr) thd = current_thd;
+  if (thd == nullptr) return;
+  Thread_pool_connection *conn =
+      static_cast<Thread_pool_connection *>(thd->scheduler.data);
+  if (conn == nullptr || conn->blocked) return;
+
+  Thread_pool_group *group = conn->group;
+  mysql_mutex_lock(&group->LOCK_group);
+  conn->blocked = true;
+  group->active_thread_count--;
+  if (!is_queue_empty(group) &&
+      group->active_thread_count < active_thread_limit())
+    wake_or_create_worker(group);
+  mysql_mutex_unlock(&group->LOCK_group);
+}
+
+/** Called when the worker executing the connection stops waiting. */
+static void thread_pool_wait_end(THD *thd) {
+  if (thd == nullptr) thd = current_thd;
+  if (thd == nullptr) return;
+  Thread_pool_connection *conn =
+      static_cast<Thread_pool_connection *>(thd->scheduler.data);
+  if (conn == nullptr || !conn->blocked) return;
+
+  Thread_pool_group *group = conn->group;
+  mysql_mutex_lock(&group->LOCK_group);
+  conn->blocked = false;
+  group->active_thread_count++;
+  mysql_mutex_unlock(&group->LOCK_group);
+}
+
+/*
+  A killed connection which waits for a request is woken up by the shutdown
+  of its socket, so nothing needs to be done.
+*/
+static void thread_pool_post_kill_notification(THD *) {}
+
+static THD_event_functions thread_pool_event_functions = {
+    thread_pool_wait_begin, thread_pool_wait_end,
+    thread_pool_post_kill_notification};
+
+THD_event_functions *Thread_pool_connection_handler::get_event_functions() {
+  return &thread_pool_event_functions;
+}
+
+bool Thread_pool_connection_handler::init() {
+#ifdef HAVE_PSI_INTERFACE
+  mysql_mutex_register("sql", all_thread_pool_mutexes,
+                       static_cast<int>(array_elements(all_thread_pool_mutexes)));
+  mysql_cond_register("sql", all_thread_pool_conds,
+                      static_cast<int>(array_elements(all_thread_pool_conds)));
+  mysql_thread_register(
+      "sql", all_thread_pool_threads,
+      static_cast<int>(array_elements(all_thread_pool_threads)));
+#endif
+
+  m_groups = new (std::nothrow) Thread_pool_group[pool_size];
+  if (m_groups == nullptr) return true;
+
+  for (uint i = 0; i < pool_size; i++) {
+    Thread_pool_group *group = &m_groups[i];
+    mysql_mutex_init(key_thread_pool_LOCK_group, &group->LOCK_group,
+                     MY_MUTEX_INIT_FAST);
+    mysql_cond_init(key_thread_pool_COND_group, &group->COND_group);
+    group->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (group->epoll_fd < 0) return true;
+  }
+  return false;
+}
+
+Thread_pool_connection_handler::~Thread_pool_connection_handler() {
+  if (m_groups == nullptr) return;
+
+  for (uint i = 0; i < pool_size; i++) {
+    Thread_pool_group *group = &m_groups[i];
+    mysql_mutex_lock(&group->LOCK_group);
+    group->shutdown = true;
+    mysql_cond_broadcast(&group->COND_group);
+    while (group->thread_count > 0 || group->listener_running)
+      mysql_cond_wait(&group->COND_group, &group->LOCK_group);
+    mysql_mutex_unlock(&group->LOCK_group);
+
+    if (group->epoll_fd >= 0) close(group->epoll_fd);
+    mysql_cond_destroy(&group->COND_group);
+    mysql_mutex_destroy(&group->LOCK_group);
+  }
+  delete[] m_groups;
+}
+
+bool Thread_pool_connection_handler::add_connection(
+    Channel_info *channel_info) {
+  DBUG_TRACE;
+
+  Thread_pool_connection *conn = new (std::nothrow) Thread_pool_connection();
+  if (conn == nullptr) {
+    connection_errors_internal++;
+    channel_info->send_error_and_close_channel(ER_OUT_OF_RESOURCES, 0, false);
+    Connection_handler_manager::dec_connection_count();
+    return true;
+  }
+
+  /* Called by the acceptor thread only. */
+  Thread_pool_group *group = &m_groups[m_next_group++ % pool_size];
+  conn->channel_info = channel_info;
+  conn->group = group;
+
+  mysql_mutex_lock(&group->LOCK_group);
+  if (!group->listener_running) {
+    my_thread_handle id;
+    int error = mysql_thread_create(key_thread_pool_listener, &id,
+                                    &connection_attrib, listener_thread, group);
+    if (error) {
+      mysql_mutex_unlock(&group->LOCK_group);
+      delete conn;
+      connection_errors_internal++;
+      LogErr(ERROR_LEVEL, ER_CONN_PER_THREAD_NO_THREAD, error);
+      channel_info->send_error_and_close_channel(ER_CANT_CREATE_THREAD, error,
+                                                 true);
+      Connection_handler_manager::dec_connection_count();
+      return true;
+    }
+    group->listener_running = true;
+  }
+
+  group->connections.insert(conn);
+  /* The first worker to pick the connection sets it up. */
+  group->queue.push_back(conn);
+  if (group->active_thread_count < active_thread_limit() ||
+      group->thread_count == 0)
+    wake_or_create_worker(group);
+  mysql_mutex_unlock(&group->LOCK_group);
+  return false;
+}
+
+uint Thread_pool_connection_handler::get_max_threads() const {
+  return max_pool_threads + pool_size;
+}
+
+#else /* HAVE_SYS_EPOLL_H */
+
+THD_event_functions *Thread_pool_connection_handler::get_event_functions() {
+  return nullptr;
+}
+
+/* The thread pool needs epoll. */
+bool Thread_pool_connection_handler::init() { return true; }
+
+Thread_pool_connection_handler::~Thread_pool_connection_handler() = default;
+
+bool Thread_pool_connection_handler::add_connection(Channel_info *) {
+  assert(false);
+  return true;
+}
+
+uint Thread_pool_connection_handler::get_max_threads() const { return 0; }
+
+#endif /* HAVE_SYS_EPOLL_H */
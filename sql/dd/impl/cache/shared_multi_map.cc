@@ -261,8 +261,10 @@ bool Shared_multi_map<T>::get(const K &key, Cache_element<T> **element) {
 
   // Is the element already missed?
   if (m_map<K>()->is_missed(key)) {
+    ++m_miss_waiters;
     while (m_map<K>()->is_missed(key))
       mysql_cond_wait(&m_miss_handled, &m_lock);
+    --m_miss_waiters;
 
     *element = use_if_present(key);
 
@@ -292,7 +294,7 @@ void Shared_multi_map<T>::put(const K *key, const T *object,
     // For a NULL object, we only need to signal that the miss is handled.
     if (m_map<K>()->is_missed(*key)) {
       m_map<K>()->set_miss_handled(*key);
-      mysql_cond_broadcast(&m_miss_handled);
+      broadcast_miss_handled();
     }
     assert(*element == nullptr);
     return;
@@ -359,7 +361,7 @@ void Shared_multi_map<T>::put(const K *key, const T *object,
     Multi_map_base<T>::add_single_element(*element);
 
     // In this case, one or more keys may be missed, so we must broadcast.
-    if (key_missed) mysql_cond_broadcast(&m_miss_handled);
+    if (key_missed) broadcast_miss_handled();
 
     // The element and the object is now owned by the cache.
     return;
@@ -180,6 +180,7 @@ class Shared_multi_map : public Multi_map_base<T> {
 
   mysql_mutex_t m_lock;         // Single mutex to lock the map.
   mysql_cond_t m_miss_handled;  // Broadcast a miss being handled.
+  size_t m_miss_waiters;        // Number of threads waiting for a miss.
 
   Free_list<Cache_element<T>> m_free_list;  // Free list.
   std::vector<Cache_element<T> *>
@@ -289,13 +290,26 @@ class Shared_multi_map : public Multi_map_base<T> {
 
   void evict_all_unused(Autolocker *lock);
 
+  /**
+    Wake up the threads waiting for a miss to be handled, if there are any.
+
+    Most misses are not waited for by other threads, and a broadcast
+    without waiters would still be a system call made while holding
+    the mutex.
+  */
+
+  void broadcast_miss_handled() {
+    mysql_mutex_assert_owner(&m_lock);
+    if (m_miss_waiters > 0) mysql_cond_broadcast(&m_miss_handled);
+  }
+
  public:
   /**
     Initialize the mutex and condition variable.
     Set initial map capacity.
   */
 
-  Shared_multi_map() : m_capacity(initial_capacity) {
+  Shared_multi_map() : m_miss_waiters(0), m_capacity(initial_capacity) {
     mysql_mutex_init(key_object_cache_mutex, &m_lock, MY_MUTEX_INIT_FAST);
     mysql_cond_init(key_object_loading_cond, &m_miss_handled);
   }
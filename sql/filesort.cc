@@ -425,6 +425,7 @@ bool filesort(THD *thd, Filesort *filesort, RowIterator *source_iterator,
                            sortlength(thd, filesort->sortorder, s_length),
                            filesort->tables, max_rows,
                            filesort->m_remove_duplicates);
+  param->m_num_sort_threads = thd->variables.filesort_threads;
 
   fs_info->addon_fields = param->addon_fields;
 
@@ -587,7 +588,8 @@ bool filesort(THD *thd, Filesort *filesort, RowIterator *source_iterator,
                                                        : "rowid");
     sort_mode.append(">");
 
-    const char *algo_text[] = {"none", "std::sort", "std::stable_sort"};
+    const char *algo_text[] = {"none", "std::sort", "std::stable_sort",
+                               "radix"};
 
     Opt_trace_object filesort_summary(trace, "filesort_summary");
     filesort_summary.add("memory_available", memory_available)
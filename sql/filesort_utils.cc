@@ -25,6 +25,9 @@
 #include <string.h>
 #include <algorithm>
 #include <cmath>
+#include <functional>
+#include <system_error>
+#include <thread>
 
 #include "add_with_saturate.h"
 #include "my_dbug.h"
@@ -111,6 +114,175 @@ class Mem_compare_varlen_key {
   bool use_hash;
 };
 
+/**
+  Run the tasks concurrently, one thread each, except the first one, which is
+  run by the calling thread. Tasks that no thread could be created for are
+  also run by the calling thread.
+ */
+void run_concurrently(const vector<std::function<void()>> &tasks) {
+  vector<std::thread> threads;
+  vector<size_t> not_started;
+  for (size_t i = 1; i < tasks.size(); ++i) {
+    try {
+      threads.emplace_back(tasks[i]);
+    } catch (const std::system_error &) {
+      not_started.push_back(i);
+    }
+  }
+  if (!tasks.empty()) tasks[0]();
+  for (size_t i : not_started) tasks[i]();
+  for (std::thread &thread : threads) thread.join();
+}
+
+/**
+  The smallest number of rows worth a sort thread of its own. Below this,
+  starting the thread and merging its output costs about as much as is saved.
+ */
+constexpr size_t kMinRowsPerSortThread = 16384;
+
+/**
+  Sort [begin, end) with std::sort or std::stable_sort, using up to
+  "max_threads" threads: each sorts a slice, and then neighbouring slices are
+  merged pairwise, in parallel, until one is left. std::inplace_merge() is
+  stable, so the result is stable if the slices were sorted stably.
+ */
+template <class Comp>
+void sort_in_parallel(vector<uchar *>::iterator begin,
+                      vector<uchar *>::iterator end, Comp comp, bool stable,
+                      size_t max_threads) {
+  const size_t num_rows = end - begin;
+  const size_t num_slices =
+      min<size_t>(max_threads, num_rows / kMinRowsPerSortThread);
+  if (num_slices <= 1) {
+    if (stable)
+      stable_sort(begin, end, comp);
+    else
+      sort(begin, end, comp);
+    return;
+  }
+
+  // bounds[i] is where slice i starts.
+  vector<vector<uchar *>::iterator> bounds;
+  for (size_t i = 0; i <= num_slices; ++i) {
+    bounds.push_back(begin + num_rows * i / num_slices);
+  }
+
+  vector<std::function<void()>> tasks;
+  for (size_t i = 0; i < num_slices; ++i) {
+    tasks.emplace_back([&bounds, &comp, stable, i] {
+      if (stable)
+        stable_sort(bounds[i], bounds[i + 1], comp);
+      else
+        sort(bounds[i], bounds[i + 1], comp);
+    });
+  }
+  run_concurrently(tasks);
+
+  // Merge runs of 2^k slices, doubling k until everything is one run.
+  for (size_t width = 1; width < num_slices; width *= 2) {
+    tasks.clear();
+    for (size_t i = 0; i + width < num_slices; i += 2 * width) {
+      const size_t last = min(i + 2 * width, num_slices);
+      tasks.emplace_back([&bounds, &comp, i, width, last] {
+        std::inplace_merge(bounds[i], bounds[i + width], bounds[last], comp);
+      });
+    }
+    run_concurrently(tasks);
+  }
+}
+
+/**
+  Buckets smaller than this are sorted by comparison instead of being
+  distributed further by radix sort.
+ */
+constexpr size_t kRadixSortCutoff = 64;
+
+/**
+  Stable MSD radix sort of the keys pointed to by [begin, end), comparing
+  bytes [depth, key_len) of each key. "aux" is scratch space for as many
+  pointers. Keys that share all bytes up to "depth" are in the same bucket,
+  so nothing before "depth" needs to be looked at.
+
+  If max_threads is more than one, the buckets of the first distribution
+  are split into that many groups of about the same size, which are then
+  sorted concurrently.
+ */
+void radix_sort(uchar **begin, uchar **end, uchar **aux, size_t depth,
+                size_t key_len, size_t max_threads) {
+  for (;;) {
+    const size_t num_rows = end - begin;
+    if (num_rows < kRadixSortCutoff) {
+      // The rest of the key, for lack of a precomputed Mem_compare.
+      const size_t len = key_len - depth;
+      stable_sort(begin, end, [depth, len](const uchar *a, const uchar *b) {
+        return memcmp(a + depth, b + depth, len) < 0;
+      });
+      return;
+    }
+
+    size_t counts[256] = {0};
+    for (uchar **p = begin; p != end; ++p) ++counts[(*p)[depth]];
+
+    // If all keys have the same byte here, just go on to the next one
+    // (common for the high-order bytes of integers).
+    if (counts[begin[0][depth]] == num_rows) {
+      if (++depth == key_len) return;
+      continue;
+    }
+
+    size_t starts[256 + 1];
+    starts[0] = 0;
+    for (size_t i = 0; i < 256; ++i) starts[i + 1] = starts[i] + counts[i];
+    size_t next[256];
+    std::copy(starts, starts + 256, next);
+    for (uchar **p = begin; p != end; ++p) aux[next[(*p)[depth]]++] = *p;
+    std::copy(aux, aux + num_rows, begin);
+
+    if (++depth == key_len) return;
+
+    if (max_threads <= 1) {
+      for (size_t i = 0; i < 256; ++i) {
+        if (counts[i] > 1) {
+          radix_sort(begin + starts[i], begin + starts[i + 1],
+                     aux + starts[i], depth, key_len, 1);
+        }
+      }
+      return;
+    }
+
+    // Make groups of consecutive buckets with about num_rows / max_threads
+    // rows each. They cover disjoint parts of "begin" and "aux".
+    vector<std::function<void()>> tasks;
+    size_t group_start = 0;
+    for (size_t i = 0; i < 256; ++i) {
+      const bool last = i == 255;
+      if (!last && (starts[i + 1] - starts[group_start]) * max_threads <
+                       num_rows) {
+        continue;
+      }
+      tasks.emplace_back([=] {
+        for (size_t j = group_start; j <= i; ++j) {
+          if (counts[j] > 1) {
+            radix_sort(begin + starts[j], begin + starts[j + 1],
+                       aux + starts[j], depth, key_len, 1);
+          }
+        }
+      });
+      group_start = i + 1;
+    }
+    run_concurrently(tasks);
+    return;
+  }
+}
+
+/**
+  Radix sort is worthwhile for many rows with short keys; for long keys, and
+  few rows, comparison sorting wins, since it usually only needs to look at
+  the first few bytes of each key.
+ */
+constexpr size_t kMinRowsForRadixSort = 4096;
+constexpr size_t kMaxRadixSortKeyLength = 16;
+
 template <class Comp>
 class Equality_from_less {
  public:
@@ -155,7 +327,8 @@ size_t Filesort_buffer::sort_buffer(Sort_param *param, size_t num_input_rows,
     // TODO: Make more elaborate heuristics than just always picking
     // std::sort.
     param->m_sort_algorithm = Sort_param::FILESORT_ALG_STD_SORT;
-    sort(it_begin, it_end, comp);
+    sort_in_parallel(it_begin, it_end, comp, /*stable=*/false,
+                     param->m_num_sort_threads);
     if (param->m_remove_duplicates) {
       num_input_rows =
           unique(it_begin, it_end,
@@ -174,6 +347,25 @@ size_t Filesort_buffer::sort_buffer(Sort_param *param, size_t num_input_rows,
     key_len -= param->sum_ref_length;
   }
 
+  // make_sortkey() produces keys that compare with memcmp(), so fixed-length
+  // keys can be radix sorted. The sort is stable, so it is good for every
+  // case below, except prefiltering for a LIMIT.
+  if (!prefilter_nth_element && num_input_rows >= kMinRowsForRadixSort &&
+      key_len > 0 && key_len <= kMaxRadixSortKeyLength) {
+    param->m_sort_algorithm = Sort_param::FILESORT_ALG_RADIX;
+    vector<uchar *> aux(num_input_rows);
+    radix_sort(m_record_pointers.data(),
+               m_record_pointers.data() + num_input_rows, aux.data(),
+               /*depth=*/0, key_len, param->m_num_sort_threads);
+    if (param->m_remove_duplicates) {
+      num_input_rows =
+          unique(it_begin, it_end,
+                 Equality_from_less<Mem_compare>(Mem_compare(key_len))) -
+          it_begin;
+    }
+    return std::min(num_input_rows, max_output_rows);
+  }
+
   /*
     std::stable_sort has some extra overhead in allocating the temp buffer,
     which takes some time. The cutover point where it starts to get faster
@@ -221,7 +413,8 @@ size_t Filesort_buffer::sort_buffer(Sort_param *param, size_t num_input_rows,
                   Mem_compare(key_len));
       it_end = it_begin + max_output_rows;
     }
-    stable_sort(it_begin, it_end, Mem_compare(key_len));
+    sort_in_parallel(it_begin, it_end, Mem_compare(key_len), /*stable=*/true,
+                     param->m_num_sort_threads);
     if (param->m_remove_duplicates) {
       num_input_rows =
           unique(it_begin, it_end,
@@ -234,7 +427,8 @@ size_t Filesort_buffer::sort_buffer(Sort_param *param, size_t num_input_rows,
                   Mem_compare_longkey(key_len));
       it_end = it_begin + max_output_rows;
     }
-    stable_sort(it_begin, it_end, Mem_compare_longkey(key_len));
+    sort_in_parallel(it_begin, it_end, Mem_compare_longkey(key_len),
+                     /*stable=*/true, param->m_num_sort_threads);
     if (param->m_remove_duplicates) {
       num_input_rows = unique(it_begin, it_end,
                               Equality_from_less<Mem_compare_longkey>(
@@ -87,6 +87,8 @@ class Filesort_buffer {
         m_space_used_other_blocks(0) {}
 
   /** Sort me...
+    Large buffers are sorted by up to param->m_num_sort_threads threads,
+    each sorting a slice of the records, after which the slices are merged.
     @return Number of records, after any deduplication
    */
   size_t sort_buffer(Sort_param *param, size_t num_input_rows,
@@ -88,6 +88,7 @@
 #include "sql/error_handler.h"               // Internal_error_handler
 #include "sql/field.h"
 #include "sql/item.h"
+#include "sql/key.h"  // key_cmp2
 #include "sql/lock.h"  // MYSQL_LOCK
 #include "sql/log.h"
 #include "sql/log_event.h"  // Write_rows_log_event
@@ -2358,6 +2359,21 @@ int ha_prepare_low(THD *thd, bool all) {
   return error;
 }
 
+void ha_commit_decided(THD *thd, bool all) {
+  DBUG_TRACE;
+  const Transaction_ctx::enum_trx_scope trx_scope =
+      all ? Transaction_ctx::SESSION : Transaction_ctx::STMT;
+  auto ha_list = thd->get_transaction()->ha_trx_info(trx_scope);
+
+  if (ha_list) {
+    for (auto const &ha_info : ha_list) {
+      auto ht = ha_info.ht();
+      if (ha_info.is_trx_read_write() && ht->commit_decided != nullptr)
+        ht->commit_decided(ht, thd);
+    }
+  }
+}
+
 /**
   @note
   according to the sql standard (ISO/IEC 9075-2:2003)
@@ -6617,6 +6633,9 @@ int DsMrr_impl::dsmrr_init(RANGE_SEQ_IF *seq_funcs, void *seq_init_param,
     return retval;
   }
 
+  if (h->active_index == table->s->primary_key && h->primary_key_is_clustered())
+    return key_sorted_init(seq_funcs, seq_init_param, n_ranges, mode, buf);
+
   /*
     This assert will hit if we have pushed an index condition to the
     primary key index and then "change our mind" and use a different
@@ -6869,6 +6888,128 @@ int DsMrr_impl::dsmrr_fill_buffer() {
   return 0;
 }
 
+/**
+  DS-MRR: Start a scan of key lookups on a clustered primary key
+
+  {This is an internal function of DiskSweep MRR implementation}
+  The clustered index holds the rows, so there are no rowids to sort.
+  Instead, the lookup keys of the ranges are collected in the buffer and
+  sorted, and the default MRR implementation reads the ranges from the
+  buffer. The B-tree is thus probed in key order rather than in the order
+  of the outer rows, and lookups of keys which are close to each other
+  find their leaf pages in the buffer pool.
+
+  All ranges must be single key lookups of the same shape, which is what
+  batched key access produces.
+*/
+
+int DsMrr_impl::key_sorted_init(RANGE_SEQ_IF *seq_funcs, void *seq_init_param,
+                                uint n_ranges, uint mode,
+                                HANDLER_BUFFER *buf) {
+  DBUG_TRACE;
+  const uint elem_size =
+      table->key_info[h->active_index].key_length + sizeof(char *);
+
+  use_default_impl = true;
+  if (static_cast<size_t>(buf->buffer_end - buf->buffer) < elem_size)
+    return h->handler::multi_range_read_init(seq_funcs, seq_init_param,
+                                             n_ranges, mode, buf);
+
+  if (!(mode & HA_MRR_NO_ASSOCIATION)) {
+    assert(!table->in_use->status_var_aggregated);
+    table->in_use->status_var.ha_multi_range_read_init_count++;
+  }
+
+  rowids_buf = buf->buffer;
+  rowids_buf_end =
+      rowids_buf + ((buf->buffer_end - buf->buffer) / elem_size) * elem_size;
+  rowids_buf_cur = rowids_buf_last = rowids_buf;
+  dsmrr_eof = false;
+
+  key_sorted_seq = *seq_funcs;
+  key_sorted_iter = seq_funcs->init(seq_init_param, n_ranges, mode);
+
+  RANGE_SEQ_IF sorted_seq_funcs = {key_sorted_seq_init, key_sorted_seq_next,
+                                   nullptr};
+  return h->handler::multi_range_read_init(&sorted_seq_funcs, this, n_ranges,
+                                           mode, buf);
+}
+
+/**
+  DS-MRR: Fill the buffer with lookup keys and sort it by key
+
+  {This is an internal function of DiskSweep MRR implementation}
+  Each element holds the key, padded to the length of the index, followed
+  by the range_info pointer of its range.
+*/
+
+void DsMrr_impl::key_sorted_fill_buffer() {
+  DBUG_TRACE;
+  KEY *key_info = table->key_info + h->active_index;
+  const uint elem_size = key_info->key_length + sizeof(char *);
+  KEY_MULTI_RANGE range;
+
+  rowids_buf_cur = rowids_buf;
+  while (rowids_buf_cur < rowids_buf_end) {
+    if (key_sorted_seq.next(key_sorted_iter, &range)) {
+      dsmrr_eof = true;
+      break;
+    }
+    assert(range.range_flag & EQ_RANGE);
+    assert(range.start_key.length <= key_info->key_length);
+    assert(rowids_buf_cur == rowids_buf ||
+           range.start_key.length == key_sorted_range.start_key.length);
+    key_sorted_range = range;
+
+    memcpy(rowids_buf_cur, range.start_key.key, range.start_key.length);
+    memcpy(rowids_buf_cur + key_info->key_length, &range.ptr, sizeof(char *));
+    rowids_buf_cur += elem_size;
+  }
+
+  if (rowids_buf_cur != rowids_buf) {
+    const uint key_length = key_sorted_range.start_key.length;
+    varlen_sort(rowids_buf, rowids_buf_cur, elem_size,
+                [key_info, key_length](const uchar *a, const uchar *b) {
+                  return key_cmp2(key_info->key_part, a, key_length, b,
+                                  key_length) < 0;
+                });
+  }
+  rowids_buf_last = rowids_buf_cur;
+  rowids_buf_cur = rowids_buf;
+}
+
+/**
+  DS-MRR: Return the next range of a key-sorted scan to the default MRR
+  implementation, refilling the buffer when all of it has been returned.
+
+  @retval 0  A range was returned
+  @retval 1  There are no more ranges
+*/
+
+uint DsMrr_impl::key_sorted_next(KEY_MULTI_RANGE *range) {
+  if (rowids_buf_cur == rowids_buf_last) {
+    if (dsmrr_eof) return 1;
+    key_sorted_fill_buffer();
+    if (rowids_buf_cur == rowids_buf_last) return 1;
+  }
+
+  const uint key_length = table->key_info[h->active_index].key_length;
+  *range = key_sorted_range;
+  range->start_key.key = rowids_buf_cur;
+  range->end_key.key = rowids_buf_cur;
+  memcpy(&range->ptr, rowids_buf_cur + key_length, sizeof(char *));
+  rowids_buf_cur += key_length + sizeof(char *);
+  return 0;
+}
+
+range_seq_t DsMrr_impl::key_sorted_seq_init(void *init_param, uint, uint) {
+  return init_param;
+}
+
+uint DsMrr_impl::key_sorted_seq_next(range_seq_t seq, KEY_MULTI_RANGE *range) {
+  return static_cast<DsMrr_impl *>(seq)->key_sorted_next(range);
+}
+
 /*
   DS-MRR implementation: multi_range_read_next() function
 */
@@ -6931,7 +7072,8 @@ ha_rows DsMrr_impl::dsmrr_info(uint keyno, uint n_ranges, uint rows,
   assert(!res);
 
   if ((*flags & HA_MRR_USE_DEFAULT_IMPL) ||
-      choose_mrr_impl(keyno, rows, flags, bufsz, cost)) {
+      choose_mrr_impl(keyno, rows, flags, bufsz, cost,
+                      /*allow_key_sorted=*/true)) {
     /* Default implementation is chosen */
     DBUG_PRINT("info", ("Default MRR implementation choosen"));
     *flags = def_flags;
@@ -6971,7 +7113,8 @@ ha_rows DsMrr_impl::dsmrr_info_const(uint keyno, RANGE_SEQ_IF *seq,
     @@optimizer_switch.
   */
   if ((*flags & HA_MRR_USE_DEFAULT_IMPL) ||
-      choose_mrr_impl(keyno, rows, flags, bufsz, cost)) {
+      choose_mrr_impl(keyno, rows, flags, bufsz, cost,
+                      /*allow_key_sorted=*/false)) {
     DBUG_PRINT("info", ("Default MRR implementation choosen"));
     *flags = def_flags;
     *bufsz = def_bufsz;
@@ -7001,13 +7144,18 @@ ha_rows DsMrr_impl::dsmrr_info_const(uint keyno, RANGE_SEQ_IF *seq,
   @param cost   IN   Cost of default MRR implementation
                 OUT  If DS-MRR is chosen, cost of DS-MRR scan
                      else the value is not modified
+  @param allow_key_sorted  If true, DS-MRR may be chosen for a clustered
+                     primary key, see key_sorted_init(). This is only
+                     done for lookups from batched key access, as
+                     ranges from the range optimizer are already sorted.
 
   @retval true   Default MRR implementation should be used
   @retval false  DS-MRR implementation should be used
 */
 
 bool DsMrr_impl::choose_mrr_impl(uint keyno, ha_rows rows, uint *flags,
-                                 uint *bufsz, Cost_estimate *cost) {
+                                 uint *bufsz, Cost_estimate *cost,
+                                 bool allow_key_sorted) {
   bool res;
   THD *thd = current_thd;
   Table_ref *tl = table->pos_in_table_list;
@@ -7017,9 +7165,12 @@ bool DsMrr_impl::choose_mrr_impl(uint keyno, ha_rows rows, uint *flags,
       hint_key_state(thd, tl, keyno, MRR_HINT_ENUM, 0) ||
       hint_table_state(thd, tl, BKA_HINT_ENUM, 0);
 
+  const bool clustered_pk =
+      keyno == table->s->primary_key && h->primary_key_is_clustered();
+
   if (!(mrr_on || force_dsmrr_by_hints) ||
       *flags & (HA_MRR_INDEX_ONLY | HA_MRR_SORTED) ||  // Unsupported by DS-MRR
-      (keyno == table->s->primary_key && h->primary_key_is_clustered()) ||
+      (clustered_pk && !allow_key_sorted) ||
       key_uses_partial_cols(table, keyno) ||
       table->s->tmp_table != NO_TMP_TABLE) {
     /* Use the default implementation, don't modify args: See comments  */
@@ -7057,7 +7208,14 @@ bool DsMrr_impl::choose_mrr_impl(uint keyno, ha_rows rows, uint *flags,
   }
 
   Cost_estimate dsmrr_cost;
-  if (get_disk_sweep_mrr_cost(keyno, rows, *flags, bufsz, &dsmrr_cost))
+  if (clustered_pk) {
+    /*
+      Key-sorted lookups do the same lookups as the default implementation,
+      only in a different order; the cost model does not capture the better
+      locality.
+    */
+    dsmrr_cost = *cost;
+  } else if (get_disk_sweep_mrr_cost(keyno, rows, *flags, bufsz, &dsmrr_cost))
     return true;
 
   /*
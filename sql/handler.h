@@ -1399,6 +1399,15 @@ typedef int (*rollback_t)(handlerton *hton, THD *thd, bool all);
 
 typedef int (*prepare_t)(handlerton *hton, THD *thd, bool all);
 
+/**
+  Called for a prepared transaction once the transaction coordinator has
+  made its commit decision durable, so that recovery would commit it and it
+  can no longer be rolled back, but before it is committed in the engine.
+  The engine may release what only protects against a rollback, such as the
+  row locks of the transaction.
+*/
+typedef void (*commit_decided_t)(handlerton *hton, THD *thd);
+
 typedef int (*recover_t)(handlerton *hton, XA_recover_txn *xid_list, uint len,
                          MEM_ROOT *mem_root);
 /**
@@ -2760,6 +2769,7 @@ struct handlerton {
   commit_t commit;
   rollback_t rollback;
   prepare_t prepare;
+  commit_decided_t commit_decided;
   recover_t recover;
   recover_prepared_in_tc_t recover_prepared_in_tc;
   commit_by_xid_t commit_by_xid;
@@ -7280,6 +7290,14 @@ class DsMrr_impl {
   bool is_mrr_assoc;
 
   bool use_default_impl; /* true <=> shortcut all calls to default MRR impl */
+
+  /*
+    Key-sorted lookups on a clustered primary key: the range sequence of the
+    MRR user, and the range the buffered lookup keys are substituted into.
+  */
+  RANGE_SEQ_IF key_sorted_seq;
+  range_seq_t key_sorted_iter;
+  KEY_MULTI_RANGE key_sorted_range;
  public:
   /**
     Initialize the DsMrr_impl object.
@@ -7323,7 +7341,14 @@ class DsMrr_impl {
 
  private:
   bool choose_mrr_impl(uint keyno, ha_rows rows, uint *flags, uint *bufsz,
-                       Cost_estimate *cost);
+                       Cost_estimate *cost, bool allow_key_sorted);
+  int key_sorted_init(RANGE_SEQ_IF *seq_funcs, void *seq_init_param,
+                      uint n_ranges, uint mode, HANDLER_BUFFER *buf);
+  void key_sorted_fill_buffer();
+  uint key_sorted_next(KEY_MULTI_RANGE *range);
+  static range_seq_t key_sorted_seq_init(void *init_param, uint n_ranges,
+                                         uint flags);
+  static uint key_sorted_seq_next(range_seq_t seq, KEY_MULTI_RANGE *range);
   bool get_disk_sweep_mrr_cost(uint keynr, ha_rows rows, uint flags,
                                uint *buffer_size, Cost_estimate *cost);
 };
@@ -7542,6 +7567,16 @@ int ha_commit_low(THD *thd, bool all, bool run_after_commit = true);
           otherwise.
  */
 int ha_prepare_low(THD *thd, bool all);
+
+/**
+  Tells the engines of a prepared transaction that its commit has been
+  decided, see commit_decided_t.
+
+  @param thd The THD session object holding the prepared transaction.
+  @param all Whether the commit regards a full transaction or the
+             statement being executed.
+ */
+void ha_commit_decided(THD *thd, bool all);
 int ha_rollback_low(THD *thd, bool all);
 
 /* transactions: these functions never call handlerton functions directly */
@@ -67,6 +67,7 @@
 #include "sql/handler.h"
 #include "sql/histograms/equi_height.h"  // Equi_height<T>
 #include "sql/histograms/singleton.h"    // Singleton<T>
+#include "sql/histograms/table_histograms.h"  // Table_histograms
 #include "sql/histograms/value_map.h"    // Value_map
 #include "sql/item.h"
 #include "sql/item_cmpfunc.h"
@@ -1428,6 +1429,28 @@ bool update_histogram(THD *thd, Table_ref *table, const columns_set &columns,
   return false;
 }
 
+bool refresh_histograms(THD *thd, Table_ref *table, results_map &results) {
+  const TABLE *tbl = table->table;
+  if (tbl->histograms == nullptr) return false;
+
+  // update_histogram() builds all its histograms with the same bucket count.
+  std::map<size_t, columns_set> columns_by_buckets;
+  for (uint i = 0; i < tbl->s->fields; ++i) {
+    const Histogram *histogram = tbl->histograms->find_histogram(i);
+    if (histogram == nullptr || histogram->get_num_buckets_specified() == 0)
+      continue;
+    columns_by_buckets[histogram->get_num_buckets_specified()].emplace(
+        tbl->field[i]->field_name);
+  }
+
+  for (const auto &[num_buckets, columns] : columns_by_buckets) {
+    if (update_histogram(thd, table, columns, static_cast<int>(num_buckets),
+                         {nullptr, 0}, results))
+      return true;
+  }
+  return false;
+}
+
 bool drop_all_histograms(THD *thd, Table_ref &table,
                          const dd::Table &table_definition,
                          results_map &results) {
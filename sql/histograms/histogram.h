@@ -725,6 +725,20 @@ Histogram *build_histogram(MEM_ROOT *mem_root, const Value_map<T> &value_map,
 bool update_histogram(THD *thd, Table_ref *table, const columns_set &columns,
                       int num_buckets, LEX_STRING data, results_map &results);
 
+/**
+  Rebuild the existing histograms of a table from its current data, each with
+  the number of buckets it was originally built with.
+
+  @param thd Thread handler.
+  @param table The table whose histograms should be rebuilt. It must be open,
+         with the same metadata locks as for update_histogram().
+  @param results A map where the result of each operation is stored. It is
+         left empty if the table has no histograms to rebuild.
+
+  @return false on success, true on error.
+*/
+bool refresh_histograms(THD *thd, Table_ref *table, results_map &results);
+
 /**
   Drop histograms for all columns in a given table.
 
@@ -191,6 +191,13 @@ class LinkedImmutableString {
   static inline LinkedImmutableString EncodeHeader(LinkedImmutableString next,
                                                    char **dst);
 
+  /// Like EncodeHeader(), but writes the header into the space right in front
+  /// of “data”, so that it ends exactly where the (already written) string
+  /// starts. There must be at least RequiredBytesForEncode(0) bytes of space
+  /// available in front of “data”.
+  static inline LinkedImmutableString EncodeHeaderBefore(
+      LinkedImmutableString next, char *data);
+
   /// Calculates an upper bound on the space required for encoding a string
   /// of the given length.
   static inline size_t RequiredBytesForEncode(size_t length) {
@@ -239,4 +246,28 @@ LinkedImmutableString LinkedImmutableString::EncodeHeader(
   return LinkedImmutableString(base);
 }
 
+LinkedImmutableString LinkedImmutableString::EncodeHeaderBefore(
+    LinkedImmutableString next, char *data) {
+  using google::protobuf::io::CodedOutputStream;
+
+  // The length of the varint depends on its own length, since the pointer
+  // difference is relative to the start of the header. Try the possible
+  // lengths from the shortest.
+  for (size_t length = 1; length <= RequiredBytesForEncode(0); ++length) {
+    char *header = data - length;
+    const size_t encoded_length =
+        next.m_ptr == nullptr ? 1
+                              : CodedOutputStream::VarintSize64(
+                                    ZigZagEncode64(next.m_ptr - header));
+    if (encoded_length == length) {
+      char *dptr = header;
+      const LinkedImmutableString ret = EncodeHeader(next, &dptr);
+      assert(dptr == data);
+      return ret;
+    }
+  }
+  assert(false);
+  return LinkedImmutableString{nullptr};
+}
+
 #endif  // IMMUTABLE_STRING_H
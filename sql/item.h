@@ -6976,6 +6976,12 @@ class Item_cache_int : public Item_cache {
     'item'; however, NULLness is still taken from 'item'.
   */
   void store_value(Item *item, longlong val_arg);
+  /// Store an explicitly provided, non-NULL value.
+  void store_value(longlong val_arg) {
+    value_cached = true;
+    value = val_arg;
+    null_value = false;
+  }
   double val_real() override;
   longlong val_int() override;
   longlong val_time_temporal() override { return val_int(); }
@@ -39,6 +39,14 @@
 #include <type_traits>
 #include <utility>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define HAVE_BATCH_PREDICATE_AVX2
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define HAVE_BATCH_PREDICATE_NEON
+#endif
+
 #include "decimal.h"
 #include "mf_wcomp.h"  // wild_one, wild_many
 #include "my_alloc.h"
@@ -8164,3 +8172,260 @@ void Item_func_eq::ensure_multi_equality_fields_are_available(
   // join condition.
   if (replace) update_used_tables();
 }
+
+/*
+  Batch evaluation of simple integer predicates.
+
+  The kernels all write one byte per value into "matches", 1 if the value is
+  within the range (or in the list) and not NULL, and 0 otherwise. The
+  comparisons themselves do not branch on the data, so that the scalar
+  versions can be vectorized by the compiler, too.
+*/
+
+static void FilterRangeScalar(const longlong *values, const uchar *nulls,
+                              size_t begin, size_t end, longlong low,
+                              longlong high, uchar *matches) {
+  for (size_t i = begin; i < end; ++i) {
+    matches[i] = (values[i] >= low) & (values[i] <= high) & (nulls[i] ^ 1);
+  }
+}
+
+static void FilterInListScalar(const longlong *values, const uchar *nulls,
+                               size_t begin, size_t end, const longlong *list,
+                               size_t list_size, uchar *matches) {
+  for (size_t i = begin; i < end; ++i) {
+    uchar found = 0;
+    for (size_t j = 0; j < list_size; ++j) found |= values[i] == list[j];
+    matches[i] = found & (nulls[i] ^ 1);
+  }
+}
+
+#if defined(HAVE_BATCH_PREDICATE_AVX2)
+
+static bool CpuHasAvx2() {
+  static const bool has_avx2 = __builtin_cpu_supports("avx2");
+  return has_avx2;
+}
+
+MY_ATTRIBUTE((target("avx2")))
+static void FilterRangeAvx2(const longlong *values, const uchar *nulls,
+                            size_t num_values, longlong low, longlong high,
+                            uchar *matches) {
+  const __m256i low_v = _mm256_set1_epi64x(low);
+  const __m256i high_v = _mm256_set1_epi64x(high);
+  size_t i = 0;
+  for (; i + 4 <= num_values; i += 4) {
+    const __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i));
+    // Outside the range if low > v or v > high.
+    const __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi64(low_v, v),
+                                            _mm256_cmpgt_epi64(v, high_v));
+    const int inside = ~_mm256_movemask_pd(_mm256_castsi256_pd(outside));
+    for (size_t k = 0; k < 4; ++k) {
+      matches[i + k] = ((inside >> k) & 1) & (nulls[i + k] ^ 1);
+    }
+  }
+  FilterRangeScalar(values, nulls, i, num_values, low, high, matches);
+}
+
+MY_ATTRIBUTE((target("avx2")))
+static void FilterInListAvx2(const longlong *values, const uchar *nulls,
+                             size_t num_values, const longlong *list,
+                             size_t list_size, uchar *matches) {
+  size_t i = 0;
+  for (; i + 4 <= num_values; i += 4) {
+    const __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i));
+    __m256i found = _mm256_setzero_si256();
+    for (size_t j = 0; j < list_size; ++j) {
+      found = _mm256_or_si256(
+          found, _mm256_cmpeq_epi64(v, _mm256_set1_epi64x(list[j])));
+    }
+    const int mask = _mm256_movemask_pd(_mm256_castsi256_pd(found));
+    for (size_t k = 0; k < 4; ++k) {
+      matches[i + k] = ((mask >> k) & 1) & (nulls[i + k] ^ 1);
+    }
+  }
+  FilterInListScalar(values, nulls, i, num_values, list, list_size, matches);
+}
+#endif  // HAVE_BATCH_PREDICATE_AVX2
+
+#if defined(HAVE_BATCH_PREDICATE_NEON)
+
+static void FilterRangeNeon(const longlong *values, const uchar *nulls,
+                            size_t num_values, longlong low, longlong high,
+                            uchar *matches) {
+  const int64x2_t low_v = vdupq_n_s64(low);
+  const int64x2_t high_v = vdupq_n_s64(high);
+  size_t i = 0;
+  for (; i + 2 <= num_values; i += 2) {
+    const int64x2_t v = vld1q_s64(values + i);
+    const uint64x2_t inside =
+        vandq_u64(vcgeq_s64(v, low_v), vcleq_s64(v, high_v));
+    matches[i] = (vgetq_lane_u64(inside, 0) & 1) & (nulls[i] ^ 1);
+    matches[i + 1] = (vgetq_lane_u64(inside, 1) & 1) & (nulls[i + 1] ^ 1);
+  }
+  FilterRangeScalar(values, nulls, i, num_values, low, high, matches);
+}
+
+static void FilterInListNeon(const longlong *values, const uchar *nulls,
+                             size_t num_values, const longlong *list,
+                             size_t list_size, uchar *matches) {
+  size_t i = 0;
+  for (; i + 2 <= num_values; i += 2) {
+    const int64x2_t v = vld1q_s64(values + i);
+    uint64x2_t found = vdupq_n_u64(0);
+    for (size_t j = 0; j < list_size; ++j) {
+      found = vorrq_u64(found, vceqq_s64(v, vdupq_n_s64(list[j])));
+    }
+    matches[i] = (vgetq_lane_u64(found, 0) & 1) & (nulls[i] ^ 1);
+    matches[i + 1] = (vgetq_lane_u64(found, 1) & 1) & (nulls[i + 1] ^ 1);
+  }
+  FilterInListScalar(values, nulls, i, num_values, list, list_size, matches);
+}
+#endif  // HAVE_BATCH_PREDICATE_NEON
+
+/// Flip the sign bit, so that unsigned values compare correctly as signed;
+/// see RowBatch::column_values().
+static inline longlong BiasUnsigned(longlong value) {
+  return static_cast<longlong>(static_cast<ulonglong>(value) ^
+                               (ulonglong{1} << 63));
+}
+
+Batch_int_predicate *Batch_int_predicate::Create(MEM_ROOT *mem_root,
+                                                 Item *cond) {
+  if (cond->type() != Item::FUNC_ITEM) return nullptr;
+  Item_func *func = down_cast<Item_func *>(cond);
+  if (func->functype() != Item_func::BETWEEN &&
+      func->functype() != Item_func::IN_FUNC) {
+    return nullptr;
+  }
+  if (down_cast<Item_func_opt_neg *>(func)->negated) return nullptr;
+
+  Item **args = func->arguments();
+  if (args[0]->type() != Item::FIELD_ITEM ||
+      args[0]->data_type() == MYSQL_TYPE_BIT) {
+    return nullptr;
+  }
+  for (uint i = 1; i < func->argument_count(); ++i) {
+    if (!args[i]->const_for_execution() || args[i]->has_subquery()) {
+      return nullptr;
+    }
+  }
+
+  if (func->functype() == Item_func::BETWEEN) {
+    const Item_func_between *between = down_cast<Item_func_between *>(func);
+    // The same comparison types as compare_between_int_result(), except for
+    // TIME, which is rare enough to not bother with.
+    if (between->cmp_type != INT_RESULT ||
+        between->compare_as_dates_with_strings ||
+        between->compare_as_temporal_times) {
+      return nullptr;
+    }
+    return new (mem_root) Batch_int_predicate(
+        func, between->compare_as_temporal_dates, /*in_list=*/nullptr);
+  }
+
+  // IN: Only plain integers on both sides, so that the comparison is
+  // integer equality.
+  if (func->argument_count() - 1 > kMaxInListSize) return nullptr;
+  for (uint i = 0; i < func->argument_count(); ++i) {
+    if (args[i]->result_type() != INT_RESULT || args[i]->is_temporal()) {
+      return nullptr;
+    }
+  }
+  longlong *in_list =
+      mem_root->ArrayAlloc<longlong>(func->argument_count() - 1);
+  if (in_list == nullptr) return nullptr;
+  return new (mem_root)
+      Batch_int_predicate(func, /*as_date=*/false, in_list);
+}
+
+bool Batch_int_predicate::EvaluateConstants(THD *thd) {
+  Item **args = m_cond->arguments();
+  const bool column_is_unsigned = args[0]->unsigned_flag;
+
+  if (m_in_list != nullptr) {
+    m_in_list_size = 0;
+    for (uint i = 1; i < m_cond->argument_count(); ++i) {
+      longlong value = args[i]->val_int();
+      if (thd->is_error()) return true;
+      // NULL can never match, and neither can values outside the range of
+      // the column's type.
+      if (args[i]->null_value) continue;
+      if (column_is_unsigned) {
+        if (!args[i]->unsigned_flag && value < 0) continue;
+        value = BiasUnsigned(value);
+      } else if (args[i]->unsigned_flag && value < 0) {
+        continue;
+      }
+      m_in_list[m_in_list_size++] = value;
+    }
+    std::sort(m_in_list, m_in_list + m_in_list_size);
+    m_in_list_size =
+        std::unique(m_in_list, m_in_list + m_in_list_size) - m_in_list;
+    return false;
+  }
+
+  longlong low = m_as_date ? args[1]->val_date_temporal() : args[1]->val_int();
+  if (thd->is_error()) return true;
+  longlong high =
+      m_as_date ? args[2]->val_date_temporal() : args[2]->val_int();
+  if (thd->is_error()) return true;
+
+  // An empty range; used when no value can match.
+  m_low = 1;
+  m_high = 0;
+
+  // If either bound is NULL, the result is either false or UNKNOWN.
+  if (args[1]->null_value || args[2]->null_value) return false;
+
+  // Handle mixed signedness the same way as compare_between_int_result().
+  if (column_is_unsigned) {
+    if (!args[1]->unsigned_flag && low < 0) low = 0;
+    if (!args[2]->unsigned_flag && high < 0) return false;
+    m_low = BiasUnsigned(low);
+    m_high = BiasUnsigned(high);
+  } else {
+    // A lower bound above LLONG_MAX cannot match any signed value.
+    if (args[1]->unsigned_flag && low < 0) return false;
+    if (args[2]->unsigned_flag && high < 0) high = LLONG_MAX;
+    m_low = low;
+    m_high = high;
+  }
+  return false;
+}
+
+void Batch_int_predicate::Evaluate(const longlong *values, const uchar *nulls,
+                                   size_t num_rows, uchar *matches) const {
+  if (m_in_list != nullptr) {
+#if defined(HAVE_BATCH_PREDICATE_AVX2)
+    if (CpuHasAvx2()) {
+      FilterInListAvx2(values, nulls, num_rows, m_in_list, m_in_list_size,
+                       matches);
+    } else {
+      FilterInListScalar(values, nulls, 0, num_rows, m_in_list,
+                         m_in_list_size, matches);
+    }
+#elif defined(HAVE_BATCH_PREDICATE_NEON)
+    FilterInListNeon(values, nulls, num_rows, m_in_list, m_in_list_size,
+                     matches);
+#else
+    FilterInListScalar(values, nulls, 0, num_rows, m_in_list, m_in_list_size,
+                       matches);
+#endif
+    return;
+  }
+
+#if defined(HAVE_BATCH_PREDICATE_AVX2)
+  if (CpuHasAvx2()) {
+    FilterRangeAvx2(values, nulls, num_rows, m_low, m_high, matches);
+  } else {
+    FilterRangeScalar(values, nulls, 0, num_rows, m_low, m_high, matches);
+  }
+#elif defined(HAVE_BATCH_PREDICATE_NEON)
+  FilterRangeNeon(values, nulls, num_rows, m_low, m_high, matches);
+#else
+  FilterRangeScalar(values, nulls, 0, num_rows, m_low, m_high, matches);
+#endif
+}
@@ -2862,4 +2862,83 @@ bool WalkConjunction(Item *condition, Func func) {
   }
 }
 
+/**
+  A simple predicate on an integer or date column, of one of the shapes
+
+    <column> BETWEEN <constant> AND <constant>
+    <column> IN (<constant>, ...)
+
+  that can be evaluated on the values of the column for an entire batch of
+  rows at once (see RowBatch and FilterIterator::ReadBatch()), instead of
+  one row at a time through Item::val_int(). The kernels use AVX2 (if the
+  CPU supports it) or NEON.
+
+  The predicate is only meant to be used for a top-level conjunct of a
+  filter condition, where UNKNOWN means the same as false. The constants may
+  change between executions, so EvaluateConstants() must be called after
+  each Init() of the filter.
+ */
+class Batch_int_predicate {
+ public:
+  /// The maximum number of elements in an IN list that is handled.
+  static constexpr uint kMaxInListSize = 16;
+
+  /**
+    Returns a predicate for "cond", or nullptr if it does not have one of the
+    supported shapes (or on OOM).
+   */
+  static Batch_int_predicate *Create(MEM_ROOT *mem_root, Item *cond);
+
+  Item_func *condition() const { return m_cond; }
+
+  /// The expression to evaluate for each row; see RowBatch::AddColumn().
+  Item *column() const { return m_cond->arguments()[0]; }
+  bool column_as_date() const { return m_as_date; }
+
+  /**
+    Evaluate the constant arguments of the predicate.
+
+    @returns true on error.
+   */
+  bool EvaluateConstants(THD *thd);
+
+  /**
+    For each of the num_rows values, set matches[i] to 1 if the predicate is
+    true for values[i], and to 0 if it is false or UNKNOWN. The values are
+    in the format of RowBatch::column_values().
+   */
+  void Evaluate(const longlong *values, const uchar *nulls, size_t num_rows,
+                uchar *matches) const;
+
+ private:
+  Batch_int_predicate(Item_func *cond, bool as_date, longlong *in_list)
+      : m_cond(cond), m_as_date(as_date), m_in_list(in_list) {}
+
+  Item_func *const m_cond;
+  const bool m_as_date;
+
+  /// For BETWEEN: the (inclusive) range of matching values. Empty if no
+  /// value can match, e.g. if one of the bounds is NULL.
+  longlong m_low{1};
+  longlong m_high{0};
+
+  /// For IN: the non-NULL values in the list. nullptr for BETWEEN.
+  longlong *const m_in_list;
+  size_t m_in_list_size{0};
+};
+
+/**
+  A FILTER condition split into the conjuncts that can be evaluated on
+  entire batches of rows (see Batch_int_predicate) and the rest, which is
+  evaluated one row at a time on the rows that remain.
+ */
+struct Batch_filter {
+  explicit Batch_filter(MEM_ROOT *mem_root) : predicates(mem_root) {}
+
+  Mem_root_array<Batch_int_predicate *> predicates;
+
+  /// The conjuncts not in "predicates", ANDed together, or nullptr if none.
+  Item *residual_condition{nullptr};
+};
+
 #endif /* ITEM_CMPFUNC_INCLUDED */
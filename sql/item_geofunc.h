@@ -27,6 +27,7 @@
 #include <sys/types.h>
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 #include "field_types.h"  // MYSQL_TYPE_BLOB
@@ -970,6 +971,7 @@ class Item_func_spatial_relation : public Item_bool_func2 {
  public:
   Item_func_spatial_relation(const POS &pos, Item *a, Item *b)
       : Item_bool_func2(pos, a, b) {}
+  ~Item_func_spatial_relation() override;
   bool resolve_type(THD *thd) override {
     if (param_type_is_default(thd, 0, -1, MYSQL_TYPE_GEOMETRY)) return true;
     // Spatial relation functions may return NULL if either parameter is NULL or
@@ -978,6 +980,7 @@ class Item_func_spatial_relation : public Item_bool_func2 {
     set_nullable(true);
     return false;
   }
+  void cleanup() override;
   void print(const THD *thd, String *str,
              enum_query_type query_type) const override {
     Item_func::print(thd, str, query_type);
@@ -1008,6 +1011,38 @@ class Item_func_spatial_relation : public Item_bool_func2 {
   virtual bool eval(const dd::Spatial_reference_system *srs,
                     const gis::Geometry *g1, const gis::Geometry *g2,
                     bool *result, bool *null) = 0;
+
+ private:
+  /**
+    Parses an argument, or returns the parse of a constant argument made
+    earlier in this execution. When one side is a constant, e.g., the polygon
+    in ST_Contains(<polygon>, t.pt), it is only parsed once instead of once
+    per row.
+
+    @param[in] arg_idx Index of the argument.
+    @param[in] str Value of the argument.
+    @param[out] srs The SRS of the geometry, or nullptr if it is Cartesian or
+    if the cached geometry was used.
+    @param[out] srid The SRID of the geometry.
+    @param[out] owned Holds the geometry if it was parsed and not cached.
+    @param[out] geometry The geometry.
+
+    @retval true An error has occurred and has been reported with my_error.
+    @retval false Success.
+  */
+  bool get_geometry(uint arg_idx, String *str,
+                    const dd::Spatial_reference_system **srs,
+                    gis::srid_t *srid, std::unique_ptr<gis::Geometry> *owned,
+                    const gis::Geometry **geometry);
+
+  /// The parsed value of the constant argument m_const_arg_idx, if any.
+  std::unique_ptr<gis::Geometry> m_const_geometry;
+  /// The string m_const_geometry was parsed from.
+  String m_const_wkb;
+  /// The SRID of m_const_geometry.
+  gis::srid_t m_const_srid{0};
+  /// Which argument m_const_geometry was parsed from.
+  uint m_const_arg_idx{0};
 };
 
 class Item_func_st_contains final : public Item_func_spatial_relation {
@@ -21,6 +21,7 @@
    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
 
 #include <stddef.h>
+#include <string.h>
 #include <boost/concept/usage.hpp>
 #include <boost/geometry/algorithms/equals.hpp>
 #include <boost/geometry/geometries/box.hpp>
@@ -91,25 +92,33 @@ longlong Item_func_spatial_relation::val_int() {
 
   const dd::Spatial_reference_system *srs1 = nullptr;
   const dd::Spatial_reference_system *srs2 = nullptr;
-  std::unique_ptr<gis::Geometry> g1;
-  std::unique_ptr<gis::Geometry> g2;
+  gis::srid_t srid1 = 0;
+  gis::srid_t srid2 = 0;
+  std::unique_ptr<gis::Geometry> owned1;
+  std::unique_ptr<gis::Geometry> owned2;
+  const gis::Geometry *g1 = nullptr;
+  const gis::Geometry *g2 = nullptr;
   std::unique_ptr<dd::cache::Dictionary_client::Auto_releaser> releaser(
       new dd::cache::Dictionary_client::Auto_releaser(
           current_thd->dd_client()));
-  if (gis::parse_geometry(current_thd, func_name(), res1, &srs1, &g1) ||
-      gis::parse_geometry(current_thd, func_name(), res2, &srs2, &g2)) {
+  if (get_geometry(0, res1, &srs1, &srid1, &owned1, &g1) ||
+      get_geometry(1, res2, &srs2, &srid2, &owned2, &g2)) {
     return error_int();
   }
 
-  gis::srid_t srid1 = srs1 == nullptr ? 0 : srs1->id();
-  gis::srid_t srid2 = srs2 == nullptr ? 0 : srs2->id();
   if (srid1 != srid2) {
     my_error(ER_GIS_DIFFERENT_SRIDS, MYF(0), func_name(), srid1, srid2);
     return error_int();
   }
 
+  // A cached geometry comes without an SRS, since the SRS is only valid as
+  // long as the releaser above. At most one argument is cached, and both SRIDs
+  // are equal, so the other argument's SRS is the one to use.
+  const dd::Spatial_reference_system *srs = srs1 != nullptr ? srs1 : srs2;
+  assert(srs != nullptr || srid1 == 0);
+
   bool result;
-  bool error = eval(srs1, g1.get(), g2.get(), &result, &null_value);
+  bool error = eval(srs, g1, g2, &result, &null_value);
 
   if (error) return error_int();
 
@@ -121,6 +130,45 @@ longlong Item_func_spatial_relation::val_int() {
   return result;
 }
 
+Item_func_spatial_relation::~Item_func_spatial_relation() = default;
+
+void Item_func_spatial_relation::cleanup() {
+  Item_bool_func2::cleanup();
+  m_const_geometry.reset();
+  m_const_wkb.mem_free();
+}
+
+bool Item_func_spatial_relation::get_geometry(
+    uint arg_idx, String *str, const dd::Spatial_reference_system **srs,
+    gis::srid_t *srid, std::unique_ptr<gis::Geometry> *owned,
+    const gis::Geometry **geometry) {
+  if (m_const_geometry != nullptr && m_const_arg_idx == arg_idx) {
+    // The argument is constant for this execution, but compare the bytes
+    // anyway, e.g., in case a user variable is assigned in the same query.
+    if (str->length() == m_const_wkb.length() &&
+        memcmp(str->ptr(), m_const_wkb.ptr(), str->length()) == 0) {
+      *srs = nullptr;
+      *srid = m_const_srid;
+      *geometry = m_const_geometry.get();
+      return false;
+    }
+    m_const_geometry.reset();
+  }
+
+  if (gis::parse_geometry(current_thd, func_name(), str, srs, owned))
+    return true;
+  *srid = *srs == nullptr ? 0 : (*srs)->id();
+  *geometry = owned->get();
+
+  if (m_const_geometry == nullptr && args[arg_idx]->const_for_execution() &&
+      !m_const_wkb.copy(*str)) {
+    m_const_geometry = std::move(*owned);
+    m_const_srid = *srid;
+    m_const_arg_idx = arg_idx;
+  }
+  return false;
+}
+
 bool Item_func_st_contains::eval(const dd::Spatial_reference_system *srs,
                                  const gis::Geometry *g1,
                                  const gis::Geometry *g2, bool *result,
@@ -1952,8 +1952,12 @@ bool Item_func_json_extract::val_json(Json_wrapper *wr) {
     if (could_return_multiple_matches) {
       Json_array_ptr a(new (std::nothrow) Json_array());
       if (a == nullptr) return error_json(); /* purecov: inspected */
-      for (Json_wrapper &ww : v) {
-        if (a->append_clone(ww.to_dom()))
+      /*
+        Build each DOM once and hand it over to the array, rather than
+        materializing it in the wrapper and then cloning it.
+      */
+      for (const Json_wrapper &ww : v) {
+        if (a->append_alias(ww.clone_dom()))
           return error_json(); /* purecov: inspected */
       }
       *wr = Json_wrapper(std::move(a));
@@ -2051,6 +2055,79 @@ static bool possible_root_path(const Json_path_iterator &begin,
 }
 #endif  // NDEBUG
 
+static void disable_logical_diffs(const Field_json *field) {
+  field->table->disable_logical_diffs_for_current_row(field);
+}
+
+static void disable_binary_diffs(const Field_json *field) {
+  field->table->disable_binary_diffs_for_current_row(field);
+}
+
+/**
+  Add a logical diff for a value which JSON_INSERT or JSON_ARRAY_APPEND has
+  inserted into an array or an object. The path is built from the location
+  of the container, so that it does not depend on auto-wrapping or on array
+  indexes relative to the end of the array in the path given by the user.
+
+  @param field      the column which is partially updated
+  @param container  the array or object which got the new value
+  @param leg        the array cell or member which was inserted
+  @param value      the inserted value
+  @retval false on success
+  @retval true on out-of-memory
+*/
+static bool add_insert_diff(const Field_json *field, const Json_dom &container,
+                            const Json_path_leg &leg,
+                            const Json_wrapper &value) {
+  Json_path path = container.get_location();
+  if (path.append(leg)) return true; /* purecov: inspected */
+  field->table->add_logical_diff(field, path, enum_json_diff_operation::INSERT,
+                                 &value);
+  return false;
+}
+
+/**
+  Add a logical diff for a non-array value which JSON_INSERT or
+  JSON_ARRAY_APPEND has auto-wrapped in a new array, or disable logical
+  diffs if that value is the whole document. Must be called before the old
+  value is replaced.
+
+  @param field          the column which is partially updated
+  @param old_value      the value which is replaced
+  @param array          the array which replaces it
+  @param[out] logical_diffs  set to false if logical diffs were disabled
+*/
+static void add_autowrap_diff(const Field_json *field,
+                              const Json_dom &old_value, Json_array *array,
+                              bool *logical_diffs) {
+  if (old_value.parent() == nullptr) {
+    // No point in partial update when we replace the entire document.
+    disable_logical_diffs(field);
+    *logical_diffs = false;
+    return;
+  }
+  Json_wrapper array_wrapper(array);
+  array_wrapper.set_alias();
+  field->table->add_logical_diff(field, old_value.get_location(),
+                                 enum_json_diff_operation::REPLACE,
+                                 &array_wrapper);
+}
+
+/**
+  Find out if JSON_INSERT or JSON_ARRAY_APPEND should collect logical diffs
+  for partial update. Binary diffs are always disabled, since inserting a
+  value makes the document grow, so it cannot be updated in place.
+
+  @param field  the column which is partially updated, or nullptr
+  @return true if logical diffs should be collected
+*/
+static bool prepare_insert_diffs(const Field_json *field) {
+  if (field == nullptr) return false;
+  const TABLE *table = field->table;
+  if (table->is_binary_diff_enabled(field)) disable_binary_diffs(field);
+  return table->is_logical_diff_enabled(field);
+}
+
 bool Item_func_json_array_append::val_json(Json_wrapper *wr) {
   assert(fixed);
 
@@ -2059,6 +2136,10 @@ bool Item_func_json_array_append::val_json(Json_wrapper *wr) {
 
     if (get_json_wrapper(args, 0, &m_doc_value, func_name(), &docw))
       return error_json();
+
+    // Should we collect logical diffs for partial update?
+    bool logical_diffs = prepare_insert_diffs(m_partial_update_column);
+
     if (args[0]->null_value) {
       null_value = true;
       return false;
@@ -2098,14 +2179,23 @@ bool Item_func_json_array_append::val_json(Json_wrapper *wr) {
 
       if (hit->json_type() == enum_json_type::J_ARRAY) {
         Json_array *arr = down_cast<Json_array *>(hit);
+        const size_t pos = arr->size();
         if (arr->append_alias(std::move(val_dom)))
           return error_json(); /* purecov: inspected */
+
+        if (logical_diffs && add_insert_diff(m_partial_update_column, *arr,
+                                             Json_path_leg(pos), valuew))
+          return error_json(); /* purecov: inspected */
       } else {
         Json_array_ptr arr(new (std::nothrow) Json_array());
         if (arr == nullptr || arr->append_clone(hit) ||
             arr->append_alias(std::move(val_dom))) {
           return error_json(); /* purecov: inspected */
         }
+
+        if (logical_diffs)
+          add_autowrap_diff(m_partial_update_column, *hit, arr.get(),
+                            &logical_diffs);
         /*
           This value will replace the old document we found using path, since
           we did an auto-wrap. If this is root, this is trivial, but if it's
@@ -2145,6 +2235,9 @@ bool Item_func_json_insert::val_json(Json_wrapper *wr) {
     if (get_json_wrapper(args, 0, &m_doc_value, func_name(), &docw))
       return error_json();
 
+    // Should we collect logical diffs for partial update?
+    bool logical_diffs = prepare_insert_diffs(m_partial_update_column);
+
     if (args[0]->null_value) {
       null_value = true;
       return false;
@@ -2211,6 +2304,10 @@ bool Item_func_json_insert::val_json(Json_wrapper *wr) {
           size_t pos = leg->first_array_index(arr->size()).position();
           if (arr->insert_alias(pos, valuew.clone_dom()))
             return error_json(); /* purecov: inspected */
+
+          if (logical_diffs && add_insert_diff(m_partial_update_column, *arr,
+                                               Json_path_leg(pos), valuew))
+            return error_json(); /* purecov: inspected */
         } else if (!leg->is_autowrap()) {
           /*
             Found a scalar or object and we didn't specify position 0 or last:
@@ -2224,6 +2321,10 @@ bool Item_func_json_insert::val_json(Json_wrapper *wr) {
             return error_json(); /* purecov: inspected */
           }
 
+          if (logical_diffs)
+            add_autowrap_diff(m_partial_update_column, *hit, newarr.get(),
+                              &logical_diffs);
+
           /*
             Now we need this value to replace the old document we found using
             path. If this is root, this is trivial, but if it's inside an
@@ -2244,6 +2345,11 @@ bool Item_func_json_insert::val_json(Json_wrapper *wr) {
         Json_object *o = down_cast<Json_object *>(hit);
         if (o->add_clone(leg->get_member_name(), valuew.to_dom()))
           return error_json(); /* purecov: inspected */
+
+        if (logical_diffs &&
+            add_insert_diff(m_partial_update_column, *o,
+                            Json_path_leg(leg->get_member_name()), valuew))
+          return error_json(); /* purecov: inspected */
       }
     }  // end of loop through paths
     // docw still owns the augmented doc, so hand it over to result
@@ -2441,14 +2547,6 @@ bool Item_json_func::supports_partial_update(const Field_json *field) const {
   return arg0->supports_partial_update(field);
 }
 
-static void disable_logical_diffs(const Field_json *field) {
-  field->table->disable_logical_diffs_for_current_row(field);
-}
-
-static void disable_binary_diffs(const Field_json *field) {
-  field->table->disable_binary_diffs_for_current_row(field);
-}
-
 /**
   Common implementation for JSON_SET and JSON_REPLACE
 */
@@ -627,6 +627,8 @@ class Item_func_modify_json_in_path : public Item_json_func {
   Represents the JSON function JSON_ARRAY_APPEND()
 */
 class Item_func_json_array_append final : public Item_func_modify_json_in_path {
+  bool can_use_in_partial_update() const override { return true; }
+
  public:
   Item_func_json_array_append(THD *thd, const POS &pos, PT_item_list *a)
       : Item_func_modify_json_in_path(thd, pos, a) {}
@@ -640,6 +642,8 @@ class Item_func_json_array_append final : public Item_func_modify_json_in_path {
   Represents the JSON function JSON_INSERT()
 */
 class Item_func_json_insert : public Item_func_modify_json_in_path {
+  bool can_use_in_partial_update() const override { return true; }
+
  public:
   Item_func_json_insert(THD *thd, const POS &pos, PT_item_list *a)
       : Item_func_modify_json_in_path(thd, pos, a) {}
@@ -40,6 +40,7 @@
 
 #include "decimal.h"
 #include "lex_string.h"
+#include "map_helpers.h"
 #include "my_alloc.h"
 #include "my_base.h"
 #include "my_compiler.h"
@@ -389,14 +390,164 @@ bool Item_singlerow_subselect::fix_fields(THD *thd, Item **ref) {
     single_field->fix_after_pullout(outer, inner);
 
     *ref = single_field;
+    return false;
   }
 
+  setup_result_cache(thd);
   return false;
 }
 
+/**
+  Results of a correlated scalar subquery, keyed by the values of its outer
+  references, cf. Item_singlerow_subselect::setup_result_cache(). Only
+  numeric results are cached, so that they can be kept without allocation.
+*/
+struct Scalar_result_cache {
+  /// Upper bound on the number of results kept
+  static constexpr size_t kMaxResults = 4096;
+
+  struct Result {
+    bool has_row;  ///< Whether the subquery returned a row
+    bool null_value;
+    longlong int_value;
+    double real_value;
+    my_decimal decimal_value;
+  };
+
+  malloc_unordered_map<std::string, Result> results{PSI_NOT_INSTRUMENTED};
+};
+
 void Item_singlerow_subselect::cleanup() {
   DBUG_TRACE;
   Item_subselect::cleanup();
+  // Data may change between executions of a prepared statement
+  delete m_result_cache;
+  m_result_cache = nullptr;
+}
+
+void Item_singlerow_subselect::setup_result_cache(THD *thd) {
+  // Without outer references the subquery is executed once anyway, and
+  // non-deterministic subqueries must be executed for every outer row.
+  if (is_maxmin() || cols() != 1 ||
+      query_expr()->uncacheable != UNCACHEABLE_DEPENDENT)
+    return;
+  if (m_value == nullptr || m_value->data_type() == MYSQL_TYPE_BIT) return;
+  switch (m_value->result_type()) {
+    case INT_RESULT:
+    case REAL_RESULT:
+    case DECIMAL_RESULT:
+      break;
+    default:
+      return;
+  }
+
+  auto *fields =
+      new (thd->mem_root) Mem_root_array<Item_field *>(thd->mem_root);
+  if (fields == nullptr) return;
+
+  const int nest_level = query_expr()->first_query_block()->nest_level;
+  const bool unsupported =
+      WalkItem(this, enum_walk::SUBQUERY_POSTFIX, [&](Item *item) {
+        if (item->type() != FIELD_ITEM && item->type() != REF_ITEM)
+          return false;
+        const Item_ident *ident = down_cast<Item_ident *>(item);
+        if (ident->depended_from == nullptr ||
+            ident->depended_from->nest_level >= nest_level)
+          return false;
+        // Only the values of plain columns can be read from the outer row.
+        // The bits of a BIT column may be stored among the NULL flags.
+        if (item->type() != FIELD_ITEM) return true;
+        Item_field *item_field = down_cast<Item_field *>(item);
+        if (item_field->field == nullptr ||
+            item_field->field->type() == MYSQL_TYPE_BIT)
+          return true;
+        for (Item_field *key_field : *fields) {
+          if (key_field == item_field) return false;
+        }
+        return fields->push_back(item_field);
+      });
+  if (unsupported || fields->empty()) return;
+
+  m_cache_key_fields = fields;
+}
+
+bool Item_singlerow_subselect::exec(THD *thd) {
+  if (m_cache_key_fields == nullptr) return Item_subselect::exec(thd);
+
+  if (m_result_cache == nullptr) {
+    m_result_cache = new (std::nothrow) Scalar_result_cache;
+    if (m_result_cache == nullptr) return Item_subselect::exec(thd);
+  }
+
+  // Equal bytes are equal values, so the key is the outer references' images
+  std::string key;
+  for (const Item_field *item_field : *m_cache_key_fields) {
+    const Field *field = item_field->field;
+    if (field->is_null()) {
+      key.push_back('\0');
+      continue;
+    }
+    const uint32 length = field->data_length();
+    key.push_back('\1');
+    key.append(pointer_cast<const char *>(&length), sizeof(length));
+    key.append(pointer_cast<const char *>(field->data_ptr()), length);
+  }
+
+  const auto it = m_result_cache->results.find(key);
+  if (it != m_result_cache->results.end()) {
+    const Scalar_result_cache::Result &result = it->second;
+    if (!result.has_row) {
+      reset_value_assigned();
+      reset();
+      return false;
+    }
+    set_value_assigned();
+    m_value->null_value = result.null_value;
+    switch (m_value->result_type()) {
+      case INT_RESULT:
+        down_cast<Item_cache_int *>(m_value)->store_value(m_value,
+                                                          result.int_value);
+        break;
+      case REAL_RESULT:
+        down_cast<Item_cache_real *>(m_value)->store_value(m_value,
+                                                           result.real_value);
+        break;
+      default: {
+        assert(m_value->result_type() == DECIMAL_RESULT);
+        my_decimal value(result.decimal_value);
+        down_cast<Item_cache_decimal *>(m_value)->store_value(m_value, &value);
+        break;
+      }
+    }
+    return false;
+  }
+
+  if (Item_subselect::exec(thd)) return true;
+
+  if (m_result_cache->results.size() < Scalar_result_cache::kMaxResults) {
+    Scalar_result_cache::Result result{};
+    result.has_row = is_value_assigned();
+    result.null_value = m_value->null_value;
+    if (result.has_row && !result.null_value) {
+      switch (m_value->result_type()) {
+        case INT_RESULT:
+          result.int_value = m_value->val_int();
+          break;
+        case REAL_RESULT:
+          result.real_value = m_value->val_real();
+          break;
+        default: {
+          const my_decimal *value = m_value->val_decimal(&result.decimal_value);
+          if (value != nullptr && value != &result.decimal_value)
+            result.decimal_value = *value;
+          break;
+        }
+      }
+      result.null_value = m_value->null_value;
+    }
+    m_result_cache->results.emplace(std::move(key), result);
+  }
+  return false;
 }
 
 /**
@@ -69,6 +69,7 @@ class Temp_table_param;
 class my_decimal;
 class subselect_indexsubquery_engine;
 struct AccessPath;
+struct Scalar_result_cache;
 class Table_ref;
 
 template <class T>
@@ -274,6 +275,7 @@ class Item_singlerow_subselect : public Item_subselect {
 
   bool fix_fields(THD *thd, Item **ref) override;
   void cleanup() override;
+  bool exec(THD *thd) override;
   Subquery_type subquery_type() const override { return SCALAR_SUBQUERY; }
   bool create_row(const mem_root_deque<Item *> &item_list, Item_cache **row,
                   bool possibly_empty);
@@ -365,6 +367,20 @@ class Item_singlerow_subselect : public Item_subselect {
   */
   Item_cache **m_row{nullptr};
   bool m_no_rows{false};  ///< @c no_rows_in_result
+
+  /**
+    Collect the outer references of a correlated, deterministic scalar
+    subquery with a numeric result into m_cache_key_fields, if they are all
+    plain columns, so that its results can be cached.
+  */
+  void setup_result_cache(THD *thd);
+  /**
+    Outer references which key m_result_cache. nullptr if the results of
+    this subquery are not cached.
+  */
+  Mem_root_array<Item_field *> *m_cache_key_fields{nullptr};
+  /// Results of earlier executions, for the current statement execution
+  Scalar_result_cache *m_result_cache{nullptr};
 };
 
 /* used in static ALL/ANY optimization */
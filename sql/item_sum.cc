@@ -434,6 +434,46 @@ bool Item_sum::check_wf_semantics1(THD *, Query_block *,
   return false;
 }
 
+/// count, int_value and real_value, followed by the length of the decimal.
+static constexpr size_t kPartialStateHeaderLength = 8 + 8 + 8 + 2;
+
+bool Item_sum_partial_state::serialize(String *to) const {
+  StringBuffer<DECIMAL_MAX_STR_LENGTH + 1> decimal_str;
+  if (my_decimal2string(E_DEC_FATAL_ERROR, &decimal_value, &decimal_str))
+    return true;
+
+  const size_t start = to->length();
+  if (to->reserve(kPartialStateHeaderLength + decimal_str.length()))
+    return true;
+  to->length(start + kPartialStateHeaderLength);
+  char *ptr = to->ptr() + start;
+  int8store(ptr, count);
+  int8store(ptr + 8, static_cast<ulonglong>(int_value));
+  float8store(ptr + 16, real_value);
+  int2store(ptr + 24, static_cast<uint16>(decimal_str.length()));
+  return to->append(decimal_str);
+}
+
+bool Item_sum_partial_state::deserialize(const uchar **from,
+                                         const uchar *end) {
+  const uchar *ptr = *from;
+  if (end - ptr < static_cast<ptrdiff_t>(kPartialStateHeaderLength)) {
+    return true;
+  }
+  count = uint8korr(ptr);
+  int_value = static_cast<longlong>(uint8korr(ptr + 8));
+  real_value = float8get(ptr + 16);
+  const size_t decimal_length = uint2korr(ptr + 24);
+  ptr += kPartialStateHeaderLength;
+  if (static_cast<size_t>(end - ptr) < decimal_length) return true;
+  if (str2my_decimal(E_DEC_FATAL_ERROR, pointer_cast<const char *>(ptr),
+                     decimal_length, &my_charset_latin1, &decimal_value)) {
+    return true;
+  }
+  *from = ptr + decimal_length;
+  return false;
+}
+
 Item_sum::Item_sum(const POS &pos, PT_item_list *opt_list, PT_window *w)
     : Item_func(pos, opt_list), m_window(w) {}
 
@@ -1978,15 +2018,48 @@ bool Item_sum_sum::add() {
                      dec_buffs + curr_dec_buff);
       curr_dec_buff ^= 1;
       null_value = false;
+      m_count++;
     }
   } else {
     sum += aggr->arg_val_real();
     if (current_thd->is_error()) return true;
-    if (!aggr->arg_is_null(true)) null_value = false;
+    if (!aggr->arg_is_null(true)) {
+      null_value = false;
+      m_count++;
+    }
   }
   return false;
 }
 
+bool Item_sum_sum::supports_partial_state() const {
+  return !has_with_distinct() && !m_is_window_function &&
+         (hybrid_type == DECIMAL_RESULT || hybrid_type == REAL_RESULT);
+}
+
+void Item_sum_sum::get_partial_state(Item_sum_partial_state *state) const {
+  assert(supports_partial_state());
+  state->count = m_count;
+  if (hybrid_type == DECIMAL_RESULT) {
+    state->decimal_value = dec_buffs[curr_dec_buff];
+  } else {
+    state->real_value = sum;
+  }
+}
+
+void Item_sum_sum::merge_partial_state(const Item_sum_partial_state &state) {
+  assert(supports_partial_state());
+  if (state.count == 0) return;
+  if (hybrid_type == DECIMAL_RESULT) {
+    my_decimal_add(E_DEC_FATAL_ERROR, dec_buffs + (curr_dec_buff ^ 1),
+                   &state.decimal_value, dec_buffs + curr_dec_buff);
+    curr_dec_buff ^= 1;
+  } else {
+    sum += state.real_value;
+  }
+  m_count += state.count;
+  null_value = false;
+}
+
 longlong Item_sum_sum::val_int() {
   assert(fixed);
   if (m_window != nullptr) {
@@ -2208,6 +2281,20 @@ bool Item_sum_count::add() {
   return current_thd->is_error();
 }
 
+bool Item_sum_count::supports_partial_state() const {
+  return !has_with_distinct() && !m_is_window_function;
+}
+
+void Item_sum_count::get_partial_state(Item_sum_partial_state *state) const {
+  assert(supports_partial_state());
+  state->count = count;
+}
+
+void Item_sum_count::merge_partial_state(const Item_sum_partial_state &state) {
+  assert(supports_partial_state());
+  count += state.count;
+}
+
 longlong Item_sum_count::val_int() {
   DBUG_TRACE;
   assert(fixed);
@@ -2305,9 +2392,8 @@ void Item_sum_avg::clear() { Item_sum_sum::clear(); }
 
 bool Item_sum_avg::add() {
   assert(!m_is_window_function);
-  if (Item_sum_sum::add()) return true;
-  if (!aggr->arg_is_null(true)) m_count++;
-  return false;
+  // Item_sum_sum::add() counts the non-NULL values for us.
+  return Item_sum_sum::add();
 }
 
 double Item_sum_avg::val_real() {
@@ -2800,6 +2886,7 @@ void Item_sum_hybrid::clear() {
   null_value = true;
   m_cnt = 0;
   m_saved_last_value_at = 0;
+  m_value_at = 0;
 }
 
 void Item_sum_hybrid::update_after_wf_arguments_changed(THD *) {
@@ -2837,6 +2924,7 @@ bool Item_sum_hybrid::check_wf_semantics1(THD *thd, Query_block *select,
   if (!m_optimize) {
     r->row_optimizable = false;
     r->range_optimizable = false;
+    r->min_max_slidable = true;
   }
   return result;
 }
@@ -3140,6 +3228,41 @@ static bool min_max_best_so_far(int comparison_result, bool is_min) {
   return is_min ? comparison_result < 0 : comparison_result > 0;
 }
 
+bool Item_sum_hybrid::supports_partial_state() const {
+  // Only integers, whose state is easy to produce and compare without Items.
+  // Temporal values are cached as integers too, but in a packed format.
+  return !m_is_window_function && hybrid_type == INT_RESULT &&
+         args[0]->result_type() == INT_RESULT && !args[0]->is_temporal() &&
+         value->result_type() == INT_RESULT;
+}
+
+void Item_sum_hybrid::get_partial_state(Item_sum_partial_state *state) const {
+  assert(supports_partial_state());
+  state->count = null_value ? 0 : 1;
+  state->int_value = null_value ? 0 : value->val_int();
+}
+
+void Item_sum_hybrid::merge_partial_state(const Item_sum_partial_state &state) {
+  assert(supports_partial_state());
+  if (state.count == 0) return;
+  if (!null_value) {
+    const longlong current = value->val_int();
+    int comparison;
+    if (args[0]->unsigned_flag) {
+      const ulonglong a = static_cast<ulonglong>(state.int_value);
+      const ulonglong b = static_cast<ulonglong>(current);
+      comparison = a < b ? -1 : (a > b ? 1 : 0);
+    } else {
+      comparison = state.int_value < current ? -1
+                                             : (state.int_value > current ? 1
+                                                                          : 0);
+    }
+    if (!min_max_best_so_far(comparison, m_is_min)) return;
+  }
+  down_cast<Item_cache_int *>(value)->store_value(state.int_value);
+  null_value = false;
+}
+
 bool Item_sum_hybrid::add() {
   arg_cache->cache_value();
   if (current_thd->is_error()) {
@@ -3153,6 +3276,7 @@ bool Item_sum_hybrid::add() {
       return true;
     }
     null_value = false;
+    if (m_is_window_function) m_value_at = m_window->rowno_being_visited();
   }
   return false;
 }
@@ -161,6 +161,40 @@ class Aggregator {
   virtual bool arg_is_null(bool use_null_value) = 0;
 };
 
+/**
+  The state of an aggregate function over a subset of its input rows, for
+  aggregating in pieces that are merged afterwards; see
+  Item_sum::merge_partial_state(). Which members are used depends on the
+  function:
+
+  - COUNT: count.
+  - SUM and AVG: count, and the sum in decimal_value or real_value,
+    depending on the result type of the function.
+  - MIN and MAX over integers: count (0 if there were only NULLs), and the
+    minimum or maximum in int_value.
+
+  Since it holds no Items, it can be filled in by code that cannot evaluate
+  Items, e.g. the reader threads of a parallel table scan.
+*/
+struct Item_sum_partial_state {
+  /// The number of non-NULL input values (of input rows, for COUNT(*)).
+  ulonglong count{0};
+  my_decimal decimal_value;
+  double real_value{0.0};
+  longlong int_value{0};
+
+  Item_sum_partial_state() { my_decimal_set_zero(&decimal_value); }
+
+  /// Append the state to "to" as a byte string. Returns true on OOM.
+  bool serialize(String *to) const;
+
+  /**
+    Read a state written by serialize() from [*from, end), and advance *from
+    past it. Returns true if the data is malformed.
+  */
+  bool deserialize(const uchar **from, const uchar *end);
+};
+
 /**
   Class Item_sum is the base class used for special expressions that SQL calls
   'set functions'. These expressions are formed with the help of aggregate
@@ -552,6 +586,30 @@ class Item_sum : public Item_func {
     return aggregator_add();
   }
 
+  /**
+    Whether the function can be computed by merging partial states (see
+    Item_sum_partial_state): the function is not DISTINCT, and not used as a
+    window function, and its subclass implements get_partial_state() and
+    merge_partial_state() for its argument types.
+  */
+  virtual bool supports_partial_state() const { return false; }
+
+  /// Get the state of the function for the rows aggregated so far.
+  virtual void get_partial_state(Item_sum_partial_state *state
+                                 [[maybe_unused]]) const {
+    assert(false);
+  }
+
+  /**
+    Combine the state of the function for another set of rows into the
+    current state, as if that set had been aggregated by this item too.
+    Usually called after clear(), with one state per subset of the rows.
+  */
+  virtual void merge_partial_state(const Item_sum_partial_state &state
+                                   [[maybe_unused]]) {
+    assert(false);
+  }
+
   /*
     Called when new group is started and results are being saved in
     a temporary table. Similarly to reset_and_add() it resets the
@@ -1058,6 +1116,9 @@ class Item_sum_sum : public Item_sum_num {
   void no_rows_in_result() override;
   void reset_field() override;
   void update_field() override;
+  bool supports_partial_state() const override;
+  void get_partial_state(Item_sum_partial_state *state) const override;
+  void merge_partial_state(const Item_sum_partial_state &state) override;
   const char *func_name() const override { return "sum"; }
   Item *copy_or_same(THD *thd) override;
 };
@@ -1108,6 +1169,9 @@ class Item_sum_count : public Item_sum_int {
   longlong val_int() override;
   void reset_field() override;
   void update_field() override;
+  bool supports_partial_state() const override;
+  void get_partial_state(Item_sum_partial_state *state) const override;
+  void merge_partial_state(const Item_sum_partial_state &state) override;
   const char *func_name() const override { return "count"; }
   Item *copy_or_same(THD *thd) override;
 };
@@ -1585,6 +1649,14 @@ class Item_sum_hybrid : public Item_sum {
   */
   int64 m_saved_last_value_at;
 
+  /**
+    Execution state: when evaluating a window function without m_optimize,
+    the row number in the partition of the row which provided the current
+    value. Lets the value be kept while that row stays in a moving frame,
+    cf. Window::can_slide_min_max().
+  */
+  int64 m_value_at;
+
   /**
     This function implements the optimized version of retrieving min/max
     value. When we have "ordered ASC" results in a window, min will always
@@ -1627,7 +1699,8 @@ class Item_sum_hybrid : public Item_sum {
         m_optimize(false),
         m_want_first(false),
         m_cnt(0),
-        m_saved_last_value_at(0) {
+        m_saved_last_value_at(0),
+        m_value_at(0) {
     collation.set(&my_charset_bin);
   }
 
@@ -1643,7 +1716,8 @@ class Item_sum_hybrid : public Item_sum {
         m_optimize(false),
         m_want_first(false),
         m_cnt(0),
-        m_saved_last_value_at(0) {
+        m_saved_last_value_at(0),
+        m_value_at(0) {
     collation.set(&my_charset_bin);
   }
 
@@ -1658,7 +1732,8 @@ class Item_sum_hybrid : public Item_sum {
         m_optimize(item->m_optimize),
         m_want_first(item->m_want_first),
         m_cnt(item->m_cnt),
-        m_saved_last_value_at(0) {}
+        m_saved_last_value_at(0),
+        m_value_at(0) {}
 
  public:
   bool fix_fields(THD *, Item **) override;
@@ -1685,10 +1760,15 @@ class Item_sum_hybrid : public Item_sum {
   void update_field() override;
   void cleanup() override;
   bool has_values() { return m_has_values; }
+  /// See #m_value_at
+  int64 value_at() const { return m_value_at; }
   void no_rows_in_result() override;
   Field *create_tmp_field(bool group, TABLE *table) override;
   bool uses_only_one_row() const override { return m_optimize; }
   bool add() override;
+  bool supports_partial_state() const override;
+  void get_partial_state(Item_sum_partial_state *state) const override;
+  void merge_partial_state(const Item_sum_partial_state &state) override;
   Item *copy_or_same(THD *thd) override;
   bool check_wf_semantics1(THD *thd, Query_block *select,
                            Window_evaluation_requirements *r) override;
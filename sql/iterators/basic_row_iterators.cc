@@ -41,6 +41,7 @@
 #include "mysqld_error.h"
 #include "sql/debug_sync.h"
 #include "sql/handler.h"
+#include "sql/iterators/row_batch.h"
 #include "sql/iterators/row_iterator.h"
 #include "sql/mem_root_array.h"
 #include "sql/range_optimizer/range_optimizer.h"
@@ -349,6 +350,22 @@ int TableScanIterator::Read() {
   return 0;
 }
 
+int TableScanIterator::ReadBatch(RowBatch *batch) {
+  // Same as the default implementation, but the calls to Read() are not
+  // virtual, so the loop over the handler stays tight.
+  batch->Clear();
+  while (!batch->full()) {
+    const int err = TableScanIterator::Read();
+    if (err == 1) return 1;
+    if (err == -1) {
+      batch->set_eof();
+      break;
+    }
+    batch->AppendFromTableBuffers();
+  }
+  return batch->num_selected() == 0 ? -1 : 0;
+}
+
 ZeroRowsIterator::ZeroRowsIterator(THD *thd,
                                    Mem_root_array<TABLE *> pruned_tables)
     : RowIterator(thd), m_pruned_tables(std::move(pruned_tables)) {}
@@ -512,3 +529,9 @@ bool FollowTailIterator::RepositionCursorAfterSpillToDisk() {
   }
   return reposition_innodb_cursor(table(), m_read_rows);
 }
+
+bool FollowTailIterator::ReadAllStoredRows() const {
+  // A cursor which is not open belongs to an earlier materialization, or
+  // this one has not read anything yet; m_read_rows is then stale.
+  return m_inited && table()->file->inited && m_read_rows == *m_stored_rows;
+}
@@ -74,6 +74,7 @@ class TableScanIterator final : public TableRowIterator {
 
   bool Init() override;
   int Read() override;
+  int ReadBatch(RowBatch *batch) override;
 
  private:
   uchar *const m_record;
@@ -497,6 +498,14 @@ class FollowTailIterator final : public TableRowIterator {
    */
   bool RepositionCursorAfterSpillToDisk();
 
+  /**
+    Returns true if this materialization has started reading, and all rows
+    stored so far have been read. A new pass over the recursive query block
+    would then find no new rows to join with, and produce nothing.
+    Called by MaterializeIterator::MaterializeRecursive().
+   */
+  bool ReadAllStoredRows() const;
+
  private:
   bool m_inited = false;
   uchar *const m_record;
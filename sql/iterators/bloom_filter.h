@@ -0,0 +1,128 @@
+#ifndef SQL_ITERATORS_BLOOM_FILTER_H_
+#define SQL_ITERATORS_BLOOM_FILTER_H_
+
+
+/* Copyright (c) 2023, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+/**
+  @file
+
+  A Bloom filter over 64-bit hash values, used by HashJoinIterator as a
+  runtime join filter: the build phase inserts the hash of every join key,
+  and the probe phase can then discard most probe rows that have no match
+  without looking them up in the hash table, and without writing them to
+  chunk files if the join has spilled to disk.
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <memory>
+#include <new>
+
+/**
+  A register-blocked Bloom filter: each key sets (and each lookup tests) four
+  bits within a single 64-bit word, so that a lookup touches one cache line
+  and needs no loop. This has a somewhat higher false positive rate than a
+  classic Bloom filter with the same number of bits, which we compensate for
+  by using 16 bits per key (giving a false positive rate of about 0.5%).
+
+  The hash values must be well mixed in all bits; the word is chosen from the
+  upper 32 bits, and the bit positions from the lower 24 bits.
+ */
+class BloomFilter {
+ public:
+  static constexpr size_t kBitsPerKey = 16;
+
+  /**
+    Allocate a filter sized for the given number of keys, and clear it.
+    If the filter is already large enough, it is only cleared.
+
+    @returns true on OOM, in which case the filter is left unusable.
+   */
+  bool Init(size_t num_keys) {
+    const size_t num_words =
+        std::max<size_t>(1, (num_keys * kBitsPerKey + 63) / 64);
+    if (num_words > m_capacity_words) {
+      m_words.reset(new (std::nothrow) uint64_t[num_words]);
+      if (m_words == nullptr) {
+        m_capacity_words = m_num_words = 0;
+        return true;
+      }
+      m_capacity_words = num_words;
+    }
+    m_num_words = num_words;
+    m_num_keys = num_keys;
+    std::fill_n(m_words.get(), m_num_words, 0);
+    m_num_inserted = 0;
+    return false;
+  }
+
+  bool initialized() const { return m_num_words > 0; }
+
+  void Insert(uint64_t hash) {
+    assert(initialized());
+    m_words[WordFor(hash)] |= BitsFor(hash);
+    ++m_num_inserted;
+  }
+
+  /// Returns false if the key with the given hash was definitely not
+  /// inserted.
+  bool MayContain(uint64_t hash) const {
+    assert(initialized());
+    const uint64_t bits = BitsFor(hash);
+    return (m_words[WordFor(hash)] & bits) == bits;
+  }
+
+  /**
+    Whether more keys have been inserted than the filter was sized for, so
+    that the false positive rate is too high for the filter to be useful.
+    Duplicate keys are counted every time they are inserted.
+   */
+  bool overfull() const { return m_num_inserted > 2 * m_num_keys; }
+
+  /// Memory used by the filter, in bytes.
+  size_t num_bytes() const { return m_num_words * sizeof(uint64_t); }
+
+ private:
+  size_t WordFor(uint64_t hash) const {
+    // Maps the upper 32 bits to [0, m_num_words) without a division.
+    return ((hash >> 32) * m_num_words) >> 32;
+  }
+
+  static uint64_t BitsFor(uint64_t hash) {
+    return (uint64_t{1} << (hash & 63)) | (uint64_t{1} << ((hash >> 6) & 63)) |
+           (uint64_t{1} << ((hash >> 12) & 63)) |
+           (uint64_t{1} << ((hash >> 18) & 63));
+  }
+
+  std::unique_ptr<uint64_t[]> m_words;
+  size_t m_capacity_words{0};
+  size_t m_num_words{0};
+  size_t m_num_keys{0};
+  size_t m_num_inserted{0};
+};
+
+#endif  // SQL_ITERATORS_BLOOM_FILTER_H_
@@ -49,11 +49,13 @@
 #include "sql/handler.h"
 #include "sql/immutable_string.h"
 #include "sql/item.h"
+#include "sql/item_cmpfunc.h"
 #include "sql/item_func.h"
 #include "sql/item_sum.h"
 #include "sql/iterators/basic_row_iterators.h"
 #include "sql/iterators/hash_join_buffer.h"
 #include "sql/iterators/hash_join_iterator.h"
+#include "sql/iterators/row_batch.h"
 #include "sql/iterators/timing_iterator.h"
 #include "sql/join_optimizer/access_path.h"
 #include "sql/join_optimizer/materialize_path_parameters.h"
@@ -109,6 +111,96 @@ int FilterIterator::Read() {
   }
 }
 
+bool FilterIterator::SetupBatchColumns(RowBatch *batch, int *columns) {
+  if (m_batch_filter->predicates.size() > RowBatch::kMaxColumns) return false;
+  for (size_t i = 0; i < m_batch_filter->predicates.size(); ++i) {
+    const Batch_int_predicate *predicate = m_batch_filter->predicates[i];
+    columns[i] =
+        batch->AddColumn(predicate->column(), predicate->column_as_date());
+    if (columns[i] < 0) return false;
+  }
+  return true;
+}
+
+void FilterIterator::ApplyBatchPredicates(RowBatch *batch,
+                                          const int *columns) const {
+  uchar *matches = batch->match_buffer();
+  for (size_t i = 0; i < m_batch_filter->predicates.size(); ++i) {
+    if (batch->num_selected() == 0) return;
+    m_batch_filter->predicates[i]->Evaluate(batch->column_values(columns[i]),
+                                            batch->column_nulls(columns[i]),
+                                            batch->num_rows(), matches);
+    size_t num_matched = 0;
+    for (size_t j = 0; j < batch->num_selected(); ++j) {
+      const uint16_t row = batch->selected_row(j);
+      if (matches[row]) batch->set_selected_row(num_matched++, row);
+    }
+    batch->TruncateSelection(num_matched);
+  }
+}
+
+int FilterIterator::ReadBatch(RowBatch *batch) {
+  // If possible, evaluate the simple predicates on entire batches, and only
+  // the rest of the condition on each row.
+  int columns[RowBatch::kMaxColumns];
+  const bool use_batch_filter =
+      m_batch_filter != nullptr && SetupBatchColumns(batch, columns);
+  if (use_batch_filter && !m_batch_constants_evaluated) {
+    for (Batch_int_predicate *predicate : m_batch_filter->predicates) {
+      if (predicate->EvaluateConstants(thd())) return 1;
+    }
+    m_batch_constants_evaluated = true;
+  }
+  Item *condition =
+      use_batch_filter ? m_batch_filter->residual_condition : m_condition;
+
+  for (;;) {
+    int err = m_source->ReadBatch(batch);
+    if (err != 0) return err;
+
+    if (use_batch_filter) {
+      ApplyBatchPredicates(batch, columns);
+      if (thd()->killed) {
+        thd()->send_kill_message();
+        return 1;
+      }
+    }
+
+    // Evaluate the condition on each row, and compact the selection vector
+    // to the rows that matched. Batch mode is never used for locking reads,
+    // so there is no need for UnlockRow() on the rows that did not.
+    if (condition != nullptr) {
+      size_t num_matched = 0;
+      for (size_t i = 0; i < batch->num_selected(); ++i) {
+        const uint16_t row = batch->selected_row(i);
+        batch->LoadRow(row);
+
+        bool matched = condition->val_int();
+
+        if (thd()->killed) {
+          thd()->send_kill_message();
+          return 1;
+        }
+
+        /* check for errors evaluating the condition */
+        if (thd()->is_error()) return 1;
+
+        if (matched) {
+          batch->set_selected_row(num_matched++, row);
+        }
+      }
+      batch->TruncateSelection(num_matched);
+    }
+
+    if (batch->num_selected() > 0) return 0;
+    if (batch->eof()) return -1;
+
+    // Nothing matched; read another batch. Our source expects to see its
+    // last row in the table buffers.
+    batch->LoadLastRow();
+  }
+}
+
 bool LimitOffsetIterator::Init() {
   if (m_source->Init()) {
     return true;
@@ -216,7 +308,7 @@ bool AggregateIterator::Init() {
     m_first_row_next_group.length(0);
   }
 
-  if (m_source->Init()) {
+  if (m_source->Init() || m_source_reader.Init(thd(), m_source.get())) {
     return true;
   }
 
@@ -251,7 +343,7 @@ int AggregateIterator::Read() {
     case READING_FIRST_ROW: {
       // Start the first group, if possible. (If we're not at the first row,
       // we already saw the first row in the new group at the previous Read().)
-      int err = m_source->Read();
+      int err = m_source_reader.Read();
       if (err == -1) {
         m_seen_eof = true;
         m_state = DONE_OUTPUTTING_ROWS;
@@ -323,7 +415,7 @@ int AggregateIterator::Read() {
 
       // Keep reading rows as long as they are part of the existing group.
       for (;;) {
-        int err = m_source->Read();
+        int err = m_source_reader.Read();
         if (err == 1) return 1;  // Error.
 
         if (err == -1) {
@@ -1168,6 +1260,10 @@ bool MaterializeIterator<Profiler>::MaterializeRecursive() {
     last_stored_rows = stored_rows;
     for (const materialize_iterator::Operand &operand : m_operands) {
       if (operand.is_recursive_reference) {
+        // The recursive reference drives its query block, so if it has no
+        // new rows, neither has the query block. Skipping it saves setting
+        // up its joins again, e.g. building hash tables, in the last pass.
+        if (operand.recursive_reader->ReadAllStoredRows()) continue;
         if (MaterializeOperand(operand, &stored_rows)) return true;
       }
     }
@@ -58,6 +58,7 @@
 #include "sql/iterators/hash_join_buffer.h"
 #include "sql/iterators/hash_join_chunk.h"
 #include "sql/iterators/hash_join_iterator.h"
+#include "sql/iterators/row_batch.h"
 #include "sql/iterators/row_iterator.h"
 #include "sql/join_type.h"
 #include "sql/mem_root_array.h"
@@ -66,6 +67,7 @@
 #include "sql_string.h"
 
 #include "extra/robin-hood-hashing/robin_hood.h"
+struct Batch_filter;
 class Cached_item;
 class FollowTailIterator;
 class Item;
@@ -86,13 +88,28 @@ struct TABLE;
  */
 class FilterIterator final : public RowIterator {
  public:
+  /**
+    @param thd Thread context
+    @param source Row source
+    @param condition The condition rows must satisfy.
+    @param batch_filter If not nullptr, "condition" split into predicates
+      that are evaluated on entire batches and the rest. Only used by
+      ReadBatch(); Read() always evaluates "condition".
+   */
   FilterIterator(THD *thd, unique_ptr_destroy_only<RowIterator> source,
-                 Item *condition)
-      : RowIterator(thd), m_source(std::move(source)), m_condition(condition) {}
+                 Item *condition, const Batch_filter *batch_filter = nullptr)
+      : RowIterator(thd),
+        m_source(std::move(source)),
+        m_condition(condition),
+        m_batch_filter(batch_filter) {}
 
-  bool Init() override { return m_source->Init(); }
+  bool Init() override {
+    m_batch_constants_evaluated = false;
+    return m_source->Init();
+  }
 
   int Read() override;
+  int ReadBatch(RowBatch *batch) override;
 
   void SetNullRowFlag(bool is_null_row) override {
     m_source->SetNullRowFlag(is_null_row);
@@ -105,8 +122,24 @@ class FilterIterator final : public RowIterator {
   void UnlockRow() override { m_source->UnlockRow(); }
 
  private:
+  /**
+    Set up value columns in "batch" for the predicates in m_batch_filter.
+    Returns false (and leaves "columns" undefined) if the batch has no room
+    for them, in which case the condition is evaluated row by row.
+   */
+  bool SetupBatchColumns(RowBatch *batch, int *columns);
+
+  /// Remove the rows that do not satisfy m_batch_filter's predicates from
+  /// the batch's selection.
+  void ApplyBatchPredicates(RowBatch *batch, const int *columns) const;
+
   unique_ptr_destroy_only<RowIterator> m_source;
   Item *m_condition;
+  const Batch_filter *m_batch_filter;
+
+  /// Whether the constants in m_batch_filter have been evaluated since the
+  /// last Init().
+  bool m_batch_constants_evaluated{false};
 };
 
 /**
@@ -290,6 +323,9 @@ class AggregateIterator final : public RowIterator {
    */
   pack_rows::TableCollection m_tables;
 
+  /// Reads from m_source, in batches if batch mode is enabled.
+  RowBatchReader m_source_reader{m_tables};
+
   /// Packed version of the first row in the group we are currently processing.
   String m_first_row_this_group;
 
@@ -23,10 +23,21 @@
 #include "sql/iterators/hash_join_buffer.h"
 
 #include <algorithm>
+#include <bit>
 #include <cstdint>
-#include <stdexcept>
+#include <cstring>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <tuple>
 #include <utility>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #include "my_alloc.h"
 #include "my_compiler.h"
 #include "my_inttypes.h"
@@ -93,6 +104,153 @@ LinkedImmutableString StoreLinkedImmutableStringFromTableBuffers(
 
 namespace hash_join_buffer {
 
+namespace {
+
+// Match a byte against all the control words of a group. Each slot
+// corresponds to kMaskBitsPerSlot bits of the returned mask, of which the
+// lowest one is set if the slot matches and the others are always zero.
+#if defined(__SSE2__)
+constexpr int kMaskBitsPerSlot = 1;
+
+inline uint64_t MatchControlByte(const uint8_t *group, uint8_t byte) {
+  const __m128i control =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+  const __m128i matches =
+      _mm_cmpeq_epi8(control, _mm_set1_epi8(static_cast<char>(byte)));
+  return static_cast<uint32_t>(_mm_movemask_epi8(matches));
+}
+#elif defined(__ARM_NEON)
+constexpr int kMaskBitsPerSlot = 4;
+
+inline uint64_t MatchControlByte(const uint8_t *group, uint8_t byte) {
+  const uint8x16_t matches = vceqq_u8(vld1q_u8(group), vdupq_n_u8(byte));
+  // NEON has no movemask; narrowing each 16-bit lane by four bits gives one
+  // nibble per slot.
+  const uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+  return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) &
+         0x1111111111111111ULL;
+}
+#else
+constexpr int kMaskBitsPerSlot = 1;
+
+inline uint64_t MatchControlByte(const uint8_t *group, uint8_t byte) {
+  uint64_t mask = 0;
+  for (int i = 0; i < 16; ++i) {
+    mask |= uint64_t{group[i] == byte} << i;
+  }
+  return mask;
+}
+#endif
+
+inline size_t FirstMatch(uint64_t mask) {
+  return std::countr_zero(mask) / kMaskBitsPerSlot;
+}
+
+inline uint8_t TagForHash(uint64_t hash) { return hash & 0x7f; }
+
+}  // namespace
+
+HashJoinHashTable::~HashJoinHashTable() { my_free(m_control); }
+
+size_t HashJoinHashTable::BytesForEntries(size_t num_entries) {
+  size_t capacity = kGroupSize;
+  while (MaxEntriesForCapacity(capacity) < num_entries) capacity *= 2;
+  return BytesForCapacity(capacity);
+}
+
+std::pair<size_t, bool> HashJoinHashTable::FindSlot(uint64_t hash,
+                                                    const Key &key) const {
+  assert(m_capacity > 0);
+  const uint8_t tag = TagForHash(hash);
+
+  // Linear probing, one group at a time. The load factor guarantees that
+  // there is an empty slot somewhere, which ends the probe.
+  const size_t group_mask = m_capacity / kGroupSize - 1;
+  for (size_t group = (hash >> 7) & group_mask;;
+       group = (group + 1) & group_mask) {
+    const size_t base = group * kGroupSize;
+    const uint8_t *control = m_control + base;
+    for (uint64_t mask = MatchControlByte(control, tag); mask != 0;
+         mask &= mask - 1) {
+      const size_t slot = base + FirstMatch(mask);
+      if (m_entries[slot].key.Decode() == key) return {slot, true};
+    }
+    const uint64_t empty = MatchControlByte(control, kEmpty);
+    if (empty != 0) return {base + FirstMatch(empty), false};
+  }
+}
+
+size_t HashJoinHashTable::FindEmptySlot(uint64_t hash) const {
+  const size_t group_mask = m_capacity / kGroupSize - 1;
+  for (size_t group = (hash >> 7) & group_mask;;
+       group = (group + 1) & group_mask) {
+    const size_t base = group * kGroupSize;
+    const uint64_t empty = MatchControlByte(m_control + base, kEmpty);
+    if (empty != 0) return base + FirstMatch(empty);
+  }
+}
+
+bool HashJoinHashTable::Rehash(size_t new_capacity) {
+  assert(new_capacity >= kGroupSize && std::has_single_bit(new_capacity));
+  uint8_t *new_control = static_cast<uint8_t *>(my_malloc(
+      key_memory_hash_op, BytesForCapacity(new_capacity), MYF(0)));
+  if (new_control == nullptr) return true;
+  memset(new_control, kEmpty, new_capacity);
+
+  uint8_t *old_control = m_control;
+  Entry *old_entries = m_entries;
+  const size_t old_capacity = m_capacity;
+  m_control = new_control;
+  m_entries = reinterpret_cast<Entry *>(new_control + new_capacity);
+  m_capacity = new_capacity;
+
+  // All keys are distinct, so each entry just goes into the first empty slot
+  // of its probe sequence.
+  for (size_t i = 0; i < old_capacity; ++i) {
+    if (old_control[i] == kEmpty) continue;
+    const size_t slot = FindEmptySlot(KeyHasher()(old_entries[i].key));
+    m_control[slot] = old_control[i];
+    m_entries[slot] = old_entries[i];
+  }
+  my_free(old_control);
+  return false;
+}
+
+std::pair<HashJoinHashTable::Entry *, bool> HashJoinHashTable::emplace(
+    ImmutableStringWithLength key) {
+  const Key decoded = key.Decode();
+  const uint64_t hash = KeyHasher()(decoded);
+  size_t slot = 0;
+  if (m_capacity > 0) {
+    bool found;
+    std::tie(slot, found) = FindSlot(hash, decoded);
+    if (found) return {&m_entries[slot], false};
+  }
+  if (m_size >= MaxEntriesForCapacity(m_capacity)) {
+    if (Rehash(std::max(m_capacity * 2, kGroupSize))) return {nullptr, false};
+    slot = FindEmptySlot(hash);
+  }
+  m_control[slot] = TagForHash(hash);
+  Entry &entry = m_entries[slot];
+  entry.key = key;
+  entry.value = LinkedImmutableString{nullptr};
+  ++m_size;
+  return {&entry, true};
+}
+
+const HashJoinHashTable::Entry *HashJoinHashTable::find(const Key &key) const {
+  if (m_size == 0) return nullptr;
+  const auto [slot, found] = FindSlot(KeyHasher()(key), key);
+  return found ? &m_entries[slot] : nullptr;
+}
+
+const HashJoinHashTable::Entry *HashJoinHashTable::first() const {
+  for (size_t i = 0; i < m_capacity; ++i) {
+    if (m_control[i] != kEmpty) return &m_entries[i];
+  }
+  return nullptr;
+}
+
 LinkedImmutableString
 HashJoinRowBuffer::StoreLinkedImmutableStringFromTableBuffers(
     LinkedImmutableString next_ptr, bool *full) {
@@ -117,12 +275,13 @@ void LoadImmutableStringIntoTableBuffers(const TableCollection &tables,
 
 HashJoinRowBuffer::HashJoinRowBuffer(
     TableCollection tables, std::vector<HashJoinCondition> join_conditions,
-    size_t max_mem_available)
+    size_t max_mem_available, uint num_partitions)
     : m_join_conditions(std::move(join_conditions)),
       m_tables(std::move(tables)),
       m_mem_root(key_memory_hash_op, 16384 /* 16 kB */),
       m_overflow_mem_root(key_memory_hash_op, 256),
       m_hash_map(nullptr),
+      m_num_partitions(std::max(num_partitions, 1U)),
       m_max_mem_available(
           std::max<size_t>(max_mem_available, 16384 /* 16 kB */)) {
   // Limit is being applied only after the first row.
@@ -130,10 +289,14 @@ HashJoinRowBuffer::HashJoinRowBuffer(
 }
 
 bool HashJoinRowBuffer::Init() {
-  if (m_hash_map.get() != nullptr) {
+  if (Initialized()) {
     // Reset the unique_ptr, so that the hash map destructors are called before
     // clearing the MEM_ROOT.
     m_hash_map.reset(nullptr);
+    m_partitions.clear();
+    m_pending_rows.clear();
+    m_num_pending_rows = 0;
+    m_num_partitioned_keys = 0;
     m_mem_root.Clear();
     // Limit is being applied only after the first row.
     m_mem_root.set_max_capacity(0);
@@ -147,17 +310,189 @@ bool HashJoinRowBuffer::Init() {
   // table.
   m_row_size_upper_bound = ComputeRowSizeUpperBound(m_tables);
 
-  m_hash_map.reset(new hash_map_type(
-      /*bucket_count=*/10, KeyHasher()));
-  if (m_hash_map == nullptr) {
-    my_error(ER_OUTOFMEMORY, MYF(ME_FATALERROR), sizeof(hash_map_type));
-    return true;
+  // Partitioning only makes sense if there is a key to partition on.
+  if (m_num_partitions > 1 && !m_join_conditions.empty()) {
+    try {
+      m_pending_rows.resize(m_num_partitions);
+      for (uint i = 0; i < m_num_partitions; ++i) {
+        m_partitions.emplace_back(new hash_map_type());
+      }
+    } catch (const std::bad_alloc &) {
+      m_partitions.clear();
+      m_pending_rows.clear();
+      my_error(ER_OUTOFMEMORY, MYF(ME_FATALERROR),
+               m_num_partitions * sizeof(hash_map_type));
+      return true;
+    }
+  } else {
+    m_hash_map.reset(new hash_map_type());
+    if (m_hash_map == nullptr) {
+      my_error(ER_OUTOFMEMORY, MYF(ME_FATALERROR), sizeof(hash_map_type));
+      return true;
+    }
   }
 
   m_last_row_stored = LinkedImmutableString{nullptr};
   return false;
 }
 
+size_t HashJoinRowBuffer::size() const {
+  if (m_partitions.empty()) return m_hash_map->size();
+  return m_num_partitioned_keys + m_num_pending_rows;
+}
+
+LinkedImmutableString HashJoinRowBuffer::first() const {
+  assert(m_num_pending_rows == 0);
+  if (m_partitions.empty()) {
+    return m_hash_map->empty() ? LinkedImmutableString{nullptr}
+                               : m_hash_map->first()->value;
+  }
+  for (const std::unique_ptr<hash_map_type> &partition : m_partitions) {
+    if (!partition->empty()) return partition->first()->value;
+  }
+  return LinkedImmutableString{nullptr};
+}
+
+StoreRowResult HashJoinRowBuffer::StagePendingRow() {
+  bool full = false;
+  const size_t key_bytes =
+      ImmutableStringWithLength::RequiredBytesForEncode(m_buffer.length());
+  const size_t header_bytes = LinkedImmutableString::RequiredBytesForEncode(0);
+  if (m_tables.has_blob_column()) {
+    // The row size upper bound can have changed.
+    m_row_size_upper_bound = ComputeRowSizeUpperBound(m_tables);
+  }
+  const size_t required_bytes =
+      key_bytes + header_bytes + m_row_size_upper_bound;
+
+  // The key and row are stored together, the same way as
+  // StoreLinkedImmutableStringFromTableBuffers() stores rows.
+  std::pair<char *, char *> block = m_mem_root.Peek();
+  if (static_cast<size_t>(block.second - block.first) < required_bytes) {
+    // No room in this block; ask for a new one and try again.
+    m_mem_root.ForceNewBlock(required_bytes);
+    block = m_mem_root.Peek();
+  }
+  bool committed = false;
+  char *start;
+  if (static_cast<size_t>(block.second - block.first) >= required_bytes) {
+    start = block.first;
+  } else {
+    start = pointer_cast<char *>(m_overflow_mem_root.Alloc(required_bytes));
+    if (start == nullptr) {
+      return StoreRowResult::FATAL_ERROR;
+    }
+    committed = true;
+    full = true;
+  }
+
+  char *dptr = start;
+  PendingRow pending_row;
+  pending_row.key = ImmutableStringWithLength::Encode(
+      m_buffer.ptr(), m_buffer.length(), &dptr);
+  pending_row.data = dptr + header_bytes;
+  char *end = pointer_cast<char *>(StoreFromTableBuffersRaw(
+      m_tables, pointer_cast<uchar *>(pending_row.data)));
+  if (!committed) {
+    m_mem_root.RawCommit(end - start);
+  }
+
+  // Until the row is inserted, give it a header without a “next” pointer,
+  // so that LastRowStored() can be used.
+  m_last_row_stored = LinkedImmutableString::EncodeHeaderBefore(
+      LinkedImmutableString{nullptr}, pending_row.data);
+
+  const size_t partition =
+      PartitionFor(Key(m_buffer.ptr(), m_buffer.length()));
+  try {
+    m_pending_rows[partition].push_back(pending_row);
+  } catch (const std::bad_alloc &) {
+    return StoreRowResult::FATAL_ERROR;
+  }
+  ++m_num_pending_rows;
+  m_last_pending_partition = partition;
+
+  // Estimate the memory that the hash maps will need once all the rows are
+  // inserted, assuming that all keys are distinct.
+  const size_t num_rows = m_num_partitioned_keys + m_num_pending_rows;
+  const size_t estimated_map_bytes =
+      hash_map_type::BytesForEntries(num_rows) +
+      m_num_pending_rows * sizeof(PendingRow);
+  if (estimated_map_bytes >= m_max_mem_available) {
+    // 0 means no limit, so set the minimum possible limit.
+    m_mem_root.set_max_capacity(1);
+    full = true;
+  } else {
+    m_mem_root.set_max_capacity(m_max_mem_available - estimated_map_bytes);
+  }
+
+  return full ? StoreRowResult::BUFFER_FULL : StoreRowResult::ROW_STORED;
+}
+
+bool HashJoinRowBuffer::InsertPendingRows(size_t partition,
+                                          bool reject_duplicate_keys) {
+  hash_map_type &hash_map = *m_partitions[partition];
+  for (PendingRow &pending_row : m_pending_rows[partition]) {
+    const auto [entry, inserted] = hash_map.emplace(pending_row.key);
+    if (entry == nullptr) return true;
+    if (!inserted && reject_duplicate_keys) continue;
+
+    // As in StoreRow(), the new row goes first in the chain.
+    entry->value = pending_row.row = LinkedImmutableString::EncodeHeaderBefore(
+        entry->value, pending_row.data);
+  }
+  return false;
+}
+
+bool HashJoinRowBuffer::Finalize(bool reject_duplicate_keys) {
+  if (m_num_pending_rows == 0) return false;
+
+  // Starting a thread costs about as much as inserting a few thousand rows,
+  // so only use worker threads if there is a fair amount of work for each.
+  static constexpr size_t kMinRowsPerBuildThread = 16384;
+  std::vector<char> errors(m_partitions.size(), false);
+  if (m_num_pending_rows < kMinRowsPerBuildThread * m_partitions.size()) {
+    for (size_t i = 0; i < m_partitions.size(); ++i) {
+      errors[i] = InsertPendingRows(i, reject_duplicate_keys);
+    }
+  } else {
+    // The workers only touch their own partition and its pending rows, so
+    // they need no synchronization beyond the join. This thread takes care of
+    // the first partition. If a thread cannot be started, its partition is
+    // inserted by this thread instead.
+    std::vector<std::thread> workers;
+    workers.reserve(m_partitions.size() - 1);
+    for (size_t i = 1; i < m_partitions.size(); ++i) {
+      try {
+        workers.emplace_back([this, i, reject_duplicate_keys, &errors] {
+          errors[i] = InsertPendingRows(i, reject_duplicate_keys);
+        });
+      } catch (const std::system_error &) {
+        errors[i] = InsertPendingRows(i, reject_duplicate_keys);
+      }
+    }
+    errors[0] = InsertPendingRows(0, reject_duplicate_keys);
+    for (std::thread &worker : workers) worker.join();
+  }
+  if (std::any_of(errors.begin(), errors.end(),
+                  [](char error) { return error; })) {
+    return true;
+  }
+
+  // Inserting the last row may have moved its header. (If it was rejected as
+  // a duplicate, it kept the header given by StagePendingRow().)
+  const PendingRow &last_row = m_pending_rows[m_last_pending_partition].back();
+  if (last_row.row != nullptr) m_last_row_stored = last_row.row;
+
+  m_num_partitioned_keys = 0;
+  for (size_t i = 0; i < m_partitions.size(); ++i) {
+    m_num_partitioned_keys += m_partitions[i]->size();
+    m_pending_rows[i].clear();
+  }
+  m_num_pending_rows = 0;
+  return false;
+}
+
 StoreRowResult HashJoinRowBuffer::StoreRow(THD *thd,
                                            bool reject_duplicate_keys) {
   bool full = false;
@@ -185,6 +520,14 @@ StoreRowResult HashJoinRowBuffer::StoreRow(THD *thd,
     }
   }
 
+  if (m_bloom_filter != nullptr) {
+    m_bloom_filter->Insert(KeyHasher()(Key(m_buffer.ptr(), m_buffer.length())));
+  }
+
+  if (!m_partitions.empty()) {
+    return StagePendingRow();
+  }
+
   // Store the key in the MEM_ROOT. Note that we will only commit the memory
   // usage for it if the key was a new one (see the call to emplace() below)..
   const size_t required_key_bytes =
@@ -215,22 +558,17 @@ StoreRowResult HashJoinRowBuffer::StoreRow(THD *thd,
     // Keep bytes_to_commit == 0; the value is already committed.
   }
 
-  std::pair<hash_map_type::iterator, bool> key_it_and_inserted;
-  try {
-    key_it_and_inserted =
-        m_hash_map->emplace(key, LinkedImmutableString{nullptr});
-  } catch (const std::overflow_error &) {
-    // This can only happen if the hash function is extremely bad
-    // (should never happen in practice).
+  const auto [entry, inserted] = m_hash_map->emplace(key);
+  if (entry == nullptr) {
     return StoreRowResult::FATAL_ERROR;
   }
   LinkedImmutableString next_ptr{nullptr};
-  if (key_it_and_inserted.second) {
+  if (inserted) {
     // We inserted an element, so the hash table may have grown.
     // Update the capacity available for the MEM_ROOT; our total may
     // have gone slightly over already, and if so, we will signal
     // that and immediately start spilling to disk.
-    size_t bytes_used = m_hash_map->calcNumBytesTotal(m_hash_map->mask() + 1);
+    size_t bytes_used = m_hash_map->num_bytes();
     if (bytes_used >= m_max_mem_available) {
       // 0 means no limit, so set the minimum possible limit.
       m_mem_root.set_max_capacity(1);
@@ -248,11 +586,11 @@ StoreRowResult HashJoinRowBuffer::StoreRow(THD *thd,
     // We already have another element with the same key, so our insert
     // failed, Put the new value in the hash bucket, but keep track of
     // what the old one was; it will be our “next” pointer.
-    next_ptr = key_it_and_inserted.first->second;
+    next_ptr = entry->value;
   }
 
   // Save the contents of all columns marked for reading.
-  m_last_row_stored = key_it_and_inserted.first->second =
+  m_last_row_stored = entry->value =
       StoreLinkedImmutableStringFromTableBuffers(next_ptr, &full);
   if (m_last_row_stored == nullptr) {
     return StoreRowResult::FATAL_ERROR;
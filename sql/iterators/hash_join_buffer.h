@@ -55,18 +55,29 @@
 ///
 /// The primary use case for these classes is, as the name implies,
 /// for implementing hash join.
+///
+/// If the buffer is created with more than one partition (see the system
+/// variable "hash_join_build_threads"), the hash table is split into that many
+/// independent hash maps, keyed off the hash of the join key. StoreRow() then
+/// only extracts the key and packs the row, which must be done in the session
+/// thread since it evaluates Items and reads the table buffers. The rows are
+/// inserted into the hash maps in Finalize(), with one worker thread per
+/// partition.
 
 #include <stddef.h>
 #include <cassert>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "extra/robin-hood-hashing/robin_hood.h"
 #include "my_alloc.h"
 #include "sql/immutable_string.h"
 #include "sql/item_cmpfunc.h"
+#include "sql/iterators/bloom_filter.h"
 #include "sql/pack_rows.h"
 #include "sql_string.h"
 
@@ -141,6 +152,99 @@ class KeyHasher {
   }
 };
 
+/// The hash table used by HashJoinRowBuffer, mapping each distinct key to the
+/// chain of rows stored with that key.
+///
+/// This is an open-addressing table in the style of SwissTable/F14: the slots
+/// are split into groups of kGroupSize, and each slot has a one-byte control
+/// word that is either kEmpty or seven bits taken from the key's hash (the
+/// tag). A lookup hashes the key once, and then compares the tag against all
+/// the control words of a group at the same time (with SSE2 or NEON where
+/// available), so that only slots with a matching tag need their key to be
+/// compared. Since the probe stops at the first group that has an empty slot,
+/// most misses are detected without looking at a single stored key, which is
+/// the common case for selective joins.
+///
+/// The entries are stored contiguously, and only hold two pointers, so that
+/// the table takes no more memory than the robin_hood map it replaced. Each
+/// new key is stored on the MEM_ROOT right before its first row, so checking
+/// the key of a matching entry usually touches the same cache line as
+/// reading the row afterwards. Entries are never removed.
+class HashJoinHashTable {
+ public:
+  struct Entry {
+    /// The key, stored on the MEM_ROOT of the row buffer.
+    ImmutableStringWithLength key;
+
+    /// The rows stored with this key.
+    LinkedImmutableString value{nullptr};
+  };
+
+  HashJoinHashTable() = default;
+  ~HashJoinHashTable();
+  HashJoinHashTable(const HashJoinHashTable &) = delete;
+  HashJoinHashTable &operator=(const HashJoinHashTable &) = delete;
+
+  /// Find the entry for the given key, or insert a new one with an empty
+  /// value (nullptr) if there is none. The key must stay valid for as long
+  /// as the table lives.
+  ///
+  /// @returns the entry, and whether it was inserted. On OOM, the entry is
+  ///   nullptr.
+  std::pair<Entry *, bool> emplace(ImmutableStringWithLength key);
+
+  /// Returns the entry for the given key, or nullptr if there is none.
+  const Entry *find(const Key &key) const;
+
+  /// Returns an arbitrary entry, or nullptr if the table is empty.
+  const Entry *first() const;
+
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+  /// The memory used by the table itself (not counting the keys and rows).
+  size_t num_bytes() const { return BytesForCapacity(m_capacity); }
+
+  /// The memory the table would use (after growing) for holding the given
+  /// number of entries.
+  static size_t BytesForEntries(size_t num_entries);
+
+ private:
+  static constexpr size_t kGroupSize = 16;
+
+  /// The control word for empty slots. Full slots have the highest bit clear.
+  static constexpr uint8_t kEmpty = 0x80;
+
+  /// The table grows when it is more than 7/8 full.
+  static size_t MaxEntriesForCapacity(size_t capacity) {
+    return capacity - capacity / 8;
+  }
+
+  static size_t BytesForCapacity(size_t capacity) {
+    return capacity * (sizeof(Entry) + 1);
+  }
+
+  /// Find the slot for the key with the given hash, or the empty slot where
+  /// it should be inserted. Returns the slot index, and whether the key was
+  /// found.
+  std::pair<size_t, bool> FindSlot(uint64_t hash, const Key &key) const;
+
+  /// Find the first empty slot in the probe sequence for the given hash.
+  size_t FindEmptySlot(uint64_t hash) const;
+
+  /// Rehash into a table with the given capacity. Returns true on OOM.
+  bool Rehash(size_t new_capacity);
+
+  /// kGroupSize control words per group, followed by m_capacity entries,
+  /// in a single allocation.
+  uint8_t *m_control{nullptr};
+  Entry *m_entries{nullptr};
+
+  /// The number of slots; zero or a power of two that is at least kGroupSize.
+  size_t m_capacity{0};
+  size_t m_size{0};
+};
+
 // A convenience form of LoadIntoTableBuffers() that also verifies the end
 // pointer for us.
 void LoadBufferRowIntoTableBuffers(const pack_rows::TableCollection &tables,
@@ -159,7 +263,7 @@ class HashJoinRowBuffer {
   // be used.
   HashJoinRowBuffer(pack_rows::TableCollection tables,
                     std::vector<HashJoinCondition> join_conditions,
-                    size_t max_mem_available_bytes);
+                    size_t max_mem_available_bytes, uint num_partitions = 1);
 
   // Initialize the HashJoinRowBuffer so it is ready to store rows. This
   // function can be called multiple times; subsequent calls will only clear the
@@ -181,33 +285,96 @@ class HashJoinRowBuffer {
   ///         my_error().
   StoreRowResult StoreRow(THD *thd, bool reject_duplicate_keys);
 
-  size_t size() const { return m_hash_map->size(); }
+  /// Insert the rows that StoreRow() has staged into the hash table. This is a
+  /// no-op unless the buffer is partitioned, and must be called after the
+  /// last call to StoreRow(), before any lookups.
+  ///
+  /// @param reject_duplicate_keys Must be the same as given to StoreRow().
+  ///
+  /// @retval false on success.
+  /// @retval true if an unrecoverable error occurred (most likely, malloc
+  ///         failed). It is the caller's responsibility to call my_error().
+  bool Finalize(bool reject_duplicate_keys);
 
-  bool empty() const { return m_hash_map->empty(); }
+  /// The number of distinct keys in the buffer. If the buffer is
+  /// partitioned and has rows that are not yet inserted into the hash table,
+  /// they are counted as if all of them had distinct keys.
+  size_t size() const;
 
-  bool inited() const { return m_hash_map != nullptr; }
+  bool empty() const { return size() == 0; }
 
-  using hash_map_type = robin_hood::unordered_flat_map<
-      ImmutableStringWithLength, LinkedImmutableString, KeyHasher, KeyEquals>;
+  bool inited() const { return Initialized(); }
 
-  using hash_map_iterator = hash_map_type::const_iterator;
+  /// The maximum amount of memory the buffer may use, in bytes.
+  size_t max_mem_available() const { return m_max_mem_available; }
 
-  hash_map_iterator find(const Key &key) const { return m_hash_map->find(key); }
+  using hash_map_type = HashJoinHashTable;
 
-  hash_map_iterator begin() const { return m_hash_map->begin(); }
+  /// Returns the chain of rows stored with the given key, or nullptr if
+  /// there are none.
+  LinkedImmutableString find(const Key &key) const {
+    assert(m_num_pending_rows == 0);
+    const hash_map_type &hash_map =
+        m_partitions.empty() ? *m_hash_map : *m_partitions[PartitionFor(key)];
+    const hash_map_type::Entry *entry = hash_map.find(key);
+    return entry == nullptr ? LinkedImmutableString{nullptr} : entry->value;
+  }
 
-  hash_map_iterator end() const { return m_hash_map->end(); }
+  /// Returns the chain of rows stored with an arbitrary key, or nullptr if
+  /// the buffer is empty. Used when there are no join conditions, in which
+  /// case all rows have the same (empty) key.
+  LinkedImmutableString first() const;
 
   LinkedImmutableString LastRowStored() const {
     assert(Initialized());
     return m_last_row_stored;
   }
 
-  bool Initialized() const { return m_hash_map.get() != nullptr; }
+  bool Initialized() const {
+    return m_hash_map != nullptr || !m_partitions.empty();
+  }
+
+  bool contains(const Key &key) const { return find(key) != nullptr; }
 
-  bool contains(const Key &key) const { return find(key) != end(); }
+  /// If set, the hash of the key of every row that StoreRow() stores (or
+  /// rejects as a duplicate) is also inserted into the given filter.
+  void set_bloom_filter(BloomFilter *bloom_filter) {
+    m_bloom_filter = bloom_filter;
+  }
 
  private:
+  /// A row packed by StoreRow() in partitioned mode, waiting to be inserted
+  /// into its partition by Finalize().
+  struct PendingRow {
+    /// The key, stored on m_mem_root.
+    ImmutableStringWithLength key;
+
+    /// The packed row data, stored on m_mem_root. It is preceded by room for
+    /// the largest possible LinkedImmutableString header.
+    char *data;
+
+    /// The row's header, once it has been written; see EncodeHeaderBefore().
+    LinkedImmutableString row{nullptr};
+  };
+
+  size_t PartitionFor(const Key &key) const {
+    return PartitionForHash(KeyHasher()(key));
+  }
+
+  size_t PartitionForHash(uint64_t hash) const {
+    // Use the upper bits, so that the partitions are not correlated with the
+    // lower bits the hash maps use for their buckets.
+    return ((hash >> 32) * m_partitions.size()) >> 32;
+  }
+
+  /// StoreRow() for partitioned buffers; see PendingRow.
+  StoreRowResult StagePendingRow();
+
+  /// Insert the pending rows of one partition. Runs without access to the
+  /// THD, and only touches the given partition and its pending rows.
+  /// Returns true on error.
+  bool InsertPendingRows(size_t partition, bool reject_duplicate_keys);
+
   const std::vector<HashJoinCondition> m_join_conditions;
 
   // A row can consist of parts from different tables. This structure tells us
@@ -226,9 +393,28 @@ class HashJoinRowBuffer {
   // disk.
   MEM_ROOT m_overflow_mem_root;
 
-  // The hash table where the rows are stored.
+  // The hash table where the rows are stored, if the buffer is not
+  // partitioned.
   std::unique_ptr<hash_map_type> m_hash_map;
 
+  // The number of partitions requested for the buffer. 1 means that the buffer
+  // is not partitioned, and that m_hash_map is used.
+  const uint m_num_partitions;
+
+  // The hash tables for each partition, if the buffer is partitioned.
+  std::vector<std::unique_ptr<hash_map_type>> m_partitions;
+
+  // The rows that are staged (but not yet inserted) for each partition.
+  std::vector<std::vector<PendingRow>> m_pending_rows;
+  size_t m_num_pending_rows{0};
+
+  // The partition of the last row that was staged.
+  size_t m_last_pending_partition{0};
+
+  // The number of distinct keys in the partitions, as of the last
+  // Finalize().
+  size_t m_num_partitioned_keys{0};
+
   // A buffer we can use when we are constructing a join key from a join
   // condition. In order to avoid reallocating memory, the buffer never shrinks.
   String m_buffer;
@@ -237,6 +423,9 @@ class HashJoinRowBuffer {
   // The maximum size of the buffer, given in bytes.
   const size_t m_max_mem_available;
 
+  // See set_bloom_filter().
+  BloomFilter *m_bloom_filter{nullptr};
+
   // The last row that was stored in the hash table, or nullptr if the hash
   // table is empty. We may have to put this row back into the tables' record
   // buffers if we have a child iterator that expects the record buffers to
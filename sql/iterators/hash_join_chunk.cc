@@ -40,6 +40,7 @@ using pack_rows::TableCollection;
 HashJoinChunk::HashJoinChunk(HashJoinChunk &&other)
     : m_tables(std::move(other.m_tables)),
       m_num_rows(other.m_num_rows),
+      m_num_bytes(other.m_num_bytes),
       m_file(other.m_file),
       m_uses_match_flags(other.m_uses_match_flags) {
   setup_io_cache(&m_file);
@@ -51,6 +52,7 @@ HashJoinChunk::HashJoinChunk(HashJoinChunk &&other)
 HashJoinChunk &HashJoinChunk::operator=(HashJoinChunk &&other) {
   m_tables = std::move(other.m_tables);
   m_num_rows = other.m_num_rows;
+  m_num_bytes = other.m_num_bytes;
   m_uses_match_flags = other.m_uses_match_flags;
 
   // Since the file we are replacing will become unreachable, free all resources
@@ -71,6 +73,7 @@ bool HashJoinChunk::Init(const TableCollection &tables, bool uses_match_flags) {
   m_tables = tables;
   m_file.file_key = key_file_hash_join;
   m_num_rows = 0;
+  m_num_bytes = 0;
   m_uses_match_flags = uses_match_flags;
   close_cached_file(&m_file);
   m_last_read_pos = 0;
@@ -162,6 +165,8 @@ bool HashJoinChunk::WriteRowToChunk(String *buffer, bool matched,
   }
 
   m_num_rows++;
+  m_num_bytes += (m_uses_match_flags ? sizeof(matched) : 0) +
+                 sizeof(data_length) + data_length;
   return false;
 }
 
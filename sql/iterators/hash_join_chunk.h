@@ -95,6 +95,10 @@ class HashJoinChunk {
   /// @param no  the number to set the counter to
   void SetNumRows(ha_rows no) { m_num_rows = no; }
 
+  /// @returns the number of bytes written to this chunk since Init(),
+  ///   including the per-row headers.
+  ulonglong NumBytes() const { return m_num_bytes; }
+
   /// Write a row to the HashJoinChunk.
   ///
   /// Read the row that lies in the record buffer (record[0]) of the given
@@ -160,6 +164,9 @@ class HashJoinChunk {
   // The number of rows in this chunk file.
   ha_rows m_num_rows{0};
 
+  // The number of bytes written to this chunk file.
+  ulonglong m_num_bytes{0};
+
   // The underlying file that is used when reading data to and from disk.
   IO_CACHE m_file;
 
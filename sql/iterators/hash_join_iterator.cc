@@ -81,7 +81,8 @@ HashJoinIterator::HashJoinIterator(
                            tables_to_get_rowid_for,
                            /*tables_to_store_contents_of_null_rows_for=*/0),
       m_tables_to_get_rowid_for(tables_to_get_rowid_for),
-      m_row_buffer(m_build_input_tables, join_conditions, max_memory_available),
+      m_row_buffer(m_build_input_tables, join_conditions, max_memory_available,
+                   thd->variables.hash_join_build_threads),
       m_join_conditions(PSI_NOT_INSTRUMENTED, join_conditions.data(),
                         join_conditions.data() + join_conditions.size()),
       m_chunk_files_on_disk(thd->mem_root, kMaxChunks),
@@ -126,6 +127,47 @@ bool HashJoinIterator::InitRowBuffer() {
   return false;
 }
 
+void HashJoinIterator::InitBloomFilter() {
+  // Larger build inputs would give a filter that does not fit in the CPU
+  // caches, and is unlikely to pay off.
+  static constexpr double kMaxBloomFilterKeys = 1024 * 1024;
+  static constexpr double kMinBloomFilterKeys = 1024;
+
+  // Only inner joins and semijoins can discard probe rows that have no
+  // matching build row.
+  m_building_bloom_filter =
+      thd()->variables.hash_join_bloom_filter &&
+      (m_join_type == JoinType::INNER || m_join_type == JoinType::SEMI) &&
+      !m_join_conditions.empty() &&
+      m_estimated_build_rows <= kMaxBloomFilterKeys &&
+      !m_bloom_filter.Init(static_cast<size_t>(
+          std::max(m_estimated_build_rows, kMinBloomFilterKeys)));
+  m_use_bloom_filter = false;
+  m_row_buffer.set_bloom_filter(m_building_bloom_filter ? &m_bloom_filter
+                                                        : nullptr);
+}
+
+void HashJoinIterator::FinishBloomFilter(bool complete) {
+  if (!m_building_bloom_filter) return;
+  m_building_bloom_filter = false;
+  m_row_buffer.set_bloom_filter(nullptr);
+
+  // If the build input was much larger than estimated, too many bits are set
+  // for the filter to reject anything.
+  m_use_bloom_filter = complete && !m_bloom_filter.overfull();
+  m_bloom_filter_checks = 0;
+  m_bloom_filter_rejections = 0;
+}
+
+bool HashJoinIterator::FinalizeRowBuffer() {
+  if (m_row_buffer.Finalize(RejectDuplicateKeys())) {
+    my_error(ER_OUTOFMEMORY, MYF(ME_FATALERROR),
+             thd()->variables.join_buff_size);
+    return true;
+  }
+  return false;
+}
+
 // Mark that blobs should be copied for each table that contains at least one
 // geometry column.
 static void MarkCopyBlobsIfTableContainsGeometry(
@@ -249,7 +291,8 @@ bool HashJoinIterator::Init() {
     // Prepare to read the build input into the hash map.
     PrepareForRequestRowId(m_build_input_tables.tables(),
                            m_tables_to_get_rowid_for);
-    if (m_build_input->Init()) {
+    if (m_build_input->Init() ||
+        m_build_reader.Init(thd(), m_build_input.get())) {
       assert(thd()->is_error() ||
              thd()->killed);  // my_error should have been called.
       return true;
@@ -259,6 +302,7 @@ bool HashJoinIterator::Init() {
   // We always start out by doing everything in memory.
   m_hash_join_type = HashJoinType::IN_MEMORY;
   m_write_to_probe_row_saving = false;
+  InitBloomFilter();
 
   m_build_iterator_has_more_rows = true;
   m_probe_input->EndPSIBatchModeIfStarted();
@@ -310,7 +354,9 @@ bool HashJoinIterator::Init() {
       } else if (m_state == State::END_OF_ROWS) {
         return false;
       } else {
-        return m_build_input->Init() || InitHashTable();
+        return m_build_input->Init() ||
+               m_build_reader.Init(thd(), m_build_input.get()) ||
+               InitHashTable();
       }
     }();
 
@@ -355,15 +401,17 @@ static bool ConstructJoinKey(
 }
 
 // Write a single row to a HashJoinChunk. The row must lie in the record buffer
-// (record[0]) for each involved table. The row is put into one of the chunks in
-// the input vector "chunks"; which chunk to use is decided by the hash value of
-// the join attribute.
+// (record[0]) for each involved table. The row is put into one of the
+// "num_chunks" chunk pairs starting at "chunks"; which chunk to use is decided
+// by the hash value of the join attribute. If "bloom_filter" is not nullptr,
+// the join key is also inserted into it.
 static bool WriteRowToChunk(
-    THD *thd, Mem_root_array<ChunkPair> *chunks, bool write_to_build_chunk,
+    THD *thd, ChunkPair *chunks, size_t num_chunks, bool write_to_build_chunk,
     const pack_rows::TableCollection &tables,
     const Prealloced_array<HashJoinCondition, 4> &join_conditions,
     const uint32 xxhash_seed, bool row_has_match,
-    bool store_row_with_null_in_join_key, String *join_key_and_row_buffer) {
+    bool store_row_with_null_in_join_key, String *join_key_and_row_buffer,
+    BloomFilter *bloom_filter) {
   assert(!thd->is_error());
   bool null_in_join_key = ConstructJoinKey(
       thd, join_conditions, tables.tables_bitmap(), join_key_and_row_buffer);
@@ -376,17 +424,22 @@ static bool WriteRowToChunk(
     return false;
   }
 
+  if (bloom_filter != nullptr) {
+    bloom_filter->Insert(hash_join_buffer::KeyHasher()(hash_join_buffer::Key(
+        join_key_and_row_buffer->ptr(), join_key_and_row_buffer->length())));
+  }
+
   const uint64_t join_key_hash =
       join_key_and_row_buffer->length() == 0
           ? kZeroKeyLengthHash
           : MY_XXH64(join_key_and_row_buffer->ptr(),
                      join_key_and_row_buffer->length(), xxhash_seed);
 
-  assert((chunks->size() & (chunks->size() - 1)) == 0);
+  assert((num_chunks & (num_chunks - 1)) == 0);
   // Since we know that the number of chunks will be a power of two, do a
-  // bitwise AND instead of (join_key_hash % chunks->size()).
-  const size_t chunk_index = join_key_hash & (chunks->size() - 1);
-  ChunkPair &chunk_pair = (*chunks)[chunk_index];
+  // bitwise AND instead of (join_key_hash % num_chunks).
+  const size_t chunk_index = join_key_hash & (num_chunks - 1);
+  ChunkPair &chunk_pair = chunks[chunk_index];
   if (write_to_build_chunk) {
     return chunk_pair.build_chunk.WriteRowToChunk(join_key_and_row_buffer,
                                                   row_has_match);
@@ -398,13 +451,16 @@ static bool WriteRowToChunk(
 
 // Write all the remaining rows from the given iterator out to chunk files
 // on disk. If the function returns true, an unrecoverable error occurred
-// (IO error etc.).
+// (IO error etc.). "RowSource" is either a RowIterator or a RowBatchReader.
+// If "bloom_filter" is not nullptr, the join keys are also inserted into it.
+template <class RowSource>
 static bool WriteRowsToChunks(
-    THD *thd, RowIterator *iterator, const pack_rows::TableCollection &tables,
+    THD *thd, RowSource *iterator, const pack_rows::TableCollection &tables,
     const Prealloced_array<HashJoinCondition, 4> &join_conditions,
     const uint32 xxhash_seed, Mem_root_array<ChunkPair> *chunks,
     bool write_to_build_chunk, bool write_rows_with_null_in_join_key,
-    table_map tables_to_get_rowid_for, String *join_key_buffer) {
+    table_map tables_to_get_rowid_for, String *join_key_buffer,
+    BloomFilter *bloom_filter) {
   for (;;) {  // Termination condition within loop.
     int res = iterator->Read();
     if (res == 1) {
@@ -420,9 +476,11 @@ static bool WriteRowsToChunks(
     assert(res == 0);
 
     RequestRowId(tables.tables(), tables_to_get_rowid_for);
-    if (WriteRowToChunk(thd, chunks, write_to_build_chunk, tables,
-                        join_conditions, xxhash_seed, /*row_has_match=*/false,
-                        write_rows_with_null_in_join_key, join_key_buffer)) {
+    if (WriteRowToChunk(thd, chunks->begin(), chunks->size(),
+                        write_to_build_chunk, tables, join_conditions,
+                        xxhash_seed, /*row_has_match=*/false,
+                        write_rows_with_null_in_join_key, join_key_buffer,
+                        bloom_filter)) {
       assert(thd->is_error());  // my_error should have been called.
       return true;
     }
@@ -519,7 +577,7 @@ bool HashJoinIterator::BuildHashTable() {
 
   PFSBatchMode batch_mode(m_build_input.get());
   for (;;) {  // Termination condition within loop.
-    int res = m_build_input->Read();
+    int res = m_build_reader.Read();
     if (res == 1) {
       assert(thd()->is_error() ||
              thd()->killed);  // my_error should have been called.
@@ -528,6 +586,7 @@ bool HashJoinIterator::BuildHashTable() {
 
     if (res == -1) {
       m_build_iterator_has_more_rows = false;
+      FinishBloomFilter(/*complete=*/true);
       // If the build input was empty, the result of inner joins and semijoins
       // will also be empty. However, if the build input was empty, the output
       // of antijoins will be all the rows from the probe input.
@@ -542,6 +601,7 @@ bool HashJoinIterator::BuildHashTable() {
       // probe row saving again (it was enabled if the hash table ran out of
       // memory _and_ we were not allowed to spill to disk).
       m_write_to_probe_row_saving = false;
+      if (FinalizeRowBuffer()) return true;
       SetReadingProbeRowState();
       return false;
     }
@@ -569,6 +629,8 @@ bool HashJoinIterator::BuildHashTable() {
             // that we only read unmatched probe rows.
             InitWritingToProbeRowSavingFile();
           }
+          FinishBloomFilter(/*complete=*/false);
+          if (FinalizeRowBuffer()) return true;
           SetReadingProbeRowState();
           return false;
         }
@@ -594,13 +656,15 @@ bool HashJoinIterator::BuildHashTable() {
         //
         // We never write out rows with NULL in condition for the build/right
         // input, as these rows will never match in a join condition.
-        if (WriteRowsToChunks(thd(), m_build_input.get(), m_build_input_tables,
+        if (WriteRowsToChunks(thd(), &m_build_reader, m_build_input_tables,
                               m_join_conditions, kChunkPartitioningHashSeed,
                               &m_chunk_files_on_disk,
                               true /* write_to_build_chunks */,
                               false /* write_rows_with_null_in_join_key */,
                               m_tables_to_get_rowid_for,
-                              &m_temporary_row_and_join_key_buffer)) {
+                              &m_temporary_row_and_join_key_buffer,
+                              m_building_bloom_filter ? &m_bloom_filter
+                                                      : nullptr)) {
           assert(thd()->is_error() ||
                  thd()->killed);  // my_error should have been called.
           return true;
@@ -615,6 +679,8 @@ bool HashJoinIterator::BuildHashTable() {
             return true;
           }
         }
+        FinishBloomFilter(/*complete=*/true);
+        if (FinalizeRowBuffer()) return true;
         SetReadingProbeRowState();
         return false;
       }
@@ -630,6 +696,108 @@ bool HashJoinIterator::BuildHashTable() {
   }
 }
 
+// A rough estimate of what the hash table needs for each row in addition to
+// the row data itself: the key, the row header and the hash table entry.
+static constexpr ulonglong kHashTableBytesPerRow = 32;
+
+bool HashJoinIterator::ShouldRepartitionChunk(
+    const ChunkPair &chunk_pair) const {
+  const HashJoinChunk &build_chunk = chunk_pair.build_chunk;
+  const ulonglong estimated_bytes =
+      build_chunk.NumBytes() + build_chunk.NumRows() * kHashTableBytesPerRow;
+  return chunk_pair.depth < kMaxRepartitionDepth &&
+         build_chunk.NumRows() > 1 &&
+         estimated_bytes > m_row_buffer.max_mem_available();
+}
+
+bool HashJoinIterator::RepartitionChunk(size_t chunk_idx) {
+  const ChunkPair &source = m_chunk_files_on_disk[chunk_idx];
+  const uint depth = source.depth + 1;
+  const ha_rows build_rows = source.build_chunk.NumRows();
+  const ha_rows probe_rows = source.probe_chunk.NumRows();
+
+  // Aim for chunks that fill 90% of the hash table, like
+  // InitializeChunkFiles().
+  constexpr double kReductionFactor = 0.9;
+  const double chunks_needed =
+      std::ceil(static_cast<double>(source.build_chunk.NumBytes() +
+                                    build_rows * kHashTableBytesPerRow) /
+                (m_row_buffer.max_mem_available() * kReductionFactor));
+  const size_t num_chunks = std::bit_ceil(
+      std::clamp<size_t>(static_cast<size_t>(chunks_needed), 2, kMaxChunks));
+
+  // The new chunk pairs go at the end, so that they are processed after the
+  // ones that are already there.
+  const size_t first_chunk = m_chunk_files_on_disk.size();
+  m_chunk_files_on_disk.resize(first_chunk + num_chunks);
+  if (m_chunk_files_on_disk.size() != first_chunk + num_chunks) {
+    my_error(ER_OUTOFMEMORY, MYF(ME_FATALERROR),
+             num_chunks * sizeof(ChunkPair));
+    return true;
+  }
+  ChunkPair *sub_chunks = &m_chunk_files_on_disk[first_chunk];
+  for (size_t i = 0; i < num_chunks; ++i) {
+    if (sub_chunks[i].build_chunk.Init(m_build_input_tables,
+                                       /*uses_match_flags=*/false) ||
+        sub_chunks[i].probe_chunk.Init(m_probe_input_tables,
+                                       m_join_type == JoinType::OUTER)) {
+      my_error(ER_TEMP_FILE_WRITE_FAILURE, MYF(0));
+      return true;
+    }
+    sub_chunks[i].depth = depth;
+  }
+
+  // Use a different seed on each level, so that rows that went to the same
+  // chunk on the previous level are spread out over the new chunks. The rows
+  // are read into a separate buffer, since the row data (e.g. BLOBs) must stay
+  // valid while the join key is constructed in
+  // m_temporary_row_and_join_key_buffer.
+  const uint32 seed = kChunkPartitioningHashSeed + depth;
+  ChunkPair &chunk_pair = m_chunk_files_on_disk[chunk_idx];
+  String row_buffer;
+  if (chunk_pair.build_chunk.Rewind()) return true;
+  for (ha_rows i = 0; i < build_rows; ++i) {
+    if (chunk_pair.build_chunk.LoadRowFromChunk(&row_buffer,
+                                                /*matched=*/nullptr) ||
+        WriteRowToChunk(thd(), sub_chunks, num_chunks,
+                        /*write_to_build_chunk=*/true, m_build_input_tables,
+                        m_join_conditions, seed, /*row_has_match=*/false,
+                        /*store_row_with_null_in_join_key=*/false,
+                        &m_temporary_row_and_join_key_buffer,
+                        /*bloom_filter=*/nullptr)) {
+      return true;
+    }
+  }
+  if (chunk_pair.probe_chunk.Rewind()) return true;
+  for (ha_rows i = 0; i < probe_rows; ++i) {
+    bool matched = false;
+    if (chunk_pair.probe_chunk.LoadRowFromChunk(&row_buffer, &matched) ||
+        WriteRowToChunk(thd(), sub_chunks, num_chunks,
+                        /*write_to_build_chunk=*/false, m_probe_input_tables,
+                        m_join_conditions, seed, matched,
+                        /*store_row_with_null_in_join_key=*/m_join_type ==
+                            JoinType::OUTER,
+                        &m_temporary_row_and_join_key_buffer,
+                        /*bloom_filter=*/nullptr)) {
+      return true;
+    }
+  }
+
+  for (size_t i = 0; i < num_chunks; ++i) {
+    // If all the build rows have the same hash, splitting them again will
+    // not help; the chunk will have to be processed with hash table refills.
+    if (sub_chunks[i].build_chunk.NumRows() == build_rows) {
+      sub_chunks[i].depth = kMaxRepartitionDepth;
+    }
+    if (sub_chunks[i].build_chunk.Rewind()) return true;
+  }
+
+  // Close the files of the original pair.
+  chunk_pair = ChunkPair();
+  ++m_spill_stats.repartitioned_chunks;
+  return false;
+}
+
 bool HashJoinIterator::ReadNextHashJoinChunk() {
   // See if we should proceed to the next pair of chunk files. In general,
   // it works like this; if we are at the end of the build chunk, move to the
@@ -645,12 +813,47 @@ bool HashJoinIterator::ReadNextHashJoinChunk() {
       m_chunk_files_on_disk[m_current_chunk].probe_chunk.NumRows() == 0;
 
   if (move_to_next_chunk) {
+    // The previous pair of chunk files is done, so close them.
+    if (m_current_chunk != -1) {
+      m_chunk_files_on_disk[m_current_chunk] = ChunkPair();
+    }
     m_current_chunk++;
     m_build_chunk_current_row = 0;
 
     // Since we are moving to a new set of chunk files, ensure that we read from
     // the chunk file and not from the probe row saving file.
     m_read_from_probe_row_saving = false;
+
+    // Skip pairs without probe rows, since no join type outputs unmatched
+    // build rows. Split the pairs that are too large for the hash table;
+    // RepartitionChunk() appends the new pairs at the end, where the loop
+    // will get to them.
+    while (m_current_chunk < static_cast<int>(m_chunk_files_on_disk.size())) {
+      ChunkPair &chunk_pair = m_chunk_files_on_disk[m_current_chunk];
+      if (chunk_pair.probe_chunk.NumRows() == 0) {
+        chunk_pair = ChunkPair();
+      } else if (ShouldRepartitionChunk(chunk_pair)) {
+        if (RepartitionChunk(m_current_chunk)) {
+          assert(thd()->is_error());  // my_error should have been called.
+          return true;
+        }
+      } else {
+        break;
+      }
+      m_current_chunk++;
+    }
+
+    if (m_current_chunk < static_cast<int>(m_chunk_files_on_disk.size())) {
+      const ChunkPair &chunk_pair = m_chunk_files_on_disk[m_current_chunk];
+      ++m_spill_stats.chunks;
+      m_spill_stats.build_rows += chunk_pair.build_chunk.NumRows();
+      m_spill_stats.build_bytes += chunk_pair.build_chunk.NumBytes();
+      m_spill_stats.probe_rows += chunk_pair.probe_chunk.NumRows();
+      m_spill_stats.probe_bytes += chunk_pair.probe_chunk.NumBytes();
+      m_spill_stats.max_chunk_build_rows =
+          std::max(m_spill_stats.max_chunk_build_rows,
+                   chunk_pair.build_chunk.NumRows());
+    }
   }
 
   if (m_current_chunk == static_cast<int>(m_chunk_files_on_disk.size())) {
@@ -704,6 +907,7 @@ bool HashJoinIterator::ReadNextHashJoinChunk() {
 
     assert(store_row_result == hash_join_buffer::StoreRowResult::ROW_STORED);
   }
+  if (FinalizeRowBuffer()) return true;
 
   // Prepare to do a lookup in the hash table for all rows from the probe
   // chunk.
@@ -714,6 +918,9 @@ bool HashJoinIterator::ReadNextHashJoinChunk() {
   m_probe_chunk_current_row = 0;
   SetReadingProbeRowState();
 
+  if (m_build_chunk_current_row < build_chunk.NumRows()) {
+    ++m_spill_stats.hash_table_refills;
+  }
   if (m_build_chunk_current_row < build_chunk.NumRows() &&
       m_join_type != JoinType::INNER) {
     // The build chunk did not fit into memory, causing us to refill the hash
@@ -913,11 +1120,7 @@ void HashJoinIterator::LookupProbeRowInHashTable() {
   if (m_join_conditions.empty()) {
     // Skip the call to find() in case we don't have any join conditions.
     // TODO(sgunders): Is this relevant for performance anymore?
-    if (m_row_buffer.empty()) {
-      m_current_row = LinkedImmutableString{nullptr};
-    } else {
-      m_current_row = m_row_buffer.begin()->second;
-    }
+    m_current_row = m_row_buffer.first();
     m_state = State::READING_FIRST_ROW_FROM_HASH_TABLE;
     return;
   }
@@ -944,13 +1147,28 @@ void HashJoinIterator::LookupProbeRowInHashTable() {
   hash_join_buffer::Key key{m_temporary_row_and_join_key_buffer.ptr(),
                             m_temporary_row_and_join_key_buffer.length()};
 
-  auto it = m_row_buffer.find(key);
-  if (it == m_row_buffer.end()) {
-    m_current_row = LinkedImmutableString{nullptr};
-  } else {
-    m_current_row = it->second;
+  // Rows from chunk files were checked before they were written.
+  if (m_use_bloom_filter && m_current_chunk == -1) {
+    // Check whether the filter pays off once enough rows have been seen.
+    static constexpr ha_rows kBloomFilterSampleRows = 4096;
+    if (++m_bloom_filter_checks == kBloomFilterSampleRows &&
+        m_bloom_filter_rejections < kBloomFilterSampleRows / 16) {
+      m_use_bloom_filter = false;
+    }
+    if (!m_bloom_filter.MayContain(hash_join_buffer::KeyHasher()(key))) {
+      // The row cannot match any build row, neither in the hash table nor in
+      // the chunk files, so skip it the same way as a NULL key above.
+      ++m_bloom_filter_rejections;
+      ++m_num_bloom_filter_rejections;
+      SetReadingProbeRowState();
+      return;
+    }
   }
 
+  m_current_row = m_row_buffer.find(key);
+  ++m_num_hash_table_probes;
+  if (m_current_row == nullptr) ++m_num_hash_table_probe_misses;
+
   m_state = State::READING_FIRST_ROW_FROM_HASH_TABLE;
 }
 
@@ -982,12 +1200,14 @@ bool HashJoinIterator::WriteProbeRowToDiskIfApplicable() {
     if ((m_join_type == JoinType::INNER || m_join_type == JoinType::OUTER) ||
         !found_match) {
       if (on_disk_hash_join() && m_current_chunk == -1) {
-        if (WriteRowToChunk(thd(), &m_chunk_files_on_disk,
+        if (WriteRowToChunk(thd(), m_chunk_files_on_disk.begin(),
+                            m_chunk_files_on_disk.size(),
                             false /* write_to_build_chunk */,
                             m_probe_input_tables, m_join_conditions,
                             kChunkPartitioningHashSeed, found_match,
                             write_rows_with_null_in_join_key,
-                            &m_temporary_row_and_join_key_buffer)) {
+                            &m_temporary_row_and_join_key_buffer,
+                            /*bloom_filter=*/nullptr)) {
           return true;
         }
       }
@@ -35,8 +35,10 @@
 #include "prealloced_array.h"
 #include "sql/immutable_string.h"
 #include "sql/item_cmpfunc.h"
+#include "sql/iterators/bloom_filter.h"
 #include "sql/iterators/hash_join_buffer.h"
 #include "sql/iterators/hash_join_chunk.h"
+#include "sql/iterators/row_batch.h"
 #include "sql/iterators/row_iterator.h"
 #include "sql/join_type.h"
 #include "sql/mem_root_array.h"
@@ -50,6 +52,35 @@ class THD;
 struct ChunkPair {
   HashJoinChunk probe_chunk;
   HashJoinChunk build_chunk;
+
+  // How many times the rows in this pair have been split into smaller chunks
+  // (see HashJoinIterator::RepartitionChunk()).
+  uint depth{0};
+};
+
+/// Statistics about the chunk files of a hash join that has spilled to disk,
+/// summed over all executions of the iterator. Shown by EXPLAIN ANALYZE.
+struct HashJoinSpillStats {
+  /// The number of chunk pairs that were loaded into the hash table.
+  ha_rows chunks{0};
+
+  /// The number of rows and bytes in those chunk pairs.
+  ha_rows build_rows{0};
+  ulonglong build_bytes{0};
+  ha_rows probe_rows{0};
+  ulonglong probe_bytes{0};
+
+  /// The largest number of rows in a single build chunk.
+  ha_rows max_chunk_build_rows{0};
+
+  /// The number of chunk pairs that were split into smaller ones because the
+  /// build chunk was too large for the hash table.
+  ha_rows repartitioned_chunks{0};
+
+  /// The number of times a build chunk did not fit in the hash table anyway,
+  /// so that the hash table had to be refilled and the probe chunk read
+  /// again.
+  ha_rows hash_table_refills{0};
 };
 
 /// @file
@@ -357,6 +388,23 @@ class HashJoinIterator final : public RowIterator {
 
   int ChunkCount() { return m_chunk_files_on_disk.size(); }
 
+  const HashJoinSpillStats &spill_stats() const { return m_spill_stats; }
+
+  /// The number of hash table lookups done for probe rows, summed over all
+  /// executions of the iterator. Shown by EXPLAIN ANALYZE.
+  ha_rows num_hash_table_probes() const { return m_num_hash_table_probes; }
+
+  /// The number of those lookups that did not find the key.
+  ha_rows num_hash_table_probe_misses() const {
+    return m_num_hash_table_probe_misses;
+  }
+
+  /// The number of probe rows that were discarded by the Bloom filter
+  /// without a hash table lookup; see m_bloom_filter.
+  ha_rows num_bloom_filter_rejections() const {
+    return m_num_bloom_filter_rejections;
+  }
+
  private:
   /// Read all rows from the build input and store the rows into the in-memory
   /// hash table. If the hash table goes full, the rest of the rows are written
@@ -371,6 +419,21 @@ class HashJoinIterator final : public RowIterator {
   /// @retval true in case of error
   bool ReadNextHashJoinChunk();
 
+  /// Whether the given chunk pair should be split into smaller ones before it
+  /// is loaded, because its build chunk is not expected to fit in the hash
+  /// table.
+  bool ShouldRepartitionChunk(const ChunkPair &chunk_pair) const;
+
+  /// Split a chunk pair whose build chunk is too large for the hash table
+  /// into smaller chunk pairs, appended to m_chunk_files_on_disk, by
+  /// partitioning its rows again on a hash with a different seed. The
+  /// original pair is closed. This adapts the number of chunks to the actual
+  /// size of the build input, which may be far larger than estimated when
+  /// the chunk files were created.
+  ///
+  /// @retval true in case of error
+  bool RepartitionChunk(size_t chunk_idx);
+
   /// Read a single row from the probe iterator input into the tables' record
   /// buffers. If we have started spilling to disk, the row is written out to a
   /// chunk file on disk as well.
@@ -458,6 +521,23 @@ class HashJoinIterator final : public RowIterator {
   /// @retval true in case of error. my_error has been called
   bool InitRowBuffer();
 
+  /// Prepare m_bloom_filter for being filled by BuildHashTable(), if the
+  /// join can use it.
+  void InitBloomFilter();
+
+  /// Stop filling m_bloom_filter, and decide whether to use it for the probe
+  /// input.
+  ///
+  /// @param complete true if the filter holds the keys of all the build
+  ///        rows; if not, it cannot be used.
+  void FinishBloomFilter(bool complete);
+
+  /// Insert any rows the row buffer has staged into its hash table, which
+  /// must be done before probing it; see HashJoinRowBuffer::Finalize().
+  ///
+  /// @retval true in case of error. my_error has been called
+  bool FinalizeRowBuffer();
+
   /// Prepare to read the probe iterator from the beginning, and enable batch
   /// mode if applicable. The iterator state will remain unchanged.
   ///
@@ -535,6 +615,9 @@ class HashJoinIterator final : public RowIterator {
   pack_rows::TableCollection m_build_input_tables;
   const table_map m_tables_to_get_rowid_for;
 
+  // Reads rows from the build input, in batches if batch mode is enabled.
+  RowBatchReader m_build_reader{m_build_input_tables};
+
   // An in-memory hash table that holds rows from the build input (directly from
   // the build input iterator, or from a chunk file). See the class comment for
   // details on how and when this is used.
@@ -556,6 +639,39 @@ class HashJoinIterator final : public RowIterator {
   ha_rows m_build_chunk_current_row = 0;
   ha_rows m_probe_chunk_current_row = 0;
 
+  // See spill_stats().
+  HashJoinSpillStats m_spill_stats;
+
+  // See num_hash_table_probes() and num_hash_table_probe_misses().
+  ha_rows m_num_hash_table_probes = 0;
+  ha_rows m_num_hash_table_probe_misses = 0;
+
+  // A runtime join filter for inner joins and semijoins (if enabled by the
+  // hash_join_bloom_filter system variable). It holds the hashes of the join
+  // keys of all build rows, both those in the hash table and those written
+  // to chunk files, so that probe rows read from the probe input can be
+  // discarded early if they cannot match any build row. This saves the hash
+  // table lookup, and, more importantly, writing the row to a chunk file if
+  // the join has spilled to disk. The filter is not used if the hash table is
+  // refilled (see HashJoinType), since the filter would then only cover part
+  // of the build input when probe rows are saved for the next refill.
+  BloomFilter m_bloom_filter;
+
+  // Whether m_bloom_filter is being filled by the build phase.
+  bool m_building_bloom_filter{false};
+
+  // Whether rows from the probe input are checked against m_bloom_filter.
+  bool m_use_bloom_filter{false};
+
+  // The number of probe rows checked against and rejected by m_bloom_filter
+  // since it was built. If the filter rejects too few rows, it is not worth
+  // checking, and is switched off.
+  ha_rows m_bloom_filter_checks = 0;
+  ha_rows m_bloom_filter_rejections = 0;
+
+  // See num_bloom_filter_rejections().
+  ha_rows m_num_bloom_filter_rejections = 0;
+
   // How many rows we assume there will be when reading the build input.
   // This is used to choose how many chunks we break it into on disk.
   const double m_estimated_build_rows;
@@ -578,6 +694,12 @@ class HashJoinIterator final : public RowIterator {
   // should be placed in.
   static constexpr size_t kMaxChunks = 128;
 
+  // How many times the rows of a chunk pair may be split into smaller chunk
+  // pairs; see RepartitionChunk(). Each level multiplies the number of chunks
+  // by up to kMaxChunks, so this is only reached if many rows have the same
+  // join key, where repartitioning does not help.
+  static constexpr uint kMaxRepartitionDepth = 3;
+
  private:
   // A buffer that is used during two phases:
   // 1) when constructing a join key from join conditions.
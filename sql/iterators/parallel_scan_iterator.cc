@@ -0,0 +1,564 @@
+/* Copyright (c) 2023, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+#include "sql/iterators/parallel_scan_iterator.h"
+
+#include <assert.h>
+#include <string.h>
+#include <algorithm>
+#include <limits>
+#include <system_error>
+#include <utility>
+
+#include "decimal.h"
+#include "field_types.h"
+#include "my_byteorder.h"
+#include "my_sys.h"
+#include "mysqld_error.h"
+#include "sql/field.h"
+#include "sql/handler.h"
+#include "sql/item.h"
+#include "sql/item_sum.h"
+#include "sql/iterators/row_batch.h"
+#include "sql/sql_class.h"
+#include "sql/sql_lex.h"
+#include "sql/sql_optimizer.h"
+#include "sql/system_variables.h"
+#include "sql/table.h"
+#include "thr_lock.h"
+
+/// The number of batches per reader thread that may be waiting to be returned
+/// by Read(). A batch is about the size of the storage engine's send buffer
+/// (ADAPTER_SEND_BUFFER_SIZE for InnoDB, which is 2 MB).
+static constexpr size_t kQueuedBatchesPerThread = 2;
+
+ParallelTableScanIterator::ParallelTableScanIterator(THD *thd, TABLE *table,
+                                                     size_t num_threads,
+                                                     ha_rows *examined_rows)
+    : TableRowIterator(thd, table),
+      m_record(table->record[0]),
+      m_row_length(table->s->reclength),
+      m_desired_threads(num_threads),
+      m_examined_rows(examined_rows) {}
+
+ParallelTableScanIterator::~ParallelTableScanIterator() {
+  StopScan();
+  if (table()->file != nullptr) {
+    table()->file->ha_index_or_rnd_end();
+  }
+}
+
+bool ParallelTableScanIterator::Init() {
+  StopScan();
+  empty_record(table());
+
+  m_current_batch.clear();
+  m_next_row = 0;
+  m_queue.clear();
+  m_scan_done = false;
+  m_scan_error = 0;
+  m_abort = false;
+  m_num_reader_threads = 0;
+  m_aggregated_rows = 0;
+
+  if (m_serial_scan) {
+    table()->file->ha_index_or_rnd_end();
+    m_serial_scan = false;
+  }
+
+  size_t num_threads = 0;
+  int error = table()->file->parallel_scan_init(
+      m_scan_ctx, &num_threads, /*use_reserved_threads=*/false,
+      m_desired_threads);
+  if (error == HA_ERR_GENERIC || (error == 0 && m_scan_ctx == nullptr)) {
+    // No reader threads were available, or the engine does not support
+    // parallel scans. Read the table the ordinary way.
+    m_scan_ctx = nullptr;
+    m_serial_scan = true;
+    m_worker_states.assign(m_num_aggregates, ParallelAggregateState());
+    error = table()->file->ha_rnd_init(true);
+    if (error) {
+      PrintError(error);
+      return true;
+    }
+    return false;
+  }
+  if (error) {
+    m_scan_ctx = nullptr;
+    PrintError(error);
+    return true;
+  }
+
+  m_num_reader_threads = num_threads;
+  m_worker_states.assign(std::max<size_t>(num_threads, 1) * m_num_aggregates,
+                         ParallelAggregateState());
+  m_max_queued_batches =
+      std::max<size_t>(num_threads, 1) * kQueuedBatchesPerThread;
+  try {
+    m_gather_thread = std::thread(&ParallelTableScanIterator::RunScan, this);
+  } catch (const std::system_error &e) {
+    table()->file->parallel_scan_end(m_scan_ctx);
+    m_scan_ctx = nullptr;
+    my_error(ER_CANT_CREATE_THREAD, MYF(0), e.code().value());
+    return true;
+  }
+  return false;
+}
+
+void ParallelTableScanIterator::RunScan() {
+  // The row layout the engine hands us must be the one of record[0], since
+  // the rows are copied there as they are.
+  auto init_fn = [this](void *, ulong, ulong row_length, const ulong *,
+                        const ulong *, const ulong *) {
+    return row_length != m_row_length;
+  };
+  auto load_fn = [this](void *thread_ctx, uint num_rows, void *rows,
+                        uint64_t) {
+    if (m_aggregates != nullptr) {
+      return AggregateRows(num_rows, static_cast<const uchar *>(rows),
+                           static_cast<ParallelAggregateState *>(thread_ctx));
+    }
+    return EnqueueRows(num_rows, static_cast<const uchar *>(rows));
+  };
+  auto end_fn = [](void *) {};
+
+  // When aggregating, each reader gets its own aggregate states. Otherwise,
+  // the readers do not need any context of their own.
+  std::vector<void *> thread_ctxs(m_num_reader_threads, nullptr);
+  if (m_aggregates != nullptr) {
+    for (size_t i = 0; i < m_num_reader_threads; ++i) {
+      thread_ctxs[i] = &m_worker_states[i * m_num_aggregates];
+    }
+  }
+  const int error = table()->file->parallel_scan(
+      m_scan_ctx, thread_ctxs.data(), init_fn, load_fn, end_fn);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_scan_error = error;
+  m_scan_done = true;
+  m_batch_available.notify_one();
+}
+
+bool ParallelTableScanIterator::EnqueueRows(uint num_rows, const uchar *rows) {
+  if (num_rows == 0) return false;
+
+  // Copy outside the lock, so that the readers only serialize on the queue
+  // itself.
+  std::vector<uchar> batch(rows, rows + size_t{num_rows} * m_row_length);
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_room_available.wait(lock, [this] {
+    return m_abort || m_queue.size() < m_max_queued_batches;
+  });
+  if (m_abort) return true;
+  m_queue.push_back(std::move(batch));
+  m_batch_available.notify_one();
+  return false;
+}
+
+/// Read an integer column described by "spec" from a record.
+static longlong ReadIntegerColumn(const ParallelAggregateSpec &spec,
+                                  const uchar *record) {
+  const uchar *ptr = record + spec.offset;
+  switch (spec.length) {
+    case 1:
+      return spec.is_unsigned ? longlong{*ptr}
+                              : longlong{static_cast<signed char>(*ptr)};
+    case 2: {
+      const int16 j = spec.low_byte_first ? sint2korr(ptr) : shortget(ptr);
+      return spec.is_unsigned ? longlong{static_cast<uint16>(j)} : longlong{j};
+    }
+    case 3:
+      return spec.is_unsigned ? longlong{uint3korr(ptr)}
+                              : longlong{sint3korr(ptr)};
+    case 4: {
+      const int32 j = spec.low_byte_first ? sint4korr(ptr) : longget(ptr);
+      return spec.is_unsigned ? longlong{static_cast<uint32>(j)} : longlong{j};
+    }
+    default:
+      assert(spec.length == 8);
+      return spec.low_byte_first ? sint8korr(ptr) : longlongget(ptr);
+  }
+}
+
+/// Add one record to the state of one aggregate.
+static void AggregateRecord(const ParallelAggregateSpec &spec,
+                            const uchar *record,
+                            ParallelAggregateState *state) {
+  if (!spec.has_column) {
+    ++state->count;
+    return;
+  }
+  if (spec.null_bit != 0 && (record[spec.null_offset] & spec.null_bit)) {
+    return;
+  }
+  const longlong value = ReadIntegerColumn(spec, record);
+  switch (spec.kind) {
+    case ParallelAggregateSpec::COUNT:
+      break;
+    case ParallelAggregateSpec::SUM:
+      if ((value > 0 &&
+           state->value > std::numeric_limits<longlong>::max() - value) ||
+          (value < 0 &&
+           state->value < std::numeric_limits<longlong>::min() - value)) {
+        // Move the integer part of the sum into the decimal before it
+        // overflows. No errors are checked (or reported, which would need a
+        // THD); a sum of 64-bit integers cannot overflow a decimal.
+        my_decimal part;
+        my_decimal sum;
+        int2my_decimal(E_DEC_OK, state->value, /*unsigned_flag=*/false, &part);
+        my_decimal_add(E_DEC_OK, &sum, &state->overflow_sum, &part);
+        state->overflow_sum = sum;
+        state->value = 0;
+      }
+      state->value += value;
+      break;
+    case ParallelAggregateSpec::MIN:
+    case ParallelAggregateSpec::MAX: {
+      if (state->count > 0) {
+        const bool less =
+            spec.is_unsigned ? static_cast<ulonglong>(value) <
+                                   static_cast<ulonglong>(state->value)
+                             : value < state->value;
+        if (less != (spec.kind == ParallelAggregateSpec::MIN)) break;
+      }
+      state->value = value;
+      break;
+    }
+  }
+  ++state->count;
+}
+
+bool ParallelTableScanIterator::AggregateRows(uint num_rows,
+                                              const uchar *rows,
+                                              ParallelAggregateState *states) {
+  for (uint i = 0; i < num_rows; ++i) {
+    const uchar *record = rows + size_t{i} * m_row_length;
+    for (size_t j = 0; j < m_num_aggregates; ++j) {
+      AggregateRecord(m_aggregates[j], record, &states[j]);
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_aggregated_rows += num_rows;
+  return m_abort;
+}
+
+int ParallelTableScanIterator::ReadNextBatch() {
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_batch_available.wait(lock,
+                           [this] { return m_scan_done || !m_queue.empty(); });
+    if (!m_queue.empty()) {
+      m_current_batch = std::move(m_queue.front());
+      m_queue.pop_front();
+      m_next_row = 0;
+      m_room_available.notify_one();
+      return 0;
+    }
+  }
+
+  // All rows have been read; tear down the scan before reporting the result.
+  const int error = m_scan_error;
+  StopScan();
+  m_current_batch.clear();
+  m_next_row = 0;
+  if (error != 0) {
+    return HandleError(error);
+  }
+  table()->set_no_row();
+  return -1;
+}
+
+int ParallelTableScanIterator::Read() {
+  if (m_aggregates != nullptr) {
+    return ReadAggregated();
+  }
+  if (m_serial_scan) {
+    int error;
+    while ((error = table()->file->ha_rnd_next(m_record))) {
+      if (error == HA_ERR_RECORD_DELETED && !thd()->killed) continue;
+      return HandleError(error);
+    }
+  } else {
+    if (m_next_row * m_row_length == m_current_batch.size()) {
+      if (m_scan_ctx == nullptr) {
+        // The scan has already ended.
+        table()->set_no_row();
+        return -1;
+      }
+      const int error = ReadNextBatch();
+      if (error != 0) return error;
+    }
+    memcpy(m_record, m_current_batch.data() + m_next_row * m_row_length,
+           m_row_length);
+    ++m_next_row;
+    table()->set_found_row();
+  }
+  if (m_examined_rows != nullptr) {
+    ++*m_examined_rows;
+  }
+  return 0;
+}
+
+int ParallelTableScanIterator::ReadAggregated() {
+  if (m_serial_scan) {
+    for (;;) {
+      const int error = table()->file->ha_rnd_next(m_record);
+      if (error == HA_ERR_RECORD_DELETED && !thd()->killed) continue;
+      if (error) return HandleError(error);
+      AggregateRows(1, m_record, m_worker_states.data());
+      if (m_examined_rows != nullptr) {
+        ++*m_examined_rows;
+      }
+    }
+  }
+
+  // The scan has already ended.
+  if (m_scan_ctx == nullptr) return -1;
+
+  const int error = ReadNextBatch();
+  assert(error != 0);
+  if (m_examined_rows != nullptr) {
+    *m_examined_rows += m_aggregated_rows;
+  }
+  return error;
+}
+
+int ParallelTableScanIterator::ReadBatch(RowBatch *batch) {
+  // Same as the default implementation, but the calls to Read() are not
+  // virtual.
+  batch->Clear();
+  while (!batch->full()) {
+    const int err = ParallelTableScanIterator::Read();
+    if (err == 1) return 1;
+    if (err == -1) {
+      batch->set_eof();
+      break;
+    }
+    batch->AppendFromTableBuffers();
+  }
+  return batch->num_selected() == 0 ? -1 : 0;
+}
+
+void ParallelTableScanIterator::StopScan() {
+  if (m_scan_ctx == nullptr) return;
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_abort = true;
+    m_room_available.notify_all();
+  }
+  if (m_gather_thread.joinable()) m_gather_thread.join();
+  table()->file->parallel_scan_end(m_scan_ctx);
+  m_scan_ctx = nullptr;
+  m_queue.clear();
+}
+
+size_t ParallelTableScanThreads(THD *thd, const Query_block *query_block,
+                                const TABLE *table) {
+  const size_t num_threads = thd->variables.parallel_table_scan_threads;
+  if (num_threads <= 1) return 0;
+
+  // Reading ahead must not be visible; see RowBatchSize().
+  if (thd->lex->sql_command != SQLCOM_SELECT ||
+      thd->tx_isolation == ISO_SERIALIZABLE ||
+      table->reginfo.lock_type != TL_READ) {
+    return 0;
+  }
+
+  // Only a single-table outermost query block. Anything that could rescan
+  // the table, or position the handler on a row (row IDs for weedout, hash
+  // join or sorting), would not see the expected handler state.
+  if (query_block->outer_query_block() != nullptr ||
+      query_block->leaf_table_count != 1) {
+    return 0;
+  }
+
+  const Table_ref *table_ref = table->pos_in_table_list;
+  if (table->s->tmp_table != NO_TMP_TABLE || table_ref == nullptr ||
+      table_ref->is_fulltext_searched() || table_ref->uses_materialization() ||
+      table_ref->schema_table != nullptr) {
+    return 0;
+  }
+
+  // The readers return records in the MySQL row format, with BLOBs pointing
+  // into memory that is only valid during the callback, and without virtual
+  // columns computed. Only InnoDB implements the parallel scan interface.
+  if (table->s->blob_fields > 0 || table->vfield != nullptr ||
+      table->file->ht == nullptr ||
+      table->file->ht->db_type != DB_TYPE_INNODB) {
+    return 0;
+  }
+  return num_threads;
+}
+
+/**
+  Describe how the reader threads are to compute "item" over "table", if they
+  can. Returns false if not.
+ */
+static bool MakeParallelAggregateSpec(const JOIN *join, const TABLE *table,
+                                      Item_sum *item,
+                                      ParallelAggregateSpec *spec) {
+  if (item->aggr_query_block != join->query_block ||
+      !item->supports_partial_state() || item->argument_count() != 1) {
+    return false;
+  }
+  switch (item->sum_func()) {
+    case Item_sum::COUNT_FUNC:
+      spec->kind = ParallelAggregateSpec::COUNT;
+      break;
+    case Item_sum::SUM_FUNC:
+    case Item_sum::AVG_FUNC:
+      // Item_sum_avg merges its state the same way as Item_sum_sum.
+      if (item->result_type() != DECIMAL_RESULT) return false;
+      spec->kind = ParallelAggregateSpec::SUM;
+      break;
+    case Item_sum::MIN_FUNC:
+      spec->kind = ParallelAggregateSpec::MIN;
+      break;
+    case Item_sum::MAX_FUNC:
+      spec->kind = ParallelAggregateSpec::MAX;
+      break;
+    default:
+      return false;
+  }
+
+  const Item *arg = item->get_arg(0)->real_item();
+  if (spec->kind == ParallelAggregateSpec::COUNT && arg->const_item()) {
+    // COUNT(*), or COUNT(<constant>), which counts all rows unless the
+    // constant is NULL.
+    if (arg->is_nullable()) return false;
+    spec->has_column = false;
+    return true;
+  }
+  if (arg->type() != Item::FIELD_ITEM) return false;
+  const Field *field = down_cast<const Item_field *>(arg)->field;
+  if (field->table != table) return false;
+  switch (field->type()) {
+    case MYSQL_TYPE_TINY:
+    case MYSQL_TYPE_SHORT:
+    case MYSQL_TYPE_INT24:
+    case MYSQL_TYPE_LONG:
+    case MYSQL_TYPE_LONGLONG:
+      break;
+    default:
+      return false;
+  }
+  spec->has_column = true;
+  spec->offset = field->offset(table->record[0]);
+  if (field->is_nullable()) {
+    spec->null_offset = field->null_offset();
+    spec->null_bit = field->null_bit;
+  }
+  spec->length = field->pack_length();
+  spec->is_unsigned = field->is_unsigned();
+  spec->low_byte_first = table->s->db_low_byte_first;
+
+  // An unsigned 64-bit value does not fit in the integer part of the sum.
+  if (spec->kind == ParallelAggregateSpec::SUM && spec->is_unsigned &&
+      spec->length == 8) {
+    return false;
+  }
+  return true;
+}
+
+bool CanAggregateInParallelScan(const JOIN *join, const TABLE *table) {
+  if (!join->implicit_grouping || join->group_optimized_away ||
+      join->having_cond != nullptr || join->sum_funcs == nullptr ||
+      join->sum_funcs[0] == nullptr) {
+    return false;
+  }
+  for (Item_sum **item = join->sum_funcs; *item != nullptr; ++item) {
+    ParallelAggregateSpec spec;
+    if (!MakeParallelAggregateSpec(join, table, *item, &spec)) return false;
+  }
+  // Anything else in the result row would have to be evaluated on some row,
+  // which we never load.
+  for (Item *item : *join->fields) {
+    if (item->type() != Item::SUM_FUNC_ITEM && !item->const_item()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+ParallelAggregateIterator::ParallelAggregateIterator(THD *thd, JOIN *join,
+                                                     TABLE *table,
+                                                     size_t num_threads,
+                                                     ha_rows *examined_rows)
+    : RowIterator(thd),
+      m_join(join),
+      m_scan(thd, table, num_threads, examined_rows),
+      m_items(thd->mem_root),
+      m_aggregates(thd->mem_root) {
+  assert(CanAggregateInParallelScan(join, table));
+  for (Item_sum **item = join->sum_funcs; *item != nullptr; ++item) {
+    ParallelAggregateSpec spec;
+    MakeParallelAggregateSpec(join, table, *item, &spec);
+    m_items.push_back(*item);
+    m_aggregates.push_back(spec);
+  }
+  m_scan.set_aggregates(m_aggregates.data(), m_aggregates.size());
+}
+
+bool ParallelAggregateIterator::Init() {
+  m_done = false;
+  return m_scan.Init();
+}
+
+int ParallelAggregateIterator::Read() {
+  if (m_done) return -1;
+
+  const int error = m_scan.Read();
+  if (error == 1) return 1;
+  assert(error == -1);
+  m_done = true;
+
+  // Merge the states of all the reader threads. Each of them may have seen
+  // any number of rows, including none.
+  const std::vector<ParallelAggregateState> &states = m_scan.worker_states();
+  const size_t num_aggregates = m_aggregates.size();
+  for (size_t i = 0; i < num_aggregates; ++i) {
+    Item_sum *item = m_items[i];
+    const ParallelAggregateSpec &spec = m_aggregates[i];
+    item->clear();
+    for (size_t j = i; j < states.size(); j += num_aggregates) {
+      const ParallelAggregateState &worker = states[j];
+      Item_sum_partial_state state;
+      state.count = worker.count;
+      if (spec.kind == ParallelAggregateSpec::SUM) {
+        my_decimal value;
+        if (int2my_decimal(E_DEC_FATAL_ERROR, worker.value,
+                           /*unsigned_flag=*/false, &value) ||
+            my_decimal_add(E_DEC_FATAL_ERROR, &state.decimal_value,
+                           &worker.overflow_sum, &value)) {
+          return 1;
+        }
+      } else {
+        state.int_value = worker.value;
+      }
+      item->merge_partial_state(state);
+    }
+  }
+  return thd()->is_error() ? 1 : 0;
+}
@@ -0,0 +1,274 @@
+#ifndef SQL_ITERATORS_PARALLEL_SCAN_ITERATOR_H_
+#define SQL_ITERATORS_PARALLEL_SCAN_ITERATOR_H_
+
+/* Copyright (c) 2023, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+/**
+  @file
+
+  A table scan that reads the table with several threads, through the
+  handler's parallel scan interface (handler::parallel_scan_init() and
+  friends). For InnoDB, this is Parallel_reader, which splits the clustered
+  index into ranges and reads them concurrently.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "my_base.h"
+#include "my_inttypes.h"
+#include "sql-common/my_decimal.h"
+#include "sql/iterators/row_iterator.h"
+#include "sql/mem_root_array.h"
+
+class Item_sum;
+class JOIN;
+class RowBatch;
+class THD;
+class Query_block;
+struct TABLE;
+
+/**
+  An aggregate function that the reader threads of a parallel scan compute
+  directly from the records they read, without evaluating any Items; see
+  ParallelAggregateIterator. The argument is an integer column, described by
+  where it is in the record, or no column at all (COUNT(*)).
+ */
+struct ParallelAggregateSpec {
+  enum Kind { COUNT, SUM, MIN, MAX };
+  Kind kind;
+
+  /// False for COUNT(*).
+  bool has_column{false};
+  size_t offset{0};
+  /// The byte and bit holding the NULL flag, if the column is nullable.
+  size_t null_offset{0};
+  uchar null_bit{0};
+  /// The size of the integer in the record (1, 2, 3, 4 or 8 bytes).
+  uint length{0};
+  bool is_unsigned{false};
+  /// See TABLE_SHARE::db_low_byte_first.
+  bool low_byte_first{true};
+};
+
+/// The state of one ParallelAggregateSpec, for the rows seen by one thread.
+struct ParallelAggregateState {
+  /// The number of non-NULL values.
+  ulonglong count{0};
+  /// For SUM, the part of the sum that fits in an integer; for MIN and MAX,
+  /// the value so far.
+  longlong value{0};
+  /// For SUM, what was moved out of "value" before it would overflow.
+  my_decimal overflow_sum;
+
+  ParallelAggregateState() { my_decimal_set_zero(&overflow_sum); }
+};
+
+/**
+  Scans a table with several reader threads, and gathers the rows into the
+  session thread, which returns them one by one like TableScanIterator does.
+  The rows come in no particular order.
+
+  The readers run inside the storage engine, and hand over full records in
+  the MySQL row format in batches. They are stopped when the gather queue is
+  full, so that the memory used is bounded, and aborted if the iterator is
+  destroyed or re-initialized before all rows have been read (e.g. because
+  of a LIMIT).
+
+  Nothing but the storage engine runs in the reader threads, so all Item
+  evaluation above this iterator stays single-threaded; the gain is in
+  reading and decoding the records. Use ParallelTableScanThreads() to decide
+  whether a table can be scanned this way.
+
+  If the storage engine cannot give us any reader threads (they are a shared
+  resource, see innodb_parallel_read_threads), the iterator falls back to an
+  ordinary handler scan.
+ */
+class ParallelTableScanIterator final : public TableRowIterator {
+ public:
+  /**
+    @param thd          session context
+    @param table        table to be scanned
+    @param num_threads  the desired number of reader threads
+    @param examined_rows if not nullptr, is incremented for each successful
+                        Read().
+  */
+  ParallelTableScanIterator(THD *thd, TABLE *table, size_t num_threads,
+                            ha_rows *examined_rows);
+  ~ParallelTableScanIterator() override;
+
+  bool Init() override;
+  int Read() override;
+  int ReadBatch(RowBatch *batch) override;
+
+  /// The number of reader threads of the last scan, or 0 if it fell back to
+  /// an ordinary handler scan.
+  size_t num_reader_threads() const { return m_num_reader_threads; }
+
+  /**
+    Make the reader threads aggregate the rows themselves instead of handing
+    them over; Read() then returns -1 (or 1 on error) without returning any
+    rows, after which worker_states() holds the result. Must be called
+    before Init(). If the scan falls back to a single thread, the session
+    thread aggregates the rows the same way.
+   */
+  void set_aggregates(const ParallelAggregateSpec *aggregates,
+                      size_t num_aggregates) {
+    m_aggregates = aggregates;
+    m_num_aggregates = num_aggregates;
+  }
+
+  /// The aggregate states, num_aggregates per thread, one thread after the
+  /// other. Valid after Read() has returned -1.
+  const std::vector<ParallelAggregateState> &worker_states() const {
+    return m_worker_states;
+  }
+
+ private:
+  /// The body of the gather thread, which runs the parallel scan.
+  void RunScan();
+
+  /// Called from the reader threads with a batch of "num_rows" records.
+  /// Waits for room in the queue. Returns true if the scan should be aborted.
+  bool EnqueueRows(uint num_rows, const uchar *rows);
+
+  /// Called from the reader threads instead of EnqueueRows() if the rows are
+  /// to be aggregated. "states" is the thread's own part of m_worker_states.
+  bool AggregateRows(uint num_rows, const uchar *rows,
+                     ParallelAggregateState *states);
+
+  /// Make the next batch from the queue the current one. Same return values
+  /// as Read().
+  int ReadNextBatch();
+
+  /// Read() when aggregating: waits for the scan to end.
+  int ReadAggregated();
+
+  /// Abort the scan if it is still running, and wait for it to stop.
+  void StopScan();
+
+  uchar *const m_record;
+  const size_t m_row_length;
+  const size_t m_desired_threads;
+  ha_rows *const m_examined_rows;
+
+  /// True if we fell back to reading through ha_rnd_next().
+  bool m_serial_scan{false};
+
+  /// The handler's scan context, from handler::parallel_scan_init().
+  void *m_scan_ctx{nullptr};
+  size_t m_num_reader_threads{0};
+
+  /// Runs handler::parallel_scan(), which returns when the readers are done.
+  std::thread m_gather_thread;
+
+  /// Protects everything below, up to m_current_batch.
+  std::mutex m_mutex;
+  std::condition_variable m_batch_available;
+  std::condition_variable m_room_available;
+
+  /// Batches of rows that have been read, but not returned yet.
+  std::deque<std::vector<uchar>> m_queue;
+  size_t m_max_queued_batches{0};
+
+  /// Set when the gather thread is done; m_scan_error is its result.
+  bool m_scan_done{false};
+  int m_scan_error{0};
+
+  /// Set by StopScan() to make the readers stop.
+  bool m_abort{false};
+
+  /// The number of rows aggregated by the readers; see set_aggregates().
+  ha_rows m_aggregated_rows{0};
+
+  /// The batch that Read() returns rows from, and the next row in it.
+  std::vector<uchar> m_current_batch;
+  size_t m_next_row{0};
+
+  /// See set_aggregates().
+  const ParallelAggregateSpec *m_aggregates{nullptr};
+  size_t m_num_aggregates{0};
+  std::vector<ParallelAggregateState> m_worker_states;
+};
+
+/**
+  Computes aggregate functions without GROUP BY over a parallel table scan,
+  by letting each reader thread aggregate the rows it reads (see
+  ParallelTableScanIterator::set_aggregates()), and then merging the states
+  of the threads into the Item_sum objects with
+  Item_sum::merge_partial_state(). Returns a single row, like
+  AggregateIterator does for implicitly grouped queries.
+
+  Only COUNT, and SUM, AVG, MIN and MAX over integer columns, are supported;
+  use CanAggregateInParallelScan() to check a query.
+ */
+class ParallelAggregateIterator final : public RowIterator {
+ public:
+  ParallelAggregateIterator(THD *thd, JOIN *join, TABLE *table,
+                            size_t num_threads, ha_rows *examined_rows);
+
+  bool Init() override;
+  int Read() override;
+  void SetNullRowFlag(bool is_null_row) override {
+    m_scan.SetNullRowFlag(is_null_row);
+  }
+  void UnlockRow() override {}
+
+ private:
+  JOIN *const m_join;
+  ParallelTableScanIterator m_scan;
+
+  /// The functions being computed, and what the readers compute for each.
+  Mem_root_array<Item_sum *> m_items;
+  Mem_root_array<ParallelAggregateSpec> m_aggregates;
+
+  bool m_done{false};
+};
+
+/**
+  Whether the aggregation in "join", which has "table" as its only table,
+  can be done by ParallelAggregateIterator: there is no GROUP BY, ROLLUP or
+  HAVING, everything in the SELECT list is either a supported aggregate
+  function or a constant, and the aggregate arguments are integer columns.
+ */
+bool CanAggregateInParallelScan(const JOIN *join, const TABLE *table);
+
+/**
+  Returns the number of reader threads to use for scanning "table" with
+  ParallelTableScanIterator, or 0 if it should be scanned by a single thread.
+  That is the case unless the parallel_table_scan_threads variable is above
+  one, the statement is a non-locking SELECT with "table" as the only table
+  of the outermost query block, and the table is a base table in InnoDB
+  without BLOB or virtual columns. These conditions ensure that reading
+  ahead is not visible, and that nobody needs to position the handler on the
+  rows (e.g. for row IDs).
+ */
+size_t ParallelTableScanThreads(THD *thd, const Query_block *query_block,
+                                const TABLE *table);
+
+#endif  // SQL_ITERATORS_PARALLEL_SCAN_ITERATOR_H_
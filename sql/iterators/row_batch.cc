@@ -0,0 +1,178 @@
+/* Copyright (c) 2023, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+#include "sql/iterators/row_batch.h"
+
+#include <algorithm>
+
+#include "my_alloc.h"
+#include "mysqld_error.h"
+#include "sql/handler.h"
+#include "sql/item.h"
+#include "sql/iterators/row_iterator.h"
+#include "sql/sql_class.h"
+#include "sql/sql_lex.h"
+#include "sql/system_variables.h"
+#include "sql/table.h"
+#include "thr_lock.h"
+
+using pack_rows::TableCollection;
+
+/// Upper limit on the memory used by the row data of a single batch.
+/// Wide rows get smaller batches.
+static constexpr size_t kMaxRowBatchBytes = 1024 * 1024;
+
+bool RowBatch::Reserve(MEM_ROOT *mem_root, size_t capacity) {
+  assert(m_rows == nullptr);
+  assert(!m_tables.has_blob_column());
+  m_row_size = std::max<size_t>(ComputeRowSizeUpperBound(m_tables), 1);
+  m_capacity = std::max<size_t>(
+      std::min(capacity, kMaxRowBatchBytes / m_row_size), 1);
+  m_rows = mem_root->ArrayAlloc<uchar>(m_capacity * m_row_size);
+  m_selection = mem_root->ArrayAlloc<uint16_t>(m_capacity);
+  m_matches = mem_root->ArrayAlloc<uchar>(m_capacity);
+  if (m_rows == nullptr || m_selection == nullptr || m_matches == nullptr) {
+    my_error(ER_OUTOFMEMORY, MYF(0), m_capacity * m_row_size);
+    return true;
+  }
+  m_mem_root = mem_root;
+  Clear();
+  return false;
+}
+
+int RowBatch::AddColumn(Item *item, bool as_date) {
+  for (size_t i = 0; i < m_num_columns; ++i) {
+    if (m_columns[i].item == item && m_columns[i].as_date == as_date) {
+      return static_cast<int>(i);
+    }
+  }
+  if (m_num_columns == kMaxColumns || m_mem_root == nullptr) return -1;
+
+  Column &column = m_columns[m_num_columns];
+  column.item = item;
+  column.as_date = as_date;
+  column.values = m_mem_root->ArrayAlloc<longlong>(m_capacity);
+  column.nulls = m_mem_root->ArrayAlloc<uchar>(m_capacity);
+  if (column.values == nullptr || column.nulls == nullptr) return -1;
+  return static_cast<int>(m_num_columns++);
+}
+
+void RowBatch::StoreColumnValues(size_t row) {
+  for (size_t i = 0; i < m_num_columns; ++i) {
+    Column &column = m_columns[i];
+    Item *item = column.item;
+    longlong value =
+        column.as_date ? item->val_date_temporal() : item->val_int();
+    if (item->unsigned_flag) {
+      value = static_cast<longlong>(static_cast<ulonglong>(value) ^
+                                    (ulonglong{1} << 63));
+    }
+    column.values[row] = value;
+    column.nulls[row] = item->null_value;
+  }
+}
+
+// The fallback for iterators that do not produce batches natively: just read
+// one row at a time and pack it into the batch.
+int RowIterator::ReadBatch(RowBatch *batch) {
+  batch->Clear();
+  while (!batch->full()) {
+    const int err = Read();
+    if (err == 1) return 1;
+    if (err == -1) {
+      batch->set_eof();
+      break;
+    }
+    batch->AppendFromTableBuffers();
+  }
+  return batch->num_selected() == 0 ? -1 : 0;
+}
+
+size_t RowBatchSize(THD *thd, const TableCollection &tables) {
+  const size_t batch_size = thd->variables.iterator_batch_size;
+  if (batch_size <= 1) return 0;
+
+  // Reading ahead must not be visible. Locking reads would lock rows the
+  // consumer may never see (and UnlockRow() would unlock the wrong row).
+  if (thd->lex->sql_command != SQLCOM_SELECT ||
+      thd->tx_isolation == ISO_SERIALIZABLE) {
+    return 0;
+  }
+
+  // Rows with BLOBs point into storage engine memory that is only valid
+  // until the next read, and have no fixed upper size. Row IDs and full-text
+  // search state belong to the row the handler is positioned on, which is not
+  // necessarily the one restored from the batch.
+  if (tables.has_blob_column() || tables.store_rowids()) return 0;
+
+  for (const pack_rows::Table &tbl : tables.tables()) {
+    const TABLE *table = tbl.table;
+    const Table_ref *table_ref = table->pos_in_table_list;
+    if (table_ref != nullptr && table_ref->is_fulltext_searched()) return 0;
+    if (table->s->tmp_table == NO_TMP_TABLE) {
+      if (table->reginfo.lock_type != TL_READ) return 0;
+    } else if (table_ref != nullptr && table_ref->is_recursive_reference()) {
+      // The work table of a recursive CTE grows while it is being read.
+      return 0;
+    }
+  }
+  return batch_size;
+}
+
+bool RowBatchReader::Init(THD *thd, RowIterator *source) {
+  m_source = source;
+  m_next_selected = 0;
+
+  const size_t batch_size = RowBatchSize(thd, m_batch.tables());
+  m_batch_mode = batch_size > 0;
+  if (!m_batch_mode) return false;
+
+  if (m_batch.capacity() == 0) {
+    // First execution; allocate the batch. It lives as long as the iterator,
+    // which lives on the same MEM_ROOT.
+    if (m_batch.Reserve(thd->mem_root, batch_size)) return true;
+  }
+  m_batch.Clear();
+  return false;
+}
+
+int RowBatchReader::ReadNextBatch() {
+  if (m_batch.eof()) return -1;
+
+  // Put the source's last row back, so that the source finds the table
+  // buffers the way it left them.
+  if (m_batch.num_rows() > 0) m_batch.LoadLastRow();
+
+  m_next_selected = 0;
+  return m_source->ReadBatch(&m_batch);
+}
+
+int RowBatchReader::Read() {
+  if (!m_batch_mode) return m_source->Read();
+
+  if (m_next_selected == m_batch.num_selected()) {
+    const int err = ReadNextBatch();
+    if (err != 0) return err;
+  }
+  m_batch.LoadRow(m_batch.selected_row(m_next_selected++));
+  return 0;
+}
@@ -0,0 +1,274 @@
+#ifndef SQL_ITERATORS_ROW_BATCH_H_
+#define SQL_ITERATORS_ROW_BATCH_H_
+
+/* Copyright (c) 2023, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+/**
+  @file
+
+  Support for reading rows from a RowIterator in batches instead of one at a
+  time; see RowIterator::ReadBatch().
+
+  A batch is filled by the iterator tree in one call, which lets scans and
+  filters run their inner loops without going back up through every
+  consumer for each row. The consumer then walks the batch and restores one
+  row at a time into the table buffers, so that Item evaluation works exactly
+  as for row-at-a-time execution.
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "my_inttypes.h"
+#include "sql/pack_rows.h"
+
+class Item;
+class RowIterator;
+class THD;
+struct MEM_ROOT;
+
+/**
+  A set of rows produced by RowIterator::ReadBatch().
+
+  The rows are stored in the packed format from pack_rows.h, in the order they
+  were read from the source. In addition, the batch holds a selection vector
+  of the rows that are still live; iterators such as FilterIterator remove
+  rows from the selection instead of moving row data around. The rows that
+  are not selected are kept, since the last row read (selected or not) may
+  need to be restored before the source can be asked for more rows; see
+  LoadLastRow().
+
+  Batches are only used for tables without BLOB columns, so that every row
+  has a fixed upper size, and the buffer can be allocated up front.
+
+  Optionally, the batch can also hold value columns: for a few integer
+  expressions (typically columns that are filtered on), the value of the
+  expression for each row is computed when the row is added, and stored
+  contiguously, so that predicates can be evaluated on the entire batch at
+  once without restoring each row; see Batch_int_predicate.
+ */
+class RowBatch {
+ public:
+  /// The maximum number of value columns in a batch.
+  static constexpr size_t kMaxColumns = 8;
+
+  explicit RowBatch(const pack_rows::TableCollection &tables)
+      : m_tables(tables) {}
+
+  /**
+    Allocate room for up to "capacity" rows. Must be called before anything
+    is added to the batch. Returns true on OOM.
+   */
+  bool Reserve(MEM_ROOT *mem_root, size_t capacity);
+
+  const pack_rows::TableCollection &tables() const { return m_tables; }
+  size_t capacity() const { return m_capacity; }
+  bool full() const { return m_num_rows == m_capacity; }
+
+  /// Number of rows stored in the batch, selected or not.
+  size_t num_rows() const { return m_num_rows; }
+
+  /// Number of rows in the selection vector.
+  size_t num_selected() const { return m_num_selected; }
+
+  /// The index of the idx-th selected row, for use with LoadRow().
+  uint16_t selected_row(size_t idx) const {
+    assert(idx < m_num_selected);
+    return m_selection[idx];
+  }
+
+  /**
+    Overwrite an entry in the selection vector. Used for compacting the
+    selection in place, together with TruncateSelection().
+   */
+  void set_selected_row(size_t idx, uint16_t row) {
+    assert(idx < m_num_selected && row < m_num_rows);
+    m_selection[idx] = row;
+  }
+
+  void TruncateSelection(size_t num_selected) {
+    assert(num_selected <= m_num_selected);
+    m_num_selected = num_selected;
+  }
+
+  /**
+    Set by the producer when its input is exhausted. The consumer must not
+    call ReadBatch() again after having seen this (until the next Init()).
+   */
+  bool eof() const { return m_eof; }
+  void set_eof() { m_eof = true; }
+
+  /// Remove all rows, and reset the EOF flag.
+  void Clear() {
+    m_num_rows = 0;
+    m_num_selected = 0;
+    m_eof = false;
+  }
+
+  /**
+    Request a value column holding the value of "item" for each row.
+    Adding the same item twice returns the existing column. The values are
+    only computed for rows that are added after the call, so this must be
+    called before asking the source for rows. Columns are kept until the
+    batch is destroyed; Clear() does not remove them.
+
+    @param item     The expression to compute; usually an Item_field.
+    @param as_date  If true, store item->val_date_temporal() instead of
+                    item->val_int().
+
+    @returns the index of the column, or -1 if there is no room for more
+      columns (or on OOM, which is not reported).
+   */
+  int AddColumn(Item *item, bool as_date);
+
+  /**
+    The values of the given column, one per stored row (not per selected
+    row). Values of unsigned items are stored offset by 2^63 (i.e., with the
+    sign bit flipped), so that comparing them as signed integers gives the
+    right order for all items.
+   */
+  const longlong *column_values(int idx) const {
+    assert(idx >= 0 && static_cast<size_t>(idx) < m_num_columns);
+    return m_columns[idx].values;
+  }
+
+  /// For each stored row, 1 if the column value is NULL, 0 otherwise.
+  const uchar *column_nulls(int idx) const {
+    assert(idx >= 0 && static_cast<size_t>(idx) < m_num_columns);
+    return m_columns[idx].nulls;
+  }
+
+  /**
+    A scratch buffer of capacity() bytes, for predicates on value columns to
+    write their results (one byte per stored row) into.
+   */
+  uchar *match_buffer() const { return m_matches; }
+
+  /// Pack the row that is currently in the table buffers and add it to the
+  /// end of the batch, as a selected row. The batch must not be full.
+  void AppendFromTableBuffers() {
+    assert(!full());
+    StoreFromTableBuffersRaw(m_tables, m_rows + m_num_rows * m_row_size);
+    if (m_num_columns > 0) StoreColumnValues(m_num_rows);
+    m_selection[m_num_selected++] = m_num_rows++;
+  }
+
+  /// Restore the given row (an index into the stored rows, not into the
+  /// selection vector) into the table buffers.
+  void LoadRow(size_t row) const {
+    assert(row < m_num_rows);
+    LoadIntoTableBuffers(m_tables, m_rows + row * m_row_size);
+  }
+
+  /// Restore the last row that was added to the batch, which is the last row
+  /// the source returned. This puts the table buffers back into the state the
+  /// source left them in, which iterators like NestedLoopIterator depend on.
+  void LoadLastRow() const { LoadRow(m_num_rows - 1); }
+
+ private:
+  struct Column {
+    Item *item;
+    bool as_date;
+    longlong *values;
+    uchar *nulls;
+  };
+
+  /// Compute the value columns for the row in the table buffers, and store
+  /// them as stored row number "row".
+  void StoreColumnValues(size_t row);
+
+  const pack_rows::TableCollection &m_tables;
+
+  /// Where the value columns are allocated. Set by Reserve().
+  MEM_ROOT *m_mem_root{nullptr};
+
+  /// Upper bound on the size of a packed row.
+  size_t m_row_size{0};
+
+  size_t m_capacity{0};
+  size_t m_num_rows{0};
+  size_t m_num_selected{0};
+  bool m_eof{false};
+
+  /// Packed rows, m_row_size bytes apart.
+  uchar *m_rows{nullptr};
+
+  /// Indexes of the selected rows, in increasing order.
+  uint16_t *m_selection{nullptr};
+
+  /// See match_buffer().
+  uchar *m_matches{nullptr};
+
+  Column m_columns[kMaxColumns];
+  size_t m_num_columns{0};
+};
+
+/**
+  Reads rows from a RowIterator through the batch interface, and hands them
+  out one at a time with the same contract as RowIterator::Read(). If batch
+  mode is not enabled for the iterator, all calls are simply forwarded to
+  the source's Read().
+
+  This is used by iterators that consume all (or almost all) rows from their
+  child, such as AggregateIterator and the build phase of HashJoinIterator.
+ */
+class RowBatchReader {
+ public:
+  explicit RowBatchReader(const pack_rows::TableCollection &tables)
+      : m_batch(tables) {}
+
+  /**
+    Prepare for reading from "source", which must already be initialized.
+    Batch mode is used if it is enabled and safe for the given tables; see
+    RowBatchSize(). Returns true on OOM.
+   */
+  bool Init(THD *thd, RowIterator *source);
+
+  /// Same contract as RowIterator::Read().
+  int Read();
+
+  bool batch_mode() const { return m_batch_mode; }
+
+ private:
+  int ReadNextBatch();
+
+  RowIterator *m_source{nullptr};
+  RowBatch m_batch;
+  bool m_batch_mode{false};
+
+  /// The next entry in the batch's selection vector to return.
+  size_t m_next_selected{0};
+};
+
+/**
+  Returns the number of rows per batch to use when reading rows for the
+  given tables in batch mode, or 0 if batch mode should not be used.
+  Batch mode is off by default (see the iterator_batch_size system variable),
+  and is never used if reading ahead could be observed, i.e., for locking
+  reads, for tables with BLOBs, for full-text search, or if row IDs are
+  needed.
+ */
+size_t RowBatchSize(THD *thd, const pack_rows::TableCollection &tables);
+
+#endif  // SQL_ITERATORS_ROW_BATCH_H_
@@ -28,6 +28,7 @@
 
 class Item;
 class JOIN;
+class RowBatch;
 class THD;
 struct TABLE;
 
@@ -50,6 +51,13 @@ class IteratorProfiler {
 
   /** The number of rows fetched. (Sum for all loops.)*/
   virtual uint64_t GetNumRows() const = 0;
+
+  /**
+    The number of storage engine row reads (handler::ha_index_*() and
+    ha_rnd_*() calls) made by this iterator and its children. (Sum for all
+    loops.) 0 if not measured.
+  */
+  virtual uint64_t GetNumStorageReads() const { return 0; }
   virtual ~IteratorProfiler() = default;
 };
 
@@ -114,6 +122,31 @@ class RowIterator {
    */
   virtual int Read() = 0;
 
+  /**
+    Read a batch of rows. The batch is cleared and then filled with as many
+    rows as fit (fewer if the end of the input is reached), which the caller
+    then restores into the record buffers one by one using RowBatch::LoadRow().
+    When the input is exhausted, the EOF flag of the batch is set, and the
+    caller must not call ReadBatch() again until after the next Init().
+
+    Before calling ReadBatch() again, the caller must call
+    RowBatch::LoadLastRow(), so that the iterator sees the record buffers in
+    the same state as after a regular Read(). Calls to Read() and ReadBatch()
+    must not be mixed between two calls to Init().
+
+    The default implementation calls Read() repeatedly; iterators that can do
+    better (e.g. by avoiding virtual calls in their inner loop) override it.
+    This is only used if RowBatchSize() says it is safe; see row_batch.h.
+
+    @retval
+      0   OK; at least one row was selected
+    @retval
+      -1   End of records; no rows were selected
+    @retval
+      1   Error
+   */
+  virtual int ReadBatch(RowBatch *batch);
+
   /**
     Mark the current row buffer as containing a NULL row or not, so that if you
     read from it and the flag is true, you'll get only NULLs no matter what is
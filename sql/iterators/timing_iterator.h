@@ -28,6 +28,7 @@
 #include <chrono>
 
 #include "my_alloc.h"
+#include "sql/iterators/row_batch.h"
 #include "sql/iterators/row_iterator.h"
 #include "sql/sql_class.h"
 #include "sql/sql_lex.h"
@@ -67,6 +68,22 @@ class IteratorProfilerImpl final : public IteratorProfiler {
 
   uint64_t GetNumInitCalls() const override { return m_num_init_calls; }
   uint64_t GetNumRows() const override { return m_num_rows; }
+  uint64_t GetNumStorageReads() const override { return m_num_storage_reads; }
+
+  /**
+    Return the number of storage engine row reads done by the session so
+    far, as counted by the Handler_read_* status variables.
+  */
+  static uint64_t StorageReads(const THD *thd) {
+    const System_status_var &status = thd->status_var;
+    return status.ha_read_first_count + status.ha_read_last_count +
+           status.ha_read_key_count + status.ha_read_next_count +
+           status.ha_read_prev_count + status.ha_read_rnd_count +
+           status.ha_read_rnd_next_count;
+  }
+
+  /** Add the storage engine row reads done by an Init() or Read() call.*/
+  void AddStorageReads(uint64_t num_reads) { m_num_storage_reads += num_reads; }
 
   /** Mark the end of an iterator->Init() call.*/
   void StopInit(TimeStamp start_time) {
@@ -101,6 +118,16 @@ class IteratorProfilerImpl final : public IteratorProfiler {
     }
   }
 
+  /**
+      Mark the end of an iterator->ReadBatch() call.
+      @param start_time time when ReadBatch() started.
+      @param num_rows the number of rows returned in the batch.
+  */
+  void StopReadBatch(TimeStamp start_time, uint64_t num_rows) {
+    StopRead(start_time, /*read_ok=*/false);
+    m_num_rows += num_rows;
+  }
+
  private:
   static double DurationToMs(duration dur) {
     return std::chrono::duration<double>(dur).count() * 1e3;
@@ -112,6 +139,9 @@ class IteratorProfilerImpl final : public IteratorProfiler {
   /** The number of rows fetched. (Sum for all loops.)*/
   uint64_t m_num_rows{0};
 
+  /** The number of storage engine row reads. (Sum for all loops.)*/
+  uint64_t m_num_storage_reads{0};
+
   /** True if we are about to read the first row.*/
   bool m_first_row;
 
@@ -162,18 +192,35 @@ class TimingIterator final : public RowIterator {
       : RowIterator(thd), m_iterator(thd, std::forward<Args>(args)...) {}
 
   bool Init() override {
+    const uint64_t start_reads = IteratorProfilerImpl::StorageReads(thd());
     const IteratorProfilerImpl::TimeStamp start_time =
         IteratorProfilerImpl::Now();
     bool err = m_iterator.Init();
     m_profiler.StopInit(start_time);
+    m_profiler.AddStorageReads(IteratorProfilerImpl::StorageReads(thd()) -
+                               start_reads);
     return err;
   }
 
   int Read() override {
+    const uint64_t start_reads = IteratorProfilerImpl::StorageReads(thd());
     const IteratorProfilerImpl::TimeStamp start_time =
         IteratorProfilerImpl::Now();
     int err = m_iterator.Read();
     m_profiler.StopRead(start_time, err == 0);
+    m_profiler.AddStorageReads(IteratorProfilerImpl::StorageReads(thd()) -
+                               start_reads);
+    return err;
+  }
+
+  int ReadBatch(RowBatch *batch) override {
+    const uint64_t start_reads = IteratorProfilerImpl::StorageReads(thd());
+    const IteratorProfilerImpl::TimeStamp start_time =
+        IteratorProfilerImpl::Now();
+    int err = m_iterator.ReadBatch(batch);
+    m_profiler.StopReadBatch(start_time, err == 0 ? batch->num_selected() : 0);
+    m_profiler.AddStorageReads(IteratorProfilerImpl::StorageReads(thd()) -
+                               start_reads);
     return err;
   }
 
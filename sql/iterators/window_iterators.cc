@@ -893,6 +893,20 @@ bool process_buffered_windowing_record(THD *thd, Temp_table_param *param,
 
   w.set_rowno_in_partition(current_row);
 
+  /**
+    Possible adjustment of the logical upper_limit: no rows exist beyond
+    last_rowno_in_cache.
+  */
+  const int64 upper = min(upper_limit, last_rowno_in_cache);
+
+  /**
+    If true, the MIN/MAX functions keep their values from the previous row's
+    frame and only visit the rows which came into the frame since.
+  */
+  const bool min_max_sliding = w.slidable_min_max() && current_row != 1 &&
+                               lower_limit <= upper &&
+                               w.can_slide_min_max(lower_limit);
+
   /*
     By default, we must:
     - if we are the first row of a partition, reset values for both
@@ -912,8 +926,9 @@ bool process_buffered_windowing_record(THD *thd, Temp_table_param *param,
     reused without change, so all the above resetting must be skipped;
     so row restoration isn't immediately needed; that and the computation of
     non-framing functions is then done in another later block of code.
-    Likewise, if we have framing WFs with inversion, and it's not the
-    first row of the partition, we must skip the resetting of framing WFs.
+    Likewise, if we have framing WFs with inversion, or sliding MIN/MAX,
+    and it's not the first row of the partition, we must skip the resetting
+    of framing WFs.
   */
   if (!static_aggregate || current_row == 1) {
     /*
@@ -926,14 +941,14 @@ bool process_buffered_windowing_record(THD *thd, Temp_table_param *param,
 
     if (current_row == 1)  // new partition
       reset_non_framing_wf_state(param->items_to_copy);
-    if (!optimizable || current_row == 1)  // new frame
+    if (!(optimizable || min_max_sliding) || current_row == 1)  // new frame
     {
       reset_framing_wf_states(param->items_to_copy);
     }  // else we remember state and update it for row 2..N
 
     /* E.g. ROW_NUMBER, RANK, DENSE_RANK */
     if (copy_funcs(param, thd, CFT_WF_NON_FRAMING)) return true;
-    if (!optimizable || current_row == 1) {
+    if (!(optimizable || min_max_sliding) || current_row == 1) {
       /*
         So far frame is empty; set up a flag which makes framing WFs set
         themselves to NULL in OUT.
@@ -959,12 +974,6 @@ bool process_buffered_windowing_record(THD *thd, Temp_table_param *param,
   */
   bool optimizable_primed = false;
 
-  /**
-    Possible adjustment of the logical upper_limit: no rows exist beyond
-    last_rowno_in_cache.
-  */
-  const int64 upper = min(upper_limit, last_rowno_in_cache);
-
   /*
     Optimization: we evaluate the peer set of the current row potentially
     several times. Window functions like CUME_DIST sets needs_peerset and is
@@ -978,10 +987,14 @@ bool process_buffered_windowing_record(THD *thd, Temp_table_param *param,
       (!static_aggregate && !optimizable))        // normal: no skip
   {
     // Compute and output current_row.
-    int64 rowno;        ///< iterates over rows in a frame
+    int64 rowno = lower_limit;  ///< iterates over rows in a frame
     int64 skipped = 0;  ///< RANGE: # of visited rows seen before the frame
 
-    for (rowno = lower_limit; rowno <= upper; rowno++) {
+    // Sliding MIN/MAX have already visited the frame up to the previous row's
+    if (min_max_sliding)
+      rowno = std::max(rowno, w.last_rowno_in_min_max_frame() + 1);
+
+    for (; rowno <= upper; rowno++) {
       if (optimizable) optimizable_primed = true;
 
       /*
@@ -1068,6 +1081,8 @@ bool process_buffered_windowing_record(THD *thd, Temp_table_param *param,
         have_peers_current_row = true;
       }
     }  // else: we already set it before breaking out of loop
+
+    if (w.slidable_min_max()) w.set_last_rowno_in_min_max_frame(upper);
   }
 
   /*
@@ -43,6 +43,7 @@
 #include "sql/iterators/composite_iterators.h"
 #include "sql/iterators/delete_rows_iterator.h"
 #include "sql/iterators/hash_join_iterator.h"
+#include "sql/iterators/parallel_scan_iterator.h"
 #include "sql/iterators/ref_row_iterators.h"
 #include "sql/iterators/row_iterator.h"
 #include "sql/iterators/sorting_iterator.h"
@@ -528,8 +529,15 @@ unique_ptr_destroy_only<RowIterator> CreateIteratorFromAccessPath(
     switch (path->type) {
       case AccessPath::TABLE_SCAN: {
         const auto &param = path->table_scan();
-        iterator = NewIterator<TableScanIterator>(
-            thd, mem_root, param.table, path->num_output_rows(), examined_rows);
+        if (param.num_parallel_threads > 0) {
+          iterator = NewIterator<ParallelTableScanIterator>(
+              thd, mem_root, param.table, param.num_parallel_threads,
+              examined_rows);
+        } else {
+          iterator = NewIterator<TableScanIterator>(
+              thd, mem_root, param.table, path->num_output_rows(),
+              examined_rows);
+        }
         break;
       }
       case AccessPath::INDEX_SCAN: {
@@ -976,7 +984,8 @@ unique_ptr_destroy_only<RowIterator> CreateIteratorFromAccessPath(
           return nullptr;
         }
         iterator = NewIterator<FilterIterator>(
-            thd, mem_root, std::move(job.children[0]), param.condition);
+            thd, mem_root, std::move(job.children[0]), param.condition,
+            param.batch_filter);
         break;
       }
       case AccessPath::SORT: {
@@ -1004,6 +1013,21 @@ unique_ptr_destroy_only<RowIterator> CreateIteratorFromAccessPath(
       }
       case AccessPath::AGGREGATE: {
         const auto &param = path->aggregate();
+        const AccessPath *child = param.child;
+        if (job.children.is_null() && join != nullptr &&
+            child->type == AccessPath::TABLE_SCAN &&
+            child->table_scan().num_parallel_threads > 0 &&
+            param.olap != ROLLUP_TYPE &&
+            CanAggregateInParallelScan(join, child->table_scan().table)) {
+          // Let the reader threads aggregate, instead of sending all the rows
+          // through a single thread.
+          ha_rows *child_examined_rows =
+              child->count_examined_rows ? &join->examined_rows : nullptr;
+          iterator = NewIterator<ParallelAggregateIterator>(
+              thd, mem_root, join, child->table_scan().table,
+              child->table_scan().num_parallel_threads, child_examined_rows);
+          break;
+        }
         if (job.children.is_null()) {
           SetupJobsForChildren(mem_root, param.child, join,
                                eligible_for_batch_mode, &job, &todo);
@@ -1536,6 +1560,7 @@ void ExpandSingleFilterAccessPath(THD *thd, AccessPath *path, const JOIN *join,
     // We don't bother trying to materialize subqueries in join conditions,
     // since they should be very rare.
     filter_path->filter().materialize_subqueries = false;
+    filter_path->filter().batch_filter = nullptr;
 
     CopyBasicProperties(*right_path, filter_path);
     filter_path->filter().condition = CreateConjunction(&items);
@@ -1593,6 +1618,7 @@ void ExpandSingleFilterAccessPath(THD *thd, AccessPath *path, const JOIN *join,
   path->filter().child = new_path;
   path->has_group_skip_scan = new_path->has_group_skip_scan;
   path->filter().materialize_subqueries = false;
+  path->filter().batch_filter = nullptr;
 
   // Clear filter_predicates, but keep applied_sargable_join_predicates.
   MutableOverflowBitset applied_sargable_join_predicates =
@@ -61,6 +61,7 @@ class Table_function;
 class Temp_table_param;
 class Window;
 struct AccessPath;
+struct Batch_filter;
 struct GroupIndexSkipScanParameters;
 struct IndexSkipScanParameters;
 struct Index_lookup;
@@ -923,6 +924,9 @@ struct AccessPath {
   union {
     struct {
       TABLE *table;
+      // If nonzero, read the table with this many threads; see
+      // ParallelTableScanIterator.
+      size_t num_parallel_threads;
     } table_scan;
     struct {
       TABLE *table;
@@ -1171,6 +1175,11 @@ struct AccessPath {
       //
       // See FinalizeMaterializedSubqueries().
       bool materialize_subqueries;
+
+      // If not nullptr, the parts of “condition” that can be evaluated on
+      // entire batches of rows in batch mode. Set up when finalizing the plan;
+      // see SetupBatchFilter().
+      const Batch_filter *batch_filter;
     } filter;
     struct {
       AccessPath *child;
@@ -1311,6 +1320,7 @@ inline AccessPath *NewTableScanAccessPath(THD *thd, TABLE *table,
   path->type = AccessPath::TABLE_SCAN;
   path->count_examined_rows = count_examined_rows;
   path->table_scan().table = table;
+  path->table_scan().num_parallel_threads = 0;
   return path;
 }
 
@@ -1480,6 +1490,7 @@ inline AccessPath *NewFilterAccessPath(THD *thd, AccessPath *child,
   path->filter().child = child;
   path->filter().condition = condition;
   path->filter().materialize_subqueries = false;
+  path->filter().batch_filter = nullptr;
   path->has_group_skip_scan = child->has_group_skip_scan;
   return path;
 }
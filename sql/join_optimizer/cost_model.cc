@@ -91,6 +91,13 @@ double EstimateCostForRefAccess(THD *thd, TABLE *table, unsigned key_idx,
                            /*worst_seeks=*/DBL_MAX);
 }
 
+double EstimateParallelTableScanCost(double serial_cost, double num_rows,
+                                     size_t num_threads) {
+  assert(num_threads > 1);
+  return kParallelScanStartupCost + serial_cost / num_threads +
+         num_rows * kGatherOneRowCost;
+}
+
 void EstimateSortCost(AccessPath *path) {
   AccessPath *child = path->sort().child;
   const double num_input_rows = child->num_output_rows();
@@ -54,6 +54,12 @@ constexpr double kHashProbeOneRowCost = 0.1;
 constexpr double kHashReturnOneRowCost = 0.07;
 constexpr double kMaterializeOneRowCost = 0.1;
 constexpr double kWindowOneRowCost = 0.1;
+constexpr double kGatherOneRowCost = 0.02;
+
+/// The fixed cost of starting the reader threads of a parallel table scan;
+/// about what it costs to read a few thousand rows. Keeps small tables from
+/// being scanned in parallel.
+constexpr double kParallelScanStartupCost = 500.0;
 
 /// A fallback cardinality estimate that is used in case the storage engine
 /// cannot provide one (like for table functions). It's a fairly arbitrary
@@ -117,6 +123,15 @@ inline FilterCost EstimateFilterCost(
 double EstimateCostForRefAccess(THD *thd, TABLE *table, unsigned key_idx,
                                 double num_output_rows);
 void EstimateSortCost(AccessPath *path);
+
+/**
+  Estimate the cost of scanning a table with "num_threads" reader threads
+  (see ParallelTableScanIterator), given the cost "serial_cost" of scanning
+  it with one thread. The reading is divided between the threads, but every
+  row must still be handed over to the session thread.
+ */
+double EstimateParallelTableScanCost(double serial_cost, double num_rows,
+                                     size_t num_threads);
 void EstimateMaterializeCost(THD *thd, AccessPath *path);
 
 /**
@@ -54,6 +54,7 @@
 #include "sql/item_cmpfunc.h"
 #include "sql/item_subselect.h"
 #include "sql/item_sum.h"
+#include "sql/iterators/hash_join_iterator.h"
 #include "sql/iterators/row_iterator.h"
 #include "sql/join_optimizer/access_path.h"
 #include "sql/join_optimizer/bit_utils.h"
@@ -1017,6 +1018,10 @@ static bool AddPathCosts(const AccessPath *path,
             static_cast<double>(profiler->GetNumRows()) / num_init_calls);
         error |=
             AddMemberToObject<Json_int>(obj, "actual_loops", num_init_calls);
+        if (profiler->GetNumStorageReads() != 0) {
+          error |= AddMemberToObject<Json_int>(
+              obj, "actual_storage_reads", profiler->GetNumStorageReads());
+        }
       }
     }
 
@@ -1076,6 +1081,13 @@ static unique_ptr<Json_object> SetObjectMembers(
             string(" in secondary engine ") + table.file->table_type();
       }
       description += table.file->explain_extra();
+      if (path->table_scan().num_parallel_threads > 0) {
+        error |= AddMemberToObject<Json_uint>(
+            obj, "parallel_threads", path->table_scan().num_parallel_threads);
+        description += " (parallel, " +
+                       std::to_string(path->table_scan().num_parallel_threads) +
+                       " threads)";
+      }
 
       error |= AddTableInfoToObject(obj, &table);
       error |= AddMemberToObject<Json_string>(obj, "access_type", "table");
@@ -1416,6 +1428,62 @@ static unique_ptr<Json_object> SetObjectMembers(
       error |= AddMemberToObject<Json_string>(obj, "access_type", "join");
       error |= AddMemberToObject<Json_string>(obj, "join_type", json_join_type);
       error |= AddMemberToObject<Json_string>(obj, "join_algorithm", "hash");
+      if (thd->lex->is_explain_analyze && path->iterator != nullptr) {
+        // Secondary engines may have their own iterators for hash joins.
+        const auto *hash_join_iterator = dynamic_cast<const HashJoinIterator *>(
+            path->iterator->real_iterator());
+        if (hash_join_iterator != nullptr &&
+            hash_join_iterator->num_hash_table_probes() > 0) {
+          const ha_rows probes = hash_join_iterator->num_hash_table_probes();
+          const ha_rows misses =
+              hash_join_iterator->num_hash_table_probe_misses();
+          error |= AddMemberToObject<Json_uint>(obj, "hash_table_probes",
+                                                probes);
+          error |= AddMemberToObject<Json_uint>(
+              obj, "hash_table_probe_misses", misses);
+          description += " (hash table probes=" + std::to_string(probes) +
+                         " misses=" + std::to_string(misses) + ")";
+        }
+        if (hash_join_iterator != nullptr &&
+            hash_join_iterator->num_bloom_filter_rejections() > 0) {
+          const ha_rows rejections =
+              hash_join_iterator->num_bloom_filter_rejections();
+          error |= AddMemberToObject<Json_uint>(
+              obj, "bloom_filter_rejections", rejections);
+          description += " (bloom filter rejections=" +
+                         std::to_string(rejections) + ")";
+        }
+        if (hash_join_iterator != nullptr &&
+            hash_join_iterator->spill_stats().chunks > 0) {
+          const HashJoinSpillStats &stats = hash_join_iterator->spill_stats();
+          error |= AddMemberToObject<Json_uint>(obj, "spill_chunks",
+                                                stats.chunks);
+          error |= AddMemberToObject<Json_uint>(obj, "spill_build_rows",
+                                                stats.build_rows);
+          error |= AddMemberToObject<Json_uint>(obj, "spill_build_bytes",
+                                                stats.build_bytes);
+          error |= AddMemberToObject<Json_uint>(obj, "spill_probe_rows",
+                                                stats.probe_rows);
+          error |= AddMemberToObject<Json_uint>(obj, "spill_probe_bytes",
+                                                stats.probe_bytes);
+          error |= AddMemberToObject<Json_uint>(
+              obj, "spill_max_chunk_build_rows", stats.max_chunk_build_rows);
+          error |= AddMemberToObject<Json_uint>(
+              obj, "spill_repartitioned_chunks", stats.repartitioned_chunks);
+          error |= AddMemberToObject<Json_uint>(
+              obj, "spill_hash_table_refills", stats.hash_table_refills);
+          description +=
+              " (spilled to disk: chunks=" + std::to_string(stats.chunks) +
+              " build rows=" + std::to_string(stats.build_rows) +
+              " build bytes=" + std::to_string(stats.build_bytes) +
+              " probe rows=" + std::to_string(stats.probe_rows) +
+              " probe bytes=" + std::to_string(stats.probe_bytes) +
+              " largest build chunk=" +
+              std::to_string(stats.max_chunk_build_rows) +
+              " repartitioned=" + std::to_string(stats.repartitioned_chunks) +
+              " refills=" + std::to_string(stats.hash_table_refills) + ")";
+        }
+      }
       children->push_back({path->hash_join().outer});
       children->push_back({path->hash_join().inner, "Hash"});
 
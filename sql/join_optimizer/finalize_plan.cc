@@ -32,7 +32,9 @@
 #include "prealloced_array.h"
 #include "sql/filesort.h"
 #include "sql/item.h"
+#include "sql/item_cmpfunc.h"
 #include "sql/item_sum.h"
+#include "sql/iterators/row_batch.h"
 #include "sql/join_optimizer/access_path.h"
 #include "sql/join_optimizer/bit_utils.h"
 #include "sql/join_optimizer/join_optimizer.h"
@@ -52,6 +54,7 @@
 #include "sql/sql_resolver.h"
 #include "sql/sql_select.h"
 #include "sql/sql_tmp_table.h"
+#include "sql/system_variables.h"
 #include "sql/table.h"
 #include "sql/temp_table_param.h"
 #include "sql/visible_fields.h"
@@ -609,6 +612,50 @@ static Item *AddCachesAroundConstantConditions(Item *item) {
   }
 }
 
+/**
+  If some of the conjuncts of a FILTER's condition can be evaluated on entire
+  batches of rows (see Batch_int_predicate), set up a Batch_filter for
+  FilterIterator to use in batch mode. This must be done after the condition
+  has reached its final form, i.e., after any rewrites for materialization
+  and caching of constants.
+
+  @returns true on OOM.
+ */
+[[nodiscard]] static bool SetupBatchFilter(THD *thd, AccessPath *path) {
+  assert(path->type == AccessPath::FILTER);
+  path->filter().batch_filter = nullptr;
+
+  // There is no point if batch mode is off. If subqueries are to be
+  // materialized, the condition is rewritten when the iterator is created.
+  if (thd->variables.iterator_batch_size <= 1 ||
+      path->filter().materialize_subqueries) {
+    return false;
+  }
+
+  Mem_root_array<Item *> conjuncts(thd->mem_root);
+  if (ExtractConditions(path->filter().condition, &conjuncts)) return true;
+
+  auto *batch_filter = new (thd->mem_root) Batch_filter(thd->mem_root);
+  if (batch_filter == nullptr) return true;
+  List<Item> residual;
+  for (Item *condition : conjuncts) {
+    Batch_int_predicate *predicate =
+        batch_filter->predicates.size() < RowBatch::kMaxColumns
+            ? Batch_int_predicate::Create(thd->mem_root, condition)
+            : nullptr;
+    if (predicate != nullptr) {
+      if (batch_filter->predicates.push_back(predicate)) return true;
+    } else if (residual.push_back(condition, thd->mem_root)) {
+      return true;
+    }
+  }
+  if (batch_filter->predicates.empty()) return false;
+
+  batch_filter->residual_condition = CreateConjunction(&residual);
+  path->filter().batch_filter = batch_filter;
+  return false;
+}
+
 /*
   Do the final touchups of the access path tree, once we have selected a final
   plan (ie., there are no more alternatives). There are currently two major
@@ -752,6 +799,10 @@ bool FinalizePlanForQueryBlock(THD *thd, Query_block *query_block) {
           error = true;
           return true;
         }
+        if (path->type == AccessPath::FILTER && SetupBatchFilter(thd, path)) {
+          error = true;
+          return true;
+        }
         return false;
       },
       /*post_order_traversal=*/true);
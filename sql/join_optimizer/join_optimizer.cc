@@ -51,6 +51,7 @@
 #include "my_inttypes.h"
 #include "my_sqlcommand.h"
 #include "my_sys.h"
+#include "my_systime.h"
 #include "my_table_map.h"
 #include "mysql/components/services/bits/psi_bits.h"
 #include "mysql/udf_registration_types.h"
@@ -64,6 +65,7 @@
 #include "sql/item_cmpfunc.h"
 #include "sql/item_func.h"
 #include "sql/item_sum.h"
+#include "sql/iterators/parallel_scan_iterator.h"
 #include "sql/join_optimizer/access_path.h"
 #include "sql/join_optimizer/bit_utils.h"
 #include "sql/join_optimizer/build_interesting_orders.h"
@@ -218,6 +220,11 @@ class CostingReceiver {
                     MakeSecondaryEngineFlags(
                         SecondaryEngineFlag::SUPPORTS_HASH_JOIN,
                         SecondaryEngineFlag::SUPPORTS_NESTED_LOOP_JOIN)));
+    if (thd->variables.optimizer_hypergraph_time_limit > 0) {
+      m_time_limit_end =
+          my_micro_time() +
+          thd->variables.optimizer_hypergraph_time_limit * 1000ULL;
+    }
   }
 
   // Not copyable, but movable so that we can reset it after graph
@@ -341,6 +348,19 @@ class CostingReceiver {
    */
   int m_num_seen_subgraph_pairs = 0;
 
+  /**
+    When, in microseconds, the time given by optimizer_hypergraph_time_limit
+    runs out, or 0 if there is no time limit.
+   */
+  ulonglong m_time_limit_end = 0;
+
+  /**
+    Whether the time limit has run out. If so, lowers the subgraph pair limit
+    to the number of pairs seen so far, so that the caller simplifies the
+    graph to what could be enumerated in time.
+   */
+  bool TimeLimitExceeded();
+
   /// The graph we are running over.
   JoinHypergraph *m_graph;
 
@@ -2933,6 +2953,7 @@ bool CostingReceiver::ProposeTableScan(
   } else {
     path.type = AccessPath::TABLE_SCAN;
     path.table_scan().table = table;
+    path.table_scan().num_parallel_threads = 0;
   }
   path.count_examined_rows = true;
   path.ordering_state = 0;
@@ -2943,7 +2964,20 @@ bool CostingReceiver::ProposeTableScan(
   m_thd->set_status_no_index_used();
 
   const double num_output_rows = table->file->stats.records;
-  const double cost = table->file->table_scan_cost().total_cost();
+  double cost = table->file->table_scan_cost().total_cost();
+
+  if (path.type == AccessPath::TABLE_SCAN) {
+    const size_t parallel_threads =
+        ParallelTableScanThreads(m_thd, m_query_block, table);
+    if (parallel_threads > 1) {
+      const double parallel_cost = EstimateParallelTableScanCost(
+          cost, num_output_rows, parallel_threads);
+      if (parallel_cost < cost) {
+        path.table_scan().num_parallel_threads = parallel_threads;
+        cost = parallel_cost;
+      }
+    }
+  }
 
   path.num_output_rows_before_filter = num_output_rows;
   path.set_init_cost(0.0);
@@ -3847,6 +3881,22 @@ void MoveDegenerateJoinConditionToFilter(THD *thd, Query_block *query_block,
   cheapest one. However, we will not get calls with the two subsets
   in reversed order.
  */
+bool CostingReceiver::TimeLimitExceeded() {
+  // Reading the clock for every pair would be a noticeable cost in itself.
+  if (m_time_limit_end == 0 || m_num_seen_subgraph_pairs % 256 != 0 ||
+      my_micro_time() < m_time_limit_end) {
+    return false;
+  }
+  m_subgraph_pair_limit = m_num_seen_subgraph_pairs;
+  if (m_trace != nullptr) {
+    *m_trace += "Exceeded optimizer_hypergraph_time_limit after " +
+                std::to_string(m_num_seen_subgraph_pairs) +
+                " subgraph pairs; simplifying the hypergraph to that many "
+                "pairs.\n";
+  }
+  return true;
+}
+
 bool CostingReceiver::FoundSubgraphPair(NodeMap left, NodeMap right,
                                         int edge_idx) {
   if (m_thd->is_error()) return true;
@@ -3861,8 +3911,9 @@ bool CostingReceiver::FoundSubgraphPair(NodeMap left, NodeMap right,
     if (evaluate_secondary_engine_optimizer_state_request()) {
       return true;
     }
-  } else if (m_num_seen_subgraph_pairs > m_subgraph_pair_limit &&
-             m_subgraph_pair_limit >= 0) {
+  } else if (m_subgraph_pair_limit >= 0 &&
+             (m_num_seen_subgraph_pairs > m_subgraph_pair_limit ||
+              TimeLimitExceeded())) {
     /* Bail out; we're going to be needing graph simplification,
      * which the caller will handle for us. */
     return true;
@@ -6299,6 +6350,7 @@ void ApplyHavingOrQualifyCondition(
     // We don't currently bother with materializing subqueries
     // in HAVING, as they should be rare.
     filter_path.filter().materialize_subqueries = false;
+    filter_path.filter().batch_filter = nullptr;
     filter_path.set_num_output_rows(
         root_path->num_output_rows() *
         EstimateSelectivity(thd, having_cond, CompanionSet(), trace));
@@ -27,6 +27,7 @@
 #include <algorithm>
 #include <array>
 #include <bit>
+#include <cmath>
 #include <iterator>
 #include <numeric>
 #include <string>
@@ -2778,6 +2779,109 @@ size_t EstimateRowWidthForJoin(const JoinHypergraph &graph,
   return ret;
 }
 
+/**
+  If the predicate is "field = constant" on a single table, returns the field.
+  Otherwise nullptr.
+ */
+const Field *GetFieldEqualToConstant(const Predicate &predicate) {
+  if (!has_single_bit(predicate.used_nodes) ||
+      !is_function_of_type(predicate.condition, Item_func::EQ_FUNC)) {
+    return nullptr;
+  }
+  const Item_func_eq *eq = down_cast<const Item_func_eq *>(predicate.condition);
+  const Item *left = eq->arguments()[0];
+  const Item *right = eq->arguments()[1];
+  if (left->type() == Item::FIELD_ITEM && right->const_for_execution()) {
+    return down_cast<const Item_field *>(left)->field;
+  }
+  if (right->type() == Item::FIELD_ITEM && left->const_for_execution()) {
+    return down_cast<const Item_field *>(right)->field;
+  }
+  return nullptr;
+}
+
+/**
+  Selectivities of single-table predicates are estimated one by one and
+  multiplied, as if the columns were independent. For correlated columns,
+  like (country, city) or (tenant_id, status), that underestimates the number
+  of rows badly.
+
+  An index on those columns holds statistics for their combination: if the
+  "field = constant" predicates on a table cover a prefix of an index of
+  length two or more, records_per_key() of that prefix estimates their
+  combined selectivity. If the product of their selectivities is lower than
+  that, each of them is raised by the same factor, so that their product
+  matches the index statistics.
+
+  @param predicates_begin  The first predicate to adjust.
+  @param predicates_end    The end of the predicates to adjust.
+  @param nodes             The nodes of the hypergraph.
+  @param[in,out] trace     Optimizer trace.
+ */
+void AdjustSelectivityForCorrelatedColumns(
+    Predicate *predicates_begin, Predicate *predicates_end,
+    const Mem_root_array<JoinHypergraph::Node> &nodes, string *trace) {
+  for (size_t node_idx = 0; node_idx < nodes.size(); ++node_idx) {
+    const TABLE *table = nodes[node_idx].table;
+    const double num_rows = table->file->stats.records;
+    if (num_rows < 1.0) continue;
+
+    // The "field = constant" predicate of each key part, or nullptr.
+    const auto find_predicate = [&](const Field *field) -> Predicate * {
+      for (Predicate *p = predicates_begin; p != predicates_end; ++p) {
+        if (p->used_nodes == TableBitmap(node_idx) &&
+            GetFieldEqualToConstant(*p) == field) {
+          return p;
+        }
+      }
+      return nullptr;
+    };
+
+    // Use the index with the longest prefix covered by the predicates.
+    uint best_key = MAX_KEY;
+    uint best_prefix_length = 1;
+    for (uint key_no = 0; key_no < table->s->keys; ++key_no) {
+      const KEY &key = table->key_info[key_no];
+      uint prefix_length = 0;
+      while (prefix_length < key.user_defined_key_parts &&
+             key.has_records_per_key(prefix_length) &&
+             find_predicate(key.key_part[prefix_length].field) != nullptr) {
+        ++prefix_length;
+      }
+      if (prefix_length > best_prefix_length) {
+        best_key = key_no;
+        best_prefix_length = prefix_length;
+      }
+    }
+    if (best_key == MAX_KEY) continue;
+
+    const KEY &key = table->key_info[best_key];
+    const double combined_selectivity = std::min(
+        1.0, key.records_per_key(best_prefix_length - 1) / num_rows);
+
+    double product = 1.0;
+    for (uint part_no = 0; part_no < best_prefix_length; ++part_no) {
+      product *= find_predicate(key.key_part[part_no].field)->selectivity;
+    }
+    if (product <= 0.0 || product >= combined_selectivity) continue;
+
+    const double factor =
+        std::pow(combined_selectivity / product, 1.0 / best_prefix_length);
+    for (uint part_no = 0; part_no < best_prefix_length; ++part_no) {
+      Predicate *predicate = find_predicate(key.key_part[part_no].field);
+      predicate->selectivity = std::min(1.0, predicate->selectivity * factor);
+    }
+
+    if (trace != nullptr) {
+      *trace += StringPrintf(
+          "Raised the selectivity of %u correlated predicates on %s from %g "
+          "to %g, using the statistics of index %s\n",
+          best_prefix_length, table->alias, product, combined_selectivity,
+          key.name);
+    }
+  }
+}
+
 /**
   Sorts the given range of predicates so that the most selective and least
   expensive predicates come first, and the less selective and more expensive
@@ -3470,6 +3574,9 @@ bool MakeSingleTableHypergraph(THD *thd, const Query_block *query_block,
     }
     graph->num_where_predicates = graph->predicates.size();
 
+    AdjustSelectivityForCorrelatedColumns(graph->predicates.begin(),
+                                          graph->predicates.end(),
+                                          graph->nodes, trace);
     SortPredicates(graph->predicates.begin(), graph->predicates.end());
   }
 
@@ -3745,6 +3852,10 @@ bool MakeJoinHypergraph(THD *thd, string *trace, JoinHypergraph *graph,
     graph->predicates.push_back(std::move(pred));
   }
 
+  AdjustSelectivityForCorrelatedColumns(
+      graph->predicates.begin() + num_cycle_predicates,
+      graph->predicates.end(), graph->nodes, trace);
+
   // Sort the predicates so that filters created from them later automatically
   // evaluate the most selective and least expensive predicates first. Don't
   // touch the join (cycle) predicates at the beginning, as they are already
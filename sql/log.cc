@@ -639,25 +639,18 @@ bool File_query_log::write_general(ulonglong event_utime,
                                    const char *command_type,
                                    size_t command_type_len,
                                    const char *sql_text, size_t sql_text_len) {
-  char buff[32];
-  size_t length = 0;
+  /*
+    Format the line prefix before taking LOCK_log, so that concurrent
+    sessions only serialize on copying the entry into the log cache.
+  */
+  char buff[iso8601_size + 32];
+  size_t length =
+      make_iso8601_timestamp(buff, event_utime, iso8601_sysvar_logtimestamps);
+  length += snprintf(buff + length, sizeof(buff) - length, "\t%5u ", thread_id);
 
   mysql_mutex_lock(&LOCK_log);
   assert(is_open());
 
-  /* Note that my_b_write() assumes it knows the length for this */
-  char local_time_buff[iso8601_size];
-  int time_buff_len = make_iso8601_timestamp(local_time_buff, event_utime,
-                                             iso8601_sysvar_logtimestamps);
-
-  if (my_b_write(&log_file, pointer_cast<uchar *>(local_time_buff),
-                 time_buff_len))
-    goto err;
-
-  if (my_b_write(&log_file, pointer_cast<const uchar *>("\t"), 1)) goto err;
-
-  length = snprintf(buff, 32, "%5u ", thread_id);
-
   if (my_b_write(&log_file, pointer_cast<uchar *>(buff), length)) goto err;
 
   if (my_b_write(&log_file, pointer_cast<const uchar *>(command_type),
@@ -695,43 +688,42 @@ bool File_query_log::write_slow(THD *thd, ulonglong current_utime,
   size_t buff_len;
   end = buff;
 
-  mysql_mutex_lock(&LOCK_log);
-  assert(is_open());
-
+  /*
+    Format the lines which only depend on the session before taking
+    LOCK_log, so that concurrent sessions only serialize on copying the
+    entry into the log cache.
+  */
+  char time_buff[iso8601_size + 16];
+  size_t time_buff_len = 0;
   if (!(specialflag & SPECIAL_SHORT_LOG_FORMAT)) {
     char my_timestamp[iso8601_size];
 
     make_iso8601_timestamp(my_timestamp, current_utime,
                            iso8601_sysvar_logtimestamps);
 
-    buff_len = snprintf(buff, sizeof buff, "# Time: %s\n", my_timestamp);
-
-    /* Note that my_b_write() assumes it knows the length for this */
-    if (my_b_write(&log_file, (uchar *)buff, buff_len)) goto err;
-
-    buff_len = snprintf(buff, 32, "%5u", thd->thread_id());
-    if (my_b_printf(&log_file, "# User@Host: %s  Id: %s\n", user_host, buff) ==
-        (uint)-1)
-      goto err;
+    time_buff_len =
+        snprintf(time_buff, sizeof time_buff, "# Time: %s\n", my_timestamp);
   }
 
   /* For slow query log */
   sprintf(query_time_buff, "%.6f", ulonglong2double(query_utime) / 1000000.0);
   sprintf(lock_time_buff, "%.6f", ulonglong2double(lock_utime) / 1000000.0);
 
+  char stats_buff[1024];
+  size_t stats_buff_len;
+
   /*
     As a general rule, if opt_log_slow_extra is set, the caller will
     have saved state at the beginning of execution, and passed in a
     pointer to that state in THD's copy_status_var_ptr.
   */
   if (!thd->copy_status_var_ptr) {
-    if (my_b_printf(&log_file,
-                    "# Query_time: %s  Lock_time: %s"
-                    " Rows_sent: %lu  Rows_examined: %lu\n",
-                    query_time_buff, lock_time_buff,
-                    (ulong)thd->get_sent_row_count(),
-                    (ulong)thd->get_examined_row_count()) == (uint)-1)
-      goto err; /* purecov: inspected */
+    stats_buff_len = snprintf(stats_buff, sizeof stats_buff,
+                              "# Query_time: %s  Lock_time: %s"
+                              " Rows_sent: %lu  Rows_examined: %lu\n",
+                              query_time_buff, lock_time_buff,
+                              (ulong)thd->get_sent_row_count(),
+                              (ulong)thd->get_examined_row_count());
   } else {
     char start_time_buff[iso8601_size];
     char end_time_buff[iso8601_size];
@@ -748,58 +740,73 @@ bool File_query_log::write_slow(THD *thd, ulonglong current_utime,
           iso8601_sysvar_logtimestamps); /* purecov: inspected */
     }
 
-    if (my_b_printf(
-            &log_file,
-            "# Query_time: %s  Lock_time: %s"
-            " Rows_sent: %lu  Rows_examined: %lu"
-            " Thread_id: %lu Errno: %lu Killed: %lu"
-            " Bytes_received: %lu Bytes_sent: %lu"
-            " Read_first: %lu Read_last: %lu Read_key: %lu"
-            " Read_next: %lu Read_prev: %lu"
-            " Read_rnd: %lu Read_rnd_next: %lu"
-            " Sort_merge_passes: %lu Sort_range_count: %lu"
-            " Sort_rows: %lu Sort_scan_count: %lu"
-            " Created_tmp_disk_tables: %lu"
-            " Created_tmp_tables: %lu"
-            " Start: %s End: %s\n",
-            query_time_buff, lock_time_buff, (ulong)thd->get_sent_row_count(),
-            (ulong)thd->get_examined_row_count(), (ulong)thd->thread_id(),
-            static_cast<ulong>(
-                thd->is_error() ? thd->get_stmt_da()->mysql_errno() : 0),
-            (ulong)thd->killed,
-            (ulong)(thd->status_var.bytes_received -
-                    thd->copy_status_var_ptr->bytes_received),
-            (ulong)(thd->status_var.bytes_sent -
-                    thd->copy_status_var_ptr->bytes_sent),
-            (ulong)(thd->status_var.ha_read_first_count -
-                    thd->copy_status_var_ptr->ha_read_first_count),
-            (ulong)(thd->status_var.ha_read_last_count -
-                    thd->copy_status_var_ptr->ha_read_last_count),
-            (ulong)(thd->status_var.ha_read_key_count -
-                    thd->copy_status_var_ptr->ha_read_key_count),
-            (ulong)(thd->status_var.ha_read_next_count -
-                    thd->copy_status_var_ptr->ha_read_next_count),
-            (ulong)(thd->status_var.ha_read_prev_count -
-                    thd->copy_status_var_ptr->ha_read_prev_count),
-            (ulong)(thd->status_var.ha_read_rnd_count -
-                    thd->copy_status_var_ptr->ha_read_rnd_count),
-            (ulong)(thd->status_var.ha_read_rnd_next_count -
-                    thd->copy_status_var_ptr->ha_read_rnd_next_count),
-            (ulong)(thd->status_var.filesort_merge_passes -
-                    thd->copy_status_var_ptr->filesort_merge_passes),
-            (ulong)(thd->status_var.filesort_range_count -
-                    thd->copy_status_var_ptr->filesort_range_count),
-            (ulong)(thd->status_var.filesort_rows -
-                    thd->copy_status_var_ptr->filesort_rows),
-            (ulong)(thd->status_var.filesort_scan_count -
-                    thd->copy_status_var_ptr->filesort_scan_count),
-            (ulong)(thd->status_var.created_tmp_disk_tables -
-                    thd->copy_status_var_ptr->created_tmp_disk_tables),
-            (ulong)(thd->status_var.created_tmp_tables -
-                    thd->copy_status_var_ptr->created_tmp_tables),
-            start_time_buff, end_time_buff) == (uint)-1)
-      goto err; /* purecov: inspected */
+    stats_buff_len = snprintf(
+        stats_buff, sizeof stats_buff,
+        "# Query_time: %s  Lock_time: %s"
+        " Rows_sent: %lu  Rows_examined: %lu"
+        " Thread_id: %lu Errno: %lu Killed: %lu"
+        " Bytes_received: %lu Bytes_sent: %lu"
+        " Read_first: %lu Read_last: %lu Read_key: %lu"
+        " Read_next: %lu Read_prev: %lu"
+        " Read_rnd: %lu Read_rnd_next: %lu"
+        " Sort_merge_passes: %lu Sort_range_count: %lu"
+        " Sort_rows: %lu Sort_scan_count: %lu"
+        " Created_tmp_disk_tables: %lu"
+        " Created_tmp_tables: %lu"
+        " Start: %s End: %s\n",
+        query_time_buff, lock_time_buff, (ulong)thd->get_sent_row_count(),
+        (ulong)thd->get_examined_row_count(), (ulong)thd->thread_id(),
+        static_cast<ulong>(
+            thd->is_error() ? thd->get_stmt_da()->mysql_errno() : 0),
+        (ulong)thd->killed,
+        (ulong)(thd->status_var.bytes_received -
+                thd->copy_status_var_ptr->bytes_received),
+        (ulong)(thd->status_var.bytes_sent -
+                thd->copy_status_var_ptr->bytes_sent),
+        (ulong)(thd->status_var.ha_read_first_count -
+                thd->copy_status_var_ptr->ha_read_first_count),
+        (ulong)(thd->status_var.ha_read_last_count -
+                thd->copy_status_var_ptr->ha_read_last_count),
+        (ulong)(thd->status_var.ha_read_key_count -
+                thd->copy_status_var_ptr->ha_read_key_count),
+        (ulong)(thd->status_var.ha_read_next_count -
+                thd->copy_status_var_ptr->ha_read_next_count),
+        (ulong)(thd->status_var.ha_read_prev_count -
+                thd->copy_status_var_ptr->ha_read_prev_count),
+        (ulong)(thd->status_var.ha_read_rnd_count -
+                thd->copy_status_var_ptr->ha_read_rnd_count),
+        (ulong)(thd->status_var.ha_read_rnd_next_count -
+                thd->copy_status_var_ptr->ha_read_rnd_next_count),
+        (ulong)(thd->status_var.filesort_merge_passes -
+                thd->copy_status_var_ptr->filesort_merge_passes),
+        (ulong)(thd->status_var.filesort_range_count -
+                thd->copy_status_var_ptr->filesort_range_count),
+        (ulong)(thd->status_var.filesort_rows -
+                thd->copy_status_var_ptr->filesort_rows),
+        (ulong)(thd->status_var.filesort_scan_count -
+                thd->copy_status_var_ptr->filesort_scan_count),
+        (ulong)(thd->status_var.created_tmp_disk_tables -
+                thd->copy_status_var_ptr->created_tmp_disk_tables),
+        (ulong)(thd->status_var.created_tmp_tables -
+                thd->copy_status_var_ptr->created_tmp_tables),
+        start_time_buff, end_time_buff);
   }
+  stats_buff_len = std::min(stats_buff_len, sizeof stats_buff - 1);
+
+  mysql_mutex_lock(&LOCK_log);
+  assert(is_open());
+
+  if (!(specialflag & SPECIAL_SHORT_LOG_FORMAT)) {
+    /* Note that my_b_write() assumes it knows the length for this */
+    if (my_b_write(&log_file, (uchar *)time_buff, time_buff_len)) goto err;
+
+    buff_len = snprintf(buff, 32, "%5u", thd->thread_id());
+    if (my_b_printf(&log_file, "# User@Host: %s  Id: %s\n", user_host, buff) ==
+        (uint)-1)
+      goto err;
+  }
+
+  if (my_b_write(&log_file, (uchar *)stats_buff, stats_buff_len)) goto err;
 
   if (thd->db().str && strcmp(thd->db().str, db)) {  // Database changed
     if (my_b_printf(&log_file, "use %s;\n", thd->db().str) == (uint)-1)
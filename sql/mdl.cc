@@ -1438,7 +1438,8 @@ MDL_context::MDL_context()
       m_force_dml_deadlock_weight(false),
       m_waiting_for(nullptr),
       m_pins(nullptr),
-      m_rand_state(UINT_MAX32) {
+      m_rand_state(UINT_MAX32),
+      m_free_tickets_count(0) {
   mysql_prlock_init(key_MDL_context_LOCK_waiting_for, &m_LOCK_waiting_for);
 }
 
@@ -1459,6 +1460,9 @@ void MDL_context::destroy() {
 
   mysql_prlock_destroy(&m_LOCK_waiting_for);
   if (m_pins) lf_hash_put_pins(m_pins);
+
+  while (m_free_tickets_count > 0)
+    ::operator delete(m_free_tickets[--m_free_tickets_count]);
 }
 
 /**
@@ -1669,10 +1673,16 @@ MDL_ticket *MDL_ticket::create(MDL_context *ctx_arg, enum_mdl_type type_arg
                                enum_mdl_duration duration_arg
 #endif
 ) {
-  return new (std::nothrow) MDL_ticket(ctx_arg, type_arg
+  void *mem;
+  if (ctx_arg->m_free_tickets_count > 0)
+    mem = ctx_arg->m_free_tickets[--ctx_arg->m_free_tickets_count];
+  else if (!(mem = ::operator new(sizeof(MDL_ticket), std::nothrow)))
+    return nullptr;
+
+  return new (mem) MDL_ticket(ctx_arg, type_arg
 #ifndef NDEBUG
-                                       ,
-                                       duration_arg
+                              ,
+                              duration_arg
 #endif
   );
 }
@@ -1681,7 +1691,16 @@ void MDL_ticket::destroy(MDL_ticket *ticket) {
   mysql_mdl_destroy(ticket->m_psi);
   ticket->m_psi = nullptr;
 
-  delete ticket;
+  /*
+    Tickets are only destroyed by the thread which owns their context, so
+    the memory can be handed back to the context without synchronization.
+  */
+  MDL_context *ctx = ticket->m_ctx;
+  ticket->~MDL_ticket();
+  if (ctx->m_free_tickets_count < MDL_context::FREE_TICKETS_SIZE)
+    ctx->m_free_tickets[ctx->m_free_tickets_count++] = ticket;
+  else
+    ::operator delete(ticket);
 }
 
 /**
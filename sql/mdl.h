@@ -1567,6 +1567,8 @@ class MDL_context {
   MDL_wait m_wait;
 
  private:
+  friend class MDL_ticket;
+
   /**
     Lists of all MDL tickets acquired by this connection.
 
@@ -1659,6 +1661,14 @@ class MDL_context {
     when searching for unused objects to free.
   */
   uint m_rand_state;
+  /**
+    Memory of tickets released by this context, re-used for its next
+    tickets. Statements which lock the same few objects again and again
+    then do not allocate and free a ticket for each lock they take.
+  */
+  static const uint FREE_TICKETS_SIZE = 16;
+  void *m_free_tickets[FREE_TICKETS_SIZE];
+  uint m_free_tickets_count;
 
  private:
   MDL_ticket *find_ticket(MDL_request *mdl_req, enum_mdl_duration *duration);
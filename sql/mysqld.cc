@@ -824,6 +824,7 @@ MySQL clients support the protocol:
 #endif
 #include "my_openssl_fips.h"  // OPENSSL_ERROR_LENGTH, set_fips_mode
 #include "sql/rpl_async_conn_failover_configuration_propagation.h"
+#include "sql/rpl_binlog_tail_cache.h"
 #include "sql/rpl_filter.h"
 #include "sql/rpl_gtid.h"
 #include "sql/rpl_gtid_persist.h"  // Gtid_table_persistor
@@ -1108,6 +1109,7 @@ static PSI_mutex_key key_BINLOG_LOCK_sync_queue;
 static PSI_mutex_key key_BINLOG_LOCK_xids;
 static PSI_mutex_key key_BINLOG_LOCK_log_info;
 static PSI_mutex_key key_BINLOG_LOCK_wait_for_group_turn;
+PSI_mutex_key key_BINLOG_LOCK_tail_cache;
 static PSI_rwlock_key key_rwlock_global_tsid_lock;
 PSI_rwlock_key key_rwlock_gtid_mode_lock;
 static PSI_rwlock_key key_rwlock_LOCK_system_variables_hash;
@@ -1358,6 +1360,10 @@ ulonglong replica_type_conversions_options;
 ulong opt_mts_replica_parallel_workers;
 ulonglong opt_mts_pending_jobs_size_max;
 bool opt_replica_preserve_commit_order;
+bool opt_replica_recompute_dependencies;
+bool opt_replication_sender_zero_copy;
+ulonglong opt_binlog_tail_cache_size;
+ulonglong opt_relay_log_tail_cache_size;
 #ifndef NDEBUG
 uint replica_rows_last_search_algorithm_used;
 #endif
@@ -2746,6 +2752,7 @@ static void clean_up(bool print_message) {
 
   injector::free_instance();
   mysql_bin_log.cleanup();
+  binlog_tail_cache.deinit();
 
   udf_load_service.deinit();
   delete rpl_source_io_monitor;
@@ -8738,6 +8745,10 @@ static int init_server_components() {
       correctly compute the set of previous gtids.
     */
     assert(!mysql_bin_log.is_relay_log);
+
+    if (binlog_tail_cache.init(opt_binlog_tail_cache_size))
+      unireg_abort(MYSQLD_ABORT_EXIT);
+
     mysql_mutex_t *log_lock = mysql_bin_log.get_log_lock();
     mysql_mutex_lock(log_lock);
 
@@ -11477,6 +11488,10 @@ SHOW_VAR status_vars[] = {
      SHOW_SCOPE_GLOBAL},
     {"Binlog_cache_use", (char *)&binlog_cache_use, SHOW_LONG,
      SHOW_SCOPE_GLOBAL},
+    {"Binlog_tail_cache_hits", (char *)&binlog_tail_cache.m_hits,
+     SHOW_LONGLONG, SHOW_SCOPE_GLOBAL},
+    {"Binlog_tail_cache_misses", (char *)&binlog_tail_cache.m_misses,
+     SHOW_LONGLONG, SHOW_SCOPE_GLOBAL},
     {"Binlog_stmt_cache_disk_use", (char *)&binlog_stmt_cache_disk_use,
      SHOW_LONG, SHOW_SCOPE_GLOBAL},
     {"Binlog_stmt_cache_use", (char *)&binlog_stmt_cache_use, SHOW_LONG,
@@ -13615,6 +13630,7 @@ static PSI_mutex_info all_server_mutexes[]=
   { &key_BINLOG_LOCK_sync, "MYSQL_BIN_LOG::LOCK_sync", 0, 0, PSI_DOCUMENT_ME},
   { &key_BINLOG_LOCK_sync_queue, "MYSQL_BIN_LOG::LOCK_sync_queue", 0, 0, PSI_DOCUMENT_ME},
   { &key_BINLOG_LOCK_xids, "MYSQL_BIN_LOG::LOCK_xids", 0, 0, PSI_DOCUMENT_ME},
+  { &key_BINLOG_LOCK_tail_cache, "Binlog_tail_cache::m_lock", 0, 0, PSI_DOCUMENT_ME},
   { &key_BINLOG_LOCK_wait_for_group_turn, "MYSQL_BIN_LOG::LOCK_wait_for_group_turn", 0, 0, PSI_DOCUMENT_ME},
   { &key_BINLOG_LOCK_after_commit, "MYSQL_BIN_LOG::LOCK_after_commit", 0, 0, PSI_DOCUMENT_ME},
   { &key_BINLOG_LOCK_after_commit_queue, "MYSQL_BIN_LOG::LOCK_after_commit_queue", 0, 0, PSI_DOCUMENT_ME},
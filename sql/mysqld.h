@@ -205,6 +205,10 @@ extern bool lower_case_file_system;
 extern bool opt_require_secure_transport;
 
 extern bool opt_replica_preserve_commit_order;
+extern bool opt_replica_recompute_dependencies;
+extern bool opt_replication_sender_zero_copy;
+extern ulonglong opt_binlog_tail_cache_size;
+extern ulonglong opt_relay_log_tail_cache_size;
 
 #ifndef NDEBUG
 extern uint replica_rows_last_search_algorithm_used;
@@ -416,6 +420,7 @@ extern PSI_file_key key_file_binlog_index_cache;
 #ifdef HAVE_PSI_INTERFACE
 
 extern PSI_mutex_key key_LOCK_tc;
+extern PSI_mutex_key key_BINLOG_LOCK_tail_cache;
 extern PSI_mutex_key key_hash_filo_lock;
 extern PSI_mutex_key key_LOCK_error_log;
 extern PSI_mutex_key key_LOCK_thd_data;
@@ -2961,10 +2961,25 @@ bool Protocol_classic::start_result_metadata(uint num_cols_arg, uint flags,
   return false;
 }
 
+/**
+  Grow the network buffer to net_result_buffer_length before the rows of a
+  result set are sent, so that they are flushed in large writes. Keeps what
+  is already buffered. The buffer is shrunk again once the command ends.
+*/
+static void grow_net_buffer_for_rows(THD *thd) {
+  NET *net = &thd->net;
+  ulong length = thd->variables.net_result_buffer_length;
+  if (length <= net->max_packet || length >= net->max_packet_size) return;
+
+  size_t write_offset = net->write_pos - net->buff;
+  if (!net_realloc(net, length)) net->write_pos = net->buff + write_offset;
+}
+
 bool Protocol_classic::end_result_metadata() {
   DBUG_TRACE;
   DBUG_PRINT("info", ("num_cols %u, flags %u", field_count, sending_flags));
   send_metadata = false;
+  grow_net_buffer_for_rows(m_thd);
   if (sending_flags & SEND_EOF) {
     /* if it is new client do not send EOF packet */
     if (!(has_client_capability(CLIENT_DEPRECATE_EOF))) {
@@ -102,6 +102,7 @@ PSI_memory_key key_memory_binlog_cache_mngr;
 PSI_memory_key key_memory_binlog_pos;
 PSI_memory_key key_memory_binlog_recover_exec;
 PSI_memory_key key_memory_binlog_statement_buffer;
+PSI_memory_key key_memory_binlog_tail_cache;
 PSI_memory_key key_memory_bison_stack;
 PSI_memory_key key_memory_blob_mem_storage;
 PSI_memory_key key_memory_db_worker_hash_entry;
@@ -301,6 +302,9 @@ static PSI_memory_info all_server_memory[] = {
     {&key_memory_HASH_ROW_ENTRY, "HASH_ROW_ENTRY", 0, 0, PSI_DOCUMENT_ME},
     {&key_memory_binlog_statement_buffer, "binlog_statement_buffer", 0, 0,
      PSI_DOCUMENT_ME},
+    {&key_memory_binlog_tail_cache, "Binlog_tail_cache",
+     PSI_FLAG_ONLY_GLOBAL_STAT, 0,
+     "Ring buffer of the most recent bytes of the active binary log."},
     {&key_memory_partition_syntax_buffer, "Partition::syntax_buffer", 0, 0,
      "Buffer used for formatting the partition expression."},
     {&key_memory_READ_INFO, "READ_INFO", PSI_FLAG_MEM_COLLECT, 0,
@@ -127,6 +127,7 @@ extern PSI_memory_key key_memory_binlog_cache_mngr;
 extern PSI_memory_key key_memory_binlog_pos;
 extern PSI_memory_key key_memory_binlog_recover_exec;
 extern PSI_memory_key key_memory_binlog_statement_buffer;
+extern PSI_memory_key key_memory_binlog_tail_cache;
 extern PSI_memory_key key_memory_bison_stack;
 extern PSI_memory_key key_memory_blob_mem_storage;
 extern PSI_memory_key key_memory_db_worker_hash_entry;
@@ -364,6 +364,35 @@ static SEL_TREE *get_func_mm_tree_from_in_predicate(
   if (predicand->type() == Item::FIELD_ITEM) {
     // The expression is (<column>) IN (...)
     Field *field = down_cast<Item_field *>(predicand)->field;
+    if (op->m_const_array != nullptr && !op->m_const_array->is_row_result() &&
+        op->m_const_array->m_used_size > 0) {
+      /*
+        All values are constants, and populate_bisection() has already
+        evaluated and sorted them (NULLs are left out, they can never match).
+        Build the ranges from the sorted array instead of from the argument
+        list: duplicates are skipped, the values are not evaluated again,
+        and since every new interval is added after the existing ones,
+        building the tree for a list of N values takes O(N log N) time
+        regardless of the order in which the values were written.
+      */
+      Item_basic_constant *value_item =
+          op->m_const_array->create_item(thd->mem_root);
+      if (value_item == nullptr) return nullptr;
+
+      SEL_TREE *tree = nullptr;
+      for (uint i = 0; i < op->m_const_array->m_used_size; i++) {
+        if (i > 0 && !op->m_const_array->compare_elems(i, i - 1)) continue;
+        op->m_const_array->value_to_item(i, value_item);
+        SEL_TREE *value_tree =
+            get_mm_parts(thd, param, prev_tables, read_tables, op, field,
+                         Item_func::EQ_FUNC, value_item);
+        tree = tree == nullptr
+                   ? value_tree
+                   : tree_or(param, remove_jump_scans, tree, value_tree);
+        if (tree == nullptr) break;
+      }
+      return tree;
+    }
     SEL_TREE *tree =
         get_mm_parts(thd, param, prev_tables, read_tables, op, field,
                      Item_func::EQ_FUNC, op->arguments()[1]);
@@ -22,6 +22,7 @@
 
 #include "sql/regexp/regexp_facade.h"
 
+#include <algorithm>
 #include <optional>
 #include <string>
 #include <tuple>
@@ -260,10 +261,29 @@ bool Regexp_facade::SetupEngine(Item *pattern_expr, uint flags) {
     return false;
   }
 
+  // Reuse the regular expression if it was compiled recently.
+  auto it = std::find_if(m_compiled.begin(), m_compiled.end(),
+                         [&](const Compiled_pattern &compiled) {
+                           return compiled.flags == flags &&
+                                  compiled.pattern == pattern &&
+                                  !compiled.engine->IsError();
+                         });
+  if (it != m_compiled.end()) {
+    std::rotate(m_compiled.begin(), it, it + 1);
+    m_engine = m_compiled.front().engine.get();
+    return false;
+  }
+
   // Actually compile the regular expression.
-  m_engine = make_unique_destroy_only<Regexp_engine>(
+  auto engine = make_unique_destroy_only<Regexp_engine>(
       *THR_MALLOC, pattern, flags, opt_regexp_stack_limit,
       opt_regexp_time_limit);
+  m_engine = engine.get();
+
+  if (m_compiled.size() == kMaxCompiledPatterns) m_compiled.pop_back();
+  m_compiled.insert(m_compiled.begin(),
+                    Compiled_pattern{std::move(pattern), flags,
+                                     std::move(engine)});
 
   // If something went wrong, an error was raised.
   return m_engine->IsError();
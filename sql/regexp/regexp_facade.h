@@ -33,6 +33,7 @@
 
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "sql/item.h"
 #include "sql/regexp/regexp_engine.h"
@@ -49,7 +50,9 @@ extern CHARSET_INFO *regexp_lib_charset;
     converted strings during matching.
 
   - Re-compilation of the regular expression in case the pattern is a field
-    reference or otherwise non-constant.
+    reference or otherwise non-constant. The most recently used compiled
+    patterns are kept, so that a pattern which is seen again is not
+    recompiled.
 
   - `NULL` handling.
 
@@ -73,7 +76,8 @@ class Regexp_facade {
       SELECT regexp_like( column, regexp_column ) FROM table;
 
     The `regexp_column` expression is non-constant and hence we have to
-    recompile the regular expression for each row.
+    recompile the regular expression whenever it evaluates to a pattern which
+    is not among the recently compiled ones.
   */
   bool SetPattern(Item *pattern_expr, uint32_t flags);
 
@@ -121,8 +125,11 @@ class Regexp_facade {
 
   String *Substr(Item *subject_expr, int start, int occurrence, String *result);
 
-  /// Delete the "engine" data structure after execution.
-  void cleanup() { m_engine = nullptr; }
+  /// Delete the "engine" data structures after execution.
+  void cleanup() {
+    m_engine = nullptr;
+    m_compiled.clear();
+  }
 
   /// Did any operation return a warning? For unit testing.
   bool EngineHasWarning() const {
@@ -176,12 +183,26 @@ class Regexp_facade {
    */
   String *AssignResult(const char *str, size_t length, String *result);
 
+  /// A compiled regular expression and the pattern and flags it was built of.
+  struct Compiled_pattern {
+    std::u16string pattern;
+    uint flags;
+    unique_ptr_destroy_only<Regexp_engine> engine;
+  };
+
+  /// The number of compiled regular expressions kept in m_compiled.
+  static constexpr size_t kMaxCompiledPatterns = 16;
+
   /**
     Used for all the actual regular expression matching, search-and-replace,
     and positional and string information. If either the regular expression
-    pattern or the subject is `NULL`, this pointer is empty.
+    pattern or the subject is `NULL`, this pointer is empty. It points to an
+    engine owned by m_compiled.
   */
-  unique_ptr_destroy_only<Regexp_engine> m_engine;
+  Regexp_engine *m_engine{nullptr};
+
+  /// The compiled regular expressions, most recently used first.
+  std::vector<Compiled_pattern> m_compiled;
 
   /**
     ICU does not copy the subject string, so we keep the subject buffer
@@ -21,18 +21,38 @@
    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
 
 #include "sql/rpl_applier_reader.h"
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include "include/mutex_lock.h"
 #include "include/mysqld_errmsg.h"  // ER_OUT_OF_RESOURCES_MSG
 #include "include/scope_guard.h"
 #include "mysql/components/services/log_builtins.h"
 #include "sql/log.h"
+#include "sql/log_event.h"
 #include "sql/mysqld.h"
+#include "sql/rpl_filter.h"
+#include "sql/rpl_msr.h"
 #include "sql/rpl_replica.h"
 #include "sql/rpl_rli.h"
 #include "sql/rpl_rli_pdb.h"
 #include "sql/sql_backup_lock.h"
+#include "sql/sql_base.h"
+#include "sql/table.h"
 #include "string_with_len.h"
 
+/**
+  How far recompute_dependency() reads ahead for the end of a transaction.
+  Larger transactions are applied serially.
+*/
+static constexpr my_off_t DEPENDENCY_LOOKAHEAD_MAX_BYTES = 16 * 1024 * 1024;
+
+/**
+  How many tables recompute_dependency() remembers. When there are more, the
+  history is cleared and the next transaction depends on all earlier ones.
+*/
+static constexpr size_t DEPENDENCY_HISTORY_MAX_TABLES = 10000;
+
 /**
    It manages a stage and the related mutex and makes the process of
    locking and entering stage/unlock and exiting stage as monolithic operations.
@@ -88,7 +108,11 @@ Rpl_applier_reader::Rpl_applier_reader(Relay_log_info *rli)
           opt_replica_sql_verify_checksum,
           std::max(replica_max_allowed_packet,
                    binlog_row_event_max_size + MAX_LOG_EVENT_HEADER)),
-      m_rli(rli) {}
+      m_rli(rli),
+      m_lookahead_reader(
+          opt_replica_sql_verify_checksum,
+          std::max(replica_max_allowed_packet,
+                   binlog_row_event_max_size + MAX_LOG_EVENT_HEADER)) {}
 
 Rpl_applier_reader::~Rpl_applier_reader() { close(); }
 
@@ -134,6 +158,13 @@ bool Rpl_applier_reader::open(const char **errmsg) {
   }  // Release acquired lock on `m_rli->data_lock`
 
   m_reading_active_log = m_rli->relay_log.is_active(m_linfo.log_file_name);
+
+  m_recompute_dependencies =
+      opt_replica_recompute_dependencies &&
+      !channel_map.is_group_replication_channel_name(m_rli->get_channel());
+  m_dependency_sequence_number = 0;
+  m_dependency_history_start = 0;
+  m_dependency_history.clear();
   ret = false;
 
 #ifndef NDEBUG
@@ -146,6 +177,8 @@ err:
 
 void Rpl_applier_reader::close() {
   m_relaylog_file_reader.close();
+  m_lookahead_reader.close();
+  m_lookahead_log_name.clear();
   m_reading_active_log = true;
   m_log_end_pos = 0;
   m_errmsg = nullptr;
@@ -236,10 +269,13 @@ Log_event *Rpl_applier_reader::read_next_event() {
   }
 
   m_rli->set_event_start_pos(m_relaylog_file_reader.position());
-  ev = m_relaylog_file_reader.read_event_object();
+  if (m_reading_active_log) ev = read_event_from_tail_cache();
+  if (ev == nullptr) ev = m_relaylog_file_reader.read_event_object();
   if (ev != nullptr) {
     m_rli->set_future_event_relay_log_pos(m_relaylog_file_reader.position());
     ev->future_event_relay_log_pos = m_rli->get_future_event_relay_log_pos();
+    if (m_recompute_dependencies && is_any_gtid_event(ev))
+      recompute_dependency(static_cast<Gtid_log_event *>(ev));
     return ev;
   }
 
@@ -257,6 +293,205 @@ Log_event *Rpl_applier_reader::read_next_event() {
   return nullptr;
 }
 
+bool Rpl_applier_reader::collect_transaction_tables(
+    std::set<std::string> *tables) {
+  const my_off_t start_pos = m_relaylog_file_reader.position();
+  /* Only what the receiver has finished writing can be read. */
+  const my_off_t end_pos = m_reading_active_log
+                               ? m_rli->relay_log.get_binlog_end_pos()
+                               : std::numeric_limits<my_off_t>::max();
+
+  if (m_lookahead_log_name != m_linfo.log_file_name ||
+      !m_lookahead_reader.is_open()) {
+    m_lookahead_reader.close();
+    m_lookahead_log_name.clear();
+    if (m_lookahead_reader.open(m_linfo.log_file_name, start_pos)) {
+      m_lookahead_reader.reset_error();
+      return false;
+    }
+    m_lookahead_log_name = m_linfo.log_file_name;
+  } else if (m_lookahead_reader.seek(start_pos)) {
+    m_lookahead_reader.close();
+    m_lookahead_log_name.clear();
+    return false;
+  }
+
+  const mysql::binlog::event::Format_description_event &fde =
+      m_lookahead_reader.format_description_event();
+
+  while (m_lookahead_reader.position() < end_pos &&
+         m_lookahead_reader.position() - start_pos <
+             DEPENDENCY_LOOKAHEAD_MAX_BYTES) {
+    unsigned char *data = nullptr;
+    unsigned int length = 0;
+
+    if (m_lookahead_reader.read_event_data(&data, &length)) {
+      m_lookahead_reader.reset_error();
+      return false;
+    }
+
+    const auto type = static_cast<mysql::binlog::event::Log_event_type>(
+        data[EVENT_TYPE_OFFSET]);
+
+    switch (type) {
+      case mysql::binlog::event::WRITE_ROWS_EVENT:
+      case mysql::binlog::event::UPDATE_ROWS_EVENT:
+      case mysql::binlog::event::DELETE_ROWS_EVENT:
+      case mysql::binlog::event::PARTIAL_UPDATE_ROWS_EVENT:
+      case mysql::binlog::event::WRITE_ROWS_EVENT_V1:
+      case mysql::binlog::event::UPDATE_ROWS_EVENT_V1:
+      case mysql::binlog::event::DELETE_ROWS_EVENT_V1:
+      case mysql::binlog::event::ROWS_QUERY_LOG_EVENT:
+        m_lookahead_reader.allocator()->deallocate(data);
+        continue;
+
+      case mysql::binlog::event::XID_EVENT:
+        m_lookahead_reader.allocator()->deallocate(data);
+        return true;
+
+      case mysql::binlog::event::TABLE_MAP_EVENT:
+      case mysql::binlog::event::QUERY_EVENT:
+        break;
+
+      default:
+        m_lookahead_reader.allocator()->deallocate(data);
+        return false;
+    }
+
+    Log_event *ev = nullptr;
+    if (binlog_event_deserialize(data, length, &fde, false, &ev)) {
+      m_lookahead_reader.allocator()->deallocate(data);
+      return false;
+    }
+    ev->register_temp_buf(reinterpret_cast<char *>(data), true);
+    std::unique_ptr<Log_event> ev_guard(ev);
+
+    if (type == mysql::binlog::event::QUERY_EVENT) {
+      const auto *qev = static_cast<Query_log_event *>(ev);
+      /* Anything but row changes may touch any table. */
+      if (qev->q_len == 5 && !strncmp(qev->query, "BEGIN", 5)) continue;
+      if (qev->q_len == 6 && !strncmp(qev->query, "COMMIT", 6)) return true;
+      return false;
+    }
+
+    const auto *tmev = static_cast<Table_map_log_event *>(ev);
+    char db[NAME_LEN + 1];
+    char table_name[NAME_LEN + 1];
+    snprintf(db, sizeof(db), "%s", tmev->get_db_name());
+    snprintf(table_name, sizeof(table_name), "%s", tmev->get_table_name());
+    if (lower_case_table_names) {
+      my_casedn_str(system_charset_info, db);
+      my_casedn_str(system_charset_info, table_name);
+    }
+    size_t db_length;
+    const char *rewritten_db =
+        m_rli->rpl_filter->get_rewrite_db(db, &db_length);
+
+    /*
+      Foreign keys make transactions on different tables depend on each
+      other. The replica only knows about them if its table definition is
+      cached, so be conservative if it is not.
+    */
+    bool has_foreign_keys = true;
+    mysql_mutex_lock(&LOCK_open);
+    const TABLE_SHARE *share = get_cached_table_share(rewritten_db, table_name);
+    if (share != nullptr)
+      has_foreign_keys =
+          share->foreign_keys > 0 || share->foreign_key_parents > 0;
+    mysql_mutex_unlock(&LOCK_open);
+    if (has_foreign_keys) return false;
+
+    std::string key(rewritten_db, db_length);
+    key.push_back('\0');
+    key.append(table_name);
+    tables->insert(key);
+  }
+
+  return false;
+}
+
+void Rpl_applier_reader::recompute_dependency(Gtid_log_event *ev) {
+  std::set<std::string> tables;
+  const bool tracked = collect_transaction_tables(&tables);
+  const int64 sequence_number = ++m_dependency_sequence_number;
+  int64 last_committed = m_dependency_history_start;
+
+  if (tracked) {
+    for (const std::string &table : tables) {
+      auto it = m_dependency_history.find(table);
+      if (it != m_dependency_history.end())
+        last_committed = std::max(last_committed, it->second);
+    }
+
+    if (m_dependency_history.size() + tables.size() >
+        DEPENDENCY_HISTORY_MAX_TABLES) {
+      m_dependency_history.clear();
+      m_dependency_history_start = sequence_number - 1;
+    }
+    for (const std::string &table : tables)
+      m_dependency_history[table] = sequence_number;
+  } else {
+    last_committed = sequence_number - 1;
+    m_dependency_history_start = sequence_number;
+    m_dependency_history.clear();
+  }
+
+  DBUG_PRINT("info", ("recomputed (%lld, %lld) as (%lld, %lld)",
+                      static_cast<long long>(ev->last_committed),
+                      static_cast<long long>(ev->sequence_number),
+                      static_cast<long long>(last_committed),
+                      static_cast<long long>(sequence_number)));
+  ev->last_committed = last_committed;
+  ev->sequence_number = sequence_number;
+}
+
+Log_event *Rpl_applier_reader::read_event_from_tail_cache() {
+  DBUG_TRACE;
+  Binlog_tail_cache *cache = m_rli->relay_log.get_tail_cache();
+  if (cache == nullptr) return nullptr;
+
+  my_off_t pos = m_relaylog_file_reader.position();
+  uint32 length = cache->event_length(m_linfo.log_file_name, pos);
+
+  /*
+    Anything that is not a complete event, or that the reader would reject,
+    is left to the file reader, so that errors are reported as usual.
+  */
+  if (length < LOG_EVENT_MINIMAL_HEADER_LEN || pos + length > m_log_end_pos ||
+      length > std::max(replica_max_allowed_packet,
+                        binlog_row_event_max_size + MAX_LOG_EVENT_HEADER)) {
+    cache->count_miss();
+    return nullptr;
+  }
+
+  auto *allocator = m_relaylog_file_reader.allocator();
+  uchar *data = allocator->allocate(length);
+  if (data == nullptr) return nullptr;
+  if (!cache->read_event(m_linfo.log_file_name, pos, length, data)) {
+    allocator->deallocate(data);
+    return nullptr;
+  }
+
+  Log_event *ev = nullptr;
+  if (binlog_event_deserialize(
+          data, length, &m_relaylog_file_reader.format_description_event(),
+          opt_replica_sql_verify_checksum,
+          &ev) != Binlog_read_error::SUCCESS ||
+      m_relaylog_file_reader.seek(pos + length)) {
+    delete ev;
+    allocator->deallocate(data);
+    return nullptr;
+  }
+  ev->register_temp_buf(reinterpret_cast<char *>(data),
+                        Default_binlog_event_allocator::
+                            DELEGATE_MEMORY_TO_EVENT_OBJECT);
+
+  if (ev->get_type_code() == mysql::binlog::event::FORMAT_DESCRIPTION_EVENT)
+    m_relaylog_file_reader.set_format_description_event(
+        dynamic_cast<mysql::binlog::event::Format_description_event &>(*ev));
+  return ev;
+}
+
 bool Rpl_applier_reader::read_active_log_end_pos() {
   m_log_end_pos = m_rli->relay_log.get_binlog_end_pos();
   m_reading_active_log = m_rli->relay_log.is_active(m_linfo.log_file_name);
@@ -23,10 +23,15 @@
 #ifndef RPL_APPLIER_READER_INCLUDED
 #define RPL_APPLIER_READER_INCLUDED
 
+#include <map>
+#include <set>
+#include <string>
+
 #include "mysqld.h"
 #include "sql/binlog.h"
 #include "sql/binlog_reader.h"
 
+class Gtid_log_event;
 class Relay_log_info;
 
 /**
@@ -45,6 +50,10 @@ class Relay_log_info;
 
    - When reaching the end of active relay log file, it will wait for new events
      coming and make MTS checkpoints accordingly while waiting for events.
+
+   - If replica_recompute_dependencies is enabled, it replaces the logical
+     timestamps of each transaction with ones computed from the tables the
+     transaction changes, see recompute_dependency().
 */
 class Rpl_applier_reader {
  public:
@@ -159,6 +168,56 @@ class Rpl_applier_reader {
 
   /* reset seconds_behind_master when starting to wait for events coming */
   void reset_seconds_behind_master();
+
+  /**
+     Read the next event of the active relay log from its tail cache, so the
+     applier does not read back what the receiver has just written. The
+     relay log is still written and remains the source of truth: this only
+     returns events before m_log_end_pos, and moves the file reader past the
+     event it returns.
+
+     @return The event, or nullptr if it should be read from the file.
+  */
+  Log_event *read_event_from_tail_cache();
+
+  /**
+     Read ahead the transaction that starts at the current position, and
+     collect the names of the tables it changes.
+
+     @param[out] tables  "db\0table" for each table changed.
+
+     @retval true   The transaction only consists of row events and was read
+                    to its end, and none of its tables has foreign keys.
+     @retval false  Dependencies of the transaction cannot be tracked by
+                    tables.
+  */
+  bool collect_transaction_tables(std::set<std::string> *tables);
+
+  /**
+     Set the last_committed and sequence_number of the transaction started by
+     ev the way the WRITESET dependency tracker on the source would, but with
+     tables rather than rows: the transaction depends on the last earlier
+     transaction that changed one of its tables. Transactions whose tables
+     cannot be collected depend on all earlier ones, and all later ones
+     depend on them.
+
+     The timestamps are only meaningful to Mts_submode_logical_clock, and
+     only if every transaction is rewritten, so this is decided once per
+     open().
+  */
+  void recompute_dependency(Gtid_log_event *ev);
+
+  /** Used by collect_transaction_tables() to read ahead. */
+  Relaylog_file_reader m_lookahead_reader;
+  std::string m_lookahead_log_name;
+
+  /** See recompute_dependency(). */
+  bool m_recompute_dependencies = false;
+  int64 m_dependency_sequence_number = 0;
+  int64 m_dependency_history_start = 0;
+  /** The last transaction that changed each table, by "db\0table". */
+  std::map<std::string, int64> m_dependency_history;
+
   /* relay_log_space_limit should be disabled temporarily in some cases. */
   void disable_relay_log_space_limit_if_needed();
 #ifndef NDEBUG
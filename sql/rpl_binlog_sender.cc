@@ -35,6 +35,7 @@
 #include "my_byteorder.h"
 #include "my_compiler.h"
 #include "my_dbug.h"
+#include "my_dir.h"
 #include "my_pointer_arithmetic.h"
 #include "my_sys.h"
 #include "my_thread.h"
@@ -55,6 +56,7 @@
 #include "sql/mysqld.h"  // global_system_variables ...
 #include "sql/protocol.h"
 #include "sql/protocol_classic.h"
+#include "sql/rpl_binlog_tail_cache.h"
 #include "sql/rpl_constants.h"  // BINLOG_DUMP_NON_BLOCK
 #include "sql/rpl_gtid.h"
 #include "sql/rpl_handler.h"    // RUN_HOOK
@@ -66,6 +68,7 @@
 #include "string_with_len.h"
 #include "typelib.h"
 #include "unsafe_string_append.h"
+#include "violite.h"
 
 #ifndef NDEBUG
 static uint binlog_dump_count = 0;
@@ -77,6 +80,7 @@ const uint32 Binlog_sender::PACKET_MAX_SIZE = UINT_MAX32;
 const ushort Binlog_sender::PACKET_SHRINK_COUNTER_THRESHOLD = 100;
 const float Binlog_sender::PACKET_GROW_FACTOR = 2.0;
 const float Binlog_sender::PACKET_SHRINK_FACTOR = 0.5;
+const uint32 Binlog_sender::ZERO_COPY_MIN_EVENT_SIZE = 16384;
 
 using mysql::binlog::event::Binary_log_event;
 using mysql::binlog::event::enum_binlog_checksum_alg;
@@ -258,7 +262,10 @@ Binlog_sender::Binlog_sender(THD *thd, const char *start_file,
       m_flag(flag),
       m_observe_transmission(false),
       m_transmit_started(false),
-      m_prev_event_type(mysql::binlog::event::UNKNOWN_EVENT) {}
+      m_prev_event_type(mysql::binlog::event::UNKNOWN_EVENT),
+      m_zero_copy(false),
+      m_zero_copy_file(-1),
+      m_use_tail_cache(false) {}
 
 void Binlog_sender::init() {
   DBUG_TRACE;
@@ -315,6 +322,14 @@ void Binlog_sender::init() {
   m_transmit_started = true;
 
   init_checksum_alg();
+  init_zero_copy();
+  if (m_exclude_gtid != nullptr) m_exclude_gtid_lookup.assign(m_exclude_gtid);
+  /*
+    The tail cache holds the events as they were written, so they cannot be
+    verified by the reader.
+  */
+  m_use_tail_cache =
+      binlog_tail_cache.is_enabled() && !opt_source_verify_checksum;
   /*
     There are two ways to tell the server to not block:
 
@@ -372,6 +387,9 @@ void Binlog_sender::cleanup() {
 
   mysql_bin_log.unregister_log_info(&m_linfo);
 
+  if (m_zero_copy)
+    vio_set_blocking(thd->get_protocol_classic()->get_net()->vio, true);
+
   thd->variables.max_allowed_packet =
       global_system_variables.max_allowed_packet;
 
@@ -494,6 +512,8 @@ void Binlog_sender::run() {
 }
 
 int Binlog_sender::send_binlog(File_reader &reader, my_off_t start_pos) {
+  m_zero_copy_file = m_zero_copy ? reader.ifile()->raw_file() : -1;
+
   if (unlikely(send_format_description_event(reader, start_pos))) return 1;
 
   if (start_pos == BIN_LOG_HEADER_SIZE) start_pos = reader.position();
@@ -577,13 +597,39 @@ int Binlog_sender::send_events(File_reader &reader, my_off_t end_pos) {
   my_off_t exclude_group_end_pos = 0;
   bool in_exclude_group = false;
 
+  /* The events of an inactive file are all complete. */
+  my_off_t zero_copy_end_pos = end_pos;
+  if (m_zero_copy_file >= 0 && end_pos == 0) {
+    MY_STAT stat;
+    if (mysql_file_fstat(m_zero_copy_file, &stat) == 0)
+      zero_copy_end_pos = stat.st_size;
+  }
+
   while (likely(log_pos < end_pos) || end_pos == 0) {
     uchar *event_ptr = nullptr;
     uint32 event_len = 0;
 
     if (unlikely(thd->killed)) return 1;
 
-    if (unlikely(read_event(reader, &event_ptr, &event_len))) return 1;
+    if (m_zero_copy_file >= 0 && !in_exclude_group) {
+      bool sent = false;
+      if (unlikely(send_event_zero_copy(reader, zero_copy_end_pos,
+                                        &exclude_group_end_pos, &sent)))
+        return 1;
+      if (sent) {
+        log_pos = reader.position();
+        continue;
+      }
+    }
+
+    bool cached = false;
+    if (m_use_tail_cache && end_pos != 0 &&
+        unlikely(read_event_from_tail_cache(reader, end_pos, &event_ptr,
+                                            &event_len, &cached)))
+      return 1;
+
+    if (!cached && unlikely(read_event(reader, &event_ptr, &event_len)))
+      return 1;
 
     if (event_ptr == nullptr) {
       if (end_pos == 0) return 0;  // Arrive the end of inactive file
@@ -686,6 +732,87 @@ int Binlog_sender::send_events(File_reader &reader, my_off_t end_pos) {
   return 0;
 }
 
+int Binlog_sender::send_event_zero_copy(File_reader &reader, my_off_t end_pos,
+                                        my_off_t *exclude_group_end_pos,
+                                        bool *sent) {
+  DBUG_TRACE;
+  *sent = false;
+
+  /* The hooks need the event in the packet. */
+  if (opt_replication_sender_observe_commit_only) return 0;
+
+  const char *log_file = m_linfo.log_file_name;
+  my_off_t log_pos = reader.position();
+  uchar header[LOG_EVENT_MINIMAL_HEADER_LEN];
+  if (mysql_file_pread(m_zero_copy_file, header, sizeof(header), log_pos,
+                       MYF(0)) != sizeof(header))
+    return 0;
+
+  uint32 event_len = uint4korr(header + EVENT_LEN_OFFSET);
+  Log_event_type event_type = (Log_event_type)header[EVENT_TYPE_OFFSET];
+
+  /*
+    A packet of MAX_PACKET_LENGTH bytes or more would have to be split, and
+    GTID events are inspected by skip_event(). Anything that is not complete
+    yet, or does not look like an event, is left to read_event() too.
+  */
+  if (event_len < ZERO_COPY_MIN_EVENT_SIZE ||
+      event_len + 1 >= MAX_PACKET_LENGTH || log_pos + event_len > end_pos ||
+      mysql::binlog::event::Log_event_type_helper::is_any_gtid_event(
+          event_type))
+    return 0;
+
+  if (unlikely(check_event_type(event_type, log_file, log_pos))) return 1;
+
+  Sender_context_guard ctx_guard(*this, event_type);
+
+  if (*exclude_group_end_pos) {
+    if (send_heartbeat_event(*exclude_group_end_pos)) return 1;
+    *exclude_group_end_pos = 0;
+  }
+
+  /* The events buffered by my_net_write() have to go first. */
+  if (flush_net()) return 1;
+
+  /* The same packet as reset_transmit_packet() and my_net_write() make. */
+  NET *net = m_thd->get_protocol_classic()->get_net();
+  uchar packet_header[NET_HEADER_SIZE + 1];
+  int3store(packet_header, event_len + 1);
+  packet_header[3] = (uchar)net->pkt_nr++;
+  packet_header[NET_HEADER_SIZE] = '\0';
+
+  const size_t total_len = sizeof(packet_header) + event_len;
+  size_t written = 0;
+  while (written < total_len) {
+    size_t head_len =
+        written < sizeof(packet_header) ? sizeof(packet_header) - written : 0;
+    my_off_t offset = log_pos + (written + head_len - sizeof(packet_header));
+    size_t ret = vio_sendfile(
+        net->vio, head_len > 0 ? packet_header + written : nullptr, head_len,
+        m_zero_copy_file, offset, total_len - written - head_len);
+    if (ret == 0 || ret == static_cast<size_t>(-1)) {
+      net->error = NET_ERROR_SOCKET_UNUSABLE;
+      set_unknown_error("Failed on sendfile()");
+      return 1;
+    }
+    written += ret;
+  }
+  m_last_event_sent_ts = now_in_nanosecs();
+
+  if (reader.seek(log_pos + event_len)) {
+    set_fatal_error(log_read_error_msg(reader.get_error_type()));
+    return 1;
+  }
+  set_last_pos(reader.position());
+  DBUG_PRINT("info", ("Sent event %s with sendfile()",
+                      Log_event::get_type_str(event_type)));
+#ifndef NDEBUG
+  if (check_event_count()) return 1;
+#endif
+  *sent = true;
+  return 0;
+}
+
 bool Binlog_sender::check_event_type(Log_event_type type, const char *log_file,
                                      my_off_t log_pos) {
   if (type == mysql::binlog::event::ANONYMOUS_GTID_LOG_EVENT) {
@@ -759,7 +886,7 @@ inline bool Binlog_sender::skip_event(const uchar *event_ptr,
       Gtid gtid;
       gtid.sidno = gtid_ev.get_sidno(m_exclude_gtid->get_tsid_map());
       gtid.gno = gtid_ev.get_gno();
-      return m_exclude_gtid->contains_gtid(gtid);
+      return m_exclude_gtid_lookup.contains_gtid(gtid);
     }
     case mysql::binlog::event::ROTATE_EVENT:
       return false;
@@ -995,6 +1122,32 @@ int Binlog_sender::check_start_file() {
 
 extern TYPELIB binlog_checksum_typelib;
 
+void Binlog_sender::init_zero_copy() {
+  DBUG_TRACE;
+#ifdef __linux__
+  NET *net = m_thd->get_protocol_classic()->get_net();
+
+  /*
+    The events are sent as they are in the binlog. So neither checksum
+    verification, plugins that observe the transmission, nor compressed or
+    TLS connections, which transform what is written, can be handled.
+  */
+  if (!opt_replication_sender_zero_copy || opt_source_verify_checksum ||
+      m_observe_transmission || net->vio == nullptr || net->compress)
+    return;
+  enum enum_vio_type type = vio_type(net->vio);
+  if (type != VIO_TYPE_TCPIP && type != VIO_TYPE_SOCKET) return;
+
+  /*
+    sendfile() cannot be asked not to block, so the write timeout is only
+    honoured on a non-blocking socket. vio_read() and vio_write() wait for
+    a non-blocking socket when it would block, so nothing else changes.
+  */
+  if (vio_set_blocking(net->vio, false)) return;
+  m_zero_copy = true;
+#endif
+}
+
 void Binlog_sender::init_checksum_alg() {
   DBUG_TRACE;
 
@@ -1220,6 +1373,59 @@ const char *Binlog_sender::log_read_error_msg(
   }
 }
 
+int Binlog_sender::read_event_from_tail_cache(File_reader &reader,
+                                              my_off_t end_pos,
+                                              uchar **event_ptr,
+                                              uint32 *event_len, bool *found) {
+  DBUG_TRACE;
+  *found = false;
+
+  my_off_t log_pos = reader.position();
+  uint32 len = binlog_tail_cache.event_length(m_linfo.log_file_name, log_pos);
+
+  /*
+    Anything that is not a complete event, or that the reader would reject,
+    is left to read_event(), so that errors are reported as usual.
+  */
+  if (len < LOG_EVENT_MINIMAL_HEADER_LEN || log_pos + len > end_pos ||
+      len > m_thd->variables.max_allowed_packet) {
+    binlog_tail_cache.count_miss();
+    return 0;
+  }
+
+  if (reset_transmit_packet(0, 0)) return 1;
+  size_t event_offset = m_packet.length();
+  uchar *event = reader.allocator()->allocate(len);
+  if (event == nullptr) {
+    set_fatal_error(log_read_error_msg(Binlog_read_error::MEM_ALLOCATE));
+    return 1;
+  }
+
+  /* The event may have been dropped from the cache meanwhile. */
+  if (!binlog_tail_cache.read_event(m_linfo.log_file_name, log_pos, len,
+                                    event)) {
+    m_packet.length(event_offset);
+    return 0;
+  }
+
+  if (reader.seek(log_pos + len)) {
+    set_fatal_error(log_read_error_msg(reader.get_error_type()));
+    return 1;
+  }
+  set_last_pos(reader.position());
+
+  *event_ptr = event;
+  *event_len = len;
+  *found = true;
+  DBUG_PRINT("info", ("Read event %s from the tail cache",
+                      Log_event::get_type_str(
+                          Log_event_type(event[EVENT_TYPE_OFFSET]))));
+#ifndef NDEBUG
+  if (check_event_count()) return 1;
+#endif
+  return 0;
+}
+
 inline int Binlog_sender::read_event(File_reader &reader, uchar **event_ptr,
                                      uint32 *event_len) {
   DBUG_TRACE;
@@ -90,6 +90,11 @@ class Binlog_sender {
     should not be sent to the client.
   */
   Gtid_set *m_exclude_gtid;
+  /*
+    A copy of m_exclude_gtid which is searched for each GTID event, since
+    the set does not change during the dump.
+  */
+  Compact_gtid_set m_exclude_gtid_lookup;
   bool m_using_gtid_protocol;
   bool m_check_previous_gtid_event;
   bool m_gtid_clear_fd_created_flag;
@@ -194,6 +199,30 @@ class Binlog_sender {
     Type of the previously processed event.
   */
   mysql::binlog::event::Log_event_type m_prev_event_type;
+  /*
+    It is true if the connection allows sending events straight from the
+    binlog file to the socket (see replication_sender_zero_copy).
+  */
+  bool m_zero_copy;
+  /*
+    The system file of the binlog being sent, if events can be sent from it
+    with sendfile(). Otherwise -1.
+  */
+  File m_zero_copy_file;
+
+  /**
+    Events smaller than this are copied through the packet buffer even when
+    they could be sent with sendfile(), since one more system call costs
+    more than copying them.
+  */
+  const static uint32 ZERO_COPY_MIN_EVENT_SIZE;
+
+  /*
+    It is true if events of the active binlog can be read from
+    binlog_tail_cache (see binlog_tail_cache_size).
+  */
+  bool m_use_tail_cache;
+
   /*
     It initializes the context, checks if the dump request is valid and
     if binlog status is correct.
@@ -202,6 +231,8 @@ class Binlog_sender {
   void cleanup();
   void init_heartbeat_period();
   void init_checksum_alg();
+  /** Set m_zero_copy, and make the socket ready for sendfile(). */
+  void init_zero_copy();
   /** Check if the requested binlog file and position are valid */
   int check_start_file();
   /** Transform read error numbers to error messages. */
@@ -230,6 +261,26 @@ class Binlog_sender {
   */
   int send_events(File_reader &reader, my_off_t end_pos);
 
+  /**
+    It sends the next event without copying it, if it is large enough and
+    needs neither to be inspected nor to be changed before it is sent. The
+    event header is read from the binlog file, and the packet header is
+    followed by the event itself with sendfile(). The reader is then moved
+    past the event.
+
+    @param[in] reader     File_reader of binlog will be sent
+    @param[in] end_pos    The position of the end of the complete events in
+                          the binlog file
+    @param[in,out] exclude_group_end_pos  See send_events(). A pending
+                          heartbeat is sent before the event.
+    @param[out] sent      Set to true if the event was sent. Otherwise,
+                          it should be read and sent as usual.
+
+    @return It returns 0 if succeeds, otherwise 1 is returned.
+  */
+  int send_event_zero_copy(File_reader &reader, my_off_t end_pos,
+                           my_off_t *exclude_group_end_pos, bool *sent);
+
   /**
     It gets the end position of the binlog file.
 
@@ -335,6 +386,23 @@ class Binlog_sender {
      @retval 1 Fail
   */
   int read_event(File_reader &reader, uchar **event_ptr, uint32 *event_len);
+  /**
+     It reads the next event from binlog_tail_cache instead of the binlog
+     file, if the whole event is cached, and moves the reader past it.
+
+     @param[in] reader        File_reader of the binlog file.
+     @param[in] end_pos       The end position of the active binlog file.
+     @param[out] event_ptr    The buffer used to store the event.
+     @param[out] event_len    Length of the event.
+     @param[out] found        Set to true if the event was read. Otherwise it
+                              should be read with read_event().
+
+     @retval 0 Succeed
+     @retval 1 Fail
+  */
+  int read_event_from_tail_cache(File_reader &reader, my_off_t end_pos,
+                                 uchar **event_ptr, uint32 *event_len,
+                                 bool *found);
   /**
     Check if it is allowed to send this event type.
 
@@ -0,0 +1,163 @@
+/* Copyright (c) 2023, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+#include "sql/rpl_binlog_tail_cache.h"
+
+#include <assert.h>
+#include <string.h>
+#include <algorithm>
+
+#include "my_byteorder.h"
+#include "my_dbug.h"
+#include "mysql/binlog/event/binlog_event.h"  // LOG_EVENT_MINIMAL_HEADER_LEN
+#include "sql/mysqld.h"                       // key_BINLOG_LOCK_tail_cache
+#include "sql/psi_memory_key.h"
+
+Binlog_tail_cache binlog_tail_cache;
+
+bool Binlog_tail_cache::init(ulonglong size) {
+  DBUG_TRACE;
+  if (size == 0) return false;
+
+  m_buffer = static_cast<uchar *>(
+      my_malloc(key_memory_binlog_tail_cache, size, MYF(MY_WME)));
+  if (m_buffer == nullptr) return true;
+  m_size = size;
+  m_log_file_name[0] = '\0';
+  m_start = m_end = 0;
+  mysql_mutex_init(key_BINLOG_LOCK_tail_cache, &m_lock, MY_MUTEX_INIT_FAST);
+  return false;
+}
+
+void Binlog_tail_cache::deinit() {
+  DBUG_TRACE;
+  if (m_buffer == nullptr) return;
+
+  mysql_mutex_destroy(&m_lock);
+  my_free(m_buffer);
+  m_buffer = nullptr;
+  m_size = 0;
+}
+
+void Binlog_tail_cache::reset(const char *log_file_name) {
+  if (m_buffer == nullptr) return;
+
+  mysql_mutex_lock(&m_lock);
+  snprintf(m_log_file_name, sizeof(m_log_file_name), "%s", log_file_name);
+  m_start = m_end = 0;
+  mysql_mutex_unlock(&m_lock);
+}
+
+void Binlog_tail_cache::append(my_off_t pos, const uchar *data,
+                               my_off_t length) {
+  if (m_buffer == nullptr || length == 0) return;
+
+  /* Only the last m_size bytes can be kept. */
+  if (length > m_size) {
+    data += length - m_size;
+    pos += length - m_size;
+    length = m_size;
+  }
+
+  mysql_mutex_lock(&m_lock);
+  if (pos != m_end) m_start = m_end = pos;
+
+  my_off_t offset = pos % m_size;
+  my_off_t first = std::min(length, m_size - offset);
+  memcpy(m_buffer + offset, data, first);
+  if (first < length) memcpy(m_buffer, data + first, length - first);
+
+  m_end = pos + length;
+  if (m_end - m_start > m_size) m_start = m_end - m_size;
+  mysql_mutex_unlock(&m_lock);
+}
+
+void Binlog_tail_cache::truncate(my_off_t pos) {
+  if (m_buffer == nullptr) return;
+
+  mysql_mutex_lock(&m_lock);
+  m_end = std::min(m_end, pos);
+  m_start = std::min(m_start, m_end);
+  mysql_mutex_unlock(&m_lock);
+}
+
+void Binlog_tail_cache::invalidate() {
+  if (m_buffer == nullptr) return;
+
+  mysql_mutex_lock(&m_lock);
+  m_start = m_end;
+  mysql_mutex_unlock(&m_lock);
+}
+
+void Binlog_tail_cache::copy_out(my_off_t pos, my_off_t length,
+                                 uchar *buffer) {
+  mysql_mutex_assert_owner(&m_lock);
+  assert(pos >= m_start && pos + length <= m_end);
+
+  my_off_t offset = pos % m_size;
+  my_off_t first = std::min(length, m_size - offset);
+  memcpy(buffer, m_buffer + offset, first);
+  if (first < length) memcpy(buffer + first, m_buffer, length - first);
+}
+
+uint32 Binlog_tail_cache::event_length(const char *log_file_name,
+                                       my_off_t pos) {
+  if (m_buffer == nullptr) return 0;
+
+  uchar header[LOG_EVENT_MINIMAL_HEADER_LEN];
+  uint32 length = 0;
+
+  mysql_mutex_lock(&m_lock);
+  if (pos >= m_start && pos + sizeof(header) <= m_end &&
+      strcmp(log_file_name, m_log_file_name) == 0) {
+    copy_out(pos, sizeof(header), header);
+    length = uint4korr(header + EVENT_LEN_OFFSET);
+  }
+  mysql_mutex_unlock(&m_lock);
+  return length;
+}
+
+bool Binlog_tail_cache::read_event(const char *log_file_name, my_off_t pos,
+                                   uint32 length, uchar *buffer) {
+  if (m_buffer == nullptr) return false;
+
+  bool found = false;
+  mysql_mutex_lock(&m_lock);
+  if (pos >= m_start && pos + length <= m_end &&
+      strcmp(log_file_name, m_log_file_name) == 0) {
+    copy_out(pos, length, buffer);
+    found = true;
+    m_hits++;
+  } else {
+    m_misses++;
+  }
+  mysql_mutex_unlock(&m_lock);
+  return found;
+}
+
+void Binlog_tail_cache::count_miss() {
+  if (m_buffer == nullptr) return;
+
+  mysql_mutex_lock(&m_lock);
+  m_misses++;
+  mysql_mutex_unlock(&m_lock);
+}
@@ -0,0 +1,126 @@
+/* Copyright (c) 2023, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+#ifndef RPL_BINLOG_TAIL_CACHE_H
+#define RPL_BINLOG_TAIL_CACHE_H
+
+#include "my_inttypes.h"
+#include "my_io.h"  // FN_REFLEN
+#include "my_sys.h"
+#include "mysql/psi/mysql_mutex.h"
+
+/**
+  @class Binlog_tail_cache
+
+  A ring buffer holding the most recently written bytes of the active binary
+  log file. It is fed by MYSQL_BIN_LOG::Binlog_ofile::write(), so it holds
+  the logical (unencrypted) bytes at their logical positions, and dump
+  threads which are close to the end of the binary log read events from it
+  instead of reading and decrypting the same bytes from the file.
+
+  The cache only ever holds one contiguous range [start, end) of one file.
+  Opening a new binary log file resets it. Dump threads only read events
+  before the binary log end position, so the bytes they read from the cache
+  are never changed afterwards, except for the header flag cleared when the
+  file is closed, which invalidates the cache.
+*/
+class Binlog_tail_cache {
+ public:
+  Binlog_tail_cache() = default;
+  Binlog_tail_cache(const Binlog_tail_cache &) = delete;
+  Binlog_tail_cache &operator=(const Binlog_tail_cache &) = delete;
+
+  /**
+    Initializes the mutex and allocates the buffer.
+
+    @param size  The size of the buffer. 0 disables the cache.
+
+    @retval false Success
+    @retval true  Out of memory
+  */
+  bool init(ulonglong size);
+  /** Frees the buffer and destroys the mutex. */
+  void deinit();
+
+  bool is_enabled() const { return m_buffer != nullptr; }
+
+  /**
+    Starts caching a new binary log file, dropping what is cached.
+
+    @param log_file_name  The name of the binary log file.
+  */
+  void reset(const char *log_file_name);
+
+  /**
+    Adds bytes written to the binary log file at the given position. If they
+    do not follow the cached range, the cache is restarted at pos.
+  */
+  void append(my_off_t pos, const uchar *data, my_off_t length);
+
+  /** Drops the cached bytes at and after pos. */
+  void truncate(my_off_t pos);
+
+  /** Drops all cached bytes, e.g. when some of them are overwritten. */
+  void invalidate();
+
+  /**
+    Returns the length of the event at pos of the given file, if its common
+    header is cached. Otherwise 0.
+  */
+  uint32 event_length(const char *log_file_name, my_off_t pos);
+
+  /**
+    Copies an event of the given file, if it is all cached, and counts a hit
+    or a miss.
+
+    @retval true  The event was copied to buffer.
+    @retval false The event is not cached. Nothing is copied.
+  */
+  bool read_event(const char *log_file_name, my_off_t pos, uint32 length,
+                  uchar *buffer);
+
+  /** Records that a dump thread read an event from the file instead. */
+  void count_miss();
+
+  /*
+    The number of events read from the cache and from the file by dump
+    threads. They are exported as status variables.
+  */
+  ulonglong m_hits{0};
+  ulonglong m_misses{0};
+
+ private:
+  /** Copies bytes out of the ring, with m_lock held. */
+  void copy_out(my_off_t pos, my_off_t length, uchar *buffer);
+
+  mysql_mutex_t m_lock;
+  uchar *m_buffer{nullptr};
+  my_off_t m_size{0};
+  char m_log_file_name[FN_REFLEN]{0};
+  /* The cached range of m_log_file_name. */
+  my_off_t m_start{0};
+  my_off_t m_end{0};
+};
+
+extern Binlog_tail_cache binlog_tail_cache;
+
+#endif /* RPL_BINLOG_TAIL_CACHE_H */
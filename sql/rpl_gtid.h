@@ -2489,6 +2489,79 @@ class Gtid_set {
   friend class Gtid_set::Free_intervals_lock;
 };
 
+/**
+  A read-only copy of a Gtid_set, laid out for lookups.
+
+  The intervals of all sidnos are stored in two flat arrays holding the
+  start and the end GNOs, ordered by sidno and then by GNO; the intervals
+  of sidno N are at the positions [m_offsets[N - 1], m_offsets[N]).  Since
+  the intervals of one sidno are disjoint and sorted, membership is a
+  binary search over the starts, and subset and intersection checks walk
+  contiguous memory instead of chasing the Interval linked lists of
+  Gtid_set.
+
+  This is meant for sets that are built once and then queried many times,
+  e.g. the GTIDs a dump thread must not send.  The copy does not follow
+  changes of the Gtid_set it was built from.  It uses the Tsid_map of that
+  Gtid_set; sidnos added to the map afterwards simply have no intervals.
+*/
+class Compact_gtid_set {
+ public:
+  Compact_gtid_set() = default;
+  /// Create a copy of the given set.  @see assign().
+  explicit Compact_gtid_set(const Gtid_set *gtid_set) { assign(gtid_set); }
+
+  /**
+    Replace the content by a copy of the given set.
+
+    The caller must hold the lock of the Tsid_map of gtid_set, if it has one.
+  */
+  void assign(const Gtid_set *gtid_set);
+  /// Remove all intervals.
+  void clear();
+  /// Return true iff this set is empty.
+  bool is_empty() const { return m_starts.empty(); }
+  /// Return the number of intervals of all sidnos.
+  size_t get_n_intervals() const { return m_starts.size(); }
+  /// Return the Tsid_map of the set this was built from.
+  const Tsid_map *get_tsid_map() const { return m_tsid_map; }
+  /// Return true iff the given GTID exists in this set.
+  bool contains_gtid(rpl_sidno sidno, rpl_gno gno) const;
+  /// Return true iff the given GTID exists in this set.
+  bool contains_gtid(const Gtid &gtid) const {
+    return contains_gtid(gtid.sidno, gtid.gno);
+  }
+  /**
+    Return true iff this set is a subset of the given set.  Both sets must
+    use the same Tsid_map.
+  */
+  bool is_subset(const Compact_gtid_set &super) const;
+  /**
+    Return true iff this set and the given set have a GTID in common.  Both
+    sets must use the same Tsid_map.
+  */
+  bool is_intersection_nonempty(const Compact_gtid_set &other) const;
+
+ private:
+  /// The number of sidnos that have a range in the arrays.
+  rpl_sidno get_max_sidno() const {
+    return m_offsets.empty() ? 0
+                             : static_cast<rpl_sidno>(m_offsets.size() - 1);
+  }
+  /// The first position of the intervals of sidno.
+  size_t begin(rpl_sidno sidno) const { return m_offsets[sidno - 1]; }
+  /// One past the last position of the intervals of sidno.
+  size_t end(rpl_sidno sidno) const { return m_offsets[sidno]; }
+
+  const Tsid_map *m_tsid_map{nullptr};
+  /// The start GNO of each interval.
+  std::vector<rpl_gno> m_starts;
+  /// The end GNO of each interval, exclusive, like Gtid_set::Interval::end.
+  std::vector<rpl_gno> m_ends;
+  /// Where the intervals of each sidno begin; has get_max_sidno() + 1 items.
+  std::vector<size_t> m_offsets;
+};
+
 /**
   Holds information about a Gtid_set.  Can also be NULL.
 
@@ -1530,3 +1530,85 @@ size_t Gtid_set::get_encoded_length(bool skip_tagged_gtids) const {
   Gtid_format gtid_format = analyze_encoding_format(skip_tagged_gtids);
   return get_encoded_length(gtid_format, skip_tagged_gtids);
 }
+
+void Compact_gtid_set::clear() {
+  m_tsid_map = nullptr;
+  m_starts.clear();
+  m_ends.clear();
+  m_offsets.clear();
+}
+
+void Compact_gtid_set::assign(const Gtid_set *gtid_set) {
+  DBUG_TRACE;
+  clear();
+  m_tsid_map = gtid_set->get_tsid_map();
+  rpl_sidno max_sidno = gtid_set->get_max_sidno();
+
+  m_offsets.reserve(max_sidno + 1);
+  m_offsets.push_back(0);
+  for (rpl_sidno sidno = 1; sidno <= max_sidno; sidno++) {
+    Gtid_set::Const_interval_iterator ivit(gtid_set, sidno);
+    const Gtid_set::Interval *iv;
+    while ((iv = ivit.get()) != nullptr) {
+      m_starts.push_back(iv->start);
+      m_ends.push_back(iv->end);
+      ivit.next();
+    }
+    m_offsets.push_back(m_starts.size());
+  }
+}
+
+bool Compact_gtid_set::contains_gtid(rpl_sidno sidno, rpl_gno gno) const {
+  if (sidno < 1 || sidno > get_max_sidno()) return false;
+  const rpl_gno *first = m_starts.data() + begin(sidno);
+  const rpl_gno *last = m_starts.data() + end(sidno);
+  // Find the last interval that starts at or before gno.
+  const rpl_gno *it = std::upper_bound(first, last, gno);
+  if (it == first) return false;
+  return gno < m_ends[it - m_starts.data() - 1];
+}
+
+bool Compact_gtid_set::is_subset(const Compact_gtid_set &super) const {
+  DBUG_TRACE;
+  assert(is_empty() || super.is_empty() || m_tsid_map == super.m_tsid_map);
+  rpl_sidno max_sidno = get_max_sidno();
+  for (rpl_sidno sidno = 1; sidno <= max_sidno; sidno++) {
+    if (begin(sidno) == end(sidno)) continue;
+    if (sidno > super.get_max_sidno()) return false;
+    const rpl_gno *super_first = super.m_starts.data() + super.begin(sidno);
+    const rpl_gno *super_last = super.m_starts.data() + super.end(sidno);
+    for (size_t i = begin(sidno); i < end(sidno); i++) {
+      /*
+        Adjacent intervals are always merged, so each interval of this set
+        must be within a single interval of super.
+      */
+      const rpl_gno *it =
+          std::upper_bound(super_first, super_last, m_starts[i]);
+      if (it == super_first) return false;
+      super_first = it - 1;
+      if (m_ends[i] > super.m_ends[super_first - super.m_starts.data()])
+        return false;
+    }
+  }
+  return true;
+}
+
+bool Compact_gtid_set::is_intersection_nonempty(
+    const Compact_gtid_set &other) const {
+  DBUG_TRACE;
+  assert(is_empty() || other.is_empty() || m_tsid_map == other.m_tsid_map);
+  rpl_sidno max_sidno = std::min(get_max_sidno(), other.get_max_sidno());
+  for (rpl_sidno sidno = 1; sidno <= max_sidno; sidno++) {
+    size_t i = begin(sidno), i_end = end(sidno);
+    size_t j = other.begin(sidno), j_end = other.end(sidno);
+    while (i < i_end && j < j_end) {
+      if (m_ends[i] <= other.m_starts[j])
+        i++;
+      else if (other.m_ends[j] <= m_starts[i])
+        j++;
+      else
+        return true;
+    }
+  }
+  return false;
+}
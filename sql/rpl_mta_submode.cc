@@ -27,7 +27,6 @@
 #include <time.h>
 #include <memory>
 
-#include "binlog/decompressing_event_object_istream.h"
 #include "lex_string.h"
 #include "my_byteorder.h"
 #include "my_compiler.h"
@@ -35,6 +34,7 @@
 #include "my_inttypes.h"
 #include "my_systime.h"
 #include "my_thread.h"
+#include "mysql/binlog/event/compression/payload_event_buffer_istream.h"
 #include "mysql/components/services/bits/psi_stage_bits.h"
 #include "mysql/components/services/log_builtins.h"
 #include "mysql/my_loglevel.h"
@@ -42,6 +42,7 @@
 #include "mysql/psi/mysql_mutex.h"
 #include "mysql/strings/int2str.h"
 #include "mysqld_error.h"
+#include "scope_guard.h"  // Variable_scope_guard
 #include "sql/binlog_reader.h"
 #include "sql/debug_sync.h"
 #include "sql/log.h"
@@ -195,19 +196,46 @@ bool Mts_submode_database::set_multi_threaded_applier_context(
     bool max_mts_dbs_in_event = false;
     std::set<std::string> dbs;
     auto &tple = *dynamic_cast<Transaction_payload_log_event *>(&ev);
-    binlog::Decompressing_event_object_istream istream(
-        tple, *rli.get_rli_description_event(),
-        psi_memory_resource(key_memory_applier));
-
-    std::shared_ptr<Log_event> inner;
-    while (istream >> inner) {
+    using Istream_t =
+        mysql::binlog::event::compression::Payload_event_buffer_istream;
+    Istream_t istream(tple, 0, psi_memory_resource(key_memory_applier));
+    Istream_t::Buffer_ptr_t buffer;
+
+    // Events inside the payload have no checksum.
+    mysql::binlog::event::Format_description_event &fde =
+        *rli.get_rli_description_event();
+    Variable_scope_guard disable_checksum_guard{fde.footer()->checksum_alg};
+    fde.footer()->checksum_alg = mysql::binlog::event::BINLOG_CHECKSUM_ALG_OFF;
+
+    // Once the payload event is marked to run in isolation, the rest of it
+    // does not need to be decompressed here.
+    while (!max_mts_dbs_in_event && istream >> buffer) {
       Mts_db_names mts_dbs;
 
-      // This transaction payload event is already marked to run in
-      // isolation or the event being handled does not contain partition
-      // information
-      if (max_mts_dbs_in_event || !inner->contains_partition_info(true))
-        continue;
+      // Only these events may carry partition information. The rest, rows
+      // events in particular, are decoded by the worker only.
+      switch (static_cast<mysql::binlog::event::Log_event_type>(
+          buffer->data()[EVENT_TYPE_OFFSET])) {
+        case mysql::binlog::event::TABLE_MAP_EVENT:
+        case mysql::binlog::event::QUERY_EVENT:
+        case mysql::binlog::event::EXECUTE_LOAD_QUERY_EVENT:
+          break;
+        default:
+          continue;
+      }
+
+      Log_event *inner_ptr = nullptr;
+      Binlog_read_error error(binlog_event_deserialize(
+          buffer->data(), buffer->size(), &fde, false, &inner_ptr));
+      if (error.has_error()) {
+        LogErr(ERROR_LEVEL, ER_RPL_REPLICA_ERROR_READING_RELAY_LOG_EVENTS,
+               rli.get_for_channel_str(), error.get_str());
+        return true;
+      }
+      std::unique_ptr<Log_event> inner(inner_ptr);
+
+      // The event being handled does not contain partition information
+      if (!inner->contains_partition_info(true)) continue;
 
       // The following queries should run in isolation, thence setting
       // OVER_MAX_DBS_IN_EVENT_MTS
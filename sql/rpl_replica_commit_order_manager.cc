@@ -23,6 +23,7 @@
 #include "sql/rpl_replica_commit_order_manager.h"
 
 #include <array>
+#include <thread>
 
 #include "debug_sync.h"  // debug_sync_set_action
 #include "my_compiler.h"
@@ -68,6 +69,31 @@ void Commit_order_manager::register_trx(Slave_worker *worker) {
   this->m_workers.push(worker->id);
 }
 
+/**
+  How many times a worker yields, waiting for its turn to commit, before
+  it goes to sleep; see Commit_order_manager::spin_for_its_turn().
+*/
+static constexpr int COMMIT_ORDER_SPIN_ROUNDS = 100;
+
+bool Commit_order_manager::spin_for_its_turn(Slave_worker *worker) {
+  auto front = this->m_workers.front();
+  if (front == cs::apply::Commit_order_queue::NO_WORKER ||
+      this->m_workers[front].m_stage !=
+          cs::apply::Commit_order_queue::enum_worker_stage::WAITED)
+    return false;
+
+  for (int i = 0; i < COMMIT_ORDER_SPIN_ROUNDS; ++i) {
+    if (this->m_workers.front() == worker->id ||
+        worker->info_thd->mdl_context.m_wait.get_status() ==
+            MDL_wait::GRANTED)
+      return true;
+    if (worker->found_commit_order_deadlock() || worker->info_thd->killed)
+      return false;
+    std::this_thread::yield();
+  }
+  return false;
+}
+
 bool Commit_order_manager::wait_on_graph(Slave_worker *worker) {
   auto worker_thd = worker->info_thd;
   bool rollback_status{false};
@@ -85,7 +111,7 @@ bool Commit_order_manager::wait_on_graph(Slave_worker *worker) {
   this->m_workers[worker->id].m_stage =
       cs::apply::Commit_order_queue::enum_worker_stage::FINISHED_APPLYING;
 
-  if (this->m_workers.front() != worker->id) {
+  if (this->m_workers.front() != worker->id && !spin_for_its_turn(worker)) {
     if (worker->found_commit_order_deadlock()) {
       /* purecov: begin inspected */
       rollback_status = true;
@@ -229,6 +229,19 @@ class Commit_order_manager {
     @return false if the worker is ready to commit, true if not.
    */
   bool wait_on_graph(Slave_worker *worker);
+
+  /**
+    Yields for a short while, waiting for the worker's turn to commit, if the
+    worker at the front of the queue is already committing. Handing over the
+    turn is then quick, and spinning saves the worker from going to sleep
+    and being woken up.
+
+    @param worker The worker that has finished applying its transaction.
+
+    @return true if it is the worker's turn to commit, false if it must
+            wait on the MDL graph.
+   */
+  bool spin_for_its_turn(Slave_worker *worker);
   /**
     Wait for its turn to commit or unregister.
 
@@ -99,9 +99,15 @@ std::vector<uint64> *Rpl_transaction_write_set_ctx::get_write_set() {
   return &write_set;
 }
 
+void Rpl_transaction_write_set_ctx::add_table_hash(uint64 hash) {
+  DBUG_TRACE;
+  m_table_hashes.insert(hash);
+}
+
 void Rpl_transaction_write_set_ctx::reset_state() {
   DBUG_TRACE;
   clear_write_set();
+  m_table_hashes.clear();
   m_has_missing_keys = m_has_related_foreign_keys = false;
   m_local_has_reached_write_set_limit = false;
 }
@@ -27,6 +27,7 @@
 #include <atomic>
 #include <list>
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -64,7 +65,7 @@
     - binlog_transaction_dependency_history_size.
   Transactions bigger than that cannot be added to the writeset history
   since they do not fit, and therefore are marked as conflicting with all
-  *subsequent* transactions anyways.
+  *subsequent* transactions on the same tables anyways, see add_table_hash().
   Therefore much of the parallelization for the transaction is already
   destroyed, and it is unlikely that also marking it as conflicting with
   *previous* transactions makes a significant difference.
@@ -118,6 +119,22 @@ class Rpl_transaction_write_set_ctx {
   */
   std::vector<uint64> *get_write_set();
 
+  /**
+    Function to add the hash of the name of a table that the transaction
+    writes to, or whose unique keys it references through a foreign key.
+    Unlike the write set, this is kept when the write set limit is
+    reached, so that the dependency tracker can still tell which tables a
+    large transaction touched.
+
+    @param[in] hash - the uint64 type hash value of the table name.
+  */
+  void add_table_hash(uint64 hash);
+
+  /**
+    Function to get the table name hashes added by add_table_hash().
+  */
+  const std::set<uint64> &get_table_hashes() const { return m_table_hashes; }
+
   /**
     Reset the object so it can be used for a new transaction.
   */
@@ -248,6 +265,10 @@ class Rpl_transaction_write_set_ctx {
   void clear_write_set();
 
   std::vector<uint64> write_set;
+
+  /** See add_table_hash(). */
+  std::set<uint64> m_table_hashes;
+
   bool m_has_missing_keys;
   bool m_has_related_foreign_keys;
 
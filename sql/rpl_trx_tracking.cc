@@ -23,6 +23,7 @@
 #include "sql/rpl_trx_tracking.h"
 
 #include <algorithm>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -239,14 +240,41 @@ void Writeset_trx_dependency_tracker::get_dependency(THD *thd,
       !write_set_ctx->was_write_set_limit_reached();
   bool exceeds_capacity = false;
 
+  /*
+    A transaction that only lacks a writeset because it was too big can
+    still be tracked by the tables it touched, instead of having all later
+    transactions depend on it.
+  */
+  const std::set<uint64> &table_hashes = write_set_ctx->get_table_hashes();
+  const bool track_by_tables =
+      !can_use_writesets && write_set_ctx->was_write_set_limit_reached() &&
+      thd->variables.binlog_format == BINLOG_FORMAT_ROW &&
+      !write_set_ctx->get_has_related_foreign_keys() &&
+      !write_set_ctx->get_has_missing_keys() && !table_hashes.empty() &&
+      m_writeset_history.size() + m_large_trx_table_history.size() +
+              table_hashes.size() <=
+          m_opt_max_history_size;
+
+  if (track_by_tables) {
+    /*
+      The commit_parent stays the one calculated with COMMIT_ORDER, since
+      the rows of this transaction are unknown.
+    */
+    for (uint64 table_hash : table_hashes)
+      m_large_trx_table_history[table_hash] = sequence_number;
+    return;
+  }
+
   if (can_use_writesets) {
     /*
      Check if adding this transaction exceeds the capacity of the writeset
      history. If that happens, m_writeset_history will be cleared only after
      using its information for current transaction.
     */
-    exceeds_capacity =
-        m_writeset_history.size() + writeset->size() > m_opt_max_history_size;
+    exceeds_capacity = m_writeset_history.size() +
+                           m_large_trx_table_history.size() +
+                           writeset->size() >
+                       m_opt_max_history_size;
 
     /*
      Compute the greatest sequence_number among all conflicts and add the
@@ -268,6 +296,15 @@ void Writeset_trx_dependency_tracker::get_dependency(THD *thd,
       }
     }
 
+    /* Depend on the large transactions that touched the same tables. */
+    for (uint64 table_hash : write_set_ctx->get_table_hashes()) {
+      Writeset_history::iterator hst =
+          m_large_trx_table_history.find(table_hash);
+      if (hst != m_large_trx_table_history.end() &&
+          hst->second > last_parent && hst->second < sequence_number)
+        last_parent = hst->second;
+    }
+
     /*
       If the transaction references tables with missing primary keys revert to
       COMMIT_ORDER, update and not reset history, as it is unnecessary because
@@ -286,12 +323,14 @@ void Writeset_trx_dependency_tracker::get_dependency(THD *thd,
   if (exceeds_capacity || !can_use_writesets) {
     m_writeset_history_start = sequence_number;
     m_writeset_history.clear();
+    m_large_trx_table_history.clear();
   }
 }
 
 void Writeset_trx_dependency_tracker::rotate(int64 start) {
   m_writeset_history_start = start;
   m_writeset_history.clear();
+  m_large_trx_table_history.clear();
 }
 
 /**
@@ -158,6 +158,15 @@ class Writeset_trx_dependency_tracker {
   */
   typedef std::map<uint64, int64> Writeset_history;
   Writeset_history m_writeset_history;
+
+  /*
+    Track the last transaction sequence number that changed each table
+    in a transaction whose writeset was too big to be added to the
+    history, using the hashes of the table names as the index. Such a
+    transaction conflicts with every later transaction on those tables,
+    but not with the rest. Counts towards m_opt_max_history_size.
+  */
+  Writeset_history m_large_trx_table_history;
 };
 
 /**
@@ -810,6 +810,8 @@ bool add_pke(TABLE *table, THD *thd, const uchar *record) {
                             table->s->table_name.length);
     pke_schema_table.append(HASH_STRING_SEPARATOR);
     pke_schema_table.append(std::to_string(table->s->table_name.length));
+    ws_ctx->add_table_hash(
+        MY_XXH64(pke_schema_table.c_str(), pke_schema_table.size(), 0));
 
     std::string pke;
     pke.reserve(NAME_LEN * 5);
@@ -1009,6 +1011,22 @@ bool add_pke(TABLE *table, THD *thd, const uchar *record) {
         const std::string referenced_table_name_length =
             std::to_string(fk[fk_number].referenced_table_name.length);
 
+        /*
+          The referenced table is touched as far as dependency tracking is
+          concerned; hash its name the same way as pke_schema_table.
+        */
+        pke.clear();
+        pke.append(HASH_STRING_SEPARATOR);
+        pke.append(fk[fk_number].referenced_table_db.str,
+                   fk[fk_number].referenced_table_db.length);
+        pke.append(HASH_STRING_SEPARATOR);
+        pke.append(referenced_schema_name_length);
+        pke.append(fk[fk_number].referenced_table_name.str,
+                   fk[fk_number].referenced_table_name.length);
+        pke.append(HASH_STRING_SEPARATOR);
+        pke.append(referenced_table_name_length);
+        ws_ctx->add_table_hash(MY_XXH64(pke.c_str(), pke.size(), 0));
+
         /*
           Prefix the hash keys with the referenced index name.
         */
@@ -310,6 +310,9 @@ class Sort_param {
   bool use_hash{false};         // Whether to use hash to distinguish cut JSON
   bool m_remove_duplicates{
       false};  ///< Whether we want to remove duplicate rows
+  /// The number of threads that may sort the sort buffer; see
+  /// Filesort_buffer::sort_buffer().
+  uint m_num_sort_threads{1};
 
   /// If we are removing duplicate rows and merging, contains a buffer where we
   /// can store the last key seen.
@@ -453,10 +456,12 @@ class Sort_param {
 
   // NOTE: Even with FILESORT_ALG_STD_STABLE, we do not necessarily have a
   // stable sort if spilling to disk; this is purely a performance option.
+  // FILESORT_ALG_RADIX is stable too.
   enum enum_sort_algorithm {
     FILESORT_ALG_NONE,
     FILESORT_ALG_STD_SORT,
-    FILESORT_ALG_STD_STABLE
+    FILESORT_ALG_STD_STABLE,
+    FILESORT_ALG_RADIX
   };
   enum_sort_algorithm m_sort_algorithm{FILESORT_ALG_NONE};
 
@@ -1833,7 +1833,8 @@ static bool open_table_and_lock_histograms(THD *thd, Table_ref *table,
 }
 
 bool Sql_cmd_analyze_table::handle_histogram_command_inner(
-    THD *thd, Table_ref *table, histograms::results_map &results) {
+    THD *thd, Table_ref *table, Histogram_command command,
+    histograms::results_map &results) {
   // Various scope guards in preparation for update/drop histogram.
 
   Disable_autocommit_guard autocommit_guard(thd);
@@ -1866,7 +1867,7 @@ bool Sql_cmd_analyze_table::handle_histogram_command_inner(
   if (open_table_and_lock_histograms(thd, table, results)) return true;
 
   // UPDATE/DROP histograms. Commit on success. Rollback on error.
-  switch (get_histogram_command()) {
+  switch (command) {
     case Histogram_command::UPDATE_HISTOGRAM:
       if (acquire_shared_backup_lock(thd, thd->variables.lock_wait_timeout) ||
           update_histogram(thd, table, results))
@@ -1877,6 +1878,13 @@ bool Sql_cmd_analyze_table::handle_histogram_command_inner(
           drop_histogram(thd, table, results))
         return true;
       break;
+    case Histogram_command::REFRESH_HISTOGRAMS:
+      if (acquire_shared_backup_lock(thd, thd->variables.lock_wait_timeout) ||
+          histograms::refresh_histograms(thd, table, results))
+        return true;
+      // Nothing to commit if the table has no histograms.
+      if (results.empty()) return false;
+      break;
     case Histogram_command::NONE:
       assert(false);
       return true;
@@ -1908,10 +1916,31 @@ bool Sql_cmd_analyze_table::handle_histogram_command_inner(
 bool Sql_cmd_analyze_table::handle_histogram_command(THD *thd,
                                                      Table_ref *table) {
   histograms::results_map results;
-  handle_histogram_command_inner(thd, table, results);
+  handle_histogram_command_inner(thd, table, get_histogram_command(), results);
   return send_histogram_results(thd, results, table);
 }
 
+void Sql_cmd_analyze_table::refresh_histograms(THD *thd, Table_ref *tables) {
+  for (Table_ref *table = tables; table != nullptr; table = table->next_local) {
+    // Histograms are handled one table at a time.
+    Table_ref *save_next_local = table->next_local,
+              *save_next_global = table->next_global;
+    table->next_local = table->next_global = nullptr;
+
+    histograms::results_map results;
+    handle_histogram_command_inner(thd, table,
+                                   Histogram_command::REFRESH_HISTOGRAMS,
+                                   results);
+    if (thd->is_error()) thd->clear_error();
+
+    table->next_local = save_next_local;
+    table->next_global = save_next_global;
+    /* Clear references to TABLE and MDL_ticket after releasing them. */
+    table->table = nullptr;
+    table->mdl_request.ticket = nullptr;
+  }
+}
+
 bool Sql_cmd_analyze_table::execute(THD *thd) {
   Table_ref *first_table = thd->lex->query_block->get_table_list();
   bool res = true;
@@ -1932,6 +1961,8 @@ bool Sql_cmd_analyze_table::execute(THD *thd) {
   if (get_histogram_command() != Histogram_command::NONE) {
     res = handle_histogram_command(thd, first_table);
   } else {
+    if (thd->variables.histogram_refresh_on_analyze)
+      refresh_histograms(thd, first_table);
     res = mysql_admin_table(thd, first_table, &thd->lex->check_opt, "analyze",
                             lock_type, true, false, 0, nullptr,
                             &handler::ha_analyze, 0, m_alter_info, true);
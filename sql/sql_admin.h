@@ -71,7 +71,9 @@ class Sql_cmd_analyze_table : public Sql_cmd_ddl_table {
     NONE,              ///< Neither UPDATE or DROP histogram is specified
     UPDATE_HISTOGRAM,  ///< UPDATE HISTOGRAM ... is specified after ANALYZE
                        ///< TABLE
-    DROP_HISTOGRAM     ///< DROP HISTOGRAM ... is specified after ANALYZE TABLE
+    DROP_HISTOGRAM,    ///< DROP HISTOGRAM ... is specified after ANALYZE TABLE
+    REFRESH_HISTOGRAMS  ///< Not specified by the user: rebuild the existing
+                        ///< histograms, see histogram_refresh_on_analyze
   };
 
   /**
@@ -180,7 +182,18 @@ class Sql_cmd_analyze_table : public Sql_cmd_ddl_table {
 
   // Carries out the main portion of the work of handle_histogram_command().
   bool handle_histogram_command_inner(THD *thd, Table_ref *table,
+                                      Histogram_command command,
                                       histograms::results_map &results);
+
+  /**
+    Rebuilds the existing histograms of each table, before they are analyzed
+    by a plain ANALYZE TABLE, when histogram_refresh_on_analyze is set.
+    Failures are not reported: analyzing the table reports the same errors.
+
+    @param thd Thread handler.
+    @param tables The tables specified in ANALYZE TABLE
+  */
+  void refresh_histograms(THD *thd, Table_ref *tables);
 };
 
 /**
@@ -301,9 +301,21 @@ mysql_mutex_t LOCK_open;
   3) If the share is still in the cache, and m_open_in_progress
      has become false, the thread will check if the share is ok
      (no error), increment the ref counter, and return the share.
+
+  The condition is partitioned by the hash of the table cache key, so
+  that finishing the opening of a share only wakes up the threads
+  waiting for shares in the same partition. Otherwise, when many table
+  definitions are opened concurrently (e.g. after a restart), every
+  finished share wakes up all waiting threads, which then all compete
+  for LOCK_open just to find that their share is still being opened.
 */
 
-mysql_cond_t COND_open;
+static const size_t COND_OPEN_PARTITIONS = 64;
+static mysql_cond_t COND_open[COND_OPEN_PARTITIONS];
+
+static mysql_cond_t *cond_open_for_key(const std::string &key) {
+  return &COND_open[std::hash<std::string>()(key) % COND_OPEN_PARTITIONS];
+}
 
 #ifdef HAVE_PSI_INTERFACE
 static PSI_mutex_key key_LOCK_open;
@@ -479,12 +491,12 @@ bool table_def_init(void) {
   init_tdc_psi_keys();
 #endif
   mysql_mutex_init(key_LOCK_open, &LOCK_open, MY_MUTEX_INIT_FAST);
-  mysql_cond_init(key_COND_open, &COND_open);
+  for (mysql_cond_t &cond : COND_open) mysql_cond_init(key_COND_open, &cond);
   oldest_unused_share = &end_of_unused_share;
   end_of_unused_share.prev = &oldest_unused_share;
 
   if (table_cache_manager.init()) {
-    mysql_cond_destroy(&COND_open);
+    for (mysql_cond_t &cond : COND_open) mysql_cond_destroy(&cond);
     mysql_mutex_destroy(&LOCK_open);
     return true;
   }
@@ -522,7 +534,7 @@ void table_def_free(void) {
     delete table_def_cache;
     table_def_cache = nullptr;
     table_cache_manager.destroy();
-    mysql_cond_destroy(&COND_open);
+    for (mysql_cond_t &cond : COND_open) mysql_cond_destroy(&cond);
     mysql_mutex_destroy(&LOCK_open);
   }
 }
@@ -717,8 +729,10 @@ TABLE_SHARE *get_table_share(THD *thd, const char *db, const char *table_name,
     open fails, so after cond_wait, we must repeat searching the
     hash table.
   */
+  const string key_str(key, key_length);
+  mysql_cond_t *cond_open = cond_open_for_key(key_str);
   for (;;) {
-    auto it = table_def_cache->find(string(key, key_length));
+    auto it = table_def_cache->find(key_str);
     if (it == table_def_cache->end()) {
       if (thd->mdl_context.owns_equal_or_stronger_lock(
               MDL_key::SCHEMA, db, "", MDL_INTENTION_EXCLUSIVE)) {
@@ -741,7 +755,7 @@ TABLE_SHARE *get_table_share(THD *thd, const char *db, const char *table_name,
       return process_found_table_share(thd, share, open_view);
 
     DEBUG_SYNC(thd, "get_share_before_COND_open_wait");
-    mysql_cond_wait(&COND_open, &LOCK_open);
+    mysql_cond_wait(cond_open, &LOCK_open);
   }
 
   /*
@@ -769,7 +783,7 @@ TABLE_SHARE *get_table_share(THD *thd, const char *db, const char *table_name,
   */
   assign_new_table_id(share);
 
-  table_def_cache->emplace(to_string(share->table_cache_key),
+  table_def_cache->emplace(key_str,
                            unique_ptr<TABLE_SHARE, Table_share_deleter>(share));
 
   /*
@@ -861,7 +875,7 @@ TABLE_SHARE *get_table_share(THD *thd, const char *db, const char *table_name,
   */
   mysql_mutex_lock(&LOCK_open);
   share->m_open_in_progress = false;
-  mysql_cond_broadcast(&COND_open);
+  mysql_cond_broadcast(cond_open);
 
   /*
     Fake an open_table_def error in debug build, resulting in
@@ -140,6 +140,8 @@ class READ_INFO {
   int *stack, *stack_pos;
   bool found_end_of_line, start_of_line, eof;
   bool need_end_io_cache;
+  /* If bytes below 0x80 are single ASCII characters in read_charset. */
+  bool ascii_based;
   IO_CACHE cache;
   int level; /* for load xml */
 
@@ -1747,6 +1749,7 @@ READ_INFO::READ_INFO(File file_par, size_t tot_length, const CHARSET_INFO *cs,
       found_end_of_line(false),
       eof(false),
       need_end_io_cache(false),
+      ascii_based(my_charset_is_ascii_based(cs)),
       error(false),
       line_truncated(false),
       found_null(false),
@@ -1993,7 +1996,11 @@ bool READ_INFO::read_field() {
       }
 
       uint ml;
-      GET_MBCHARLEN(read_charset, chr, ml);
+      // Most input is ASCII, skip the charset lookup for it.
+      if (ascii_based && static_cast<uint>(chr) < 0x80)
+        ml = 1;
+      else
+        GET_MBCHARLEN(read_charset, chr, ml);
       if (ml == 0) {
         *to = '\0';
         my_error(ER_INVALID_CHARACTER_STRING, MYF(0), read_charset->csname,
@@ -1303,6 +1303,24 @@ void bind_fields(Item *first) {
   for (Item *item = first; item; item = item->next_free) item->bind_fields();
 }
 
+/**
+  Give back the memory of a network read buffer which grew to receive a large
+  packet, so that an idle connection does not hold on to it until it
+  disconnects.
+
+  @param net     The network handler of the connection
+  @param length  The size to shrink the buffer to, i.e. net_buffer_length
+*/
+static void shrink_net_buffer(NET *net, ulong length) {
+  /*
+    With the compressed protocol the buffer may still hold the beginning of
+    the next command.
+  */
+  if (net->max_packet <= length || net->remain_in_buf != 0) return;
+
+  if (!net_realloc(net, length)) net->read_pos = net->buff;
+}
+
 /**
   Read one command from connection and execute it (query or simple command).
   This function is called in loop from thread function.
@@ -1462,6 +1480,7 @@ bool do_command(THD *thd) {
   return_value = dispatch_command(thd, &com_data, command);
   thd->get_protocol_classic()->get_output_packet()->shrink(
       thd->variables.net_buffer_length);
+  if (!return_value) shrink_net_buffer(net, thd->variables.net_buffer_length);
 
 out:
   /* The statement instrumentation must be closed in all cases. */
@@ -2406,20 +2425,17 @@ done:
   thd->work_part_info = nullptr;
 
   /*
-    If we've allocated a lot of memory (compared to the default preallocation
-    size = 8192; note that we don't actually preallocate anymore), free
-    it so that one big query won't cause us to hold on to a lot of RAM forever.
-    If not, keep the last block so that the next query will hopefully be able to
-    run without allocating memory from the OS.
+    Keep the largest block which is not much bigger than the default
+    preallocation size = 8192 (note that we don't actually preallocate
+    anymore), so that the next query will hopefully be able to run without
+    allocating memory from the OS. Free everything else, so that one big
+    query won't cause us to hold on to a lot of RAM forever.
 
     The factor 5 is pretty much arbitrary, but ends up allowing three
     allocations (1 + 1.5 + 1.5²) under the current allocation policy.
   */
   constexpr size_t kPreallocSz = 40960;
-  if (thd->mem_root->allocated_size() < kPreallocSz)
-    thd->mem_root->ClearForReuse();
-  else
-    thd->mem_root->Clear();
+  thd->mem_root->ClearForReuse(kPreallocSz);
 
     /* SHOW PROFILE instrumentation, end */
 #if defined(ENABLED_PROFILING)
@@ -2323,14 +2323,28 @@ bool init_ref(THD *thd, unsigned keyparts, unsigned length, unsigned keyno,
   ref->key_parts = keyparts;
   ref->key_length = length;
   ref->key = keyno;
-  if (!(ref->key_buff = thd->mem_root->ArrayAlloc<uchar>(ALIGN_SIZE(length))) ||
-      !(ref->key_buff2 =
-            thd->mem_root->ArrayAlloc<uchar>(ALIGN_SIZE(length))) ||
-      !(ref->key_copy = thd->mem_root->ArrayAlloc<store_key *>(keyparts)) ||
-      !(ref->items = thd->mem_root->ArrayAlloc<Item *>(keyparts)) ||
-      !(ref->cond_guards = thd->mem_root->ArrayAlloc<bool *>(keyparts))) {
-    return true;
-  }
+  /*
+    Carve all the arrays out of one allocation, as this runs for every ref
+    access of every execution, e.g. for each primary key point select.
+  */
+  const size_t buff_size = ALIGN_SIZE(length);
+  const size_t key_copy_size = ALIGN_SIZE(sizeof(store_key *) * keyparts);
+  const size_t items_size = ALIGN_SIZE(sizeof(Item *) * keyparts);
+  const size_t cond_guards_size = ALIGN_SIZE(sizeof(bool *) * keyparts);
+  const size_t total_size =
+      key_copy_size + items_size + cond_guards_size + 2 * buff_size;
+  char *mem = static_cast<char *>(thd->mem_root->Alloc(total_size));
+  if (mem == nullptr) return true;
+  memset(mem, 0, total_size);
+  ref->key_copy = pointer_cast<store_key **>(mem);
+  mem += key_copy_size;
+  ref->items = pointer_cast<Item **>(mem);
+  mem += items_size;
+  ref->cond_guards = pointer_cast<bool **>(mem);
+  mem += cond_guards_size;
+  ref->key_buff = pointer_cast<uchar *>(mem);
+  mem += buff_size;
+  ref->key_buff2 = pointer_cast<uchar *>(mem);
   ref->key_err = true;
   ref->null_rejecting = 0;
   ref->use_count = 0;
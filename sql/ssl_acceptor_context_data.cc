@@ -329,6 +329,15 @@ Ssl_acceptor_context_data::Ssl_acceptor_context_data(
       LogErr(WARNING_LEVEL, ER_SSL_LIBRARY_ERROR, sslGetErrString(error_num));
     }
 
+#ifdef SSL_OP_ENABLE_KTLS
+    /*
+      OpenSSL only switches a connection to kTLS when the kernel supports the
+      negotiated cipher, and keeps working in user space otherwise.
+    */
+    if (ssl_acceptor_fd_ && opt_tls_ktls)
+      SSL_CTX_set_options(ssl_acceptor_fd_->ssl_context, SSL_OP_ENABLE_KTLS);
+#endif /* SSL_OP_ENABLE_KTLS */
+
     if (ssl_acceptor_fd_) acceptor_ = SSL_new(ssl_acceptor_fd_->ssl_context);
 
     if (ssl_acceptor_fd_ && acceptor_) {
@@ -40,6 +40,7 @@ std::string mysql_admin_channel("mysql_admin");
 /** SSL context options */
 
 bool opt_tls_certificates_enforced_validation{false};
+bool opt_tls_ktls{false};
 
 /* Related to client server connection port */
 static const char *opt_ssl_ca = nullptr;
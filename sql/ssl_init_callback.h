@@ -33,6 +33,7 @@ extern std::atomic_bool g_admin_ssl_configured;
 extern std::string mysql_main_channel;
 extern std::string mysql_admin_channel;
 extern bool opt_tls_certificates_enforced_validation;
+extern bool opt_tls_ktls;
 
 /** helper class to deal with optionally empty strings */
 class OptionalString {
@@ -1009,6 +1009,24 @@ static Sys_var_ulong Sys_pfs_max_digest_sample_age(
     VALID_RANGE(0, 1024 * 1024), DEFAULT(60), BLOCK_SIZE(1),
     PFS_TRAILING_PROPERTIES);
 
+static Sys_var_bool Sys_pfs_digest_eviction(
+    "performance_schema_digest_eviction",
+    "When the EVENTS_STATEMENTS_SUMMARY_BY_DIGEST table is full, replace"
+    " digests with a low total latency by new digests, instead of"
+    " aggregating new digests in the NULL digest row.",
+    GLOBAL_VAR(pfs_param.m_digest_eviction), CMD_LINE(OPT_ARG),
+    DEFAULT(false), PFS_TRAILING_PROPERTIES);
+
+static Sys_var_ulong Sys_pfs_statement_sample_rate(
+    "performance_schema_statement_sample_rate",
+    "Instrument only one statement out of this many in each thread."
+    " Statements that are not sampled are not counted in the statement"
+    " events and summary tables. When the value is 1, all statements are"
+    " instrumented.",
+    GLOBAL_VAR(pfs_param.m_statement_sample_rate), CMD_LINE(REQUIRED_ARG),
+    VALID_RANGE(1, 1024 * 1024), DEFAULT(1), BLOCK_SIZE(1),
+    PFS_TRAILING_PROPERTIES);
+
 static Sys_var_long Sys_pfs_connect_attrs_size(
     "performance_schema_session_connect_attrs_size",
     "Size of session attribute string buffer per thread."
@@ -1236,6 +1254,15 @@ static Sys_var_ulong Sys_binlog_cache_size(
     NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(nullptr),
     ON_UPDATE(fix_binlog_cache_size));
 
+static Sys_var_ulonglong Sys_binlog_tail_cache_size(
+    "binlog_tail_cache_size",
+    "The size of the in-memory buffer holding the most recently written "
+    "part of the active binary log, which dump threads read events from "
+    "instead of reading the binary log file. 0 disables it.",
+    READ_ONLY GLOBAL_VAR(opt_binlog_tail_cache_size), CMD_LINE(REQUIRED_ARG),
+    VALID_RANGE(0, ULLONG_MAX), DEFAULT(0), BLOCK_SIZE(IO_SIZE),
+    NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(nullptr), ON_UPDATE(nullptr));
+
 static Sys_var_ulong Sys_binlog_stmt_cache_size(
     "binlog_stmt_cache_size",
     "The size of the statement cache for "
@@ -2252,6 +2279,43 @@ static Sys_var_ulong Sys_join_buffer_size(
     HINT_UPDATEABLE SESSION_VAR(join_buff_size), CMD_LINE(REQUIRED_ARG),
     VALID_RANGE(128, ULONG_MAX), DEFAULT(256 * 1024), BLOCK_SIZE(128));
 
+static Sys_var_ulong Sys_iterator_batch_size(
+    "iterator_batch_size",
+    "The number of rows that aggregation and hash join build read from their "
+    "input at a time, letting scans and filters below them run in a tight "
+    "loop. Only used for non-locking reads of tables without BLOB columns. "
+    "0 or 1 means that rows are read one at a time",
+    HINT_UPDATEABLE SESSION_VAR(iterator_batch_size), CMD_LINE(REQUIRED_ARG),
+    VALID_RANGE(0, 65535), DEFAULT(0), BLOCK_SIZE(1));
+
+static Sys_var_ulong Sys_hash_join_build_threads(
+    "hash_join_build_threads",
+    "The number of partitions the hash table of a hash join is split into, "
+    "and the number of threads that insert rows into them when the build "
+    "input is large. 1 means that the hash table is built by the session "
+    "thread only",
+    HINT_UPDATEABLE SESSION_VAR(hash_join_build_threads),
+    CMD_LINE(REQUIRED_ARG), VALID_RANGE(1, 64), DEFAULT(1), BLOCK_SIZE(1));
+
+static Sys_var_ulong Sys_parallel_table_scan_threads(
+    "parallel_table_scan_threads",
+    "The number of threads to read a table with, for full table scans in "
+    "single-table SELECT queries when the hypergraph optimizer finds it "
+    "cheaper than reading with one thread. The storage engine may give "
+    "fewer threads (see innodb_parallel_read_threads). 1 disables parallel "
+    "table scans",
+    HINT_UPDATEABLE SESSION_VAR(parallel_table_scan_threads),
+    CMD_LINE(REQUIRED_ARG), VALID_RANGE(1, 256), DEFAULT(1), BLOCK_SIZE(1));
+
+static Sys_var_bool Sys_hash_join_bloom_filter(
+    "hash_join_bloom_filter",
+    "Build a Bloom filter over the join keys of the build input of inner "
+    "hash joins and hash semijoins, and use it to discard probe rows that "
+    "cannot match before they are looked up in the hash table or written "
+    "to disk",
+    HINT_UPDATEABLE SESSION_VAR(hash_join_bloom_filter), CMD_LINE(OPT_ARG),
+    DEFAULT(false));
+
 static Sys_var_keycache Sys_key_buffer_size(
     "key_buffer_size",
     "The size of the buffer used for "
@@ -3026,6 +3090,15 @@ static Sys_var_ulong Sys_net_buffer_length(
     VALID_RANGE(1024, 1024 * 1024), DEFAULT(16384), BLOCK_SIZE(1024),
     NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(check_net_buffer_length));
 
+static Sys_var_ulong Sys_net_result_buffer_length(
+    "net_result_buffer_length",
+    "Size the network buffer grows to while the rows of a result set are "
+    "sent, so that they are written to the client in fewer and larger "
+    "writes. The buffer is shrunk back to net_buffer_length after the "
+    "statement. 0 keeps it at net_buffer_length",
+    SESSION_VAR(net_result_buffer_length), CMD_LINE(REQUIRED_ARG),
+    VALID_RANGE(0, 16 * 1024 * 1024), DEFAULT(0), BLOCK_SIZE(1024));
+
 static bool fix_net_read_timeout(sys_var *self, THD *thd, enum_var_type type) {
   if (!self->is_global_persist(type)) {
     // net_buffer_length is a specific property for the classic protocols
@@ -3154,6 +3227,17 @@ static Sys_var_ulong Sys_optimizer_max_subgraph_pairs(
     CMD_LINE(REQUIRED_ARG), VALID_RANGE(1, INT_MAX), DEFAULT(100000),
     BLOCK_SIZE(1));
 
+static Sys_var_ulong Sys_optimizer_hypergraph_time_limit(
+    "optimizer_hypergraph_time_limit",
+    "Time in milliseconds the hypergraph join optimizer may spend "
+    "enumerating join orders before it starts reducing the search space "
+    "heuristically, as if optimizer_max_subgraph_pairs had been reached "
+    "with the number of subgraph pairs seen by then. 0 means no limit. "
+    "Ignored by the old (non-hypergraph) join optimizer",
+    HINT_UPDATEABLE SESSION_VAR(optimizer_hypergraph_time_limit),
+    CMD_LINE(REQUIRED_ARG), VALID_RANGE(0, 3600 * 1000), DEFAULT(0),
+    BLOCK_SIZE(1));
+
 static Sys_var_ulong Sys_range_optimizer_max_mem_size(
     "range_optimizer_max_mem_size",
     "Maximum amount of memory used by the range optimizer "
@@ -3192,6 +3276,15 @@ static Sys_var_ulonglong Sys_histogram_generation_max_mem_size(
     NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(check_session_admin),
     ON_UPDATE(nullptr));
 
+static Sys_var_bool Sys_histogram_refresh_on_analyze(
+    "histogram_refresh_on_analyze",
+    "If set, ANALYZE TABLE without UPDATE or DROP HISTOGRAM also rebuilds the "
+    "existing histograms of the analyzed tables from their current data, "
+    "with the number of buckets each histogram was built with",
+    SESSION_VAR(histogram_refresh_on_analyze), CMD_LINE(OPT_ARG),
+    DEFAULT(false), NO_MUTEX_GUARD, NOT_IN_BINLOG,
+    ON_CHECK(check_session_admin), ON_UPDATE(nullptr));
+
 /*
   Need at least 400Kb to get through bootstrap.
   Need at least 8Mb to get through mtr check testcase, which does
@@ -3864,14 +3957,46 @@ static Sys_var_ulong Sys_trans_prealloc_size(
     ON_UPDATE(nullptr), DEPRECATED_VAR(""));
 
 static const char *thread_handling_names[] = {
-    "one-thread-per-connection", "no-threads", "loaded-dynamically", nullptr};
+    "one-thread-per-connection", "no-threads", "pool-of-threads",
+    "loaded-dynamically", nullptr};
 static Sys_var_enum Sys_thread_handling(
     "thread_handling",
     "Define threads usage for handling queries, one of "
-    "one-thread-per-connection, no-threads, loaded-dynamically",
+    "one-thread-per-connection, no-threads, pool-of-threads, "
+    "loaded-dynamically",
     READ_ONLY GLOBAL_VAR(Connection_handler_manager::thread_handling),
     CMD_LINE(REQUIRED_ARG), thread_handling_names, DEFAULT(0));
 
+static Sys_var_uint Sys_thread_pool_size(
+    "thread_pool_size",
+    "Number of thread groups of the thread pool, used when thread_handling "
+    "is pool-of-threads. Each group waits for the requests of its "
+    "connections and executes them with a few threads",
+    READ_ONLY GLOBAL_VAR(Thread_pool_connection_handler::pool_size),
+    CMD_LINE(REQUIRED_ARG), VALID_RANGE(1, 512), DEFAULT(16), BLOCK_SIZE(1));
+
+static Sys_var_uint Sys_thread_pool_stall_limit(
+    "thread_pool_stall_limit",
+    "Time in milliseconds after which a thread group which did not start "
+    "executing a queued request starts one more thread",
+    READ_ONLY GLOBAL_VAR(Thread_pool_connection_handler::stall_limit),
+    CMD_LINE(REQUIRED_ARG), VALID_RANGE(10, 60000), DEFAULT(500),
+    BLOCK_SIZE(1));
+
+static Sys_var_uint Sys_thread_pool_oversubscribe(
+    "thread_pool_oversubscribe",
+    "Number of threads of a thread group, in addition to one, that may "
+    "execute requests at the same time",
+    READ_ONLY GLOBAL_VAR(Thread_pool_connection_handler::oversubscribe),
+    CMD_LINE(REQUIRED_ARG), VALID_RANGE(1, 1000), DEFAULT(3), BLOCK_SIZE(1));
+
+static Sys_var_uint Sys_thread_pool_max_threads(
+    "thread_pool_max_threads",
+    "Maximum number of threads the thread pool executes requests with",
+    READ_ONLY GLOBAL_VAR(Thread_pool_connection_handler::max_pool_threads),
+    CMD_LINE(REQUIRED_ARG), VALID_RANGE(1, 100000), DEFAULT(100000),
+    BLOCK_SIZE(1));
+
 static Sys_var_charptr Sys_secure_file_priv(
     "secure_file_priv",
     "Limit LOAD DATA, SELECT ... OUTFILE, and LOAD_FILE() to files "
@@ -4089,6 +4214,17 @@ static Sys_var_bool Sys_replica_preserve_commit_order(
 static Sys_var_deprecated_alias Sys_slave_preserve_commit_order(
     "slave_preserve_commit_order", Sys_replica_preserve_commit_order);
 
+static Sys_var_bool Sys_replica_recompute_dependencies(
+    "replica_recompute_dependencies",
+    "Make the replica applier compute the dependencies between transactions "
+    "from the tables they change, instead of using the ones from the source. "
+    "This gives parallelism with sources that use COMMIT_ORDER dependency "
+    "tracking. Transactions with statements other than row changes, or on "
+    "tables with foreign keys, are applied serially.",
+    GLOBAL_VAR(opt_replica_recompute_dependencies), CMD_LINE(OPT_ARG),
+    DEFAULT(false), NO_MUTEX_GUARD, NOT_IN_BINLOG,
+    ON_CHECK(check_slave_stopped), ON_UPDATE(nullptr));
+
 bool Sys_var_charptr::global_update(THD *, set_var *var) {
   char *new_val, *ptr = var->save_result.string_value.str;
   const size_t len = var->save_result.string_value.length;
@@ -4667,6 +4803,14 @@ static Sys_var_ulong Sys_sort_buffer(
     VALID_RANGE(MIN_SORT_MEMORY, ULONG_MAX), DEFAULT(DEFAULT_SORT_MEMORY),
     BLOCK_SIZE(1));
 
+static Sys_var_ulong Sys_filesort_threads(
+    "filesort_threads",
+    "The number of threads that sort the rows in the sort buffer when it "
+    "holds many rows; the sorted parts are then merged, also in parallel. "
+    "1 means that the sort buffer is sorted by the session thread only",
+    HINT_UPDATEABLE SESSION_VAR(filesort_threads), CMD_LINE(REQUIRED_ARG),
+    VALID_RANGE(1, 64), DEFAULT(1), BLOCK_SIZE(1));
+
 /**
   Check sql modes strict_mode, 'NO_ZERO_DATE', 'NO_ZERO_IN_DATE' and
   'ERROR_FOR_DIVISION_BY_ZERO' are used together. If only subset of it
@@ -6141,6 +6285,17 @@ static Sys_var_ulonglong Sys_relay_log_space_limit(
     READ_ONLY GLOBAL_VAR(relay_log_space_limit), CMD_LINE(REQUIRED_ARG),
     VALID_RANGE(0, ULLONG_MAX), DEFAULT(0), BLOCK_SIZE(1));
 
+static Sys_var_ulonglong Sys_relay_log_tail_cache_size(
+    "relay_log_tail_cache_size",
+    "The size of the in-memory buffer, per replication channel, holding the "
+    "most recently received part of the active relay log. The applier reads "
+    "events from it instead of reading them back from the relay log file. "
+    "0 disables it.",
+    READ_ONLY GLOBAL_VAR(opt_relay_log_tail_cache_size),
+    CMD_LINE(REQUIRED_ARG), VALID_RANGE(0, ULLONG_MAX), DEFAULT(0),
+    BLOCK_SIZE(IO_SIZE), NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(nullptr),
+    ON_UPDATE(nullptr));
+
 static Sys_var_uint Sys_sync_relaylog_period(
     "sync_relay_log",
     "Synchronously flush relay log to disk after "
@@ -7399,6 +7554,17 @@ static Sys_var_bool Sys_replication_sender_observe_commit_only(
     DEFAULT(false), NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(nullptr),
     ON_UPDATE(nullptr));
 
+static Sys_var_bool Sys_replication_sender_zero_copy(
+    "replication_sender_zero_copy",
+    "Send large binary log events to replicas with sendfile(), without "
+    "copying them, when the connection uses neither TLS nor compression, "
+    "the binary log is not encrypted, source_verify_checksum is off and no "
+    "plugin observes the transmission. Only supported on Linux. Takes effect "
+    "for new dump threads.",
+    GLOBAL_VAR(opt_replication_sender_zero_copy), CMD_LINE(OPT_ARG),
+    DEFAULT(false), NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(nullptr),
+    ON_UPDATE(nullptr));
+
 static Sys_var_bool Sys_skip_replica_start(
     "skip_replica_start",
     "Do not start replication threads automatically "
@@ -7538,6 +7704,16 @@ static Sys_var_bool Sys_tls_certificates_enforced_validation(
     CMD_LINE(OPT_ARG), DEFAULT(false), NO_MUTEX_GUARD, NOT_IN_BINLOG,
     ON_CHECK(nullptr), ON_UPDATE(nullptr));
 
+static Sys_var_bool Sys_tls_ktls(
+    "tls_ktls",
+    "If set to TRUE, TLS connections hand record encryption and decryption "
+    "over to the kernel (kTLS) after the handshake, when the OpenSSL library "
+    "and the kernel support it for the negotiated cipher. Otherwise, or when "
+    "unsupported, OpenSSL does it in the server process.",
+    READ_ONLY NON_PERSIST GLOBAL_VAR(opt_tls_ktls), CMD_LINE(OPT_ARG),
+    DEFAULT(false), NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(nullptr),
+    ON_UPDATE(nullptr));
+
 static Sys_var_ulonglong Sys_set_operations_buffer_size(
     "set_operations_buffer_size",
     "The maximum size of the buffer used for hash based set operations ",
@@ -220,6 +220,7 @@ struct System_variables {
   ulonglong long_query_time;
   bool end_markers_in_json;
   bool windowing_use_high_precision;
+  bool hash_join_bloom_filter;
   /* A bitmap for switching optimizations on/off */
   ulonglong optimizer_switch;
   ulonglong optimizer_trace;           ///< bitmap to tune optimizer tracing
@@ -236,7 +237,11 @@ struct System_variables {
   uint eq_range_index_dive_limit;
   uint cte_max_recursion_depth;
   ulonglong histogram_generation_max_mem_size;
+  bool histogram_refresh_on_analyze;
   ulong join_buff_size;
+  ulong iterator_batch_size;
+  ulong hash_join_build_threads;
+  ulong parallel_table_scan_threads;
   ulong lock_wait_timeout;
   ulong max_allowed_packet;
   ulong max_error_count;
@@ -248,12 +253,14 @@ struct System_variables {
   ulong net_buffer_length;
   ulong net_interactive_timeout;
   ulong net_read_timeout;
+  ulong net_result_buffer_length;
   ulong net_retry_count;
   ulong net_wait_timeout;
   ulong net_write_timeout;
   ulong optimizer_prune_level;
   ulong optimizer_search_depth;
   ulong optimizer_max_subgraph_pairs;
+  ulong optimizer_hypergraph_time_limit;
   ulonglong parser_max_mem_size;
   ulong range_optimizer_max_mem_size;
   ulong preload_buff_size;
@@ -262,6 +269,7 @@ struct System_variables {
   ulong read_rnd_buff_size;
   ulong div_precincrement;
   ulong sortbuff_size;
+  ulong filesort_threads;
   ulong max_sp_recursion_depth;
   ulong default_week_format;
   ulong max_seeks_for_key;
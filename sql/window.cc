@@ -128,6 +128,9 @@ bool Window::check_window_functions1(THD *thd, Query_block *select) {
       (m_frame->m_query_expression == WFU_ROWS) && !m_static_aggregates;
   m_range_optimizable =
       (m_frame->m_query_expression == WFU_RANGE) && !m_static_aggregates;
+  m_min_max_slidable =
+      (m_frame->m_query_expression == WFU_ROWS) && !m_static_aggregates;
+  bool has_framing = false;
 
   for (Item_sum &wf : m_functions) {
     Window_evaluation_requirements reqs;
@@ -157,6 +160,10 @@ bool Window::check_window_functions1(THD *thd, Query_block *select) {
     m_opt_last_row |= reqs.opt_last_row;
     m_row_optimizable &= reqs.row_optimizable;
     m_range_optimizable &= reqs.range_optimizable;
+    if (wf.framing()) {
+      has_framing = true;
+      m_min_max_slidable &= reqs.min_max_slidable;
+    }
 
     if (thd->lex->is_explain() && !m_frame->m_originally_absent &&
         !wf.framing()) {
@@ -174,9 +181,24 @@ bool Window::check_window_functions1(THD *thd, Query_block *select) {
     }
   }
 
+  m_min_max_slidable &= has_framing;
+  assert(!m_min_max_slidable || !m_row_optimizable);
+
   return false;
 }
 
+bool Window::can_slide_min_max(int64 first_rowno) {
+  assert(m_min_max_slidable);
+  if (m_last_rowno_in_min_max_frame == 0) return false;
+
+  for (Item_sum &wf : m_functions) {
+    if (!wf.framing()) continue;
+    const Item_sum_hybrid &min_max = down_cast<Item_sum_hybrid &>(wf);
+    if (!min_max.null_value && min_max.value_at() < first_rowno) return false;
+  }
+  return true;
+}
+
 static Item_cache *make_result_item(Item *value) {
   Item *order_expr = down_cast<Item_ref *>(value)->ref_item();
   Item_cache *result = nullptr;
@@ -1414,6 +1436,7 @@ void Window::reset_execution_state(Reset_level level) {
   m_last_row_output = 0;
   m_last_rowno_in_cache = 0;
   m_aggregates_primed = false;
+  m_last_rowno_in_min_max_frame = 0;
   m_first_rowno_in_range_frame = 1;
   m_last_rowno_in_range_frame = 0;
   m_first_rowno_in_rows_frame = 1;
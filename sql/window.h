@@ -168,6 +168,14 @@ class Window {
   */
   bool m_range_optimizable;
 
+  /**
+    The framing functions are all MIN/MAX which can not use the window's
+    ordering, and the frame has ROW unit. Over a moving frame, each keeps its
+    value as long as the row which provided it stays in the frame, so only the
+    rows coming into the frame need to be visited, cf. can_slide_min_max().
+  */
+  bool m_min_max_slidable;
+
   /**
     The aggregates (SUM, etc) can be evaluated once for a partition, since it
     is static, i.e. all rows will have the same value for the aggregates, e.g.
@@ -515,6 +523,13 @@ class Window {
    */
   bool m_aggregates_primed;
 
+  /**
+    Execution state: for slidable MIN/MAX, cf. m_min_max_slidable, the last
+    row in the partition visited by the functions for the previous row's
+    frame. 0 if no frame has been visited yet in the partition.
+  */
+  int64 m_last_rowno_in_min_max_frame;
+
   /*------------------------------------------------------------------------
    *
    * RANGE boundary frame state variables.
@@ -690,6 +705,7 @@ class Window {
         m_needs_partition_cardinality(false),
         m_row_optimizable(true),
         m_range_optimizable(true),
+        m_min_max_slidable(false),
         m_static_aggregates(false),
         m_opt_first_row(false),
         m_opt_last_row(false),
@@ -714,6 +730,7 @@ class Window {
         m_rowno_in_frame(0),
         m_rowno_in_partition(0),
         m_aggregates_primed(false),
+        m_last_rowno_in_min_max_frame(0),
         m_first_rowno_in_range_frame(1),
         m_last_rowno_in_range_frame(0),
         m_is_last_row_in_frame(false),
@@ -1114,6 +1131,34 @@ class Window {
   */
   bool optimizable_range_aggregates() const { return m_range_optimizable; }
 
+  /**
+    Return true if the set of window functions are all MIN/MAX which can slide
+    along a ROW unit frame. Only relevant if m_needs_buffering is true.
+  */
+  bool slidable_min_max() const { return m_min_max_slidable; }
+
+  /**
+    Return true if the MIN/MAX functions still hold the values of the previous
+    row's frame, and all the rows which provided them are in the frame which
+    starts at first_rowno. Then only the rows of the frame after
+    last_rowno_in_min_max_frame() need to be visited.
+  */
+  bool can_slide_min_max(int64 first_rowno);
+
+  /**
+    See #m_last_rowno_in_min_max_frame
+  */
+  int64 last_rowno_in_min_max_frame() const {
+    return m_last_rowno_in_min_max_frame;
+  }
+
+  /**
+    See #m_last_rowno_in_min_max_frame
+  */
+  void set_last_rowno_in_min_max_frame(int64 rowno) {
+    m_last_rowno_in_min_max_frame = rowno;
+  }
+
   /**
     Return true if the aggregates are static, i.e. the same aggregate values for
     all rows in partition. Only relevant if m_needs_buffering is true.
@@ -1577,6 +1622,12 @@ struct Window_evaluation_requirements {
     Similar to row_optimizable but for RANGE frame bounds unit
   */
   bool range_optimizable;
+  /**
+    Set to true if the function is a MIN or MAX whose value, over a moving
+    frame, stays valid as long as the row which provided it stays in the
+    frame. Only applicable if the frame has ROW bounds unit.
+  */
+  bool min_max_slidable;
 
   Window_evaluation_requirements()
       : needs_buffer(false),
@@ -1585,7 +1636,8 @@ struct Window_evaluation_requirements {
         opt_first_row(false),
         opt_last_row(false),
         row_optimizable(true),
-        range_optimizable(true) {}
+        range_optimizable(true),
+        min_max_slidable(false) {}
 };
 
 #endif /* WINDOWS_INCLUDED */
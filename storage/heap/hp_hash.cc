@@ -115,11 +115,15 @@ uchar *hp_search(HP_INFO *info, HP_KEYDEF *keyinfo, const uchar *key,
   prev_ptr = nullptr;
 
   if (share->records) {
-    pos = hp_find_hash(
-        &keyinfo->block,
-        hp_mask(hp_hashnr(keyinfo, key), share->blength, share->records));
+    /*
+      Equal keys have equal hash values, so the key hash cached in each
+      entry lets us skip comparing keys of the other entries in the chain.
+    */
+    const ulong hashnr = static_cast<ulong>(hp_hashnr(keyinfo, key));
+    pos = hp_find_hash(&keyinfo->block,
+                       hp_mask(hashnr, share->blength, share->records));
     do {
-      if (!hp_key_cmp(keyinfo, pos->ptr_to_rec, key)) {
+      if (pos->hash == hashnr && !hp_key_cmp(keyinfo, pos->ptr_to_rec, key)) {
         switch (nextflag) {
           case 0: /* Search after key */
             DBUG_PRINT("exit", ("found key at %p", pos->ptr_to_rec));
@@ -146,9 +150,8 @@ uchar *hp_search(HP_INFO *info, HP_KEYDEF *keyinfo, const uchar *key,
       }
       if (flag) {
         flag = 0; /* Reset flag */
-        if (hp_find_hash(&keyinfo->block,
-                         hp_mask(hp_rec_hashnr(keyinfo, pos->ptr_to_rec),
-                                 share->blength, share->records)) != pos)
+        if (hp_find_hash(&keyinfo->block, hp_mask(pos->hash, share->blength,
+                                                  share->records)) != pos)
           break; /* Wrong link */
       }
     } while ((pos = pos->next_key));
@@ -1065,9 +1065,10 @@ void btr_free(const page_id_t &page_id, const page_size_t &page_size) {
 
 /** Truncate an index tree. We just free all except the root.
 Currently, this function is only specific for clustered indexes and the only
-caller is DDTableBuffer which manages a table with only a clustered index.
+callers are DDTableBuffer which manages a table with only a clustered index,
+and the rollback of a bulk insert into an empty table (TRX_UNDO_EMPTY_REC).
 It is up to the caller to ensure atomicity and to ensure correct recovery by
-calling btr_truncate_recover().
+calling btr_truncate_recover(), or by running again.
 @param[in]      index           clustered index */
 void btr_truncate(const dict_index_t *index) {
   ut_ad(index->is_clustered());
@@ -1109,6 +1110,8 @@ void btr_truncate(const dict_index_t *index) {
   /* Free all except the root, we don't want to change it. */
   btr_free_but_not_root(block, MTR_LOG_ALL);
 
+  btr_search_drop_page_hash_index(block, false);
+
   /* Reset the mark saying that we have finished the truncate.
   The PAGE_MAX_TRX_ID would be reset here. */
   page_create(block, &mtr, dict_table_is_comp(index->table), false);
@@ -34,6 +34,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
 #include <stddef.h>
 
+#include "buf0rea.h"
 #include "rem0cmp.h"
 #include "trx0trx.h"
 #include "ut0byte.h"
@@ -325,9 +326,18 @@ void btr_pcur_t::move_to_next_page(mtr_t *mtr) {
 
   auto block = get_block();
 
-  auto next_block =
-      btr_block_get(page_id_t(block->page.id.space(), next_page_no),
-                    block->page.size, mode, UT_LOCATION_HERE, index, mtr);
+  const page_id_t next_page_id(block->page.id.space(), next_page_no);
+
+  /* If the next page is not in the buffer pool, the scan is reading cold
+  data and would wait for one page read at a time. Then also start reading
+  the page after it, so that its read overlaps with the processing of the
+  next page. */
+  const bool read_ahead = !table->is_intrinsic() && !import_ctx &&
+                          !dict_index_is_ibuf(index) &&
+                          !buf_page_peek(next_page_id);
+
+  auto next_block = btr_block_get(next_page_id, block->page.size, mode,
+                                  UT_LOCATION_HERE, index, mtr);
 
   auto next_page = buf_block_get_frame(next_block);
 
@@ -354,6 +364,15 @@ void btr_pcur_t::move_to_next_page(mtr_t *mtr) {
   page_cur_set_before_first(next_block, get_page_cur());
 
   ut_d(page_check_dir(next_page));
+
+  if (read_ahead) {
+    const auto next_next_page_no = btr_page_get_next(next_page, mtr);
+
+    if (next_next_page_no != FIL_NULL) {
+      buf_read_ahead_leaf(page_id_t(next_page_id.space(), next_next_page_no),
+                          next_block->page.size);
+    }
+  }
 }
 
 void btr_pcur_t::move_backward_from_page(mtr_t *mtr) {
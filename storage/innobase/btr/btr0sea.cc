@@ -46,6 +46,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "btr0pcur.h"
 #include "buf0buf.h"
 #include "ha0ha.h"
+#include "os0thread.h"
 
 #include "page0cur.h"
 #include "page0page.h"
@@ -72,6 +73,8 @@ static ib_mutex_t btr_search_enabled_mutex;
 ulong btr_ahi_parts = 8;
 ut::fast_modulo_t btr_ahi_parts_fast_modulo(8);
 
+bool btr_search_latch_free = false;
+
 #ifdef UNIV_SEARCH_PERF_STAT
 /** Number of successful adaptive hash index lookups */
 ulint btr_search_n_succ = 0;
@@ -92,6 +95,20 @@ constexpr uint32_t BTR_SEARCH_PAGE_BUILD_LIMIT = 16;
 before hash index building is started */
 constexpr uint32_t BTR_SEARCH_BUILD_LIMIT = 100;
 
+/** Every this many searches in the hash index of an index, the share of them
+that found the record is checked. */
+constexpr uint32_t BTR_SEARCH_HIT_WINDOW = 1024;
+
+/** If fewer than one in this many searches in the hash index of an index have
+found the record, the index stops using the hash index for a while. */
+constexpr uint32_t BTR_SEARCH_MIN_HIT_RATIO = 16;
+
+/** For how many searches an index stops using the hash index. The searches
+in the B-tree that are not preceded by a search in the hash index do not
+update the search info, so the hash index is not built for the index either
+during that time. */
+constexpr uint32_t BTR_SEARCH_SKIP_SEARCHES = 16 * BTR_SEARCH_HIT_WINDOW;
+
 /** Compute a value to seed the hash value of a record.
 @param[in]      index   Index structure
 @return hash value for seed */
@@ -213,12 +230,57 @@ void btr_search_sys_t::search_part_t::initialize(size_t hash_size) {
   hash_table = ib_create((hash_size / btr_ahi_parts), LATCH_ID_HASH_TABLE_MUTEX,
                          0, MEM_HEAP_FOR_BTR_SEARCH);
   hash_table->heap->free_block_ptr = &free_block_for_heap;
+  hash_table->latch_free_readers = btr_search_latch_free;
 
 #if defined UNIV_AHI_DEBUG || defined UNIV_DEBUG
   hash_table->adaptive = true;
 #endif /* UNIV_AHI_DEBUG || UNIV_DEBUG */
 }
 
+size_t btr_search_sys_t::search_part_t::reader_enter() {
+  const size_t slot = ut::this_thread_hash % N_READER_SLOTS;
+
+  for (;;) {
+    const auto current = epoch.load();
+    auto &n_readers = readers[slot].n_readers[current % 2];
+
+    n_readers.fetch_add(1);
+
+    /* If wait_for_readers() has started a new epoch meanwhile, it may have
+    missed our increment: register in the new epoch instead. Otherwise, it
+    will see us, as both the increment and its read of the counter are
+    sequentially consistent with the reads of the epoch. */
+    if (epoch.load() == current) {
+      return slot * 2 + current % 2;
+    }
+
+    n_readers.fetch_sub(1);
+  }
+}
+
+void btr_search_sys_t::search_part_t::reader_exit(size_t ticket) {
+  readers[ticket / 2].n_readers[ticket % 2].fetch_sub(
+      1, std::memory_order_release);
+}
+
+void btr_search_sys_t::search_part_t::wait_for_readers() {
+  ut_ad(rw_lock_own(&latch, RW_LOCK_X));
+
+  /* The readers that enter from now on count in the other epoch. */
+  const auto previous = epoch.fetch_add(1) % 2;
+
+  for (auto &slot : readers) {
+    /* A reader never blocks while registered, so this is short. */
+    for (ulint i = 0; slot.n_readers[previous].load() != 0; ++i) {
+      if (i < 64) {
+        UT_RELAX_CPU();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+}
+
 void btr_search_sys_resize(ulint hash_size) {
   /* Step-1: Lock all search latches in exclusive mode. */
   btr_search_x_lock_all(UT_LOCATION_HERE);
@@ -242,6 +304,7 @@ void btr_search_sys_resize(ulint hash_size) {
         ib_create((hash_size / btr_ahi_parts), LATCH_ID_HASH_TABLE_MUTEX, 0,
                   MEM_HEAP_FOR_BTR_SEARCH);
     part.hash_table->heap->free_block_ptr = &part.free_block_for_heap;
+    part.hash_table->latch_free_readers = btr_search_latch_free;
 
 #if defined UNIV_AHI_DEBUG || defined UNIV_DEBUG
     part.hash_table->adaptive = true;
@@ -323,6 +386,16 @@ bool btr_search_disable() {
 
   btr_search_enabled = false;
   srv_btr_search_enabled = false;
+
+  if (btr_search_latch_free) {
+    /* A reader without latches which has seen the AHI enabled may still be
+    about to use a block which buf_pool_clear_hash_index() lets be freed with
+    its entries still in the hash table. */
+    for (ulint i = 0; i < btr_ahi_parts; ++i) {
+      btr_search_sys->parts[i].wait_for_readers();
+    }
+  }
+
   btr_search_x_unlock_all();
 
   /* Clear AHI info for all non-private blocks from Buffer Pool. */
@@ -347,6 +420,7 @@ bool btr_search_disable() {
   for (ulint i = 0; i < btr_ahi_parts; ++i) {
     const auto hash_table = btr_search_sys->parts[i].hash_table;
     hash_table_clear(hash_table);
+    hash_table->free_nodes = nullptr;
     mem_heap_empty(hash_table->heap);
   }
 
@@ -382,6 +456,9 @@ btr_search_t *btr_search_info_create(mem_heap_t *heap) {
 
   info->hash_analysis = 0;
   info->n_hash_potential = 0;
+  info->n_hash_window_searches = 0;
+  info->n_hash_window_hits = 0;
+  info->n_hash_skip = 0;
 
   info->last_hash_succ = false;
 
@@ -801,6 +878,94 @@ static bool btr_search_check_guess(btr_cur_t *cursor,
   }
 }
 
+/** Account for the outcome of a search in the hash index of an index, and stop
+using the hash index for the index for a while if it rarely finds anything.
+@param[in,out]  info    search info of the index
+@param[in]      hit     true if the search found the record */
+static void btr_search_update_hit_ratio(btr_search_t *info, bool hit) {
+  /* Like the rest of the search info, these counters are approximate. */
+  if (hit) {
+    info->n_hash_window_hits.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  if (info->n_hash_window_searches.fetch_add(1, std::memory_order_relaxed) + 1 <
+      BTR_SEARCH_HIT_WINDOW) {
+    return;
+  }
+
+  const auto n_hits = info->n_hash_window_hits.exchange(0);
+  info->n_hash_window_searches.store(0, std::memory_order_relaxed);
+
+  if (n_hits * BTR_SEARCH_MIN_HIT_RATIO < BTR_SEARCH_HIT_WINDOW) {
+    info->n_hash_skip.store(BTR_SEARCH_SKIP_SEARCHES,
+                            std::memory_order_relaxed);
+  }
+}
+
+/** Looks up a record in the adaptive hash index without taking the latch of
+the part, and latches the page of the record.
+@param[in]      index           index to search in
+@param[in]      hash_value      hash value of the searched tuple
+@param[in]      latch_mode      BTR_SEARCH_LEAF or BTR_MODIFY_LEAF
+@param[out]     searched        true if the hash table was searched
+@param[in,out]  mtr             mini-transaction to latch the page in
+@return the record, on a page latched in mtr, or nullptr */
+static const rec_t *btr_search_get_latch_free(const dict_index_t *index,
+                                              uint64_t hash_value,
+                                              ulint latch_mode, bool &searched,
+                                              mtr_t *mtr) {
+  auto &part = btr_get_search_part(index);
+
+  searched = false;
+
+  const auto ticket = part.reader_enter();
+  const auto reader_guard =
+      create_scope_guard([&part, ticket]() { part.reader_exit(ticket); });
+
+  if (!btr_search_enabled) {
+    return nullptr;
+  }
+
+  const auto table = part.hash_table;
+  const auto seq = table->modify_seq.load(std::memory_order_acquire);
+
+  if (seq % 2 != 0) {
+    /* An entry is being removed. */
+    return nullptr;
+  }
+
+  searched = true;
+
+  const rec_t *rec = ha_search_and_get_data_latch_free(table, hash_value);
+
+  if (rec == nullptr) {
+    return nullptr;
+  }
+
+  auto block = buf_block_from_ahi(rec);
+
+  /* The block stays in the buffer pool until we leave, because in our part of
+  the AHI it still has entries, which btr_search_drop_page_hash_index() must
+  remove before it can be freed. We must not wait for anything here, so the
+  block is not moved in the LRU list yet. */
+  if (!buf_page_get_known_nowait(latch_mode, block, Cache_hint::KEEP_OLD,
+                                 __FILE__, __LINE__, mtr)) {
+    return nullptr;
+  }
+
+  std::atomic_thread_fence(std::memory_order_acquire);
+
+  if (table->modify_seq.load(std::memory_order_relaxed) != seq) {
+    /* The entry may have been removed, and the record moved or deleted,
+    before we latched the page. */
+    btr_leaf_page_release(block, latch_mode, mtr);
+
+    return nullptr;
+  }
+
+  return rec;
+}
+
 bool btr_search_guess_on_hash(const dtuple_t *tuple, ulint mode,
                               ulint latch_mode, btr_cur_t *cursor,
                               ulint has_search_latch, mtr_t *mtr) {
@@ -835,6 +1000,13 @@ bool btr_search_guess_on_hash(const dtuple_t *tuple, ulint mode,
     return false;
   }
 
+  if (info->n_hash_skip.load(std::memory_order_relaxed) > 0) {
+    /* The hash index has rarely found the records of this index lately. */
+    info->n_hash_skip.fetch_sub(1, std::memory_order_relaxed);
+
+    return false;
+  }
+
   const auto prefix_info = info->prefix_info.load();
 
   cursor->ahi.prefix_info = prefix_info;
@@ -849,61 +1021,94 @@ bool btr_search_guess_on_hash(const dtuple_t *tuple, ulint mode,
 
   cursor->ahi.ahi_hash_value = hash_value;
 
-  if (!has_search_latch) {
-    if (!btr_search_s_lock_nowait(index, UT_LOCATION_HERE)) {
+  buf_block_t *block;
+
+  if (!has_search_latch && btr_search_latch_free) {
+    bool searched;
+
+    rec = btr_search_get_latch_free(index, hash_value, latch_mode, searched,
+                                    mtr);
+
+    if (!searched) {
       return false;
     }
-  }
 
-  auto latch_guard =
-      create_scope_guard([index]() { btr_search_s_unlock(index); });
+    cursor->flag = BTR_CUR_HASH_FAIL;
+
+#ifdef UNIV_SEARCH_PERF_STAT
+    info->n_hash_fail++;
+#endif /* UNIV_SEARCH_PERF_STAT */
+
+    info->last_hash_succ = false;
+
+    if (rec == nullptr) {
+      btr_search_update_hit_ratio(info, false);
 
-  if (!has_search_latch) {
-    if (!btr_search_enabled) {
       return false;
     }
+
+    block = buf_block_from_ahi(rec);
+
+    buf_block_dbg_add_level(block, SYNC_TREE_NODE_FROM_HASH);
   } else {
-    /* If we had a latch, then the guard is not needed. */
-    latch_guard.commit();
-  }
+    if (!has_search_latch) {
+      if (!btr_search_s_lock_nowait(index, UT_LOCATION_HERE)) {
+        return false;
+      }
+    }
 
-  ut_ad(rw_lock_get_writer(btr_get_search_latch(index)) != RW_LOCK_X);
-  ut_ad(rw_lock_get_reader_count(btr_get_search_latch(index)) > 0);
+    auto latch_guard =
+        create_scope_guard([index]() { btr_search_s_unlock(index); });
 
-  rec =
-      (rec_t *)ha_search_and_get_data(btr_get_search_table(index), hash_value);
+    if (!has_search_latch) {
+      if (!btr_search_enabled) {
+        return false;
+      }
+    } else {
+      /* If we had a latch, then the guard is not needed. */
+      latch_guard.commit();
+    }
 
-  /* We did the hash search. If we decide to return before successfully
-  verifying the search is correct, we will return with the following state of
-  the cursor. */
-  cursor->flag = BTR_CUR_HASH_FAIL;
+    ut_ad(rw_lock_get_writer(btr_get_search_latch(index)) != RW_LOCK_X);
+    ut_ad(rw_lock_get_reader_count(btr_get_search_latch(index)) > 0);
+
+    rec = (rec_t *)ha_search_and_get_data(btr_get_search_table(index),
+                                          hash_value);
+
+    /* We did the hash search. If we decide to return before successfully
+    verifying the search is correct, we will return with the following state of
+    the cursor. */
+    cursor->flag = BTR_CUR_HASH_FAIL;
 
 #ifdef UNIV_SEARCH_PERF_STAT
-  info->n_hash_fail++;
+    info->n_hash_fail++;
 #endif /* UNIV_SEARCH_PERF_STAT */
 
-  info->last_hash_succ = false;
-
-  if (rec == nullptr) {
-    return false;
-  }
+    info->last_hash_succ = false;
 
-  buf_block_t *block = buf_block_from_ahi(rec);
+    if (rec == nullptr) {
+      btr_search_update_hit_ratio(info, false);
 
-  if (!has_search_latch) {
-    if (!buf_page_get_known_nowait(latch_mode, block, Cache_hint::MAKE_YOUNG,
-                                   __FILE__, __LINE__, mtr)) {
       return false;
     }
 
-    /* Release the AHI S-latch. It is released after the
-    buf_page_get_known_nowait which is latching the block, so no one else can
-    remove it. Up to this point we have the AHI is S-latched and since we found
-    an AHI entry that leads to this block, the entry can't be removed and thus
-    the block must be still in the buffer pool. */
-    latch_guard.rollback();
+    block = buf_block_from_ahi(rec);
 
-    buf_block_dbg_add_level(block, SYNC_TREE_NODE_FROM_HASH);
+    if (!has_search_latch) {
+      if (!buf_page_get_known_nowait(latch_mode, block, Cache_hint::MAKE_YOUNG,
+                                     __FILE__, __LINE__, mtr)) {
+        return false;
+      }
+
+      /* Release the AHI S-latch. It is released after the
+      buf_page_get_known_nowait which is latching the block, so no one else
+      can remove it. Up to this point we have the AHI is S-latched and since
+      we found an AHI entry that leads to this block, the entry can't be
+      removed and thus the block must be still in the buffer pool. */
+      latch_guard.rollback();
+
+      buf_block_dbg_add_level(block, SYNC_TREE_NODE_FROM_HASH);
+    }
   }
 
   if (buf_block_get_state(block) != BUF_BLOCK_FILE_PAGE) {
@@ -934,9 +1139,13 @@ bool btr_search_guess_on_hash(const dtuple_t *tuple, ulint mode,
       btr_leaf_page_release(block, latch_mode, mtr);
     }
 
+    btr_search_update_hit_ratio(info, false);
+
     return false;
   }
 
+  btr_search_update_hit_ratio(info, true);
+
   if (info->n_hash_potential < BTR_SEARCH_BUILD_LIMIT + 5) {
     info->n_hash_potential++;
   }
@@ -1212,6 +1421,13 @@ void btr_search_drop_page_hash_index(buf_block_t *block, bool force) {
         ha_remove_a_node_to_page(hash_table, hashes[i], page);
       }
 
+      if (btr_search_latch_free) {
+        /* The caller may free the block as soon as we return. A reader
+        without latches that found one of the removed entries must first
+        have given up on the block, or have buffer-fixed it. */
+        btr_get_search_part(index).wait_for_readers();
+      }
+
       btr_search_set_block_not_cached(block);
       MONITOR_ATOMIC_INC_VALUE(MONITOR_ADAPTIVE_HASH_ROW_REMOVED, n_cached);
 
@@ -127,6 +127,27 @@ struct set_numa_interleave_t {
 #define NUMA_MEMPOLICY_INTERLEAVE_IN_SCOPE
 #endif /* HAVE_LIBNUMA */
 
+int buf_pool_numa_node(ulint index) {
+#ifdef HAVE_LIBNUMA
+  if (!srv_numa_local_buffer_pool || srv_numa_interleave ||
+      numa_available() == -1) {
+    return -1;
+  }
+  struct bitmask *numa_nodes = numa_get_mems_allowed();
+  std::vector<int> nodes;
+  for (int node = 0; node <= numa_max_node(); ++node) {
+    if (numa_bitmask_isbitset(numa_nodes, node)) {
+      nodes.push_back(node);
+    }
+  }
+  numa_bitmask_free(numa_nodes);
+  return nodes.empty() ? -1 : nodes[index % nodes.size()];
+#else
+  (void)index;
+  return -1;
+#endif /* HAVE_LIBNUMA */
+}
+
 /*
                 IMPLEMENTATION OF THE BUFFER POOL
                 =================================
@@ -908,6 +929,22 @@ bool buf_pool_t::allocate_chunk(ulonglong mem_size, buf_chunk_t *chunk) {
                "MPOL_MF_MOVE", strerror(errno));
     }
     numa_bitmask_free(numa_nodes);
+  } else if (numa_node >= 0) {
+    /* Prefer rather than bind, so that running out of memory on the node
+    does not fail the allocation. */
+    const auto low_level_info = ut::large_page_low_level_info(
+        chunk->mem, ut::fallback_to_normal_page_t{});
+    struct bitmask *node_mask = numa_allocate_nodemask();
+    numa_bitmask_setbit(node_mask, numa_node);
+    int st = mbind(low_level_info.base_ptr, low_level_info.allocation_size,
+                   MPOL_PREFERRED, node_mask->maskp, node_mask->size,
+                   MPOL_MF_MOVE);
+    if (st != 0) {
+      ib::warn(ER_IB_MSG_54, low_level_info.base_ptr,
+               low_level_info.allocation_size, "MPOL_PREFERRED",
+               "MPOL_MF_MOVE", strerror(errno));
+    }
+    numa_bitmask_free(node_mask);
   }
 #endif /* HAVE_LIBNUMA */
 
@@ -1203,6 +1240,8 @@ static void buf_pool_create(buf_pool_t *buf_pool, ulint buf_pool_size,
   ulint chunk_size;
   buf_chunk_t *chunk;
 
+  buf_pool->numa_node = buf_pool_numa_node(instance_no);
+
 #ifdef UNIV_LINUX
   cpu_set_t cpuset;
 
@@ -1214,7 +1253,16 @@ static void buf_pool_create(buf_pool_t *buf_pool, ulint buf_pool_size,
 
   buf_pool->stat.reset();
 
-  if (pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) == -1) {
+  /* If the instance has a NUMA node, initialize it from there instead. */
+#ifdef HAVE_LIBNUMA
+  const bool on_numa_node = buf_pool->numa_node >= 0 &&
+                            numa_run_on_node(buf_pool->numa_node) == 0;
+#else
+  const bool on_numa_node = false;
+#endif /* HAVE_LIBNUMA */
+
+  if (!on_numa_node &&
+      pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) == -1) {
     ib::error(ER_IB_ERR_SCHED_SETAFFNINITY_FAILED)
         << "sched_setaffinity() failed!";
   }
@@ -1296,6 +1344,20 @@ static void buf_pool_create(buf_pool_t *buf_pool, ulint buf_pool_size,
     buf_pool->old_size = buf_pool->curr_size;
     buf_pool->n_chunks_new = buf_pool->n_chunks;
 
+    /* Remember about as many evicted pages as fit in the pool. */
+    if (buf_LRU_policy == BUF_LRU_POLICY_2Q) {
+      const ulint n_ghosts = ut_2_power_up(buf_pool->curr_size);
+      buf_pool->lru_ghosts = ut::new_arr_withkey<std::atomic<uint32_t>>(
+          UT_NEW_THIS_FILE_PSI_KEY, ut::Count{n_ghosts});
+      for (ulint i = 0; i < n_ghosts; ++i) {
+        buf_pool->lru_ghosts[i].store(0, std::memory_order_relaxed);
+      }
+      buf_pool->lru_ghosts_mask = n_ghosts - 1;
+    } else {
+      buf_pool->lru_ghosts = nullptr;
+      buf_pool->lru_ghosts_mask = 0;
+    }
+
     /* Number of locks protecting page_hash must be a
     power of two */
     srv_n_page_hash_locks =
@@ -1420,6 +1482,10 @@ static void buf_pool_free_instance(buf_pool_t *buf_pool) {
   ut::free(buf_pool->chunks);
   mutex_exit(&buf_pool->chunks_mutex);
   mutex_free(&buf_pool->chunks_mutex);
+  if (buf_pool->lru_ghosts != nullptr) {
+    ut::delete_arr(buf_pool->lru_ghosts);
+    buf_pool->lru_ghosts = nullptr;
+  }
   ha_clear(buf_pool->page_hash);
   ut::delete_(buf_pool->page_hash);
   ut::delete_(buf_pool->zip_hash);
@@ -1441,6 +1507,24 @@ static void buf_pool_free() {
 @param[in]  total_size    Size of the total pool in bytes.
 @param[in]  n_instances   Number of buffer pool instances to create.
 @return DB_SUCCESS if success, DB_ERROR if not enough memory or error */
+/** Register the chunks of all the buffer pool instances with the native AIO,
+see os_aio_register_buffers(). */
+static void buf_pool_register_chunks() {
+  os_aio_buffers_t buffers;
+
+  for (ulint i = 0; i < srv_buf_pool_instances; ++i) {
+    const buf_pool_t *buf_pool = buf_pool_from_array(i);
+
+    for (ulint j = 0; j < buf_pool->n_chunks; ++j) {
+      const buf_chunk_t *chunk = &buf_pool->chunks[j];
+
+      buffers.emplace_back(chunk->mem, chunk->mem_size());
+    }
+  }
+
+  os_aio_register_buffers(buffers);
+}
+
 dberr_t buf_pool_init(ulint total_size, ulint n_instances) {
   ulint i;
   const ulint size = total_size / n_instances;
@@ -1534,6 +1618,8 @@ dberr_t buf_pool_init(ulint total_size, ulint n_instances) {
   buf_stat_per_index = ut::new_withkey<buf_stat_per_index_t>(
       ut::make_psi_memory_key(mem_key_buf_stat_per_index_t));
 
+  buf_pool_register_chunks();
+
   return (DB_SUCCESS);
 }
 
@@ -1999,7 +2085,10 @@ static bool buf_pool_withdraw_blocks(buf_pool_t *buf_pool) {
 static void buf_pool_resize_hash(buf_pool_t *buf_pool) {
   hash_table_t *new_hash_table;
 
-  ut_ad(mutex_own(&buf_pool->zip_hash_mutex));
+  /* The resizing thread holds zip_hash_mutex and all the page_hash latches of
+  every instance for us. We may run in a helper thread, so mutex_own() cannot
+  be asserted here. */
+  ut_ad(buf_pool_resizing);
 
   /* create a temporary hash_table with twice larger cells[]  */
   new_hash_table = ut::new_<hash_table_t>(2 * buf_pool->curr_size);
@@ -2021,9 +2110,9 @@ static void buf_pool_resize_hash(buf_pool_t *buf_pool) {
 
       const auto hash_value = prev_bpage->id.hash();
 
-      HASH_DELETE(buf_page_t, hash, buf_pool->page_hash, hash_value,
-                  prev_bpage);
-
+      /* The old cells are freed below, so there is no need to unlink the
+      page from them. This also avoids HASH_DELETE asserting that this
+      thread holds the page_hash latch. */
       HASH_INSERT(buf_page_t, hash, new_hash_table, hash_value, prev_bpage);
     }
   }
@@ -2362,6 +2451,9 @@ withdraw_retry:
   buf_chunk_map_reg =
       ut::new_withkey<buf_pool_chunk_map_t>(UT_NEW_THIS_FILE_PSI_KEY);
 
+  /* The chunks to delete must not stay registered for IO. */
+  os_aio_unregister_buffers();
+
   buf_resize_status_progress_reset();
   buf_resize_status(BUF_POOL_RESIZE_IN_PROGRESS, "Starting pool resize");
   /* add/delete chunks */
@@ -2504,6 +2596,8 @@ withdraw_retry:
     buf_resize_status_progress_update(i + 1, srv_buf_pool_instances);
   }
 
+  buf_pool_register_chunks();
+
   /* set instance sizes */
   {
     ulint curr_size = 0;
@@ -2534,10 +2628,17 @@ withdraw_retry:
     buf_resize_status_progress_reset();
     buf_resize_status(BUF_POOL_RESIZE_HASH, "Resizing hash tables.");
 
+    /* The hash tables of the instances are independent, so rebuild them
+    concurrently to shorten the time for which all the buffer pool mutexes
+    are held. */
+    std::vector<std::thread> threads;
+
     for (ulint i = 0; i < srv_buf_pool_instances; ++i) {
-      buf_pool_t *buf_pool = buf_pool_from_array(i);
+      threads.emplace_back(buf_pool_resize_hash, buf_pool_from_array(i));
+    }
 
-      buf_pool_resize_hash(buf_pool);
+    for (ulint i = 0; i < srv_buf_pool_instances; ++i) {
+      threads[i].join();
 
       ib::info(ER_IB_MSG_67)
           << "buffer pool " << i << " : hash tables were resized.";
@@ -6586,6 +6687,7 @@ static void buf_stats_aggregate_pool_info(
   }
   total_info->n_pages_made_young += pool_info->n_pages_made_young;
   total_info->n_pages_not_made_young += pool_info->n_pages_not_made_young;
+  total_info->n_pages_ghost_hits += pool_info->n_pages_ghost_hits;
   total_info->n_pages_read += pool_info->n_pages_read;
   total_info->n_pages_created += pool_info->n_pages_created;
   total_info->n_pages_written += pool_info->n_pages_written;
@@ -6656,6 +6758,8 @@ void buf_stats_get_pool_info(
 
   pool_info->n_pages_not_made_young = buf_pool->stat.n_pages_not_made_young;
 
+  pool_info->n_pages_ghost_hits = buf_pool->stat.n_pages_ghost_hits;
+
   pool_info->n_pages_read = buf_pool->stat.n_pages_read;
 
   pool_info->n_pages_created = buf_pool->stat.n_pages_created;
@@ -720,10 +720,14 @@ class Double_write {
   @param[in]  in_bpage          Page to write.
   @param[in]  sync              true if it's a synchronous write.
   @param[in]  e_block           block containing encrypted data frame.
+  @param[in]  defer             true if the caller will submit the
+                                asynchronous write, together with the
+                                others of its batch, with
+                                os_aio_simulated_wake_handler_threads().
   @return DB_SUCCESS or error code */
   [[nodiscard]] static dberr_t write_to_datafile(
-      const buf_page_t *in_bpage, bool sync,
-      const file::Block *e_block) noexcept;
+      const buf_page_t *in_bpage, bool sync, const file::Block *e_block,
+      bool defer = false) noexcept;
 
   /** Force a flush of the page queue.
   @param[in] flush_type           FLUSH LIST or LRU LIST flush.
@@ -989,6 +993,21 @@ class Segment {
   /** Flush the segment to disk. */
   void flush() noexcept { os_file_flush(m_file.m_pfs); }
 
+  /** Write to the segment and flush it to disk, as one submission if
+  io_uring is used.
+  @param[in] ptr                Start writing from here.
+  @param[in] len                Number of bytes to write. */
+  void write_and_flush(const void *ptr, uint32_t len) noexcept {
+    ut_a(len <= m_end - m_start);
+    IORequest req(IORequest::WRITE | IORequest::DO_NOT_WAKE);
+
+    req.dblwr();
+
+    auto err = os_file_write_and_flush(req, m_file.m_name.c_str(),
+                                       m_file.m_pfs, ptr, m_start, len);
+    ut_a(err == DB_SUCCESS);
+  }
+
   /** File that owns the segment. */
   dblwr::File &m_file;
 
@@ -1052,6 +1071,15 @@ class Batch_segment : public Segment {
   @param[in] len    amount of data to write */
   void write(const byte *buf, uint32_t len) noexcept;
 
+  /**  Write a batch to the segment and flush it to disk.
+  @param[in] buffer             Buffer to write. */
+  void write_and_flush(const Buffer &buffer) noexcept;
+
+  /**  Write a batch to the segment and flush it to disk.
+  @param[in] buf    Buffer to write
+  @param[in] len    amount of data to write */
+  void write_and_flush(const byte *buf, uint32_t len) noexcept;
+
   /** Called on page write completion.
   @return if batch ended. */
   [[nodiscard]] bool write_complete() noexcept {
@@ -1255,19 +1283,20 @@ uint16_t Reduced_double_write::write_dblwr_pages(
 
   batch_segment->start(this);
 
-  batch_segment->write(m_page, REDUCED_BATCH_PAGE_SIZE);
+#ifndef _WIN32
+  if (is_fsync_required()) {
+    batch_segment->write_and_flush(m_page, REDUCED_BATCH_PAGE_SIZE);
+  } else
+#endif /* !_WIN32 */
+  {
+    batch_segment->write(m_page, REDUCED_BATCH_PAGE_SIZE);
+  }
 
   m_bytes_written += REDUCED_BATCH_PAGE_SIZE;
 
   m_buffer.clear();
   clear();
 
-#ifndef _WIN32
-  if (is_fsync_required()) {
-    batch_segment->flush();
-  }
-#endif /* !_WIN32 */
-
   batch_segment->set_batch_size(m_buf_pages.size());
   return batch_segment->id();
 }
@@ -1363,6 +1392,14 @@ void Batch_segment::write(const byte *buf, uint32_t len) noexcept {
   Segment::write(buf, len);
 }
 
+void Batch_segment::write_and_flush(const Buffer &buffer) noexcept {
+  Segment::write_and_flush(buffer.begin(), buffer.size());
+}
+
+void Batch_segment::write_and_flush(const byte *buf, uint32_t len) noexcept {
+  Segment::write_and_flush(buf, len);
+}
+
 dberr_t Double_write::create_v2() noexcept {
   ut_a(!s_files.empty());
   ut_a(s_instances == nullptr);
@@ -1600,7 +1637,8 @@ void Double_write::check_block(const buf_block_t *block) noexcept {
 }
 
 dberr_t Double_write::write_to_datafile(const buf_page_t *in_bpage, bool sync,
-                                        const file::Block *e_block) noexcept {
+                                        const file::Block *e_block,
+                                        bool defer) noexcept {
   ut_ad(buf_page_in_file(in_bpage));
   ut_ad(in_bpage->current_thread_has_io_responsibility());
   ut_ad(in_bpage->is_io_fix_write());
@@ -1620,7 +1658,7 @@ dberr_t Double_write::write_to_datafile(const buf_page_t *in_bpage, bool sync,
 
   uint32_t type = IORequest::WRITE;
 
-  if (sync) {
+  if (sync || defer) {
     type |= IORequest::DO_NOT_WAKE;
   }
 
@@ -2185,18 +2223,19 @@ uint16_t Double_write::write_dblwr_pages(buf_flush_t flush_type) noexcept {
 
   batch_segment->start(this);
 
-  batch_segment->write(m_buffer);
+#ifndef _WIN32
+  if (is_fsync_required()) {
+    batch_segment->write_and_flush(m_buffer);
+  } else
+#endif /* !_WIN32 */
+  {
+    batch_segment->write(m_buffer);
+  }
 
   m_bytes_written += m_buffer.size();
 
   m_buffer.clear();
 
-#ifndef _WIN32
-  if (is_fsync_required()) {
-    batch_segment->flush();
-  }
-#endif /* !_WIN32 */
-
   batch_segment->set_batch_size(m_buf_pages.size());
 
   return batch_segment->id();
@@ -2214,8 +2253,8 @@ void Double_write::write_data_pages(buf_flush_t flush_type,
     bpage->set_dblwr_batch_id(batch_id);
 
     ut_d(bpage->take_io_responsibility());
-    auto err =
-        write_to_datafile(bpage, false, std::get<1>(m_buf_pages.m_pages[i]));
+    auto err = write_to_datafile(bpage, false,
+                                 std::get<1>(m_buf_pages.m_pages[i]), true);
 
     if (err == DB_PAGE_IS_STALE || err == DB_TABLESPACE_DELETED) {
       /* For async operation, if space is deleted, fil_io already
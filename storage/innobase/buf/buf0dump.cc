@@ -607,8 +607,12 @@ static void buf_load() {
       continue;
     }
 
+    /* Issue the reads asynchronously. dump[] is sorted, so the read
+    requests of a tablespace are queued in page order and can be merged
+    by the AIO layer. The number of outstanding requests is bounded by
+    the AIO slots, reserve_slot() waits for a free one. */
     buf_read_page_background(page_id_t(this_space_id, BUF_DUMP_PAGE(dump[i])),
-                             page_size, true);
+                             page_size, false);
 
     if (i % 64 == 63) {
       os_aio_simulated_wake_handler_threads();
@@ -646,6 +650,9 @@ static void buf_load() {
     buf_load_throttle_if_needed(&last_check_time, &last_activity_cnt, i);
   }
 
+  /* Wake up the handlers for the last reads queued in simulated aio. */
+  os_aio_simulated_wake_handler_threads();
+
   if (space != nullptr) {
     fil_space_release(space);
   }
@@ -76,6 +76,10 @@ this program; if not, write to the Free Software Foundation, Inc.,
 static const int buf_flush_page_cleaner_priority = -20;
 #endif /* UNIV_LINUX */
 
+#ifdef HAVE_LIBNUMA
+#include <numa.h>
+#endif /* HAVE_LIBNUMA */
+
 /** Number of pages flushed through non flush_list flushes. */
 static ulint buf_lru_flush_page_count = 0;
 
@@ -86,6 +90,13 @@ static uint buf_flush_lsn_scan_factor = 3;
 /** Target oldest LSN for the requested flush_sync */
 static lsn_t buf_flush_sync_lsn = 0;
 
+/** The latest decisions of the page cleaner coordinator, for
+buf_flush_update_exported_variables(). */
+static std::atomic<lsn_t> pc_export_lsn_rate{0};
+static std::atomic<lsn_t> pc_export_predicted_age{0};
+static std::atomic<ulint> pc_export_pages_target{0};
+static std::atomic<ulint> pc_export_lagging_slots{0};
+
 #ifdef UNIV_DEBUG
 /** Get the lsn up to which data pages are to be synchronously flushed.
 @return target lsn for the requested flush_sync */
@@ -131,6 +142,18 @@ struct page_cleaner_slot_t {
   ulint n_pages_requested;
   /*!< number of requested pages
   for the slot */
+  /* These values are set by pc_request() with n_pages_requested */
+  bool flush_list_requested;
+  /*!< true if flush_list flushing
+  is requested */
+  lsn_t lsn_limit;
+  /*!< upper limit of LSN to be
+  flushed */
+  ulint n_pages_target;
+  /*!< number of pages recommended
+  by Adaptive_flush for the next
+  request; protected by
+  page_cleaner_t::mutex */
   /* These values are updated during state==PAGE_CLEANER_STATE_FLUSHING,
   and committed with state==PAGE_CLEANER_STATE_FINISHED.
   The consistency is protected by the 'state' */
@@ -164,10 +187,6 @@ struct page_cleaner_t {
                            threads. */
   os_event_t is_finished;  /*!< event to signal that all
                            slots were finished. */
-  bool requested;          /*!< true if requested pages
-                           to flush */
-  lsn_t lsn_limit;         /*!< upper limit of LSN to be
-                           flushed */
   ulint n_slots;           /*!< total number of slots */
   ulint n_slots_requested;
   /*!< number of slots
@@ -1784,7 +1803,9 @@ static ulint buf_flush_LRU_list_batch(buf_pool_t *buf_pool, ulint max) {
       if (acquired && buf_flush_ready_for_replace(bpage)) {
         /* block is ready for eviction i.e., it is
         clean and is not IO-fixed or buffer fixed. */
+        const page_id_t page_id = bpage->id;
         if (buf_LRU_free_page(bpage, true)) {
+          buf_LRU_ghost_add(buf_pool, page_id);
           ++evict_count;
           mutex_enter(&buf_pool->LRU_list_mutex);
         } else {
@@ -2150,7 +2171,9 @@ bool buf_flush_single_page_from_LRU(buf_pool_t *buf_pool) {
         /* block is ready for eviction i.e., it is
         clean and is not IO-fixed or buffer fixed. */
 
+        const page_id_t page_id = bpage->id;
         if (buf_LRU_free_page(bpage, true)) {
+          buf_LRU_ghost_add(buf_pool, page_id);
           freed = true;
           break;
         }
@@ -2255,9 +2278,17 @@ ulint prev_iter_pages_dirty = 0;
 /** Actual number of pages flushed by last iteration. */
 ulint prev_iter_pages_flushed = 0;
 
+/** LSN at previous iteration. */
+lsn_t prev_iter_lsn = 0;
+
 /** Average redo generation rate */
 lsn_t lsn_avg_rate = 0;
 
+/** Redo generation rate over the last few iterations. Unlike lsn_avg_rate,
+which is updated every srv_flushing_avg_loops iterations, it follows a write
+burst within a second or two. */
+lsn_t lsn_recent_rate = 0;
+
 /** Average page flush rate */
 ulint page_avg_rate = 0;
 
@@ -2285,6 +2316,7 @@ bool initialize(ulint n_pages_last) {
     prev_lsn = curr_lsn;
     prev_time = curr_time;
     prev_iter_time = curr_time;
+    prev_iter_lsn = curr_lsn;
 
     return (true);
   }
@@ -2298,6 +2330,26 @@ bool initialize(ulint n_pages_last) {
   return (false);
 }
 
+/** Update lsn_recent_rate with the redo generated since the previous
+iteration. */
+void set_recent_rate() {
+  if (cur_iter_time <= prev_iter_time || cur_iter_lsn < prev_iter_lsn) {
+    return;
+  }
+
+  const auto delta_time_s =
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+          cur_iter_time - prev_iter_time)
+          .count();
+
+  const auto lsn_rate =
+      static_cast<lsn_t>((cur_iter_lsn - prev_iter_lsn) / delta_time_s);
+
+  lsn_recent_rate = (lsn_recent_rate + lsn_rate) / 2;
+
+  pc_export_lsn_rate.store(lsn_recent_rate, std::memory_order_relaxed);
+}
+
 /** Set average LSN and page flush speed across multiple iterations. */
 void set_average() {
   ++n_iterations;
@@ -2502,6 +2554,16 @@ ulint set_flush_target_by_lsn(bool sync_flush, lsn_t sync_flush_limit_lsn) {
 
   lsn_t age = cur_iter_lsn > oldest_lsn ? cur_iter_lsn - oldest_lsn : 0;
 
+  /* With a look-ahead, act on the age that the redo will have in that many
+  seconds if it keeps being generated at the recent rate, so that flushing
+  is stepped up before the age gets close to the sync flush point. */
+  lsn_t lsn_rate = lsn_avg_rate;
+  if (srv_adaptive_flushing_lookahead > 0) {
+    lsn_rate = std::max(lsn_avg_rate, lsn_recent_rate);
+    age += lsn_rate * srv_adaptive_flushing_lookahead;
+  }
+  pc_export_predicted_age.store(age, std::memory_order_relaxed);
+
   ulint pct_for_dirty = get_pct_for_dirty();
   ulint pct_for_lsn = get_pct_for_lsn(age);
   ulint pct_total = std::max(pct_for_dirty, pct_for_lsn);
@@ -2518,7 +2580,7 @@ ulint set_flush_target_by_lsn(bool sync_flush, lsn_t sync_flush_limit_lsn) {
     scan_factor = 1;
     buf_flush_sync_lsn = target_lsn;
   } else {
-    target_lsn = oldest_lsn + lsn_avg_rate * buf_flush_lsn_scan_factor;
+    target_lsn = oldest_lsn + lsn_rate * buf_flush_lsn_scan_factor;
     scan_factor = buf_flush_lsn_scan_factor;
     buf_flush_sync_lsn = 0;
   }
@@ -2551,8 +2613,7 @@ ulint set_flush_target_by_lsn(bool sync_flush, lsn_t sync_flush_limit_lsn) {
     sum_pages_for_lsn += pages_for_lsn;
 
     mutex_enter(&page_cleaner->mutex);
-    ut_ad(page_cleaner->slots[i].state == PAGE_CLEANER_STATE_NONE);
-    page_cleaner->slots[i].n_pages_requested = pages_for_lsn / scan_factor + 1;
+    page_cleaner->slots[i].n_pages_target = pages_for_lsn / scan_factor + 1;
     mutex_exit(&page_cleaner->mutex);
   }
 
@@ -2586,15 +2647,11 @@ ulint set_flush_target_by_lsn(bool sync_flush, lsn_t sync_flush_limit_lsn) {
 
   /* Normalize request for each instance */
   mutex_enter(&page_cleaner->mutex);
-  ut_ad(page_cleaner->n_slots_requested == 0);
-  ut_ad(page_cleaner->n_slots_flushing == 0);
-  ut_ad(page_cleaner->n_slots_finished == 0);
-
   for (ulint i = 0; i < srv_buf_pool_instances; i++) {
     /* if REDO has enough of free space,
     don't care about age distribution of pages */
-    page_cleaner->slots[i].n_pages_requested =
-        pct_for_lsn > 30 ? page_cleaner->slots[i].n_pages_requested * n_pages /
+    page_cleaner->slots[i].n_pages_target =
+        pct_for_lsn > 30 ? page_cleaner->slots[i].n_pages_target * n_pages /
                                    sum_pages_for_lsn +
                                1
                          : n_pages / srv_buf_pool_instances + 1;
@@ -2689,7 +2746,7 @@ ulint set_flush_target_by_page(ulint n_pages_lsn) {
   /* Set new targets for each instance */
   mutex_enter(&page_cleaner->mutex);
   for (ulint i = 0; i < srv_buf_pool_instances; i++) {
-    page_cleaner->slots[i].n_pages_requested = n_pages / srv_buf_pool_instances;
+    page_cleaner->slots[i].n_pages_target = n_pages / srv_buf_pool_instances;
   }
   mutex_exit(&page_cleaner->mutex);
 
@@ -2721,6 +2778,8 @@ ulint page_recommendation(ulint last_pages_in, bool is_sync_flush,
   if limit is reached. */
   set_average();
 
+  set_recent_rate();
+
   /* Set page flush target based on LSN. */
   auto n_pages =
       skip_lsn ? 0
@@ -2732,9 +2791,11 @@ ulint page_recommendation(ulint last_pages_in, bool is_sync_flush,
   n_pages = set_flush_target_by_page(n_pages);
 
   prev_iter_time = cur_iter_time;
+  prev_iter_lsn = cur_iter_lsn;
   prev_iter_pages_dirty = cur_iter_pages_dirty;
 
   MONITOR_SET(MONITOR_FLUSH_N_TO_FLUSH_REQUESTED, n_pages);
+  pc_export_pages_target.store(n_pages, std::memory_order_relaxed);
   return (n_pages);
 }
 }  // namespace Adaptive_flush
@@ -2822,7 +2883,9 @@ static void buf_flush_page_cleaner_close(void) {
 }
 
 /**
-Requests for all slots to flush all buffer pool instances.
+Requests for all slots to flush all buffer pool instances. The slots that
+are still busy with an earlier request, which pc_wait_finished() has left
+running, are not requested again.
 @param min_n    wished minimum number of blocks flushed
                 (it is not guaranteed that the actual number is that big)
 @param lsn_limit in the case BUF_FLUSH_LIST all blocks whose
@@ -2840,35 +2903,40 @@ static void pc_request(ulint min_n, lsn_t lsn_limit) {
 
   mutex_enter(&page_cleaner->mutex);
 
-  ut_ad(page_cleaner->n_slots_requested == 0);
-  ut_ad(page_cleaner->n_slots_flushing == 0);
-  ut_ad(page_cleaner->n_slots_finished == 0);
-
-  page_cleaner->requested = (min_n > 0);
-  page_cleaner->lsn_limit = lsn_limit;
+  ulint n_requested = 0;
 
   for (ulint i = 0; i < page_cleaner->n_slots; i++) {
     page_cleaner_slot_t *slot = &page_cleaner->slots[i];
 
-    ut_ad(slot->state == PAGE_CLEANER_STATE_NONE);
+    if (slot->state != PAGE_CLEANER_STATE_NONE) {
+      continue;
+    }
 
     if (min_n == ULINT_MAX) {
       slot->n_pages_requested = ULINT_MAX;
     } else if (min_n == 0) {
       slot->n_pages_requested = 0;
+    } else {
+      /* Set by Adaptive_flush::page_recommendation() */
+      slot->n_pages_requested = slot->n_pages_target;
+      slot->n_pages_target = 0;
     }
 
-    /* slot->n_pages_requested was already set by
-    Adaptive_flush::page_recommendation() */
+    slot->flush_list_requested = (min_n > 0);
+    slot->lsn_limit = lsn_limit;
 
     slot->state = PAGE_CLEANER_STATE_REQUESTED;
+    ++n_requested;
   }
 
-  page_cleaner->n_slots_requested = page_cleaner->n_slots;
-  page_cleaner->n_slots_flushing = 0;
-  page_cleaner->n_slots_finished = 0;
+  if (n_requested > 0) {
+    page_cleaner->n_slots_requested += n_requested;
 
-  os_event_set(page_cleaner->is_requested);
+    /* A slot left running by pc_wait_finished() may have set it. */
+    os_event_reset(page_cleaner->is_finished);
+
+    os_event_set(page_cleaner->is_requested);
+  }
 
   mutex_exit(&page_cleaner->mutex);
 }
@@ -2876,6 +2944,30 @@ static void pc_request(ulint min_n, lsn_t lsn_limit) {
 /**
 Do flush for one slot.
 @return the number of the slots which has not been treated yet. */
+/** NUMA node that the current page cleaner thread runs on, or -1. */
+static thread_local int pc_numa_node = -1;
+
+/** Number of page cleaner threads that have called pc_bind_to_numa_node(). */
+static std::atomic<ulint> pc_n_threads_started{0};
+
+/** Make the current page cleaner thread run on the NUMA node of its turn,
+if srv_numa_local_buffer_pool is set. pc_flush_slot() then prefers the
+buffer pool instances on that node. */
+static void pc_bind_to_numa_node() {
+  const int node = buf_pool_numa_node(pc_n_threads_started.fetch_add(1));
+  if (node < 0) {
+    return;
+  }
+#ifdef HAVE_LIBNUMA
+  if (numa_run_on_node(node) != 0) {
+    ib::error(ER_IB_ERR_SCHED_SETAFFNINITY_FAILED)
+        << "numa_run_on_node() failed!";
+    return;
+  }
+  pc_numa_node = node;
+#endif /* HAVE_LIBNUMA */
+}
+
 static ulint pc_flush_slot(void) {
   std::chrono::steady_clock::duration lru_time;
   std::chrono::steady_clock::duration flush_list_time{};
@@ -2885,13 +2977,20 @@ static ulint pc_flush_slot(void) {
   mutex_enter(&page_cleaner->mutex);
 
   if (page_cleaner->n_slots_requested > 0) {
-    page_cleaner_slot_t *slot = nullptr;
-    ulint i;
-
-    for (i = 0; i < page_cleaner->n_slots; i++) {
-      slot = &page_cleaner->slots[i];
+    ulint i = page_cleaner->n_slots;
 
-      if (slot->state == PAGE_CLEANER_STATE_REQUESTED) {
+    /* Take the first requested slot, or the first one whose instance is on
+    our own NUMA node, if any. */
+    for (ulint j = 0; j < page_cleaner->n_slots; j++) {
+      if (page_cleaner->slots[j].state != PAGE_CLEANER_STATE_REQUESTED) {
+        continue;
+      }
+      if (i == page_cleaner->n_slots) {
+        i = j;
+      }
+      if (pc_numa_node < 0 ||
+          buf_pool_from_array(j)->numa_node == pc_numa_node) {
+        i = j;
         break;
       }
     }
@@ -2899,6 +2998,7 @@ static ulint pc_flush_slot(void) {
     /* slot should be found because
     page_cleaner->n_slots_requested > 0 */
     ut_a(i < page_cleaner->n_slots);
+    page_cleaner_slot_t *slot = &page_cleaner->slots[i];
 
     buf_pool_t *buf_pool = buf_pool_from_array(i);
 
@@ -2928,12 +3028,12 @@ static ulint pc_flush_slot(void) {
         slot->n_flushed_list = 0;
       } else {
         /* Flush pages from flush_list if required */
-        if (page_cleaner->requested) {
+        if (slot->flush_list_requested) {
           const auto flush_list_start = std::chrono::steady_clock::now();
 
           slot->succeeded_list = buf_flush_do_batch(
               buf_pool, BUF_FLUSH_LIST, slot->n_pages_requested,
-              page_cleaner->lsn_limit, &slot->n_flushed_list);
+              slot->lsn_limit, &slot->n_flushed_list);
 
           flush_list_time = std::chrono::steady_clock::now() - flush_list_start;
           list_pass = 1;
@@ -2969,29 +3069,45 @@ static ulint pc_flush_slot(void) {
 }
 
 /**
-Wait until all flush requests are finished.
+Wait until all flush requests are finished, or until the timeout if there
+is one. On timeout, the slots that are finished are collected and the others
+are left running: pc_request() skips them, and a later call collects them.
+This way a slow buffer pool instance does not hold up the flushing of the
+others.
 @param n_flushed_lru    number of pages flushed from the end of the LRU list.
 @param n_flushed_list   number of pages flushed from the end of the
                         flush_list.
+@param timeout          how long to wait for the slots, or
+                        std::chrono::microseconds::max() to wait for all
 @return                 true if all flush_list flushing batch were success. */
-static bool pc_wait_finished(ulint *n_flushed_lru, ulint *n_flushed_list) {
+static bool pc_wait_finished(
+    ulint *n_flushed_lru, ulint *n_flushed_list,
+    std::chrono::microseconds timeout = std::chrono::microseconds::max()) {
   bool all_succeeded = true;
 
   *n_flushed_lru = 0;
   *n_flushed_list = 0;
 
-  os_event_wait(page_cleaner->is_finished);
+  if (timeout == std::chrono::microseconds::max()) {
+    os_event_wait(page_cleaner->is_finished);
+  } else if (timeout.count() > 0) {
+    os_event_wait_time(page_cleaner->is_finished, timeout);
+  }
 
   mutex_enter(&page_cleaner->mutex);
 
-  ut_ad(page_cleaner->n_slots_requested == 0);
-  ut_ad(page_cleaner->n_slots_flushing == 0);
-  ut_ad(page_cleaner->n_slots_finished == page_cleaner->n_slots);
+  ut_ad(timeout != std::chrono::microseconds::max() ||
+        (page_cleaner->n_slots_requested == 0 &&
+         page_cleaner->n_slots_flushing == 0 &&
+         page_cleaner->n_slots_finished == page_cleaner->n_slots));
 
   for (ulint i = 0; i < page_cleaner->n_slots; i++) {
     page_cleaner_slot_t *slot = &page_cleaner->slots[i];
 
-    ut_ad(slot->state == PAGE_CLEANER_STATE_FINISHED);
+    if (slot->state != PAGE_CLEANER_STATE_FINISHED) {
+      ut_ad(timeout != std::chrono::microseconds::max());
+      continue;
+    }
 
     *n_flushed_lru += slot->n_flushed_lru;
     *n_flushed_list += slot->n_flushed_list;
@@ -3004,6 +3120,10 @@ static bool pc_wait_finished(ulint *n_flushed_lru, ulint *n_flushed_list) {
 
   page_cleaner->n_slots_finished = 0;
 
+  pc_export_lagging_slots.store(
+      page_cleaner->n_slots_requested + page_cleaner->n_slots_flushing,
+      std::memory_order_relaxed);
+
   os_event_reset(page_cleaner->is_finished);
 
   mutex_exit(&page_cleaner->mutex);
@@ -3132,6 +3252,8 @@ static void buf_flush_page_coordinator_thread() {
 
   THD *thd = create_internal_thd();
 
+  pc_bind_to_numa_node();
+
 #ifdef UNIV_LINUX
   /* linux might be able to set different setting for each thread.
   worth to try to set high priority for page cleaner threads */
@@ -3350,11 +3472,24 @@ static void buf_flush_page_coordinator_thread() {
               std::chrono::steady_clock::now() - flush_start);
       page_cleaner->flush_pass++;
 
-      /* Wait for all slots to be finished */
+      /* Wait for all slots to be finished, or with independent cleaners
+      only until the next iteration is due. */
       ulint n_flushed_lru = 0;
       ulint n_flushed_list = 0;
 
-      pc_wait_finished(&n_flushed_lru, &n_flushed_list);
+      if (srv_page_cleaner_independent && !is_sync_flush) {
+        const auto now = std::chrono::steady_clock::now();
+        const auto next_loop_time = loop_start_time + std::chrono::seconds{1};
+
+        pc_wait_finished(
+            &n_flushed_lru, &n_flushed_list,
+            next_loop_time > now
+                ? std::chrono::duration_cast<std::chrono::microseconds>(
+                      next_loop_time - now)
+                : std::chrono::microseconds::zero());
+      } else {
+        pc_wait_finished(&n_flushed_lru, &n_flushed_list);
+      }
 
       if (n_flushed_list > 0 || n_flushed_lru > 0) {
         buf_flush_stats(n_flushed_list, n_flushed_lru);
@@ -3546,8 +3681,21 @@ thread_exit:
   destroy_internal_thd(thd);
 }
 
+void buf_flush_update_exported_variables() {
+  export_vars.innodb_page_cleaner_lsn_rate =
+      pc_export_lsn_rate.load(std::memory_order_relaxed);
+  export_vars.innodb_page_cleaner_predicted_redo_age =
+      pc_export_predicted_age.load(std::memory_order_relaxed);
+  export_vars.innodb_page_cleaner_pages_target =
+      pc_export_pages_target.load(std::memory_order_relaxed);
+  export_vars.innodb_page_cleaner_lagging_instances =
+      pc_export_lagging_slots.load(std::memory_order_relaxed);
+}
+
 /** Worker thread of page_cleaner. */
 static void buf_flush_page_cleaner_thread() {
+  pc_bind_to_numa_node();
+
 #ifdef UNIV_LINUX
   /* linux might be able to set different setting for each thread
   worth to try to set high priority for page cleaner threads */
@@ -135,6 +135,50 @@ std::chrono::milliseconds get_buf_LRU_old_threshold() {
 
 /** @} */
 
+ulong buf_LRU_policy = BUF_LRU_POLICY_MIDPOINT;
+
+/** Get the slot and fingerprint of a page in buf_pool->lru_ghosts.
+@param[in]      buf_pool        buffer pool instance
+@param[in]      page_id         page id
+@param[out]     fingerprint     the value that marks the page (never 0)
+@return the slot of the page */
+static std::atomic<uint32_t> *buf_LRU_ghost_slot(const buf_pool_t *buf_pool,
+                                                 const page_id_t &page_id,
+                                                 uint32_t *fingerprint) {
+  /* page_id.hash() also picks the buffer pool instance, so mix it again
+  for the slot to use all the bits. */
+  const uint64_t hash = ut::hash_uint64(page_id.hash());
+  *fingerprint = static_cast<uint32_t>(hash >> 32) | 1;
+  return &buf_pool->lru_ghosts[hash & buf_pool->lru_ghosts_mask];
+}
+
+void buf_LRU_ghost_add(buf_pool_t *buf_pool, const page_id_t &page_id) {
+  if (buf_pool->lru_ghosts == nullptr) {
+    return;
+  }
+  uint32_t fingerprint;
+  buf_LRU_ghost_slot(buf_pool, page_id, &fingerprint)
+      ->store(fingerprint, std::memory_order_relaxed);
+}
+
+/** Check if a page was evicted recently, and forget it if so.
+@param[in]      buf_pool        buffer pool instance
+@param[in]      page_id         page id
+@return true if the page was in buf_pool->lru_ghosts */
+static bool buf_LRU_ghost_remove(buf_pool_t *buf_pool,
+                                 const page_id_t &page_id) {
+  if (buf_pool->lru_ghosts == nullptr) {
+    return false;
+  }
+  uint32_t fingerprint;
+  auto slot = buf_LRU_ghost_slot(buf_pool, page_id, &fingerprint);
+  if (slot->load(std::memory_order_relaxed) != fingerprint) {
+    return false;
+  }
+  slot->store(0, std::memory_order_relaxed);
+  return true;
+}
+
 /** Takes a block out of the LRU list and page hash table.
 If the block is compressed-only (BUF_BLOCK_ZIP_PAGE),
 the object will be freed.
@@ -1118,7 +1162,11 @@ static bool buf_LRU_free_from_common_LRU_list(buf_pool_t *buf_pool,
       mutex_enter(block_mutex);
 
       if (buf_flush_ready_for_replace(bpage)) {
+        const page_id_t page_id = bpage->id;
         freed = buf_LRU_free_page(bpage, true);
+        if (freed) {
+          buf_LRU_ghost_add(buf_pool, page_id);
+        }
       }
 
       if (!freed) {
@@ -1708,6 +1756,13 @@ void buf_LRU_add_block(buf_page_t *bpage, /*!< in: control block */
                                   added to the start, regardless of this
                                   parameter */
 {
+  if (old && buf_LRU_ghost_remove(buf_pool_from_bpage(bpage), bpage->id)) {
+    /* The page was evicted recently, so it is not a one-off read from a
+    scan; see BUF_LRU_POLICY_2Q. */
+    ++buf_pool_from_bpage(bpage)->stat.n_pages_ghost_hits;
+    old = false;
+  }
+
   buf_LRU_add_block_low(bpage, old);
 }
 
@@ -107,8 +107,11 @@ ulint buf_read_page_low(dberr_t *err, bool sync, ulint type, ulint mode,
   ut_ad(buf_page_in_file(bpage));
   ut_ad(!mutex_own(&buf_pool_from_bpage(bpage)->LRU_list_mutex));
 
+  std::chrono::steady_clock::time_point start_time;
+
   if (sync) {
     thd_wait_begin(nullptr, THD_WAIT_DISKIO);
+    start_time = std::chrono::steady_clock::now();
   }
 
   void *dst;
@@ -127,6 +130,8 @@ ulint buf_read_page_low(dberr_t *err, bool sync, ulint type, ulint mode,
                 bpage);
 
   if (sync) {
+    srv_stats.page_read_latency.add(std::chrono::steady_clock::now() -
+                                    start_time);
     thd_wait_end(nullptr);
   }
 
@@ -325,6 +330,25 @@ bool buf_read_page_background(const page_id_t &page_id,
   return (count > 0);
 }
 
+bool buf_read_ahead_leaf(const page_id_t &page_id,
+                         const page_size_t &page_size) {
+  if (!srv_read_ahead_threshold || srv_startup_is_before_trx_rollback_phase) {
+    return false;
+  }
+
+  dberr_t err;
+
+  const auto count =
+      buf_read_page_low(&err, false, IORequest::IGNORE_MISSING,
+                        BUF_READ_ANY_PAGE, page_id, page_size, false);
+
+  if (count > 0) {
+    buf_pool_get(page_id)->stat.n_ra_pages_read += count;
+  }
+
+  return count > 0;
+}
+
 ulint buf_read_ahead_linear(const page_id_t &page_id,
                             const page_size_t &page_size, bool inside_ibuf) {
   buf_pool_t *buf_pool = buf_pool_get(page_id);
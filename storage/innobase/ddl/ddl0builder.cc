@@ -1762,7 +1762,9 @@ dberr_t Builder::btree_build() noexcept {
   auto observer = m_ctx.m_trx->flush_observer;
   Dup dup = {m_index, m_ctx.m_table, m_ctx.m_col_map, 0};
   Merge_cursor cursor(this, &dup, m_local_stage);
-  const auto io_buffer_size = m_ctx.load_io_buffer_size(m_thread_ctxs.size());
+  /* Share the buffer budget with the other indexes being loaded. */
+  const auto io_buffer_size = m_ctx.load_io_buffer_size(
+      m_thread_ctxs.size() * m_loader.n_concurrent_builders());
 
   uint64_t total_rows{};
   dberr_t err{DB_SUCCESS};
@@ -1818,6 +1820,9 @@ dberr_t Builder::btree_build() noexcept {
 
   if (err == DB_SUCCESS) {
     m_loader.add_task(Loader::Task{this});
+
+    /* The merge and load buffers have been released. */
+    m_loader.admit_next_builder();
   }
 
   return get_error();
@@ -1997,7 +2002,8 @@ dberr_t Builder::merge_sort(size_t thread_id) noexcept {
     merge_ctx.m_dup = &dup;
     merge_ctx.m_stage = m_local_stage;
     merge_ctx.m_file = &thread_ctx->m_file;
-    merge_ctx.m_n_threads = m_thread_ctxs.size();
+    merge_ctx.m_n_threads =
+        m_thread_ctxs.size() * m_loader.n_concurrent_builders();
 
     Merge_file_sort merge_file_sort{&merge_ctx};
 
@@ -153,7 +153,7 @@ dberr_t Loader::Thread_data::load(const row_prebuilt_t *prebuilt,
 
     Btree_multi::Btree_load::Wait_callbacks cbk_set(
         sub_tree, wait_cbk.m_fn_begin, wait_cbk.m_fn_end);
-    fill_index_entry(prebuilt);
+    fill_index_entry(prebuilt, m_row);
 
     m_err = sub_tree->insert(m_entry, 0);
     if (m_err != DB_SUCCESS) {
@@ -255,6 +255,42 @@ dberr_t Loader::Thread_data::load(const row_prebuilt_t *prebuilt,
   return m_err;
 }
 
+dberr_t Loader::load_row(const row_prebuilt_t *prebuilt, const dtuple_t *row) {
+  ut_a(!m_sub_tree_loads.empty());
+  ut_a(!m_ctxs.empty());
+
+  return m_ctxs[0].load_row(prebuilt, m_sub_tree_loads[0], row);
+}
+
+dberr_t Loader::Thread_data::load_row(const row_prebuilt_t *prebuilt,
+                                      Btree_multi::Btree_load *sub_tree,
+                                      const dtuple_t *row) {
+  dict_table_t *table = prebuilt->table;
+
+  fill_index_entry(prebuilt, row);
+
+  /* The sub-tree cannot store columns externally. Check it here, so that
+  nothing is changed if the row has to be inserted the usual way. */
+  const auto rec_size = rec_get_converted_size(table->first_index(), m_entry);
+
+  if (page_zip_rec_needs_ext(rec_size, dict_table_is_comp(table),
+                             dtuple_get_n_fields(m_entry),
+                             dict_table_page_size(table))) {
+    return DB_BULK_TOO_BIG_RECORD;
+  }
+
+  auto err = sub_tree->insert(m_entry, 0);
+
+  if (err == DB_DATA_NOT_SORTED || err == DB_DUPLICATE_KEY) {
+    /* The row was not loaded and the sub-tree is intact. */
+    return err;
+  }
+
+  m_err = err;
+
+  return err;
+}
+
 void Loader::Thread_data::free() {
   /* Free the tuple memory */
   mem_heap_free(m_heap);
@@ -348,7 +384,8 @@ void Loader::Thread_data::fill_system_columns(const row_prebuilt_t *prebuilt) {
   dfield_set_data(roll_ptr_field, m_rollptr_data, DATA_ROLL_PTR_LEN);
 }
 
-void Loader::Thread_data::fill_index_entry(const row_prebuilt_t *prebuilt) {
+void Loader::Thread_data::fill_index_entry(const row_prebuilt_t *prebuilt,
+                                            const dtuple_t *row) {
   dict_index_t *primary_key = prebuilt->table->first_index();
 
   /* This function is a miniature of row_ins_index_entry_set_vals(). */
@@ -358,7 +395,7 @@ void Loader::Thread_data::fill_index_entry(const row_prebuilt_t *prebuilt) {
     auto field = dtuple_get_nth_field(m_entry, index);
 
     auto column_number = primary_key->get_col_no(index);
-    auto row_field = dtuple_get_nth_field(m_row, column_number);
+    auto row_field = dtuple_get_nth_field(row, column_number);
     auto data = dfield_get_data(row_field);
     auto data_len = dfield_get_len(row_field);
 
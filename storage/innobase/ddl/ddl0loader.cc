@@ -32,6 +32,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "ddl0impl-builder.h"
 #include "ddl0impl-cursor.h"
 #include "ddl0impl-loader.h"
+#include "ddl0impl-merge.h"
 #include "handler0alter.h"
 #include "os0thread-create.h"
 #include "ut0stage.h"
@@ -167,8 +168,12 @@ class Loader::Task_queue {
         --m_n_idle;
       }
 
-      auto task = m_tasks.front();
-      m_tasks.pop_front();
+      auto it = next_task();
+      auto task = *it;
+      m_tasks.erase(it);
+
+      const auto builder_id = task.m_builder->id();
+      ++m_n_running[builder_id];
 
       IF_DEBUG(++m_n_tasks_executed;)
 
@@ -176,6 +181,13 @@ class Loader::Task_queue {
 
       err = task();
 
+      mutex_enter(&m_mutex);
+
+      ut_a(m_n_running[builder_id] > 0);
+      --m_n_running[builder_id];
+
+      mutex_exit(&m_mutex);
+
     } while (err == DB_SUCCESS);
 
     mutex_enter(&m_mutex);
@@ -214,6 +226,35 @@ class Loader::Task_queue {
 
  private:
   using Tasks = std::deque<Task, ut::allocator<Task>>;
+  using Counters = std::vector<size_t, ut::allocator<size_t>>;
+
+  /** Pick the next task to execute. Tasks are mostly executed in FIFO order,
+  but the oldest task of the builder with the fewest tasks running comes
+  first. This splits the threads evenly between the indexes that are being
+  sorted and loaded, instead of letting the tasks of one index starve the
+  others. The order of the tasks of one builder is preserved.
+  @return the task to execute. */
+  Tasks::iterator next_task() noexcept {
+    ut_ad(mutex_own(&m_mutex));
+    ut_a(!m_tasks.empty());
+
+    auto selected = m_tasks.begin();
+    auto n_running = m_n_running[selected->m_builder->id()];
+
+    for (auto it = m_tasks.begin(); it != m_tasks.end() && n_running > 0;
+         ++it) {
+      const auto n = m_n_running[it->m_builder->id()];
+
+      if (n < n_running) {
+        selected = it;
+        n_running = n;
+      }
+    }
+
+    return selected;
+  }
+
+ private:
 
   /** DDL context. */
   const Context &m_ctx;
@@ -236,6 +277,9 @@ class Loader::Task_queue {
   /** Number of threads idle. */
   size_t m_n_idle{};
 
+  /** Number of tasks running, per builder ID. */
+  Counters m_n_running{};
+
   /** Number of tasks executed. */
   IF_DEBUG(size_t m_n_tasks_executed{};)
 
@@ -248,6 +292,7 @@ Loader::Task_queue::Task_queue(const Context &ctx, bool sync) noexcept
   if (!m_sync) {
     m_consumer_event = os_event_create();
     mutex_create(LATCH_ID_WORK_QUEUE, &m_mutex);
+    m_n_running.resize(ctx.m_indexes.size());
   }
 }
 
@@ -285,6 +330,37 @@ Loader::~Loader() noexcept {
 
 void Loader::add_task(Task task) noexcept { m_taskq->enqueue(task); }
 
+void Loader::admit_next_builder() noexcept {
+  const auto i = m_next_pending.fetch_add(1, std::memory_order_relaxed);
+
+  if (i < m_pending_builders.size()) {
+    add_task(Task{m_pending_builders[i]});
+  }
+}
+
+size_t Loader::max_concurrent_builders(
+    const Builders &builders) const noexcept {
+  size_t n_threads{1};
+
+  for (auto builder : builders) {
+    n_threads = std::max(n_threads, builder->n_threads());
+  }
+
+  /* The smallest buffers that a merge sort can get, see
+  Context::merge_io_buffer_size(). */
+  const size_t min_io_size = std::max(size_t(srv_page_size), IO_BLOCK_SIZE);
+  const auto min_size =
+      ((n_threads * Merge_file_sort::N_WAY_MERGE) + 1) * min_io_size;
+
+  auto n = m_ctx.m_max_buffer_size / min_size;
+
+  /* More indexes than threads would only shrink the buffers of each index
+  without sorting any faster. */
+  n = std::min(n, m_ctx.m_max_threads);
+
+  return std::max(size_t{1}, std::min(n, builders.size()));
+}
+
 dberr_t Loader::load() noexcept {
   ut_a(m_taskq == nullptr);
 
@@ -297,12 +373,32 @@ dberr_t Loader::load() noexcept {
     return DB_OUT_OF_MEMORY;
   }
 
+  Builders sort_builders{};
+
   for (auto builder : m_builders) {
     ut_a(builder->get_state() == Builder::State::ADD);
     /* RTrees are built during the scan phase, using row by row insert. */
     if (!builder->is_spatial_index()) {
       builder->set_next_state();
-      add_task(Task{builder});
+
+      if (builder->get_state() == Builder::State::SETUP_SORT) {
+        sort_builders.push_back(builder);
+      } else {
+        add_task(Task{builder});
+      }
+    }
+  }
+
+  /* The indexes that need a merge sort share innodb_ddl_buffer_size. Start
+  as many of them as the budget allows, the rest are started one by one as
+  the running ones finish loading their B-tree. */
+  m_n_concurrent_builders = max_concurrent_builders(sort_builders);
+
+  for (size_t i = 0; i < sort_builders.size(); ++i) {
+    if (i < m_n_concurrent_builders) {
+      add_task(Task{sort_builders[i]});
+    } else {
+      m_pending_builders.push_back(sort_builders[i]);
     }
   }
 
@@ -28,14 +28,45 @@ this program; if not, write to the Free Software Foundation, Inc.,
  DDL cluster index scan implementation.
  Created 2020-11-01 by Sunny Bains. */
 
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
 #include "btr0load.h"
 #include "ddl0impl-cursor.h"
 #include "ddl0impl-rtree.h"
+#include "gis0rtree.h"
 #include "log0chkp.h"
 #include "row0vers.h"
 
 namespace ddl {
 
+/** Position of a point along a Hilbert curve which fills a 2^16 x 2^16 grid.
+@param[in] x                    Column of the point in the grid.
+@param[in] y                    Row of the point in the grid.
+@return distance of the point from the start of the curve. */
+static uint32_t hilbert_distance(uint32_t x, uint32_t y) noexcept {
+  uint32_t d{};
+
+  for (uint32_t s = 1 << 15; s > 0; s >>= 1) {
+    const uint32_t rx = (x & s) > 0;
+    const uint32_t ry = (y & s) > 0;
+
+    d += s * s * ((3 * rx) ^ ry);
+
+    /* Rotate the quadrant so that the curve stays continuous. */
+    if (ry == 0) {
+      if (rx == 1) {
+        x = 0xFFFF - x;
+        y = 0xFFFF - y;
+      }
+      std::swap(x, y);
+    }
+  }
+
+  return d;
+}
+
 RTree_inserter::RTree_inserter(Context &ctx, dict_index_t *index) noexcept
     : m_dtuples(ut::new_withkey<Tuples>(ut::make_psi_memory_key(mem_key_ddl))),
       m_index(index),
@@ -71,6 +102,75 @@ void RTree_inserter::deep_copy_tuples(Tuples::iterator it) noexcept {
   }
 }
 
+void RTree_inserter::sort_tuples() noexcept {
+  if (m_dtuples->size() < 2) {
+    return;
+  }
+
+  using Keyed = std::pair<uint32_t, dtuple_t *>;
+  std::vector<Keyed, ut::allocator<Keyed>> keyed(
+      ut::allocator<Keyed>(ut::make_psi_memory_key(mem_key_ddl)));
+
+  keyed.reserve(m_dtuples->size());
+
+  /* Centres of the MBRs, and the box that bounds them. */
+  double min_x{DBL_MAX}, max_x{-DBL_MAX}, min_y{DBL_MAX}, max_y{-DBL_MAX};
+  std::vector<std::pair<double, double>,
+              ut::allocator<std::pair<double, double>>>
+      centres(ut::allocator<std::pair<double, double>>(
+          ut::make_psi_memory_key(mem_key_ddl)));
+
+  centres.reserve(m_dtuples->size());
+
+  for (auto dtuple : *m_dtuples) {
+    rtr_mbr_t mbr;
+
+    rtr_get_mbr_from_tuple(dtuple, &mbr);
+
+    const double x = mbr.xmin / 2 + mbr.xmax / 2;
+    const double y = mbr.ymin / 2 + mbr.ymax / 2;
+
+    centres.emplace_back(x, y);
+
+    /* Skip empty geometries, whose MBRs are inverted infinities. */
+    if (std::isfinite(x) && std::isfinite(y)) {
+      min_x = std::min(min_x, x);
+      max_x = std::max(max_x, x);
+      min_y = std::min(min_y, y);
+      max_y = std::max(max_y, y);
+    }
+  }
+
+  if (min_x > max_x) {
+    return;
+  }
+
+  const auto grid = [](double v, double min, double max) -> uint32_t {
+    if (!(v > min)) {
+      return 0;
+    } else if (!(v < max)) {
+      return 0xFFFF;
+    }
+    return static_cast<uint32_t>((v - min) / (max - min) * 0xFFFF);
+  };
+
+  for (size_t i = 0; i < m_dtuples->size(); ++i) {
+    const auto &centre = centres[i];
+
+    keyed.emplace_back(hilbert_distance(grid(centre.first, min_x, max_x),
+                                        grid(centre.second, min_y, max_y)),
+                       (*m_dtuples)[i]);
+  }
+
+  std::stable_sort(
+      keyed.begin(), keyed.end(),
+      [](const Keyed &lhs, const Keyed &rhs) { return lhs.first < rhs.first; });
+
+  for (size_t i = 0; i < keyed.size(); ++i) {
+    (*m_dtuples)[i] = keyed[i].second;
+  }
+}
+
 void RTree_inserter::add_to_batch(const dtuple_t *row,
                                   const row_ext_t *ext) noexcept {
   auto dtuple = row_build_index_entry(row, ext, m_index, m_dtuple_heap);
@@ -100,6 +200,8 @@ dberr_t RTree_inserter::batch_insert(trx_id_t trx_id,
 
   cursor.index = m_index;
 
+  sort_tuples();
+
   for (auto it = m_dtuples->begin(); it != m_dtuples->end(); ++it) {
     auto dtuple = *it;
 
@@ -2426,6 +2426,36 @@ static void dict_index_try_cache_rec_offsets(dict_index_t *index) {
   ut_a(index->rec_cache.nullable_cols <= index->n_nullable);
 }
 
+/** Check if all the fields of the index are fixed length and NOT NULL, and
+thus all leaf records have the same offsets. If so, it initializes
+rec_cache.leaf_offsets, so that rec_get_offsets() can copy them instead of
+decoding the header of each leaf record.
+@param[in]  index   The index instance for which rec_cache should be computed
+*/
+static void dict_index_try_cache_leaf_rec_offsets(dict_index_t *index) {
+  ut_ad(index->rec_cache.leaf_offsets == nullptr);
+
+  if (index->n_nullable > 0) {
+    return;
+  }
+
+  const auto n_fields = dict_index_get_n_fields(index);
+  for (size_t i = 0; i < n_fields; i++) {
+    if (!index->get_field(i)->fixed_len) {
+      return;
+    }
+  }
+
+  const auto offsets_len = n_fields + (1 + REC_OFFS_HEADER_SIZE);
+  auto *const offsets = static_cast<ulint *>(
+      mem_heap_alloc(index->heap, sizeof(ulint) * offsets_len));
+
+  rec_offs_set_n_alloc(offsets, offsets_len);
+  rec_offs_set_n_fields(offsets, n_fields);
+  rec_init_fixed_offsets(index, offsets);
+  index->rec_cache.leaf_offsets = offsets;
+}
+
 /** Adds an index to the dictionary cache, with possible indexing newly
 added column.
 @param[in,out]  table   table on which the index is
@@ -2562,6 +2592,7 @@ dberr_t dict_index_add_to_cache_w_vcol(dict_table_t *table, dict_index_t *index,
       (!table->has_instant_cols() && !table->has_row_versions()) &&
       !dict_index_is_spatial(index)) {
     dict_index_try_cache_rec_offsets(new_index);
+    dict_index_try_cache_leaf_rec_offsets(new_index);
   } else {
     /* The rules should not prevent caching for intrinsic tables */
     ut_ad(!table->is_intrinsic());
@@ -1516,7 +1516,8 @@ static bool dict_stats_analyze_index_for_n_prefix(
     segment i=6: [11, 12]
 
     then we select a random record from each segment and dive
-    below it */
+    below it, or its middle record if innodb_stats_deterministic_sampling
+    is set, so that the same pages are sampled from the same B-tree */
     const uint64_t n_diff = n_diff_data->n_diff_on_level;
     const uint64_t n_pick = n_diff_data->n_leaf_pages_to_analyze;
 
@@ -1526,7 +1527,9 @@ static bool dict_stats_analyze_index_for_n_prefix(
     ut_a(left <= right);
     ut_a(right <= last_idx_on_level);
 
-    const uint64_t rnd = ut::random_from_interval(left, right);
+    const uint64_t rnd = srv_stats_deterministic_sampling
+                             ? left + (right - left) / 2
+                             : ut::random_from_interval(left, right);
 
     const uint64_t dive_below_idx = boundaries->at(rnd);
 
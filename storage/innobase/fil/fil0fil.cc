@@ -484,7 +484,7 @@ class Tablespace_dirs {
   using Result = std::pair<std::string, Tablespace_files::Names *>;
 
   /** Constructor */
-  Tablespace_dirs() : m_dirs(), m_checked() {}
+  Tablespace_dirs() : m_dirs(), m_checked(), m_deferred(false) {}
 
   /** Normalize and save a directory to scan for IBD and IBU datafiles
   before recovery.
@@ -509,12 +509,17 @@ class Tablespace_dirs {
     }
 
     m_checked = 0;
+    m_unique.clear();
+    m_deferred_files.clear();
+    m_deferred = false;
   }
 
   /** Erase a space ID to filename mapping.
   @param[in]    space_id        Tablespace ID to erase
   @return true if successful */
   [[nodiscard]] bool erase_path(space_id_t space_id) {
+    check_deferred_files();
+
     for (auto &dir : m_dirs) {
       if (dir.erase_path(space_id)) {
         return true;
@@ -529,6 +534,8 @@ class Tablespace_dirs {
   @return directory searched and pointer to names that map to the
           tablespace ID */
   [[nodiscard]] Result find_by_id(space_id_t space_id) {
+    check_deferred_files();
+
     for (auto &dir : m_dirs) {
       const auto names = dir.find_by_id(space_id);
 
@@ -629,12 +636,34 @@ class Tablespace_dirs {
                        size_t thread_id, std::mutex *mutex,
                        Space_id_set *unique, Space_id_set *duplicates);
 
+  /** Read the tablespace IDs of files found by the scan, using several
+  threads if there are many files.
+  @param[in]      files           Files to check
+  @param[in,out]  duplicates      Duplicate space IDs found */
+  void check_files(const Scanned_files &files, Space_id_set *duplicates);
+
+  /** Read the tablespace IDs of the .ibd files whose check was deferred
+  by scan(). Called before the first lookup by tablespace ID. */
+  void check_deferred_files();
+
  private:
   /** Directories scanned and the files discovered under them. */
   Scanned m_dirs;
 
   /** Number of files checked. */
   std::atomic_size_t m_checked;
+
+  /** Tablespace IDs of the files checked so far. */
+  Space_id_set m_unique;
+
+  /** .ibd files found by scan() whose header has not been read yet. */
+  Scanned_files m_deferred_files;
+
+  /** true if m_deferred_files must be checked before a lookup. */
+  std::atomic_bool m_deferred;
+
+  /** Serializes the check of m_deferred_files. */
+  std::mutex m_deferred_mutex;
 };
 
 /** Determine if space flushing should be disabled, for example when user has
@@ -8845,6 +8874,7 @@ dberr_t fil_set_compression(space_id_t space_id, const char *algorithm) {
     switch (srv_debug_compress) {
       case Compression::LZ4:
       case Compression::ZLIB:
+      case Compression::ZSTD:
       case Compression::NONE:
 
         compression.m_type = static_cast<Compression::Type>(srv_debug_compress);
@@ -11362,16 +11392,59 @@ dberr_t Tablespace_dirs::scan() {
                             << undo_files.size() << " undo files";
   }
 
-  Space_id_set unique;
   Space_id_set duplicates;
 
+#ifndef UNIV_HOTBACKUP
+  if (!srv_validate_tablespace_paths && !ibd_files.empty()) {
+    /* The tablespace paths in the data dictionary are trusted, so the
+    header of each .ibd file is only needed if a tablespace has to be
+    found by its space ID, which is the case for crash recovery, DDL log
+    replay and path validation. After a clean shutdown none of these
+    need it, so don't open every .ibd file just to read its space ID. */
+    ib::info(ER_IB_MSG_383)
+        << "Deferring the space ID check of " << ibd_files.size()
+        << " '.ibd' files until a tablespace is looked up by its ID";
+
+    m_deferred_files = std::move(ibd_files);
+    ibd_files.clear();
+    m_deferred = true;
+  }
+#endif /* !UNIV_HOTBACKUP */
+
+  check_files(ibd_files, &duplicates);
+
+  check_files(undo_files, &duplicates);
+
+  ut_a(m_checked == ibd_files.size() + undo_files.size());
+
+  ib::info(ER_IB_MSG_383) << "Completed space ID check of " << m_checked.load()
+                          << " files.";
+
+  dberr_t err;
+
+  if (!duplicates.empty()) {
+    ib::error(ER_IB_MSG_384)
+        << "Multiple files found for the same tablespace ID:";
+
+    print_duplicates(duplicates);
+
+    err = DB_FAIL;
+  } else {
+    err = DB_SUCCESS;
+  }
+
+  return err;
+}
+
+void Tablespace_dirs::check_files(const Scanned_files &files,
+                                  Space_id_set *duplicates) {
   /* Get the number of additional threads needed to scan the files. */
-  size_t n_threads = fil_get_scan_threads(ibd_files.size());
+  size_t n_threads = fil_get_scan_threads(files.size());
 
   if (n_threads > 0) {
     ib::info(ER_IB_MSG_382)
         << "Using " << (n_threads + 1) << " threads to"
-        << " scan " << ibd_files.size() << " tablespace files";
+        << " scan " << files.size() << " tablespace files";
   }
 
   std::mutex m;
@@ -11388,18 +11461,27 @@ dberr_t Tablespace_dirs::scan() {
       check = std::bind(&Tablespace_dirs::duplicate_check, this, _1, _2, _3, _4,
                         _5, _6);
 
-  par_for(PFS_NOT_INSTRUMENTED, ibd_files, n_threads, check, &m, &unique,
-          &duplicates);
+  par_for(PFS_NOT_INSTRUMENTED, files, n_threads, check, &m, &m_unique,
+          duplicates);
+}
 
-  duplicate_check(undo_files.begin(), undo_files.end(), n_threads, &m, &unique,
-                  &duplicates);
+void Tablespace_dirs::check_deferred_files() {
+  if (!m_deferred) {
+    return;
+  }
 
-  ut_a(m_checked == ibd_files.size() + undo_files.size());
+  std::lock_guard<std::mutex> guard(m_deferred_mutex);
 
-  ib::info(ER_IB_MSG_383) << "Completed space ID check of " << m_checked.load()
-                          << " files.";
+  if (!m_deferred) {
+    return;
+  }
 
-  dberr_t err;
+  Space_id_set duplicates;
+
+  check_files(m_deferred_files, &duplicates);
+
+  ib::info(ER_IB_MSG_383) << "Completed deferred space ID check of "
+                          << m_deferred_files.size() << " files.";
 
   if (!duplicates.empty()) {
     ib::error(ER_IB_MSG_384)
@@ -11407,12 +11489,13 @@ dberr_t Tablespace_dirs::scan() {
 
     print_duplicates(duplicates);
 
-    err = DB_FAIL;
-  } else {
-    err = DB_SUCCESS;
+    ib::fatal(UT_LOCATION_HERE, ER_IB_MSG_384)
+        << "Remove the duplicate files, or restart with"
+        << " --innodb-validate-tablespace-paths=ON";
   }
 
-  return err;
+  m_deferred_files.clear();
+  m_deferred = false;
 }
 
 void fil_set_scan_dir(const std::string &directory, bool is_undo_dir) {
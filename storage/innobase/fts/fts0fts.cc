@@ -4378,11 +4378,14 @@ static dberr_t fts_sync(fts_sync_t *sync, bool unlock_cache, bool wait,
     sync->trx->dict_operation_lock_mode = RW_S_LATCH;
   }
 
+  /* The first pass writes most of the cache, so it never keeps the cache
+  locked, to not stall inserts and updates for its whole duration. */
+  bool first_pass = true;
+
 begin_sync:
-  if (cache->total_size > fts_max_cache_size) {
+  if (!first_pass && cache->total_size > fts_max_cache_size) {
     /* Avoid the case: sync never finish when
     insert/update keeps coming. */
-    ut_ad(sync->unlock_cache);
     sync->unlock_cache = false;
   }
 
@@ -4415,6 +4418,7 @@ begin_sync:
       continue;
     }
 
+    first_pass = false;
     goto begin_sync;
   }
 
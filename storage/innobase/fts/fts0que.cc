@@ -3014,16 +3014,19 @@ static dberr_t fts_query_filter_doc_ids(
     }
 
     /* Unpack the positions within the document. */
-    while (*ptr) {
-      last_pos += fts_decode_vlc(&ptr);
+    if (query->collect_positions) {
+      while (*ptr) {
+        last_pos += fts_decode_vlc(&ptr);
 
-      /* Collect the matching word positions, for phrase
-      matching later. */
-      if (query->collect_positions) {
+        /* Collect the matching word positions, for phrase
+        matching later. */
         ib_vector_push(match->positions, &last_pos);
-      }
 
-      ++freq;
+        ++freq;
+      }
+    } else {
+      /* Only the number of positions is needed. */
+      freq = fts_skip_vlc_list(&ptr, static_cast<byte *>(data) + len);
     }
 
     /* End of list marker. */
@@ -157,8 +157,13 @@ bool ha_insert_for_hash_func(hash_table_t *table, uint64_t hash_value,
 
   /* We have to allocate a new chain node */
 
-  node = static_cast<ha_node_t *>(
-      mem_heap_alloc(hash_get_heap(table), sizeof(ha_node_t)));
+  if (table->latch_free_readers && table->free_nodes != nullptr) {
+    node = static_cast<ha_node_t *>(table->free_nodes);
+    table->free_nodes = node->next;
+  } else {
+    node = static_cast<ha_node_t *>(
+        mem_heap_alloc(hash_get_heap(table), sizeof(ha_node_t)));
+  }
 
   if (node == nullptr) {
     /* It was a btr search type memory heap and at the moment
@@ -181,6 +186,10 @@ bool ha_insert_for_hash_func(hash_table_t *table, uint64_t hash_value,
 
   node->next = nullptr;
 
+  /* A reader without latches must see the node initialized once it can
+  reach it. */
+  std::atomic_thread_fence(std::memory_order_release);
+
   prev_node = static_cast<ha_node_t *>(first_node);
 
   if (prev_node == nullptr) {
@@ -217,7 +226,37 @@ void ha_delete_hash_node(hash_table_t *table, /*!< in: hash table */
   }
 #endif /* UNIV_AHI_DEBUG || UNIV_DEBUG */
 
-  HASH_DELETE_AND_COMPACT(ha_node_t, next, table, del_node);
+  if (!table->latch_free_readers) {
+    HASH_DELETE_AND_COMPACT(ha_node_t, next, table, del_node);
+    return;
+  }
+
+  /* Readers without latches may be on the node, or about to reach it. Unlink
+  it, but leave its next pointer as it is, so that they can continue along the
+  chain, and keep the node for reuse instead of moving another node in its
+  place. */
+  ha_modify_begin(table);
+
+  auto cell = hash_get_nth_cell(
+      table, hash_calc_cell_id(del_node->hash_value, table));
+
+  if (cell->node == del_node) {
+    cell->node = del_node->next;
+  } else {
+    auto node = static_cast<ha_node_t *>(cell->node);
+
+    while (node->next != del_node) {
+      node = node->next;
+      ut_a(node != nullptr);
+    }
+
+    node->next = del_node->next;
+  }
+
+  ha_modify_end(table);
+
+  del_node->next = static_cast<ha_node_t *>(table->free_nodes);
+  table->free_nodes = del_node;
 }
 
 bool ha_search_and_update_if_found_func(hash_table_t *table,
@@ -249,7 +288,9 @@ bool ha_search_and_update_if_found_func(hash_table_t *table,
 
     node->block = new_block;
 #endif /* UNIV_AHI_DEBUG || UNIV_DEBUG */
+    ha_modify_begin(table);
     node->data = new_data;
+    ha_modify_end(table);
 
     return true;
   }
@@ -109,8 +109,9 @@ void hash_create_sync_obj(hash_table_t *table, latch_id_t id,
 
   ut_a(sync_latch_get_level(id) != SYNC_UNKNOWN);
 
-  table->rw_locks = static_cast<rw_lock_t *>(ut::malloc_withkey(
-      UT_NEW_THIS_FILE_PSI_KEY, n_sync_obj * sizeof(rw_lock_t)));
+  table->rw_locks = static_cast<ut::Cacheline_padded<rw_lock_t> *>(
+      ut::malloc_withkey(UT_NEW_THIS_FILE_PSI_KEY,
+                         n_sync_obj * sizeof(*table->rw_locks)));
 
   for (size_t i = 0; i < n_sync_obj; i++) {
     rw_lock_create(hash_table_locks_key, table->rw_locks + i, id);
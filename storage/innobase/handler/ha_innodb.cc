@@ -456,7 +456,7 @@ static ulong innodb_default_row_format = DEFAULT_ROW_FORMAT_DYNAMIC;
 #ifdef UNIV_DEBUG
 /** Values for --innodb-debug-compress names. */
 static const char *innodb_debug_compress_names[] = {"none", "zlib", "lz4",
-                                                    "lz4hc", NullS};
+                                                    "zstd", NullS};
 
 /** Enumeration of --innodb-debug-compress */
 static TYPELIB innodb_debug_compress_typelib = {
@@ -476,6 +476,15 @@ static TYPELIB innodb_stats_method_typelib = {
     array_elements(innodb_stats_method_names) - 1,
     "innodb_stats_method_typelib", innodb_stats_method_names, nullptr};
 
+/** Possible values of innodb_buffer_pool_lru_policy, see buf_LRU_policy_t */
+static const char *innodb_lru_policy_names[] = {"MIDPOINT", "2Q", NullS};
+
+/** Used to define an enumerate type of the system variable
+innodb_buffer_pool_lru_policy. */
+static TYPELIB innodb_lru_policy_typelib = {
+    array_elements(innodb_lru_policy_names) - 1, "innodb_lru_policy_typelib",
+    innodb_lru_policy_names, nullptr};
+
 #endif /* UNIV_HOTBACKUP */
 
 /** Possible values of the parameter innodb_checksum_algorithm */
@@ -859,6 +868,7 @@ static PSI_thread_info all_innodb_threads[] = {
                    PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME),
     PSI_THREAD_KEY(recv_writer_thread, "ib_recv_write", PSI_FLAG_SINGLETON, 0,
                    PSI_DOCUMENT_ME),
+    PSI_THREAD_KEY(recv_apply_thread, "ib_recv_apply", 0, 0, PSI_DOCUMENT_ME),
     PSI_THREAD_KEY(srv_error_monitor_thread, "ib_srv_err_mon",
                    PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME),
     PSI_THREAD_KEY(srv_lock_timeout_thread, "ib_srv_lock_to",
@@ -870,6 +880,8 @@ static PSI_thread_info all_innodb_threads[] = {
     PSI_THREAD_KEY(srv_purge_thread, "ib_srv_purge", PSI_FLAG_SINGLETON, 0,
                    PSI_DOCUMENT_ME),
     PSI_THREAD_KEY(srv_worker_thread, "ib_srv_wkr", 0, 0, PSI_DOCUMENT_ME),
+    PSI_THREAD_KEY(srv_undo_truncate_thread, "ib_undo_trunc",
+                   PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME),
     PSI_THREAD_KEY(trx_recovery_rollback_thread, "ib_tx_recov", 0, 0,
                    PSI_DOCUMENT_ME),
     PSI_THREAD_KEY(page_flush_thread, "ib_pg_flush", 0, 0, PSI_DOCUMENT_ME),
@@ -1097,6 +1109,21 @@ static MYSQL_THDVAR_BOOL(ft_enable_stopword, PLUGIN_VAR_OPCMDARG,
                          "Create FTS index with stopword.", nullptr, nullptr,
                          /* default */ true);
 
+static MYSQL_THDVAR_BOOL(
+    bulk_insert_empty_tables, PLUGIN_VAR_OPCMDARG,
+    "Load the rows of INSERT ... SELECT and LOAD DATA into an empty table"
+    " bottom-up while they come in primary key order, holding an exclusive"
+    " lock on the table until the transaction ends.",
+    nullptr, nullptr, /* default */ false);
+
+static MYSQL_THDVAR_BOOL(
+    early_lock_release, PLUGIN_VAR_OPCMDARG,
+    "Release the row locks of a transaction as soon as the binary log has"
+    " made its commit durable (sync_binlog=1, binlog_error_action="
+    "ABORT_SERVER), instead of at the end of the commit, so that transactions"
+    " updating the same rows are not serialized on the group commit.",
+    nullptr, nullptr, /* default */ false);
+
 static MYSQL_THDVAR_ULONG(lock_wait_timeout, PLUGIN_VAR_RQCMDARG,
                           "Timeout in seconds an InnoDB transaction may wait "
                           "for a lock before being rolled back. Values above "
@@ -1235,6 +1262,18 @@ static SHOW_VAR innodb_status_variables[] = {
     {"redo_log_capacity_resized",
      (char *)&export_vars.innodb_redo_log_capacity_resized, SHOW_LONGLONG,
      SHOW_SCOPE_GLOBAL},
+    {"page_cleaner_lsn_rate",
+     (char *)&export_vars.innodb_page_cleaner_lsn_rate, SHOW_LONGLONG,
+     SHOW_SCOPE_GLOBAL},
+    {"page_cleaner_predicted_redo_age",
+     (char *)&export_vars.innodb_page_cleaner_predicted_redo_age,
+     SHOW_LONGLONG, SHOW_SCOPE_GLOBAL},
+    {"page_cleaner_pages_target",
+     (char *)&export_vars.innodb_page_cleaner_pages_target, SHOW_LONG,
+     SHOW_SCOPE_GLOBAL},
+    {"page_cleaner_lagging_instances",
+     (char *)&export_vars.innodb_page_cleaner_lagging_instances, SHOW_LONG,
+     SHOW_SCOPE_GLOBAL},
     {"redo_log_resize_status",
      (char *)&export_vars.innodb_redo_log_resize_status, SHOW_CHAR,
      SHOW_SCOPE_GLOBAL},
@@ -1506,6 +1545,11 @@ static int innobase_xa_prepare(handlerton *hton, /*!< in: InnoDB handlerton */
                                bool all); /*!< in: true - prepare transaction
                                           false - the current SQL statement
                                           ended */
+/** Releases the record locks of a prepared transaction whose commit has been
+decided, if innodb_early_lock_release is set for the session.
+@param[in]      hton    InnoDB handlerton
+@param[in]      thd     session of the transaction */
+static void innobase_commit_decided(handlerton *hton, THD *thd);
 /** This function is used to recover X/Open XA distributed transactions.
  @return number of prepared transactions stored in xid_list */
 static int innobase_xa_recover(
@@ -2625,6 +2669,9 @@ dberr_t Compression::check(const char *algorithm, Compression *compression) {
   } else if (innobase_strcasecmp(algorithm, "lz4") == 0) {
     compression->m_type = LZ4;
 
+  } else if (innobase_strcasecmp(algorithm, "zstd") == 0) {
+    compression->m_type = ZSTD;
+
   } else {
     return (DB_UNSUPPORTED);
   }
@@ -2648,6 +2695,7 @@ bool Compression::validate(const Compression::Type type) {
     case NONE:
     case ZLIB:
     case LZ4:
+    case ZSTD:
       break;
     default:
       ret = false;
@@ -5135,6 +5183,72 @@ constexpr PSI_metric_info_v1 simple(const char *name, const char *unit,
           &variable};
 }
 
+// latency histogram metric callback, delivers the cumulative count of each
+// bucket with the bucket upper bound in microseconds as "le" attribute
+static void get_metric_latency_histogram(
+    void *measurement_context, measurement_delivery_callback_t delivery,
+    void *delivery_context) {
+  assert(measurement_context != nullptr);
+  assert(delivery != nullptr);
+  using Histogram = Counter::Latency_histogram;
+  static const auto bounds = [] {
+    std::array<std::string, Histogram::N_BUCKETS> result;
+    for (size_t i = 0; i + 1 < Histogram::N_BUCKETS; ++i) {
+      result[i] = std::to_string(Histogram::upper_bound_us(i));
+    }
+    result[Histogram::N_BUCKETS - 1] = "+Inf";
+    return result;
+  }();
+  const auto *histogram = static_cast<const Histogram *>(measurement_context);
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < Histogram::N_BUCKETS; ++i) {
+    cumulative += histogram->count(i);
+    delivery->value_int64_attr(delivery_context,
+                               ut::clamp<int64_t>(cumulative), "le",
+                               bounds[i].c_str());
+  }
+}
+
+// latency histogram sum metric callback
+static void get_metric_latency_sum(void *measurement_context,
+                                   measurement_delivery_callback_t delivery,
+                                   void *delivery_context) {
+  assert(measurement_context != nullptr);
+  assert(delivery != nullptr);
+  const auto *histogram =
+      static_cast<const Counter::Latency_histogram *>(measurement_context);
+  delivery->value_int64(delivery_context,
+                        ut::clamp<int64_t>(histogram->sum_us()));
+}
+
+constexpr PSI_metric_info_v1 histogram(const char *name,
+                                       const char *description,
+                                       Counter::Latency_histogram &variable) {
+  return {name,
+          "us",
+          description,
+          MetricOTELType::ASYNC_COUNTER,
+          MetricNumType::METRIC_INTEGER,
+          0,
+          0,
+          get_metric_latency_histogram,
+          &variable};
+}
+
+constexpr PSI_metric_info_v1 histogram_sum(
+    const char *name, const char *description,
+    Counter::Latency_histogram &variable) {
+  return {name,
+          "us",
+          description,
+          MetricOTELType::ASYNC_COUNTER,
+          MetricNumType::METRIC_INTEGER,
+          0,
+          0,
+          get_metric_latency_sum,
+          &variable};
+}
+
 //
 // Telemetry metric sources instrumented within the InnoDB storage engine
 // are being defined below.
@@ -5435,6 +5549,27 @@ static PSI_metric_info_v1 data_metrics[] = {
      export_vars.innodb_data_written)
 };
 
+static PSI_metric_info_v1 latency_metrics[] = {
+    histogram("log_fsync",
+     "Number of redo log fsyncs with a latency in microseconds up to the le attribute",
+     srv_stats.log_fsync_latency),
+    histogram_sum("log_fsync_sum",
+     "Total latency of redo log fsyncs in microseconds",
+     srv_stats.log_fsync_latency),
+    histogram("row_lock_wait",
+     "Number of row lock waits with a latency in microseconds up to the le attribute",
+     srv_stats.row_lock_wait_latency),
+    histogram_sum("row_lock_wait_sum",
+     "Total latency of row lock waits in microseconds",
+     srv_stats.row_lock_wait_latency),
+    histogram("page_read",
+     "Number of synchronous page reads with a latency in microseconds up to the le attribute",
+     srv_stats.page_read_latency),
+    histogram_sum("page_read_sum",
+     "Total latency of synchronous page reads in microseconds",
+     srv_stats.page_read_latency)
+};
+
 // clang-format on
 
 static PSI_meter_info_v1 inno_meter[] = {
@@ -5443,7 +5578,9 @@ static PSI_meter_info_v1 inno_meter[] = {
     {"mysql.inno.buffer_pool", "MySql InnoDB buffer pool metrics", 10, 0, 0,
      buffer_metrics, std::size(buffer_metrics)},
     {"mysql.inno.data", "MySql InnoDB data metrics", 10, 0, 0, data_metrics,
-     std::size(data_metrics)}};
+     std::size(data_metrics)},
+    {"mysql.inno.latency", "MySql InnoDB latency histograms", 10, 0, 0,
+     latency_metrics, std::size(latency_metrics)}};
 
 /** Initialize the InnoDB storage engine plugin.
 @param[in,out]  p       InnoDB handlerton
@@ -5472,6 +5609,7 @@ static int innodb_init(void *p) {
   innobase_hton->commit = innobase_commit;
   innobase_hton->rollback = innobase_rollback;
   innobase_hton->prepare = innobase_xa_prepare;
+  innobase_hton->commit_decided = innobase_commit_decided;
   innobase_hton->recover = innobase_xa_recover;
   innobase_hton->recover_prepared_in_tc = innobase_xa_recover_prepared_in_tc;
   innobase_hton->commit_by_xid = innobase_commit_by_xid;
@@ -9326,6 +9464,64 @@ void innobase_get_multi_value(const TABLE *mysql_table, ulint f_idx,
   ut_ad(succ);
 }
 
+void ha_innobase::start_bulk_insert(ha_rows rows) {
+  /* The size of the load when the number of rows is not known, for sizing the
+  extent cache of the loader. */
+  constexpr size_t DEFAULT_BULK_INSERT_SIZE = 1024 * 1024 * 1024;
+
+  THD *thd = ha_thd();
+
+  if (!THDVAR(thd, bulk_insert_empty_tables) || high_level_read_only ||
+      m_prebuilt->table->is_intrinsic()) {
+    return;
+  }
+
+  switch (thd_sql_command(thd)) {
+    case SQLCOM_LOAD:
+    case SQLCOM_INSERT_SELECT:
+    case SQLCOM_REPLACE_SELECT:
+      break;
+    default:
+      return;
+  }
+
+  update_thd(thd);
+
+  trx_t *trx = m_prebuilt->trx;
+
+  TrxInInnoDB trx_in_innodb(trx);
+
+  if (trx_in_innodb.is_aborted()) {
+    return;
+  }
+
+  if (m_prebuilt->mysql_template == nullptr ||
+      m_prebuilt->template_type != ROW_MYSQL_WHOLE_ROW) {
+    build_template(true);
+  }
+
+  const size_t data_size =
+      rows > 0 ? rows * table->s->reclength : DEFAULT_BULK_INSERT_SIZE;
+
+  /* If the rows cannot be loaded, they are inserted the usual way. An error
+  is reported again by the first insert. */
+  static_cast<void>(row_bulk_insert_begin(
+      m_prebuilt, data_size, bulk_load_available_memory(thd)));
+}
+
+int ha_innobase::end_bulk_insert() {
+  if (m_prebuilt->bulk_insert == nullptr) {
+    return 0;
+  }
+
+  TrxInInnoDB trx_in_innodb(m_prebuilt->trx);
+
+  const auto error = row_bulk_insert_end(m_prebuilt);
+
+  return convert_error_code_to_mysql(error, m_prebuilt->table->flags,
+                                     m_user_thd);
+}
+
 /** Stores a row in an InnoDB database, to the table specified in this
  handle.
  @return error code */
@@ -20392,6 +20588,24 @@ static int innobase_xa_prepare(handlerton *hton, /*!< in: InnoDB handlerton */
   return (0);
 }
 
+static void innobase_commit_decided(handlerton *hton, THD *thd) {
+  assert(hton == innodb_hton_ptr);
+
+  if (!THDVAR(thd, early_lock_release)) {
+    return;
+  }
+
+  trx_t *trx = thd_to_trx(thd);
+
+  /* Only a prepared transaction has its commit decided; one that was
+  committed in one phase has released its locks already. */
+  if (trx == nullptr || !trx_state_eq(trx, TRX_STATE_PREPARED)) {
+    return;
+  }
+
+  lock_trx_release_rec_locks_early(trx);
+}
+
 /** This function is used to recover X/Open XA distributed transactions.
  @return number of prepared transactions stored in xid_list */
 static int innobase_xa_recover(
@@ -22288,6 +22502,14 @@ static MYSQL_SYSVAR_BOOL(
     "Include delete marked records when calculating persistent statistics",
     nullptr, nullptr, false);
 
+static MYSQL_SYSVAR_BOOL(
+    stats_deterministic_sampling, srv_stats_deterministic_sampling,
+    PLUGIN_VAR_OPCMDARG,
+    "Sample the same leaf pages each time persistent statistics are "
+    "calculated for an unchanged index, instead of random ones, so that "
+    "servers with the same data get the same index cardinalities",
+    nullptr, nullptr, false);
+
 static MYSQL_SYSVAR_ULONG(
     io_capacity, srv_io_capacity, PLUGIN_VAR_RQCMDARG,
     "Number of IOPs the server can do. Tunes the background IO rate", nullptr,
@@ -22455,6 +22677,21 @@ static MYSQL_SYSVAR_ULONG(
     "Number of iterations over which the background flushing is averaged.",
     nullptr, nullptr, 30, 1, 1000, 0);
 
+static MYSQL_SYSVAR_ULONG(
+    adaptive_flushing_lookahead, srv_adaptive_flushing_lookahead,
+    PLUGIN_VAR_RQCMDARG,
+    "Number of seconds ahead for which adaptive flushing predicts the"
+    " checkpoint age from the recent redo generation rate (0 = use the"
+    " current age).",
+    nullptr, nullptr, 0, 0, 60, 0);
+
+static MYSQL_SYSVAR_BOOL(
+    page_cleaner_independent, srv_page_cleaner_independent,
+    PLUGIN_VAR_NOCMDARG,
+    "Let the page cleaners of fast buffer pool instances start their next"
+    " round without waiting for the slow ones.",
+    nullptr, nullptr, false);
+
 static MYSQL_SYSVAR_ULONG(
     max_purge_lag, srv_max_purge_lag, PLUGIN_VAR_RQCMDARG,
     "Desired maximum length of the purge queue (0 = no limit)", nullptr,
@@ -22467,6 +22704,13 @@ static MYSQL_SYSVAR_ULONG(max_purge_lag_delay, srv_max_purge_lag_delay,
                           0L,                   /* Minimum value */
                           10000000UL, 0);       /* Maximum value */
 
+static MYSQL_SYSVAR_BOOL(
+    mvcc_csn, srv_mvcc_csn, PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+    "Give each committed transaction a commit sequence number and let a"
+    " read view store the number instead of copying the ids of the active"
+    " transactions (disabled by default).",
+    nullptr, nullptr, false);
+
 static MYSQL_SYSVAR_BOOL(rollback_on_timeout, innobase_rollback_on_timeout,
                          PLUGIN_VAR_OPCMDARG | PLUGIN_VAR_READONLY,
                          "Roll back the complete transaction on lock wait "
@@ -22529,6 +22773,14 @@ static MYSQL_SYSVAR_ULONG(
     "Number of InnoDB Adaptive Hash Index Partitions. (default = 8). ", nullptr,
     nullptr, 8, 1, 512, 0);
 
+/** Whether searches in the AHI are done without taking the partition latch. */
+static MYSQL_SYSVAR_BOOL(
+    adaptive_hash_index_latch_free, btr_search_latch_free,
+    PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+    "Search the InnoDB Adaptive Hash Index without latching its partitions;"
+    " writers wait for the readers to leave instead (disabled by default).",
+    nullptr, nullptr, false);
+
 static MYSQL_SYSVAR_ULONG(
     replication_delay, srv_replication_delay, PLUGIN_VAR_RQCMDARG,
     "Replication thread delay (ms) on the slave server if"
@@ -22856,6 +23108,13 @@ static MYSQL_SYSVAR_ULONG(force_recovery_crash, srv_force_recovery_crash,
                           nullptr, 0, 0, 100, 0);
 #endif /* UNIV_DEBUG */
 
+static MYSQL_SYSVAR_ULONG(
+    recovery_apply_threads, srv_recovery_apply_threads,
+    PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+    "Number of threads applying redo log records to pages during crash"
+    " recovery. Each of them owns a part of the pages.",
+    nullptr, nullptr, 4, 1, 64, 0);
+
 static MYSQL_SYSVAR_ULONG(page_size, srv_page_size,
                           PLUGIN_VAR_OPCMDARG | PLUGIN_VAR_READONLY |
                               PLUGIN_VAR_NOPERSIST,
@@ -22912,6 +23171,22 @@ static MYSQL_SYSVAR_BOOL(
     "of the redo log should be done by each thread individually (OFF).",
     nullptr, innodb_log_writer_threads_update, true);
 
+static MYSQL_SYSVAR_BOOL(
+    log_reserve_combining, srv_log_reserve_combining, PLUGIN_VAR_OPCMDARG,
+    "Whether concurrent reservations of space in the redo log buffer are"
+    " combined, so that a single thread advances the current sn for a group"
+    " of mini-transactions (ON), or each mini-transaction advances it on"
+    " its own (OFF).",
+    nullptr, nullptr, false);
+
+static MYSQL_SYSVAR_BOOL(
+    log_pmem, srv_log_pmem, PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+    "Whether redo log files on persistent memory (DAX) should be memory"
+    " mapped and written with non-temporal stores, which makes them durable"
+    " without fsync. Files which cannot be mapped with MAP_SYNC are written"
+    " as usual.",
+    nullptr, nullptr, false);
+
 static MYSQL_SYSVAR_UINT(
     log_spin_cpu_abs_lwm, srv_log_spin_cpu_abs_lwm, PLUGIN_VAR_RQCMDARG,
     "Minimum value of cpu time for which spin-delay is used."
@@ -23066,6 +23341,15 @@ static MYSQL_SYSVAR_UINT(
     " The timeout is disabled if 0.",
     nullptr, nullptr, 1000, 0, UINT_MAX32, 0);
 
+static MYSQL_SYSVAR_ENUM(
+    buffer_pool_lru_policy, buf_LRU_policy,
+    PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+    "How pages get into the 'new' blocks of the buffer pool LRU list."
+    " MIDPOINT: when accessed again after innodb_old_blocks_time."
+    " 2Q: only when read again shortly after being evicted, which keeps"
+    " pages that are touched by a single scan out of the 'new' blocks.",
+    nullptr, nullptr, BUF_LRU_POLICY_MIDPOINT, &innodb_lru_policy_typelib);
+
 static MYSQL_SYSVAR_LONG(
     open_files, innobase_open_files, PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
     "How many files at the maximum InnoDB keeps open at the same time.",
@@ -23179,6 +23463,14 @@ static MYSQL_SYSVAR_ULONG(
     1,                             /* Minimum value */
     FSP_MAX_ROLLBACK_SEGMENTS, 0); /* Maximum value */
 
+static MYSQL_SYSVAR_BOOL(
+    rollback_segment_affinity, srv_rollback_segment_affinity,
+    PLUGIN_VAR_OPCMDARG,
+    "Assign the transactions of a thread to the rollback segment it used"
+    " last, instead of to all rollback segments in turn, so that small"
+    " transactions keep reusing the same cached undo log page.",
+    nullptr, nullptr, false);
+
 static MYSQL_SYSVAR_BOOL(undo_log_encrypt, srv_undo_log_encrypt,
                          PLUGIN_VAR_OPCMDARG,
                          "Enable or disable Encrypt of UNDO tablespace.",
@@ -23205,12 +23497,36 @@ static MYSQL_SYSVAR_BOOL(use_native_aio, srv_use_native_aio,
                          "Use native AIO if supported on this platform.",
                          nullptr, nullptr, true);
 
+#ifdef HAVE_LIBURING
+static MYSQL_SYSVAR_BOOL(
+    use_io_uring, srv_use_io_uring, PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+    "Use io_uring instead of libaio for native AIO, if the kernel supports it,"
+    " and submit each doublewrite batch together with its fsync.",
+    nullptr, nullptr, false);
+
+static MYSQL_SYSVAR_BOOL(
+    io_uring_sqpoll, srv_io_uring_sqpoll,
+    PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+    "Let a kernel thread poll the io_uring submission queues, instead of"
+    " submitting IO with system calls. Needs innodb_use_io_uring.",
+    nullptr, nullptr, false);
+#endif /* HAVE_LIBURING */
+
 #ifdef HAVE_LIBNUMA
 static MYSQL_SYSVAR_BOOL(
     numa_interleave, srv_numa_interleave,
     PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
     "Use NUMA interleave memory policy to allocate InnoDB buffer pool.",
     nullptr, nullptr, false);
+
+static MYSQL_SYSVAR_BOOL(
+    numa_local_buffer_pool, srv_numa_local_buffer_pool,
+    PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+    "Allocate each InnoDB buffer pool instance on one NUMA node, taking the "
+    "nodes in turn, and let the page cleaner threads run on the nodes and "
+    "prefer flushing the instances on their own node. Ignored if "
+    "innodb_numa_interleave is set.",
+    nullptr, nullptr, false);
 #endif /* HAVE_LIBNUMA */
 
 static MYSQL_SYSVAR_BOOL(
@@ -23519,6 +23835,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(doublewrite_files),
     MYSQL_SYSVAR(doublewrite_pages),
     MYSQL_SYSVAR(stats_include_delete_marked),
+    MYSQL_SYSVAR(stats_deterministic_sampling),
     MYSQL_SYSVAR(api_enable_binlog),
     MYSQL_SYSVAR(api_enable_mdl),
     MYSQL_SYSVAR(api_disable_rowlock),
@@ -23530,6 +23847,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(flush_log_at_trx_commit),
     MYSQL_SYSVAR(flush_method),
     MYSQL_SYSVAR(force_recovery),
+    MYSQL_SYSVAR(recovery_apply_threads),
 #ifdef UNIV_DEBUG
     MYSQL_SYSVAR(force_recovery_crash),
 #endif /* UNIV_DEBUG */
@@ -23538,6 +23856,8 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(ft_total_cache_size),
     MYSQL_SYSVAR(ft_result_cache_limit),
     MYSQL_SYSVAR(ft_enable_stopword),
+    MYSQL_SYSVAR(bulk_insert_empty_tables),
+    MYSQL_SYSVAR(early_lock_release),
     MYSQL_SYSVAR(ft_max_token_size),
     MYSQL_SYSVAR(ft_min_token_size),
     MYSQL_SYSVAR(ft_num_word_optimize),
@@ -23556,6 +23876,8 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(log_write_ahead_size),
     MYSQL_SYSVAR(log_group_home_dir),
     MYSQL_SYSVAR(log_writer_threads),
+    MYSQL_SYSVAR(log_pmem),
+    MYSQL_SYSVAR(log_reserve_combining),
     MYSQL_SYSVAR(log_spin_cpu_abs_lwm),
     MYSQL_SYSVAR(log_spin_cpu_pct_hwm),
     MYSQL_SYSVAR(log_wait_for_flush_spin_hwm),
@@ -23586,10 +23908,14 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(adaptive_flushing),
     MYSQL_SYSVAR(flush_sync),
     MYSQL_SYSVAR(flushing_avg_loops),
+    MYSQL_SYSVAR(adaptive_flushing_lookahead),
+    MYSQL_SYSVAR(page_cleaner_independent),
     MYSQL_SYSVAR(max_purge_lag),
     MYSQL_SYSVAR(max_purge_lag_delay),
+    MYSQL_SYSVAR(mvcc_csn),
     MYSQL_SYSVAR(old_blocks_pct),
     MYSQL_SYSVAR(old_blocks_time),
+    MYSQL_SYSVAR(buffer_pool_lru_policy),
     MYSQL_SYSVAR(open_files),
     MYSQL_SYSVAR(optimize_fulltext_only),
     MYSQL_SYSVAR(rollback_on_timeout),
@@ -23605,6 +23931,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(stats_auto_recalc),
     MYSQL_SYSVAR(adaptive_hash_index),
     MYSQL_SYSVAR(adaptive_hash_index_parts),
+    MYSQL_SYSVAR(adaptive_hash_index_latch_free),
     MYSQL_SYSVAR(stats_method),
     MYSQL_SYSVAR(replication_delay),
     MYSQL_SYSVAR(status_file),
@@ -23624,8 +23951,13 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(autoinc_lock_mode),
     MYSQL_SYSVAR(version),
     MYSQL_SYSVAR(use_native_aio),
+#ifdef HAVE_LIBURING
+    MYSQL_SYSVAR(use_io_uring),
+    MYSQL_SYSVAR(io_uring_sqpoll),
+#endif /* HAVE_LIBURING */
 #ifdef HAVE_LIBNUMA
     MYSQL_SYSVAR(numa_interleave),
+    MYSQL_SYSVAR(numa_local_buffer_pool),
 #endif /* HAVE_LIBNUMA */
     MYSQL_SYSVAR(change_buffering),
     MYSQL_SYSVAR(change_buffer_max_size),
@@ -23673,6 +24005,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(undo_log_truncate),
     MYSQL_SYSVAR(undo_log_encrypt),
     MYSQL_SYSVAR(rollback_segments),
+    MYSQL_SYSVAR(rollback_segment_affinity),
     MYSQL_SYSVAR(undo_directory),
     MYSQL_SYSVAR(temp_tablespaces_dir),
     MYSQL_SYSVAR(undo_tablespaces),
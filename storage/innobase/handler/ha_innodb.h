@@ -131,6 +131,16 @@ class ha_innobase : public handler {
 
   int write_row(uchar *buf) override;
 
+  /** Start loading the rows of an INSERT ... SELECT or LOAD DATA into an
+  empty table bottom-up, if innodb_bulk_insert_empty_tables is set and the
+  table qualifies; see row_bulk_insert_begin().
+  @param[in]  rows  estimated number of rows, or 0 if unknown */
+  void start_bulk_insert(ha_rows rows) override;
+
+  /** End the bulk load started by start_bulk_insert(), if any.
+  @return error code */
+  int end_bulk_insert() override;
+
   int update_row(const uchar *old_data, uchar *new_data) override;
 
   int delete_row(const uchar *buf) override;
@@ -876,22 +876,23 @@ int ha_innopart::open(const char *name, int mode [[maybe_unused]],
     return HA_ERR_INITIALIZATION;
   }
 
-  /* Currently we track statistics for all partitions, but for
-  the secondary indexes we only use the biggest partition. */
-
-  for (uint part_id = 0; part_id < m_tot_parts; part_id++) {
-    innobase_copy_frm_flags_from_table_share(
-        m_part_share->get_table_part(part_id), table->s);
-    dict_stats_init(m_part_share->get_table_part(part_id));
-  }
-
   MONITOR_INC(MONITOR_TABLE_OPEN);
 
   /* TODO: refactor this in ha_innobase so it can increase code reuse. */
 
+  /* Set up and check all partitions in one pass, so that each
+  dict_table_t is visited only once per open. */
   for (uint part_id = 0; part_id < m_tot_parts; part_id++) {
     bool no_tablespace;
     ib_table = m_part_share->get_table_part(part_id);
+
+    /* Currently we track statistics for all partitions, but for
+    the secondary indexes we only use the biggest partition.
+    dict_stats_init() returns at once if the share has already
+    loaded them. */
+    innobase_copy_frm_flags_from_table_share(ib_table, table->s);
+    dict_stats_init(ib_table);
+
     if (dict_table_is_discarded(ib_table)) {
       /* If the op is an IMPORT, open the space without this warning. */
       if (thd_tablespace_op(thd) != Alter_info::ALTER_IMPORT_TABLESPACE) {
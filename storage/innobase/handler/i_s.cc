@@ -3869,6 +3869,13 @@ static ST_FIELD_INFO i_s_innodb_buffer_stats_fields_info[] = {
      STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
      STRUCT_FLD(open_method, 0)},
 
+#define IDX_BUF_STATS_GHOST_HITS 32
+    {STRUCT_FLD(field_name, "NUMBER_PAGES_GHOST_HITS"),
+     STRUCT_FLD(field_length, MY_INT64_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONGLONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
     END_OF_ST_FIELD_INFO};
 
 /** Fill Information Schema table INNODB_BUFFER_POOL_STATS for a particular
@@ -3968,6 +3975,8 @@ static int i_s_innodb_stats_fill(
 
   OK(fields[IDX_BUF_STATS_UNZIP_CUR]->store(info->unzip_cur, true));
 
+  OK(fields[IDX_BUF_STATS_GHOST_HITS]->store(info->n_pages_ghost_hits, true));
+
   return schema_table_store_record(thd, table);
 }
 
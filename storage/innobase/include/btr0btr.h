@@ -287,9 +287,10 @@ void btr_free(const page_id_t &page_id, const page_size_t &page_size);
 
 /** Truncate an index tree. We just free all except the root.
 Currently, this function is only specific for clustered indexes and the only
-caller is DDTableBuffer which manages a table with only a clustered index.
+callers are DDTableBuffer which manages a table with only a clustered index,
+and the rollback of a bulk insert into an empty table (TRX_UNDO_EMPTY_REC).
 It is up to the caller to ensure atomicity and to ensure correct recovery by
-calling btr_truncate_recover().
+calling btr_truncate_recover(), or by running again.
 @param[in]      index           clustered index */
 void btr_truncate(const dict_index_t *index);
 
@@ -63,6 +63,13 @@ struct btr_search_t {
   /** number of consecutive searches which would have succeeded, or did succeed,
   using the hash index; the range is 0 .. BTR_SEARCH_BUILD_LIMIT + 5. */
   std::atomic<uint64_t> n_hash_potential;
+  /** number of searches in the hash index, and how many of them succeeded,
+  since the hit ratio was last checked; see BTR_SEARCH_HIT_WINDOW. */
+  std::atomic<uint32_t> n_hash_window_searches;
+  std::atomic<uint32_t> n_hash_window_hits;
+  /** number of searches that will not try the hash index, because it has
+  not been finding the records for a while */
+  std::atomic<uint32_t> n_hash_skip;
   /** @} */
 
   std::atomic<btr_search_prefix_info_t> prefix_info;
@@ -112,6 +119,38 @@ class btr_search_sys_t {
     X-latched rwlock. Changes from nullptr to non-nullptr are done without any
     protection. Changes from non-null to a different non-null are prohibited. */
     std::atomic<buf_block_t *> free_block_for_heap;
+
+    /** Number of slots in which the readers without latches register. */
+    static constexpr size_t N_READER_SLOTS = 32;
+
+    /** The count of readers without latches, for each of the two latest
+    epochs. A reader picks a slot by its thread, to spread the counting over
+    cache lines. */
+    struct alignas(ut::INNODB_CACHE_LINE_SIZE) reader_slot_t {
+      std::atomic<uint64_t> n_readers[2]{};
+    };
+
+    /** Enter a search without latches. Between this and reader_exit() the
+    hash table, its nodes and the blocks its nodes point to will not be freed,
+    see wait_for_readers().
+    @return what to pass to reader_exit() */
+    [[nodiscard]] size_t reader_enter();
+
+    /** Leave a search without latches.
+    @param[in]  ticket  what reader_enter() returned */
+    void reader_exit(size_t ticket);
+
+    /** Wait for all the readers without latches that may have seen the hash
+    table before it was changed. The caller must X-latch the part, which also
+    makes sure that only one thread waits at a time. */
+    void wait_for_readers();
+
+    /** Incremented by wait_for_readers(). Its parity selects the counters
+    for readers that enter. */
+    alignas(ut::INNODB_CACHE_LINE_SIZE) std::atomic<uint64_t> epoch{0};
+
+    /** Readers without latches, see reader_enter(). */
+    reader_slot_t readers[N_READER_SLOTS];
   };
 
   /** Partitions of the AHI system. */
@@ -55,6 +55,10 @@ extern std::atomic_bool btr_search_enabled;
 /** Number of adaptive hash index partition. */
 extern ulong btr_ahi_parts;
 
+/** If true, searches in the adaptive hash index do not take the partition
+latch; only changes to the index do. */
+extern bool btr_search_latch_free;
+
 /** Structure to facilitate fast modulo for number of adaptive hash index
 partition. */
 extern ut::fast_modulo_t btr_ahi_parts_fast_modulo;
@@ -179,6 +179,9 @@ struct buf_pool_info_t {
   ulint n_pages_made_young;
   /** number of pages not made young */
   ulint n_pages_not_made_young;
+  /** number of pages read into the new blocks because they had been
+  evicted recently */
+  ulint n_pages_ghost_hits;
   /** buf_pool->n_pages_read */
   ulint n_pages_read;
   /** buf_pool->n_pages_created */
@@ -966,6 +969,13 @@ static inline buf_pool_t *buf_pool_from_block(
 @return buffer pool */
 static inline buf_pool_t *buf_pool_get(const page_id_t &page_id);
 
+/** Get the NUMA node that the buffer pool instance or page cleaner thread
+with the given index is placed on, if srv_numa_local_buffer_pool is set. The
+nodes that we may allocate memory on are taken in turn.
+@param[in]      index   instance or thread index
+@return NUMA node, or -1 if not placing them on nodes */
+int buf_pool_numa_node(ulint index);
+
 /** Returns the buffer pool instance given its array index
  @return buffer pool */
 static inline buf_pool_t *buf_pool_from_array(
@@ -2202,6 +2212,10 @@ struct buf_pool_stat_t {
   enough ago, in buf_page_peek_if_too_old(). Not protected. */
   uint64_t n_pages_not_made_young;
 
+  /** Number of pages put at the start of the LRU list when read, because
+  they were found in buf_pool_t::lru_ghosts. Protected by LRU_list_mutex. */
+  uint64_t n_pages_ghost_hits;
+
   /** LRU size in bytes. Protected by LRU_list_mutex. */
   uint64_t LRU_bytes;
 
@@ -2227,6 +2241,8 @@ struct buf_pool_stat_t {
 
     dst.n_pages_not_made_young = src.n_pages_not_made_young;
 
+    dst.n_pages_ghost_hits = src.n_pages_ghost_hits;
+
     dst.LRU_bytes = src.LRU_bytes;
 
     dst.flush_list_bytes = src.flush_list_bytes;
@@ -2243,6 +2259,7 @@ struct buf_pool_stat_t {
     n_ra_pages_evicted = 0;
     n_pages_made_young = 0;
     n_pages_not_made_young = 0;
+    n_pages_ghost_hits = 0;
     LRU_bytes = 0;
     flush_list_bytes = 0;
   }
@@ -2308,6 +2325,21 @@ struct buf_pool_t {
   /** Array index of this buffer pool instance */
   ulint instance_no;
 
+  /** NUMA node that the memory of this instance is preferably allocated on,
+  or -1; see buf_pool_numa_node() */
+  int numa_node;
+
+  /** With BUF_LRU_POLICY_2Q, the pages that were evicted most recently: a
+  direct-mapped hash table of page id fingerprints, with 0 for no page.
+  Accessed without latching; a lost update only makes a page go to the old
+  blocks or new blocks when it should not have. nullptr with other
+  policies. */
+  std::atomic<uint32_t> *lru_ghosts;
+
+  /** The number of entries in lru_ghosts minus one; a power of two minus
+  one. */
+  ulint lru_ghosts_mask;
+
   /** Current pool size in bytes */
   ulint curr_pool_size;
 
@@ -202,6 +202,10 @@ void buf_flush_page_cleaner_disabled_debug_update(THD *thd, SYS_VAR *var,
 /** Initialize page_cleaner.  */
 void buf_flush_page_cleaner_init();
 
+/** Copy the latest decisions of the page cleaner coordinator to
+export_vars. */
+void buf_flush_update_exported_variables();
+
 #if defined UNIV_DEBUG || defined UNIV_BUF_DEBUG
 /** Validates the flush list.
  @return true if ok */
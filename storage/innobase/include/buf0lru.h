@@ -235,6 +235,29 @@ least this many milliseconds ago.  Not protected by any mutex or latch. */
 std::chrono::milliseconds get_buf_LRU_old_threshold();
 /** @} */
 
+/** Page replacement policies, for innodb_buffer_pool_lru_policy. */
+enum buf_LRU_policy_t : ulong {
+  /** Pages that are read are put at the midpoint of the LRU list, and are
+  moved to the start when they are accessed again after
+  buf_LRU_old_threshold. */
+  BUF_LRU_POLICY_MIDPOINT,
+  /** Like 2Q: pages that are read stay in the old blocks whatever their
+  accesses, and are only put at the start of the LRU list if they are read
+  again shortly after being evicted. The pages evicted most recently are
+  remembered in buf_pool_t::lru_ghosts. Pages that have been in the new
+  blocks once are moved back like with BUF_LRU_POLICY_MIDPOINT. */
+  BUF_LRU_POLICY_2Q
+};
+
+/** The page replacement policy, a buf_LRU_policy_t. Set at startup. */
+extern ulong buf_LRU_policy;
+
+/** Remember that a page was evicted from the LRU list, for
+BUF_LRU_POLICY_2Q. Does nothing with other policies.
+@param[in]      buf_pool        buffer pool instance
+@param[in]      page_id         page that was evicted */
+void buf_LRU_ghost_add(buf_pool_t *buf_pool, const page_id_t &page_id);
+
 /** @brief Statistics for selecting the LRU list for eviction.
 
 These statistics are not 'of' LRU but 'for' LRU.  We keep count of I/O
@@ -78,6 +78,18 @@ released by the i/o-handler thread.
 bool buf_read_page_background(const page_id_t &page_id,
                               const page_size_t &page_size, bool sync);
 
+/** Issues an asynchronous read of the next leaf page of a B-tree scan, if
+it is not in the buffer pool, so that its read overlaps with the processing
+of the current page. Like the linear read-ahead, this is disabled by
+innodb_read_ahead_threshold=0.
+NOTE: the calling thread may own latches on pages; this function does not
+wait for any latch.
+@param[in]      page_id         page id of the leaf page to read
+@param[in]      page_size       page size
+@return true if a read request was issued */
+bool buf_read_ahead_leaf(const page_id_t &page_id,
+                         const page_size_t &page_size);
+
 /** Applies a random read-ahead in buf_pool if there are at least a threshold
 value of accessed pages from the random read-ahead area. Does not read any
 page, not even the one at the position (space, offset), if the read-ahead
@@ -53,6 +53,14 @@ class Loader {
                  Btree_multi::Btree_load *sub_tree, const Rows_mysql &rows,
                  Bulk_load::Stat_callbacks &wait_cbk);
 
+    /** Load a row, already converted to the InnoDB format, to a sub-tree.
+    @param[in]      prebuilt  prebuilt structures from innodb table handler
+    @param[in,out]  sub_tree  sub tree to load data to
+    @param[in]      row       row with all the columns of the table
+    @return innodb error code */
+    dberr_t load_row(const row_prebuilt_t *prebuilt,
+                     Btree_multi::Btree_load *sub_tree, const dtuple_t *row);
+
     /** Free thread specific data. */
     void free();
 
@@ -77,8 +85,9 @@ class Loader {
                        size_t row_index);
 
     /** Fill he cluster index entry from tuple data.
-    @param[in]  prebuilt  prebuilt structures from innodb table handler */
-    void fill_index_entry(const row_prebuilt_t *prebuilt);
+    @param[in]  prebuilt  prebuilt structures from innodb table handler
+    @param[in]  row       row with the column data */
+    void fill_index_entry(const row_prebuilt_t *prebuilt, const dtuple_t *row);
 
     /** Store integer column in Innodb format.
     @param[in]      col       sql column data
@@ -135,6 +144,15 @@ class Loader {
   dberr_t load(const row_prebuilt_t *prebuilt, size_t thread_index,
                const Rows_mysql &rows, Bulk_load::Stat_callbacks &wait_cbk);
 
+  /** Load one row to the sub-tree of the first thread. Used to load the rows
+  inserted one by one by a statement, which must come in key order.
+  @param[in]  prebuilt  prebuilt structures from innodb table handler
+  @param[in]  row       row with all the columns of the table
+  @return DB_DATA_NOT_SORTED, DB_DUPLICATE_KEY or DB_BULK_TOO_BIG_RECORD if
+  the row does not follow the previous one or needs external storage, in which
+  case nothing was loaded, or another innodb error code */
+  dberr_t load_row(const row_prebuilt_t *prebuilt, const dtuple_t *row);
+
   /** Finish bulk load operation, combining the sub-trees produced by concurrent
   threads.
   @param[in]  prebuilt  prebuilt structures from innodb table handler
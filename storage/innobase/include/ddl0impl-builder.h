@@ -102,6 +102,11 @@ struct Builder {
   /** @return the DDL context. */
   Context &ctx() noexcept { return m_ctx; }
 
+  /** @return the number of scan thread states, each has its own file. */
+  [[nodiscard]] size_t n_threads() const noexcept {
+    return m_thread_ctxs.size();
+  }
+
   /** Parallel scan thread spawn failed, release the extra thread states. */
   void fallback_to_single_thread() noexcept;
 
@@ -89,6 +89,16 @@ class Loader {
   @param[in] task               Task to add. */
   void add_task(Task task) noexcept;
 
+  /** Note that a builder has loaded its index, and start the merge sort of
+  the next index that is waiting for buffer memory, if any. */
+  void admit_next_builder() noexcept;
+
+  /** @return the number of indexes that are merge sorted and loaded at the
+  same time. They share the buffer budget equally. */
+  [[nodiscard]] size_t n_concurrent_builders() const noexcept {
+    return m_n_concurrent_builders;
+  }
+
   /** Validate the indexes (except FTS).
   @return true on success. */
   [[nodiscard]] bool validate_indexes() const noexcept;
@@ -106,6 +116,13 @@ class Loader {
   @return DB_SUCCESS or error code. */
   [[nodiscard]] dberr_t scan_and_build_indexes() noexcept;
 
+  /** Calculate how many builders can merge sort and load their indexes at
+  the same time, without going over the buffer budget.
+  @param[in] builders           Builders that need to sort their rows.
+  @return the number of builders to run concurrently, at least one. */
+  [[nodiscard]] size_t max_concurrent_builders(
+      const Builders &builders) const noexcept;
+
  private:
   /** DDL context, shared by the loader threads. */
   ddl::Context &m_ctx;
@@ -122,6 +139,15 @@ class Loader {
   /** Index builders. */
   Builders m_builders{};
 
+  /** Number of builders that can be in the sort and load phases. */
+  size_t m_n_concurrent_builders{1};
+
+  /** Builders waiting for buffer memory before they can start sorting. */
+  Builders m_pending_builders{};
+
+  /** Next builder in m_pending_builders to start. */
+  std::atomic<size_t> m_next_pending{};
+
   /** Task queue. */
   Task_queue *m_taskq{};
 };
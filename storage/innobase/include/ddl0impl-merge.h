@@ -56,7 +56,8 @@ struct Merge_file_sort {
     /** For reporting duplicates, it has the index instance too. */
     Dup *m_dup{};
 
-    /** Number of scan threads used, for memory buffer calculation. */
+    /** Number of scan threads used, times the number of indexes that are
+    sorted at the same time, for memory buffer calculation. */
     size_t m_n_threads{};
 
     /** PFS progress monitoring. */
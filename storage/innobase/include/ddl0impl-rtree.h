@@ -84,6 +84,10 @@ class RTree_inserter {
   @param[in] it                 Deep copy from this tuple onwards. */
   void deep_copy_tuples(Tuples::iterator it) noexcept;
 
+  /** Sort the cached tuples along a Hilbert curve over the centres of their
+  MBRs, so that consecutive inserts go to the same or nearby leaf pages. */
+  void sort_tuples() noexcept;
+
  private:
   /** vector used to cache index rows made from cluster index scan */
   Tuples *m_dtuples{};
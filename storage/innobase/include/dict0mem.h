@@ -982,6 +982,11 @@ struct rec_cache_t {
 
   /** Number of NULLable columns among those for which offsets are cached */
   size_t nullable_cols{0};
+
+  /** Holds reference to cached offsets of all the fields of a leaf record, if
+  they are all fixed length and NOT NULL, so that every leaf record has the
+  same layout. */
+  const ulint *leaf_offsets{nullptr};
 };
 
 /** Cache position of last inserted or selected record by caching record
@@ -37,6 +37,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
 #include "mem0mem.h"
 #include "univ.i"
+#include "ut0cpu_cache.h"
 #include "ut0rnd.h"
 #ifndef UNIV_HOTBACKUP
 #include "sync0rw.h"
@@ -456,10 +457,27 @@ class hash_table_t {
   Otherwise, 0. Is zero iff the type is HASH_TABLE_SYNC_NONE. */
   size_t n_sync_obj = 0;
   /** nullptr, or an array of n_sync_obj rw_locks used to protect segments of
-  the hash table. Is nullptr iff the type is HASH_TABLE_SYNC_NONE. */
-  rw_lock_t *rw_locks = nullptr;
+  the hash table. Is nullptr iff the type is HASH_TABLE_SYNC_NONE. Each lock
+  is padded, so that S-latching one, as every buf_page_hash_get_locked() call
+  does, does not invalidate the cache line of its neighbour on other CPUs. */
+  ut::Cacheline_padded<rw_lock_t> *rw_locks = nullptr;
 
 #endif /* !UNIV_HOTBACKUP */
+  /** If true, the chains may be searched without any latch (see
+  btr_search_latch_free): a deleted node is then put on free_nodes instead of
+  compacting the heap, so that the node memory is never moved nor freed while
+  the table exists, and the modifications that make a found node stale are
+  counted in modify_seq. */
+  bool latch_free_readers = false;
+
+  /** Deleted nodes, linked by their next pointers, to be reused by inserts.
+  Only used if latch_free_readers. */
+  void *free_nodes = nullptr;
+
+  /** Odd while a node is being deleted or its data changed, and incremented
+  again afterwards. A reader without latches can trust what it found if this
+  was even before and unchanged after its search. */
+  std::atomic<uint64_t> modify_seq{0};
   mem_heap_t *heap = nullptr;
 #ifdef UNIV_DEBUG
   static constexpr uint32_t HASH_TABLE_MAGIC_N = 76561114;
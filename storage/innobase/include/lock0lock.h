@@ -656,6 +656,14 @@ prepare to release locks early.
 @param[in]      only_gap        release only GAP locks */
 void lock_trx_release_read_locks(trx_t *trx, bool only_gap);
 
+/** Release all record locks of a prepared transaction whose commit has been
+decided and made durable by the binary log, so that transactions waiting to
+modify the same rows do not have to wait for the commit to complete. The
+implicit locks of the transaction are ignored from then on, and it must not be
+rolled back. Table locks are kept until the commit.
+@param[in,out]  trx             transaction in TRX_STATE_PREPARED */
+void lock_trx_release_rec_locks_early(trx_t *trx);
+
 /** Iterate over the granted locks which conflict with trx->lock.wait_lock and
 prepare the hit list for ASYNC Rollback.
 
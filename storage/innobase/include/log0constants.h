@@ -157,6 +157,13 @@ constexpr lsn_t LSN_MAX = (1ULL << 63) - 1;
 /** The sn bit to express locked state. */
 constexpr sn_t SN_LOCKED = 1ULL << 63;
 
+/** Number of slots in which concurrent reservations of space in the log
+buffer are combined, when innodb_log_reserve_combining is ON. */
+constexpr size_t LOG_RESERVE_N_SLOTS = 16;
+
+/** Reservations longer than this are never combined with other ones. */
+constexpr size_t LOG_RESERVE_COMBINE_MAX_LEN = 16 * 1024;
+
 /** First checkpoint field in the log header. We write alternately to
 the checkpoint fields when we make new checkpoints. This field is only
 defined in the first log file. */
@@ -71,6 +71,45 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
 class THD;
 
+#ifndef UNIV_HOTBACKUP
+
+/** A slot in which concurrent reservations of space in the log buffer are
+combined into a single update of log_t::sn. The first thread coming to a
+free slot becomes the leader of a group; the threads coming while the group
+is open join it. The leader closes the group, reserves the space for all
+of it, and publishes where it starts. Each member then takes its own part,
+and the last one frees the slot. */
+struct alignas(ut::INNODB_CACHE_LINE_SIZE) Log_reserve_slot {
+  /** Bit set in m_state when the group has been closed. */
+  static constexpr uint64_t CLOSED = 1ULL << 63;
+
+  /** While the group is open, the number of its members is stored in
+  m_state shifted left by this, and the number of bytes they reserve
+  below it. */
+  static constexpr uint64_t N_MEMBERS_SHIFT = 32;
+
+  /** Mask for the number of bytes reserved by an open group. */
+  static constexpr uint64_t LEN_MASK = (1ULL << N_MEMBERS_SHIFT) - 1;
+
+  /** Maximum number of members of a single group. */
+  static constexpr uint64_t MAX_MEMBERS = 64;
+
+  /** 0 when the slot is free; the number of members and the number of bytes
+  of an open group; or CLOSED and the number of members which have not
+  taken their parts yet. */
+  std::atomic<uint64_t> m_state{0};
+
+  /** Value of log_t::sn before it was advanced by the leader (can have
+  SN_LOCKED set), or 0 until that happened. */
+  std::atomic<sn_t> m_start_sn{0};
+
+  /** Number of threads which found the slot busy since the last time a
+  leader looked at it. If non-zero, the leader lets others join it. */
+  std::atomic<uint32_t> m_n_missed{0};
+};
+
+#endif /* !UNIV_HOTBACKUP */
+
 /** Redo log - single data structure with state of the redo log system.
 In future, one could consider splitting this to multiple data structures. */
 struct alignas(ut::INNODB_CACHE_LINE_SIZE) log_t {
@@ -107,6 +146,11 @@ struct alignas(ut::INNODB_CACHE_LINE_SIZE) log_t {
   /** Mutex which can be used for x-lock sn value */
   mutable ib_mutex_t sn_x_lock_mutex;
 
+  /** Slots in which reservations of concurrent threads are combined,
+  before they advance sn (see innodb_log_reserve_combining). A thread
+  always uses the same slot. */
+  Log_reserve_slot reserve_slots[LOG_RESERVE_N_SLOTS];
+
   /** Aligned log buffer. Committing mini-transactions write there
   redo records, and the log_writer thread writes the log buffer to
   disk in background.
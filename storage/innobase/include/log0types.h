@@ -390,6 +390,14 @@ class Log_file_handle {
   @return DB_SUCCESS or error */
   dberr_t open();
 
+  /** Maps the opened file to memory, if innodb_log_pmem is ON and the file
+  is on persistent memory, which supports MAP_SYNC. Leaves m_pmem equal to
+  nullptr otherwise. */
+  void pmem_map();
+
+  /** Unmaps the file, if it was mapped by pmem_map(). */
+  void pmem_unmap();
+
   /** Creates and configures an io request object according to currently
   configured encryption metadata (m_encryption_*) and m_block_size.
   @param[in] req_type            defines type of IO operation (read or write)
@@ -433,9 +441,14 @@ class Log_file_handle {
   /** Whether file is opened */
   bool m_is_open;
 
-  /** Whether file has been modified using this handle since it was opened. */
+  /** Whether file has been modified using this handle since it was opened.
+  Writes done through m_pmem are durable at once, and do not set it. */
   bool m_is_modified;
 
+  /** The whole file mapped to memory, if it is on persistent memory and
+  innodb_log_pmem is ON, otherwise nullptr. */
+  byte *m_pmem;
+
   /** File name */
   std::string m_file_path;
 
@@ -363,7 +363,8 @@ class Encryption {
   @param[in,out]  src     data read from disk, decrypt
                           data will be copied to this page
   @param[in]      src_len source data length
-  @param[in,out]  tmp     scratch area to use for decrypt
+  @param[in,out]  tmp     scratch area, unused since AES-CBC is decrypted
+                          in place; kept for compatibility
   @param[in]  tmp_len     size of the scratch area in bytes
   @return DB_SUCCESS or error code */
   [[nodiscard]] dberr_t decrypt(const IORequest &type, byte *src, ulint src_len,
@@ -61,6 +61,8 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
 
 #include <functional>
 #include <stack>
+#include <utility>
+#include <vector>
 
 /** Prefix all files and directory created under data directory with special
 string so that it never conflicts with MySQL schema directory. */
@@ -1581,6 +1583,18 @@ bool os_aio_init(ulint n_readers, ulint n_writers);
 /** Starts one thread for each segment created in os_aio_init */
 void os_aio_start_threads();
 
+/** Start and length of memory areas that are read into and written from. */
+typedef std::vector<std::pair<byte *, size_t>> os_aio_buffers_t;
+
+/** Register memory that most of the asynchronous IO reads into and writes
+from, like the buffer pool chunks, so that the IO need not map it each time.
+Replaces any earlier registration. Does nothing unless io_uring is used.
+@param[in]      buffers         memory to register */
+void os_aio_register_buffers(const os_aio_buffers_t &buffers);
+
+/** Undo os_aio_register_buffers(), before the memory is freed. */
+void os_aio_unregister_buffers();
+
 /**
 Frees the asynchronous io system. */
 void os_aio_free();
@@ -1881,6 +1895,20 @@ dberr_t os_file_write_retry(IORequest &type, const char *name,
                             pfs_os_file_t file, const void *buf,
                             os_offset_t offset, ulint n);
 
+/** Write to a file and flush it to disk. With io_uring, the write and the
+fsync are one submission, the fsync being linked to the write; otherwise
+this is os_file_write_retry() followed by os_file_flush().
+@param[in]  type     IO flags
+@param[in]  name     name of the file or path as a null-terminated string
+@param[in]  file     handle to an open file
+@param[in]  buf      buffer from which to write
+@param[in]  offset   file offset from the start where to write
+@param[in]  n        number of bytes to write, starting from offset
+@return DB_SUCCESS if request was successful */
+dberr_t os_file_write_and_flush(IORequest &type, const char *name,
+                                pfs_os_file_t file, const void *buf,
+                                os_offset_t offset, ulint n);
+
 /** Helper class for doing synchronous file IO. Currently, the objective
 is to hide the OS specific code, so that the higher level functions aren't
 peppered with "#ifdef". Makes the code flow difficult to follow.  */
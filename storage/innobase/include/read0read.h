@@ -70,6 +70,11 @@ class MVCC {
   @param view           Preallocated view, owned by the caller */
   void clone_oldest_view(ReadView *view);
 
+  /** Find the smallest snapshot commit sequence number of the open views
+  and of the purge view. The caller must own the trx_sys_t::mutex.
+  @return the smallest snapshot CSN, or the next CSN if there is none */
+  trx_id_t oldest_snapshot_csn() const;
+
   /**
   @return the number of active views */
   ulint size() const;
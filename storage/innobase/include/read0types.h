@@ -172,6 +172,9 @@ class ReadView {
     if (id >= m_low_limit_id) {
       return (false);
 
+    } else if (m_snapshot_csn > 0) {
+      return (csn_changes_visible(id));
+
     } else if (m_ids.empty()) {
       return (true);
     }
@@ -243,6 +246,12 @@ class ReadView {
   }
 #endif /* UNIV_DEBUG */
  private:
+  /** Check whether the changes by id are visible by comparing its commit
+  sequence number with m_snapshot_csn.
+  @param[in]    id      transaction id, m_up_limit_id <= id < m_low_limit_id
+  @return whether the view sees the modifications of id. */
+  [[nodiscard]] bool csn_changes_visible(trx_id_t id) const;
+
   /**
   Copy the transaction ids from the source vector */
   inline void copy_trx_ids(const trx_ids_t &trx_ids);
@@ -295,6 +304,14 @@ class ReadView {
   was taken */
   ids_t m_ids;
 
+  /** trx_sys_t::rw_trx_ids_version when m_ids was copied */
+  uint64_t m_ids_version;
+
+  /** If not 0, the view sees exactly the transactions that got a commit
+  sequence number below this value, and m_ids only holds the creator of a
+  cloned view. */
+  trx_id_t m_snapshot_csn;
+
   /** The view does not need to see the undo logs for transactions
   whose transaction number is strictly smaller (<) than this value:
   they can be removed in purge if not needed by other views */
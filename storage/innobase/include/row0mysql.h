@@ -70,6 +70,9 @@ class innodb_session_t;
 namespace dd {
 class Table;
 }
+namespace ddl_bulk {
+class Loader;
+}
 struct TABLE;
 struct btr_pcur_t;
 struct dfield_t;
@@ -235,6 +238,30 @@ dberr_t row_lock_table(row_prebuilt_t *prebuilt);
 [[nodiscard]] dberr_t row_insert_for_mysql(const byte *mysql_rec,
                                            row_prebuilt_t *prebuilt);
 
+/** Starts loading the rows that the current statement inserts with
+row_insert_for_mysql() bottom-up into the clustered index, instead of inserting
+them one by one. This is only done if the table is empty and has no other
+index to maintain, nor foreign keys to check. The table is locked in exclusive
+mode, and an undo log record is written which empties the table again in a
+rollback (TRX_UNDO_EMPTY_REC), in place of the undo log records of the rows.
+
+As long as the rows come in key order, they are loaded. After the first row
+that does not, the load is ended and the remaining rows are inserted the usual
+way.
+@param[in,out]  prebuilt        prebuilt struct in MySQL handle
+@param[in]      data_size       estimated size of the rows to be loaded
+@param[in]      memory          buffer pool memory to use for the load
+@return DB_SUCCESS if the rows are loaded, DB_UNSUPPORTED if the table does
+not qualify, or error code */
+[[nodiscard]] dberr_t row_bulk_insert_begin(row_prebuilt_t *prebuilt,
+                                            size_t data_size, size_t memory);
+
+/** Ends loading rows started by row_bulk_insert_begin(), if it has not ended
+already. The loaded pages are written to disk.
+@param[in,out]  prebuilt        prebuilt struct in MySQL handle
+@return error code or DB_SUCCESS */
+[[nodiscard]] dberr_t row_bulk_insert_end(row_prebuilt_t *prebuilt);
+
 /** Builds a dummy query graph used in selects. */
 void row_prebuild_sel_graph(row_prebuilt_t *prebuilt); /*!< in: prebuilt struct
                                                        in MySQL handle */
@@ -838,6 +865,10 @@ struct row_prebuilt_t {
   /** The MySQL handler object. */
   ha_innobase *m_mysql_handler;
 
+  /** Loads the rows inserted by the current statement bottom-up, if not
+  nullptr; see row_bulk_insert_begin(). */
+  ddl_bulk::Loader *bulk_insert;
+
   /** limit value to avoid fts result overflow */
   ulonglong m_fts_limit;
 
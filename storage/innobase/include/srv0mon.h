@@ -144,6 +144,7 @@ enum monitor_id_t {
   MONITOR_DEADLOCK,
   MONITOR_DEADLOCK_FALSE_POSITIVES,
   MONITOR_DEADLOCK_ROUNDS,
+  MONITOR_DEADLOCK_CHECK_MICROSECOND,
   MONITOR_LOCK_THREADS_WAITING,
   MONITOR_TIMEOUT,
   MONITOR_LOCKREC_WAIT,
@@ -156,6 +156,15 @@ struct srv_stats_t {
 
   /** Number of sampled pages skipped */
   ulint_ctr_64_t n_sampled_pages_skipped;
+
+  /** Latencies of redo log fsyncs done by the log flusher */
+  Counter::Latency_histogram log_fsync_latency;
+
+  /** Latencies of row lock waits */
+  Counter::Latency_histogram row_lock_wait_latency;
+
+  /** Latencies of synchronous page reads */
+  Counter::Latency_histogram page_read_latency;
 };
 
 /** Structure which keeps shared future objects for InnoDB background
@@ -392,7 +401,18 @@ OS (provided we compiled Innobase with it in), otherwise we will
 use simulated aio we build below with threads.
 Currently we support native aio on windows and linux */
 extern bool srv_use_native_aio;
+/** If true, use io_uring instead of libaio for native aio on Linux, and
+link the doublewrite buffer writes with their fsync. Has no effect unless
+InnoDB is built with liburing. */
+extern bool srv_use_io_uring;
+/** If true, let kernel threads poll the io_uring submission queues, which
+spares the system calls for submitting IO. */
+extern bool srv_io_uring_sqpoll;
 extern bool srv_numa_interleave;
+/** If true, allocate each buffer pool instance on a single NUMA node, and
+let the page cleaner threads prefer the instances on their own node. Has no
+effect if srv_numa_interleave is set. */
+extern bool srv_numa_local_buffer_pool;
 
 /* The innodb_directories variable value. This a list of directories
 deliminated by ';', i.e the FIL_PATH_SEPARATOR. */
@@ -407,6 +427,10 @@ extern ulong srv_undo_tablespaces;
 /** The number of rollback segments per tablespace */
 extern ulong srv_rollback_segments;
 
+/** If true, each thread keeps assigning the rollback segment it used last to
+its transactions, see get_next_redo_rseg_from_undo_spaces(). */
+extern bool srv_rollback_segment_affinity;
+
 /** Maximum size of undo tablespace. */
 extern unsigned long long srv_max_undo_tablespace_size;
 
@@ -484,6 +508,15 @@ extern ulong srv_log_recent_closed_size;
 /** Whether to activate/pause the log writer threads. */
 extern bool srv_log_writer_threads;
 
+/** Whether redo log files are memory mapped and written with non-temporal
+stores, when they are on persistent memory (DAX), instead of being written
+with write() and persisted with fsync(). */
+extern bool srv_log_pmem;
+
+/** Whether concurrent reservations of space in the log buffer are combined
+into a single update of log_t::sn. */
+extern bool srv_log_reserve_combining;
+
 /** Minimum absolute value of cpu time for which spin-delay is used. */
 extern uint srv_log_spin_cpu_abs_lwm;
 
@@ -675,12 +708,17 @@ extern double srv_max_dirty_pages_pct_lwm;
 
 extern ulong srv_adaptive_flushing_lwm;
 extern ulong srv_flushing_avg_loops;
+extern ulong srv_adaptive_flushing_lookahead;
+extern bool srv_page_cleaner_independent;
 
 extern ulong srv_force_recovery;
 #ifdef UNIV_DEBUG
 extern ulong srv_force_recovery_crash;
 #endif /* UNIV_DEBUG */
 
+/** Number of threads applying redo log records to pages during recovery. */
+extern ulong srv_recovery_apply_threads;
+
 /** The value of the configuration parameter innodb_fast_shutdown,
 controlling the InnoDB shutdown.
 
@@ -701,6 +739,7 @@ extern bool srv_stats_persistent;
 extern unsigned long long srv_stats_persistent_sample_pages;
 extern bool srv_stats_auto_recalc;
 extern bool srv_stats_include_delete_marked;
+extern bool srv_stats_deterministic_sampling;
 
 extern ulong srv_checksum_algorithm;
 
@@ -724,6 +763,10 @@ extern ulong srv_n_free_tickets_to_enter;
 extern ulong srv_spin_wait_delay;
 extern bool srv_priority_boost;
 
+/** If true then read views use a commit sequence number instead of a copy of
+the active transaction ids, see ReadView::csn_changes_visible(). */
+extern bool srv_mvcc_csn;
+
 extern ulint srv_truncated_status_writes;
 
 #if defined UNIV_DEBUG || defined UNIV_IBUF_DEBUG
@@ -808,12 +851,14 @@ extern mysql_pfs_key_t log_flush_notifier_thread_key;
 extern mysql_pfs_key_t page_flush_coordinator_thread_key;
 extern mysql_pfs_key_t page_flush_thread_key;
 extern mysql_pfs_key_t recv_writer_thread_key;
+extern mysql_pfs_key_t recv_apply_thread_key;
 extern mysql_pfs_key_t srv_error_monitor_thread_key;
 extern mysql_pfs_key_t srv_lock_timeout_thread_key;
 extern mysql_pfs_key_t srv_master_thread_key;
 extern mysql_pfs_key_t srv_monitor_thread_key;
 extern mysql_pfs_key_t srv_purge_thread_key;
 extern mysql_pfs_key_t srv_worker_thread_key;
+extern mysql_pfs_key_t srv_undo_truncate_thread_key;
 extern mysql_pfs_key_t trx_recovery_rollback_thread_key;
 extern mysql_pfs_key_t srv_ts_alter_encrypt_thread_key;
 extern mysql_pfs_key_t parallel_read_thread_key;
@@ -1171,6 +1216,16 @@ struct export_var_t {
   ulonglong innodb_redo_log_physical_size; /*!< Redo log physical size */
   ulonglong innodb_redo_log_capacity_resized; /*!< Redo log capacity after
                                               the last finished redo resize */
+  ulonglong innodb_page_cleaner_lsn_rate; /*!< Recent redo generation
+                                          rate, in LSN per second */
+  ulonglong innodb_page_cleaner_predicted_redo_age; /*!< Checkpoint age that
+                                                    adaptive flushing acted
+                                                    on */
+  ulint innodb_page_cleaner_pages_target; /*!< Pages to flush recommended
+                                          by adaptive flushing */
+  ulint innodb_page_cleaner_lagging_instances; /*!< Buffer pool instances
+                                               still flushing from an
+                                               earlier round */
   ulint innodb_log_waits;                     /*!< srv_log_waits */
   ulint innodb_log_write_requests;            /*!< srv_log_write_requests */
   ulint innodb_log_writes;                    /*!< srv_log_writes */
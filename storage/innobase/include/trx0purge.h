@@ -960,10 +960,23 @@ class Truncate {
   /** Reset the timer. */
   void reset_timer() { m_timer.reset(); }
 
+  /** Is the marked tablespace being truncated in the background?
+  @return true if the undo truncate thread is running */
+  bool is_truncating() const { return (m_truncating.load()); }
+
+  /** Note that the undo truncate thread has started or ended.
+  @param[in]  truncating  true when it starts */
+  void set_truncating(bool truncating) { m_truncating.store(truncating); }
+
  private:
   /** UNDO space ID that is marked for truncate. */
   space_id_t m_space_id_marked;
 
+  /** This is true while the undo truncate thread truncates the marked space.
+  Meanwhile the purge coordinator does not touch the marked space, nor mark
+  another one. */
+  std::atomic<bool> m_truncating{false};
+
   /** This is true if the marked space is empty of undo logs and ready
   to truncate.  We leave the rsegs object 'inactive' until after it is
   truncated and rebuilt.  This allow the code to do the check for undo
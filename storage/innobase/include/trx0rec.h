@@ -163,7 +163,8 @@ byte *trx_undo_update_rec_get_update(const byte *ptr, const dict_index_t *index,
     dict_index_t *index,         /*!< in: clustered index */
     const dtuple_t *clust_entry, /*!< in: in the case of an insert,
                                  index entry to insert into the
-                                 clustered index, otherwise NULL */
+                                 clustered index, or NULL to log
+                                 TRX_UNDO_EMPTY_REC; otherwise NULL */
     const upd_t *update,         /*!< in: in the case of an update,
                                  the update vector, otherwise NULL */
     ulint cmpl_info,             /*!< in: compiler info on secondary
@@ -294,6 +295,9 @@ const byte *trx_undo_read_v_idx(const dict_table_t *table, const byte *ptr,
 compilation info multiplied by 16 is ORed to this value in an undo log
 record */
 
+/** insert into an empty clustered index whose records are not logged one by
+one: the rollback empties the index again */
+constexpr uint32_t TRX_UNDO_EMPTY_REC = 10;
 /** fresh insert into clustered index */
 constexpr uint32_t TRX_UNDO_INSERT_REC = 11;
 /** update of a non-delete-marked  record */
@@ -142,6 +142,23 @@ or trx_sys_allocate_trx_id_trx_no() was called.
 @return the next trx->id or trx->no that will be allocated */
 inline trx_id_t trx_sys_get_next_trx_id_or_no();
 
+/** Retrieves the number of times a transaction id has been removed from
+trx_sys_t::rw_trx_ids. Can be read without holding the trx_sys_t::mutex.
+@return the version of the set of active RW transaction ids */
+inline uint64_t trx_sys_get_rw_trx_ids_version();
+
+/** Assign the next commit sequence number to a transaction that is erased
+from trx_sys_t::rw_trx_ids, and record it in trx_sys_t::csn_map. The caller
+must own the trx_sys_t::mutex.
+@param[in,out]  trx             Transaction, must have an id */
+void trx_sys_assign_csn(trx_t *trx);
+
+/** Look up the commit sequence number of a finished transaction in
+trx_sys_t::csn_map, without any latch.
+@param[in]      trx_id          Transaction id
+@return the commit sequence number, or 0 if trx_id is not in the map */
+inline trx_id_t trx_sys_get_csn(trx_id_t trx_id);
+
 #ifdef UNIV_DEBUG
 /* Flag to control TRX_RSEG_N_SLOTS behavior debugging. */
 extern uint trx_rseg_n_slots_debug;
@@ -367,6 +384,19 @@ class Space_Ids : public std::vector<space_id_t, ut::allocator<space_id_t>> {
 /** Number of shards created for transactions. */
 constexpr size_t TRX_SHARDS_N = 256;
 
+/** Number of slots in trx_sys_t::csn_map. */
+constexpr size_t TRX_CSN_MAP_SIZE = 256 * 1024;
+
+/** The commit sequence number of a finished transaction, see
+trx_sys_t::csn_map. */
+struct Trx_csn_slot {
+  /** Transaction id, or 0 if the slot is unused or being written. */
+  std::atomic<trx_id_t> m_trx_id;
+
+  /** Commit sequence number of m_trx_id. */
+  std::atomic<trx_id_t> m_csn;
+};
+
 /** Computes shard number for a given trx_id.
 @param[in]  trx_id  trx_id for which shard_no should be computed
 @return the computed shard number (number in range 0..TRX_SHARDS_N-1) */
@@ -386,6 +416,15 @@ class Trx_by_id_with_min {
   using By_id = std::unordered_map<trx_id_t, trx_t *, Trx_track_hash>;
   By_id m_by_id;
 
+  using Csn_by_id = std::unordered_map<trx_id_t, trx_id_t, Trx_track_hash>;
+
+  /** Commit sequence numbers of finished transactions which were pushed out
+  of trx_sys_t::csn_map while some read view could still need them. */
+  Csn_by_id m_csn_by_id;
+
+  /** Prune m_csn_by_id when it grows to this size. */
+  size_t m_csn_prune_size{64};
+
   /** For observers which use Trx_shard::mutex protection: each transaction id
   in the m_by_id is guaranteed to be at least m_min_id.
   Writes are protected with Trx_shard::mutex.
@@ -407,6 +446,41 @@ class Trx_by_id_with_min {
     ut_ad(trx == nullptr || !trx_state_eq(trx, TRX_STATE_COMMITTED_IN_MEMORY));
     return trx;
   }
+  /** Get the commit sequence number of a transaction in the shard.
+  @param[in]    trx_id          Transaction id
+  @return the commit sequence number, TRX_ID_MAX if the transaction is
+  active and has none yet, or 0 if the transaction is not in the shard */
+  trx_id_t get_csn(trx_id_t trx_id) const {
+    const auto trx = get(trx_id);
+
+    if (trx != nullptr) {
+      const auto csn = trx->csn.load();
+      return csn == 0 ? TRX_ID_MAX : csn;
+    }
+
+    const auto it = m_csn_by_id.find(trx_id);
+    return it == m_csn_by_id.end() ? 0 : it->second;
+  }
+
+  /** Remember the commit sequence number of a finished transaction.
+  @param[in]    trx_id          Transaction id
+  @param[in]    csn             Its commit sequence number
+  @param[in]    min_csn         Numbers below this are no longer needed */
+  void add_csn(trx_id_t trx_id, trx_id_t csn, trx_id_t min_csn) {
+    if (m_csn_by_id.size() >= m_csn_prune_size) {
+      for (auto it = m_csn_by_id.begin(); it != m_csn_by_id.end();) {
+        if (it->second < min_csn) {
+          it = m_csn_by_id.erase(it);
+        } else {
+          ++it;
+        }
+      }
+      m_csn_prune_size = std::max(size_t{64}, 2 * m_csn_by_id.size());
+    }
+
+    m_csn_by_id.emplace(trx_id, csn);
+  }
+
   void insert(trx_t &trx) {
     const trx_id_t trx_id = trx.id;
     ut_ad(0 == m_by_id.count(trx_id));
@@ -550,6 +624,32 @@ struct trx_sys_t {
   releasing locks to ensure right order of removal and consistent snapshot. */
   trx_ids_t rw_trx_ids;
 
+  /** Incremented whenever an id is removed from rw_trx_ids. Ids are only
+  added to rw_trx_ids together with a newly allocated trx->id, so a ReadView
+  whose m_low_limit_id is still equal to next_trx_id_or_no and which was
+  created at the same version holds exactly the current rw_trx_ids. This lets
+  AC-NL-RO transactions reuse their view without the trx_sys_t::mutex.
+  Modified with the trx_sys_t::mutex held. */
+  std::atomic<uint64_t> rw_trx_ids_version;
+
+  /** The next commit sequence number, see trx_sys_assign_csn(). Only used
+  if srv_mvcc_csn is set. Modified with the trx_sys_t::mutex held. */
+  std::atomic<trx_id_t> next_csn;
+
+  /** Commit sequence numbers of the last finished RW transactions, indexed
+  by trx->id % TRX_CSN_MAP_SIZE, or nullptr if srv_mvcc_csn is not set.
+  Written with the trx_sys_t::mutex held, read without any latch. An entry
+  that is overwritten while a read view could still need it is moved to the
+  Trx_shard of its transaction. */
+  Trx_csn_slot *csn_map;
+
+  /** Number of csn_map entries moved to a Trx_shard. */
+  std::atomic<uint64_t> csn_map_n_moved;
+
+  /** No read view has a snapshot CSN below this value. Lazily updated by
+  trx_sys_assign_csn(). Protected by the trx_sys_t::mutex. */
+  trx_id_t csn_min_snapshot;
+
   char pad7[ut::INNODB_CACHE_LINE_SIZE];
 
   /** Mapping from transaction id to transaction instance. */
@@ -565,6 +565,12 @@ struct trx_lock_t {
   Writers may set it to false at any time. */
   std::atomic<bool> inherit_all;
 
+  /** Set when the record locks of a prepared transaction have been released
+  before its commit, see lock_trx_release_rec_locks_early(). From then on its
+  implicit locks are ignored, and it must not be rolled back.
+  Written with trx->mutex held. */
+  std::atomic<bool> released_early;
+
   /** Weight of the waiting transaction used for scheduling.
   The higher the weight the more we are willing to grant a lock to this
   transaction.
@@ -742,6 +748,12 @@ struct trx_t {
                when trx->in_rw_trx_list. Initially
                set to TRX_ID_MAX. */
 
+  /** Commit sequence number, assigned by trx_sys_assign_csn() when the
+  transaction is erased from trx_sys_t::rw_trx_ids, or 0. Reset when the
+  transaction is added to its Trx_shard, and read with the Trx_shard mutex
+  held. Only used if srv_mvcc_csn is set. */
+  std::atomic<trx_id_t> csn;
+
   /** State of the trx from the point of view of concurrency control
   and the valid state transitions.
 
@@ -42,8 +42,11 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "ut0cpu_cache.h"
 #include "ut0dbg.h"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <bit>
+#include <chrono>
 #include <functional>
 
 /** Default number of slots to use in ib_counter_t */
@@ -367,6 +370,56 @@ inline void add(Shards<COUNT> &dst, const Shards<COUNT> &src) noexcept {
     dst.m_arr[i++].m_n.fetch_add(count, dst.m_memory_order);
   });
 }
+
+/** Histogram of latencies, with buckets bounded by powers of two
+microseconds. Bucket 0 counts latencies under 1us, bucket i counts
+latencies in [2^(i-1), 2^i) us, and the last bucket counts all longer
+latencies. Each bucket is a sharded counter, so that concurrent threads
+do not contend on the same cache line. */
+class Latency_histogram {
+ public:
+  /** Number of buckets. The last one has no upper bound. */
+  static constexpr size_t N_BUCKETS = 24;
+
+  /** Number of shards of each bucket. */
+  static constexpr size_t N_SHARDS = 16;
+
+  /** Add a latency.
+  @param[in]  latency  Duration of the measured operation. */
+  template <typename Duration>
+  void add(Duration latency) noexcept {
+    const auto us =
+        std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    const uint64_t value = us > 0 ? static_cast<uint64_t>(us) : 0;
+    const size_t bucket =
+        std::min<size_t>(std::bit_width(value), N_BUCKETS - 1);
+
+    Counter::inc(m_buckets[bucket], ut::this_thread_hash);
+    Counter::add(m_sum_us, ut::this_thread_hash, value);
+  }
+
+  /** @return number of latencies in a bucket.
+  @param[in]  bucket  Bucket index, less than N_BUCKETS. */
+  Type count(size_t bucket) const noexcept {
+    return Counter::total(m_buckets[bucket]);
+  }
+
+  /** @return upper bound in microseconds of a bucket, except the last.
+  @param[in]  bucket  Bucket index, less than N_BUCKETS - 1. */
+  static constexpr Type upper_bound_us(size_t bucket) noexcept {
+    return Type{1} << bucket;
+  }
+
+  /** @return sum of all latencies in microseconds. */
+  Type sum_us() const noexcept { return Counter::total(m_sum_us); }
+
+ private:
+  /** Number of latencies in each bucket. */
+  std::array<Shards<N_SHARDS>, N_BUCKETS> m_buckets{};
+
+  /** Sum of all latencies in microseconds. */
+  Shards<N_SHARDS> m_sum_us{};
+};
 }  // namespace Counter
 
 #endif /* ut0counter_h */
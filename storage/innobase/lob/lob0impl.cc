@@ -25,6 +25,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 *****************************************************************************/
 
 #include "lob0impl.h"
+#include "buf0rea.h"
 #include "lob0del.h"
 #include "lob0index.h"
 #include "lob0inf.h"
@@ -1157,9 +1158,34 @@ ulint read(ReadContext *ctx, ref_t ref, ulint offset, ulint len, byte *buf) {
   const ulint commit_freq = 10;
   ulint data_pages_count = 0;
 
+  /* When reading many data pages, issue asynchronous reads for the data
+  pages of the next entries of the index list, so that the reads of the
+  data pages overlap instead of being done one at a time. Older versions
+  of the entries are not read ahead. */
+  const ulint read_ahead_pages = 8;
+  const bool read_ahead = want > read_ahead_pages * ctx->m_page_size.physical();
+  index_entry_t ahead_entry(&mtr, ctx->m_index);
+  fil_addr_t ahead_loc = node_loc;
+  /* Number of entries, from the current one, whose page was read ahead. */
+  ulint n_ahead = 0;
+
   while (!fil_addr_is_null(node_loc) && want > 0) {
     old_version.reset(nullptr);
 
+    for (; read_ahead && n_ahead < read_ahead_pages &&
+           !fil_addr_is_null(ahead_loc);
+         ++n_ahead) {
+      ahead_entry.reset(first_page.addr2ptr_s_cache(cached_blocks, ahead_loc));
+      const page_no_t ahead_page_no = ahead_entry.get_page_no();
+      const page_id_t ahead_page_id(ctx->m_space_id, ahead_page_no);
+
+      if (ahead_page_no != FIL_NULL && ahead_page_no != first_page_no &&
+          !buf_page_peek(ahead_page_id)) {
+        buf_read_page_background(ahead_page_id, ctx->m_page_size, false);
+      }
+      ahead_loc = ahead_entry.get_next();
+    }
+
     node = first_page.addr2ptr_s_cache(cached_blocks, node_loc);
     cur_entry.reset(node);
 
@@ -1230,6 +1256,10 @@ ulint read(ReadContext *ctx, ref_t ref, ulint offset, ulint len, byte *buf) {
     total_read += actual_read;
     page_offset = 0;
     node_loc = cur_entry.get_next();
+
+    if (n_ahead > 0) {
+      --n_ahead;
+    }
   }
 
   /* Assert that we have read what has been requested or what is
@@ -2371,30 +2371,38 @@ static void lock_rec_grant(lock_t *in_lock) {
   case, that there are no WAITING locks, and in such situation iterating over
   all bits, and calling lock_rec_grant_by_heap_no() slows down the execution
   noticeably. (I guess that checking bits is not the costly part, but rather the
-  allocation of vectors inside lock_rec_grant_by_heap_no). Therefore we first
-  check if there is any lock which is waiting at all.
-  Note: This condition could be further narrowed to check if the `lock` is
-  waiting for the `in_lock` and/or `lock->trx` is blocked by the `in_lock->trx`,
-  and we could optimize lock_rec_grant_by_heap_no() to allocate vectors only if
-  there are at least two waiters to arbitrate among, but in practice the current
-  simple heuristic is good enough. */
-  bool found_waiter = false;
+  allocation of vectors inside lock_rec_grant_by_heap_no).
+  Moreover, lock_rec_grant_by_heap_no() scans the whole queue of the record,
+  but only considers the waiting locks which are blocked by in_lock->trx. On a
+  hot page, where in_lock covers many records and the queues are long, calling
+  it for each bit of in_lock means scanning the locks of the page once per
+  record. Therefore we first collect, in a single pass over the locks on the
+  page, the records on which some lock is waiting for in_lock->trx. A WAITING
+  lock is always for a single record. */
+  const auto in_trx = in_lock->trx;
+  const auto n_bits = lock_rec_get_n_bits(in_lock);
+  ut::vector<ulint> heap_nos;
   for (auto lock = lock_rec_get_first_on_page_addr(lock_hash, page_id);
        lock != nullptr; lock = lock_rec_get_next_on_page(lock)) {
-    if (lock->is_waiting()) {
-      found_waiter = true;
-      break;
+    if (!lock->is_waiting() ||
+        lock->trx->lock.blocking_trx.load(std::memory_order_relaxed) !=
+            in_trx) {
+      continue;
+    }
+    const auto heap_no = lock_rec_find_set_bit(lock);
+    ut_ad(heap_no != ULINT_UNDEFINED);
+    if (heap_no < n_bits && lock_rec_get_nth_bit(in_lock, heap_no)) {
+      heap_nos.push_back(heap_no);
     }
   }
-  if (found_waiter) {
-    mon_type_t grant_attempts = 0;
-    for (ulint heap_no = 0; heap_no < lock_rec_get_n_bits(in_lock); ++heap_no) {
-      if (lock_rec_get_nth_bit(in_lock, heap_no)) {
-        lock_rec_grant_by_heap_no(in_lock, heap_no);
-        ++grant_attempts;
-      }
+  if (!heap_nos.empty()) {
+    std::sort(heap_nos.begin(), heap_nos.end());
+    heap_nos.erase(std::unique(heap_nos.begin(), heap_nos.end()),
+                   heap_nos.end());
+    for (const auto heap_no : heap_nos) {
+      lock_rec_grant_by_heap_no(in_lock, heap_no);
     }
-    MONITOR_INC_VALUE(MONITOR_RECLOCK_GRANT_ATTEMPTS, grant_attempts);
+    MONITOR_INC_VALUE(MONITOR_RECLOCK_GRANT_ATTEMPTS, heap_nos.size());
   }
   MONITOR_INC(MONITOR_RECLOCK_RELEASE_ATTEMPTS);
 }
@@ -4105,6 +4113,18 @@ static bool lock_release_read_lock(lock_t *lock, bool only_gap) {
   }
 }
 
+/** Used to release a lock of a transaction whose commit has been decided, see
+lock_trx_release_rec_locks_early().
+@param[in]   lock       the lock that we consider releasing
+@return true iff the function did release the lock */
+static bool lock_release_rec_lock_early(lock_t *lock) {
+  if (!lock->is_record_lock() || lock->is_predicate()) {
+    return false;
+  }
+  lock_rec_dequeue_from_page(lock);
+  return true;
+}
+
 namespace locksys {
 
 /** A helper function which solves a chicken-and-egg problem occurring when one
@@ -4157,16 +4177,18 @@ starve threads waiting for X-latch on it such as lock_wait_timeout_thread().
 This defines the longest allowed critical section duration. */
 constexpr auto MAX_CS_DURATION = std::chrono::seconds{1};
 
-/** Tries to release read locks of a transaction without latching the whole
-lock sys. This may fail, if there are many concurrent threads editing the
+/** Tries to release some record locks of a transaction without latching the
+whole lock sys. This may fail, if there are many concurrent threads editing the
 list of locks of this transaction (for example due to B-tree pages being
 merged or split, or due to implicit-to-explicit conversion).
 It is called during XA prepare to release locks early.
 @param[in,out]  trx             transaction
-@param[in]      only_gap        release only GAP locks
+@param[in]      release         called for each lock with the shard latched,
+                                returns true if it released (a part of) it
 @return true if and only if it succeeded to do the job*/
-[[nodiscard]] static bool try_release_read_locks_in_s_mode(trx_t *trx,
-                                                           bool only_gap) {
+template <typename F>
+[[nodiscard]] static bool try_release_rec_locks_in_s_mode(trx_t *trx,
+                                                          F &&release) {
   /* In order to access trx->lock.trx_locks safely we need to hold trx->mutex.
   So, conceptually we'd love to hold trx->mutex while iterating through
   trx->lock.trx_locks.
@@ -4197,13 +4219,13 @@ It is called during XA prepare to release locks early.
     page_no, and next pointer, which, as long as we hold trx->mutex, should be
     immutable.
     */
-    const auto release_read_lock = [lock, only_gap, &made_progress]() {
+    const auto release_rec_lock = [lock, &release, &made_progress]() {
       /* Note: The |= does not short-circut. We want the RHS called.*/
-      made_progress |= lock_release_read_lock(lock, only_gap);
+      made_progress |= release(lock);
     };
     if (lock_get_type_low(lock) == LOCK_REC) {
       /* Following call temporarily releases trx->mutex */
-      if (!try_relatch_trx_and_shard_and_do(lock, release_read_lock) ||
+      if (!try_relatch_trx_and_shard_and_do(lock, release_rec_lock) ||
           (made_progress && shared_latch_guard.is_x_blocked_by_us())) {
         /* Someone has modified the list while we were re-acquiring the latches,
         or someone is waiting for x-latch and we've already made some progress,
@@ -4219,14 +4241,16 @@ It is called during XA prepare to release locks early.
   return true;
 }
 
-/** Release read locks of a transaction latching the whole lock-sys in
+/** Release some record locks of a transaction latching the whole lock-sys in
 exclusive mode, which is a bit too expensive to do by default.
 It is called during XA prepare to release locks early.
 @param[in,out]  trx             transaction
-@param[in]      only_gap        release only GAP locks
+@param[in]      release         called for each lock, see
+                                try_release_rec_locks_in_s_mode()
 @return true if and only if it succeeded to do the job*/
-[[nodiscard]] static bool try_release_read_locks_in_x_mode(trx_t *trx,
-                                                           bool only_gap) {
+template <typename F>
+[[nodiscard]] static bool try_release_rec_locks_in_x_mode(trx_t *trx,
+                                                          F &&release) {
   ut_ad(!trx_mutex_own(trx));
   /* We will iterate over locks from various shards. */
   Global_exclusive_latch_guard guard{UT_LOCATION_HERE};
@@ -4240,30 +4264,56 @@ It is called during XA prepare to release locks early.
     }
     DEBUG_SYNC_C("lock_trx_release_read_locks_in_x_mode_will_release");
 
-    lock_release_read_lock(lock, only_gap);
+    release(lock);
   }
 
   trx_mutex_exit(trx);
   return true;
 }
-}  // namespace locksys
 
-void lock_trx_release_read_locks(trx_t *trx, bool only_gap) {
+/** Releases the record locks of a transaction for which release returns true,
+first trying to do it with the shared global latch, and then with the
+exclusive one.
+@param[in,out]  trx             transaction
+@param[in]      release         see try_release_rec_locks_in_s_mode() */
+template <typename F>
+static void release_rec_locks(trx_t *trx, F &&release) {
   ut_ad(trx_can_be_handled_by_current_thread(trx));
 
   const size_t MAX_FAILURES = 5;
 
   for (size_t failures = 0; failures < MAX_FAILURES; ++failures) {
-    if (locksys::try_release_read_locks_in_s_mode(trx, only_gap)) {
+    if (try_release_rec_locks_in_s_mode(trx, release)) {
       return;
     }
     std::this_thread::yield();
   }
 
-  while (!locksys::try_release_read_locks_in_x_mode(trx, only_gap)) {
+  while (!try_release_rec_locks_in_x_mode(trx, release)) {
     std::this_thread::yield();
   }
 }
+}  // namespace locksys
+
+void lock_trx_release_read_locks(trx_t *trx, bool only_gap) {
+  locksys::release_rec_locks(trx, [only_gap](lock_t *lock) {
+    return lock_release_read_lock(lock, only_gap);
+  });
+}
+
+void lock_trx_release_rec_locks_early(trx_t *trx) {
+  ut_ad(trx_state_eq(trx, TRX_STATE_PREPARED));
+
+  /* Setting the flag under trx->mutex orders it with
+  lock_rec_convert_impl_to_expl_for_trx(): a conversion either sees it and
+  creates no lock, or it has created the lock already and we release it
+  below. */
+  trx_mutex_enter(trx);
+  trx->lock.released_early.store(true);
+  trx_mutex_exit(trx);
+
+  locksys::release_rec_locks(trx, lock_release_rec_lock_early);
+}
 
 namespace locksys {
 /** Releases transaction locks, and releases possible other transactions waiting
@@ -5093,7 +5143,7 @@ static void rec_queue_validate_latched(const buf_block_t *block,
     trx_sys->latch_and_execute_with_active_trx(
         trx_id,
         [&](const trx_t *impl_trx) {
-          if (impl_trx != nullptr) {
+          if (impl_trx != nullptr && !impl_trx->lock.released_early.load()) {
             ut_ad(owns_page_shard(block->get_page_id()));
             /* impl_trx cannot become TRX_STATE_COMMITTED_IN_MEMORY nor removed
             from active_rw_trxs.by_id until we release Trx_shard's mutex, which
@@ -5481,7 +5531,9 @@ static void lock_rec_convert_impl_to_expl_for_trx(
 
     ut_ad(!trx_state_eq(trx, TRX_STATE_NOT_STARTED));
 
+    /* A trx which released its locks early lets others modify its rows. */
     if (!trx_state_eq(trx, TRX_STATE_COMMITTED_IN_MEMORY) &&
+        !trx->lock.released_early.load() &&
         !lock_rec_has_expl(LOCK_X | LOCK_REC_NOT_GAP, block, heap_no, trx)) {
       ulint type_mode;
 
@@ -5521,7 +5573,8 @@ void lock_rec_convert_impl_to_expl(const buf_block_t *block, const rec_t *rec,
     trx = lock_sec_rec_some_has_impl(rec, index, offsets);
     if (trx) {
       DEBUG_SYNC_C("lock_rec_convert_impl_to_expl_will_validate");
-      ut_ad(!lock_rec_other_trx_holds_expl(LOCK_S | LOCK_REC_NOT_GAP, trx, rec,
+      ut_ad(trx->lock.released_early.load() ||
+            !lock_rec_other_trx_holds_expl(LOCK_S | LOCK_REC_NOT_GAP, trx, rec,
                                            block));
     }
   }
@@ -6182,6 +6235,7 @@ void lock_trx_release_locks(trx_t *trx) /*!< in/out: transaction */
   impossible even if the above reasoning was wrong. */
   trx_mutex_enter(trx);
   trx->lock.n_rec_locks.store(0);
+  trx->lock.released_early.store(false);
 
   ut_a(UT_LIST_GET_LEN(trx->lock.trx_locks) == 0);
   ut_a(ib_vector_is_empty(trx->lock.autoinc_locks));
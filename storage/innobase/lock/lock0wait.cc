@@ -34,6 +34,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
 #include <mysql/service_thd_wait.h>
 #include <sys/types.h>
+#include <thread>
 
 #include "ha_prototypes.h"
 #include "lock0lock.h"
@@ -324,6 +325,7 @@ void lock_wait_suspend_thread(que_thr_t *thr) {
     srv_stats.n_lock_wait_time.add(
         std::chrono::duration_cast<std::chrono::microseconds>(diff_time)
             .count());
+    srv_stats.row_lock_wait_latency.add(diff_time);
 
     if (diff_time > lock_sys->n_lock_max_wait_time) {
       lock_sys->n_lock_max_wait_time = diff_time;
@@ -554,7 +556,15 @@ static void lock_wait_check_slots_for_timeouts() {
   lock_wait_mutex_exit();
 }
 
-/** Takes a snapshot of the content of slots which are in use
+/** The number of slots lock_wait_snapshot_waiting_threads() looks at before
+it lets other threads acquire lock_wait_mutex. */
+static constexpr size_t LOCK_WAIT_SNAPSHOT_CHUNK_SIZE = 256;
+
+/** Takes a snapshot of the content of slots which are in use. The slots are
+looked at in chunks of LOCK_WAIT_SNAPSHOT_CHUNK_SIZE, and lock_wait_mutex is
+released between the chunks, so the snapshot is not consistent: a transaction
+which moved to another slot meanwhile may appear twice, see
+lock_wait_build_wait_for_graph().
 @param[out]   infos   Will contain the information about slots which are in use
 @return value of lock_wait_table_reservations before taking the snapshot
 */
@@ -570,26 +580,33 @@ static uint64_t lock_wait_snapshot_waiting_threads(
   keep the lock_wait_mutex too long.
   Anything more fancy than push_back seems to impact performance.
 
-  Note: one should be able to prove that we don't really need a "consistent"
-  snapshot - the algorithm should still work if we split the loop into several
-  smaller "chunks" snapshotted independently and stitch them together. Care must
-  be taken to "merge" duplicates keeping the freshest version (reservation_no)
-  of slot for each trx.
-  So, if (in future) this loop turns out to be a bottleneck (say, by increasing
-  congestion on lock_wait_mutex), one can try to release and require the lock
-  every X iterations and modify the lock_wait_build_wait_for_graph() to handle
-  duplicates in a smart way.
+  We don't really need a "consistent" snapshot - the algorithm works if we split
+  the loop into several smaller "chunks" snapshotted independently and stitch
+  them together, because each candidate cycle is verified against the current
+  content of the slots before we act on it. With thousands of waiting threads a
+  single pass would keep every thread which starts or ends a wait blocked on
+  lock_wait_mutex for the whole pass, so we release it after each chunk. The
+  duplicates this may cause are merged in lock_wait_build_wait_for_graph(),
+  keeping the freshest version (reservation_no) of slot for each trx.
   */
   const auto table_reservations = lock_wait_table_reservations;
-  for (auto slot = lock_sys->waiting_threads; slot < lock_sys->last_slot;
-       ++slot) {
-    if (slot->in_use) {
-      auto from = thr_get_trx(slot->thr);
-      auto to = from->lock.blocking_trx.load();
-      if (to != nullptr) {
-        infos.push_back({from, to, slot, slot->reservation_no});
+  auto slot = lock_sys->waiting_threads;
+  while (slot < lock_sys->last_slot) {
+    const auto chunk_end = slot + LOCK_WAIT_SNAPSHOT_CHUNK_SIZE;
+    for (; slot < lock_sys->last_slot && slot < chunk_end; ++slot) {
+      if (slot->in_use) {
+        auto from = thr_get_trx(slot->thr);
+        auto to = from->lock.blocking_trx.load();
+        if (to != nullptr) {
+          infos.push_back({from, to, slot, slot->reservation_no});
+        }
       }
     }
+    if (slot < lock_sys->last_slot) {
+      lock_wait_mutex_exit();
+      std::this_thread::yield();
+      lock_wait_mutex_enter();
+    }
   }
   lock_wait_mutex_exit();
   return table_reservations;
@@ -648,12 +665,6 @@ transactions, such that for each waiter we have one outgoing edge.
                         waiting is not among transactions in infos[].trx. */
 static void lock_wait_build_wait_for_graph(
     ut::vector<waiting_trx_info_t> &infos, ut::vector<int> &outgoing) {
-  /** We are going to use int and uint to store positions within infos */
-  ut_ad(infos.size() < std::numeric_limits<uint>::max());
-  const auto n = static_cast<uint>(infos.size());
-  ut_ad(n < static_cast<uint>(std::numeric_limits<int>::max()));
-  outgoing.clear();
-  outgoing.resize(n, -1);
   /* This particular implementation sorts infos by ::trx, and then uses
   lower_bound to find index in infos corresponding to ::wait_for, which has
   O(nlgn) complexity and modifies infos, but has a nice property of avoiding any
@@ -668,6 +679,26 @@ static void lock_wait_build_wait_for_graph(
   2 * srv_max_n_threads buckets. This however did not increase transactions per
   second, so introducing a custom implementation seems unjustified here. */
   sort(infos.begin(), infos.end());
+  /* The snapshot was taken in chunks, so a trx which left its slot and reserved
+  another one meanwhile can appear twice. Only the latest reservation may still
+  be valid, so keep the entry with the largest reservation_no. */
+  size_t n_unique = 0;
+  for (size_t i = 0; i < infos.size(); ++i) {
+    if (n_unique > 0 && infos[n_unique - 1].trx == infos[i].trx) {
+      if (infos[n_unique - 1].reservation_no < infos[i].reservation_no) {
+        infos[n_unique - 1] = infos[i];
+      }
+      continue;
+    }
+    infos[n_unique++] = infos[i];
+  }
+  infos.resize(n_unique);
+  /** We are going to use int and uint to store positions within infos */
+  ut_ad(infos.size() < std::numeric_limits<uint>::max());
+  const auto n = static_cast<uint>(infos.size());
+  ut_ad(n < static_cast<uint>(std::numeric_limits<int>::max()));
+  outgoing.clear();
+  outgoing.resize(n, -1);
   waiting_trx_info_t needle{};
   for (uint from = 0; from < n; ++from) {
     /* Assert that the order used by sort and lower_bound depends only on the
@@ -1408,6 +1439,7 @@ static void lock_wait_update_schedule_and_check_for_deadlocks() {
   bottleneck, one can check if declaring this vectors as static solves the
   issue.
   */
+  const auto started_at = std::chrono::steady_clock::now();
   ut::vector<waiting_trx_info_t> infos;
   ut::vector<int> outgoing;
   ut::vector<trx_schedule_weight_t> new_weights;
@@ -1423,6 +1455,8 @@ static void lock_wait_update_schedule_and_check_for_deadlocks() {
     /* This will also update trx->lock.schedule_weight for trxs on cycles. */
     lock_wait_find_and_handle_deadlocks(infos, outgoing, new_weights);
   }
+
+  MONITOR_INC_TIME(MONITOR_DEADLOCK_CHECK_MICROSECOND, started_at);
 }
 
 /** A thread which wakes up threads whose lock wait may have lasted too long,
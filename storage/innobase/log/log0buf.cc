@@ -47,6 +47,12 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
 /* std::memcpy */
 #include <cstring>
 
+/* std::hash */
+#include <functional>
+
+/* std::this_thread */
+#include <thread>
+
 /* Log_handle, ... */
 #include "log0buf.h"
 
@@ -123,6 +129,16 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
 
     where _len_ is number of data bytes we need to write.
 
+    When innodb_log_reserve_combining is ON, threads which reserve at the
+    same time are grouped in log.reserve_slots, and a single fetch_add is
+    done by the first thread of each group for all of its members. Each
+    member then gets its part:
+
+         start_sn = group_start_sn + len of members which joined before
+
+    This way the cache line of log.sn is not bounced between all the CPUs
+    committing mini-transactions.
+
     Then range of sn values is translated to range of lsn values:
 
          start_lsn = log_translate_sn_to_lsn(start_sn)
@@ -523,6 +539,100 @@ static inline void log_buffer_s_lock_wait(log_t &log, const sn_t start_sn) {
   }
 }
 
+/** Number of pause instructions a leader of a group in log.reserve_slots
+waits for others to join, when the slot was found busy recently. */
+constexpr size_t LOG_RESERVE_LEADER_SPINS = 30;
+
+/** Reserves space in the sequence of data bytes, together with the other
+threads using the same slot of log.reserve_slots at the same time, with a
+single update of log.sn done by the leader of the group. Threads which find
+the slot busy advance log.sn on their own.
+
+A thread which modifies a page after another one committed its changes to
+it, reserves after the group of the other thread was closed, so it gets a
+larger sn than the other thread, as when log.sn is advanced directly.
+@param[in,out] log     redo log
+@param[in]     len     number of data bytes to reserve for write
+@return start sn of reserved, with SN_LOCKED set if log.sn was x-locked */
+static inline sn_t log_buffer_reserve_combined(log_t &log, size_t len) {
+  thread_local const size_t slot_no =
+      std::hash<std::thread::id>{}(std::this_thread::get_id()) %
+      LOG_RESERVE_N_SLOTS;
+
+  auto &slot = log.reserve_slots[slot_no];
+
+  constexpr uint64_t MEMBER = 1ULL << Log_reserve_slot::N_MEMBERS_SHIFT;
+
+  uint64_t state = slot.m_state.load(std::memory_order_relaxed);
+  uint64_t offset;
+  bool is_leader;
+
+  for (;;) {
+    if (state == 0) {
+      if (slot.m_state.compare_exchange_weak(state, MEMBER + len,
+                                             std::memory_order_acq_rel)) {
+        is_leader = true;
+        offset = 0;
+        break;
+      }
+    } else if ((state & Log_reserve_slot::CLOSED) == 0 &&
+               (state >> Log_reserve_slot::N_MEMBERS_SHIFT) <
+                   Log_reserve_slot::MAX_MEMBERS &&
+               (state & Log_reserve_slot::LEN_MASK) + len <=
+                   Log_reserve_slot::LEN_MASK) {
+      if (slot.m_state.compare_exchange_weak(state, state + MEMBER + len,
+                                             std::memory_order_acq_rel)) {
+        is_leader = false;
+        offset = state & Log_reserve_slot::LEN_MASK;
+        break;
+      }
+    } else {
+      /* The group is being served or is full, do not wait for it. */
+      slot.m_n_missed.fetch_add(1, std::memory_order_relaxed);
+      return log.sn.fetch_add(len);
+    }
+  }
+
+  if (is_leader) {
+    if (slot.m_n_missed.load(std::memory_order_relaxed) != 0) {
+      /* There are more threads using the slot than it can serve one by
+      one. Give them a chance to join the group. */
+      slot.m_n_missed.store(0, std::memory_order_relaxed);
+      for (size_t i = 0; i < LOG_RESERVE_LEADER_SPINS; ++i) {
+        UT_RELAX_CPU();
+      }
+    }
+
+    /* Close the group, keeping only the number of its members. */
+    state = slot.m_state.load(std::memory_order_relaxed);
+    while (!slot.m_state.compare_exchange_weak(
+        state,
+        Log_reserve_slot::CLOSED | (state >> Log_reserve_slot::N_MEMBERS_SHIFT),
+        std::memory_order_acq_rel)) {
+    }
+
+    const sn_t start_sn =
+        log.sn.fetch_add(state & Log_reserve_slot::LEN_MASK);
+    ut_a((start_sn & ~SN_LOCKED) > 0);
+
+    slot.m_start_sn.store(start_sn, std::memory_order_release);
+  }
+
+  sn_t start_sn;
+  while ((start_sn = slot.m_start_sn.load(std::memory_order_acquire)) == 0) {
+    UT_RELAX_CPU();
+  }
+
+  /* The last member which takes its part frees the slot. */
+  if (slot.m_state.fetch_sub(1, std::memory_order_acq_rel) ==
+      (Log_reserve_slot::CLOSED | 1)) {
+    slot.m_start_sn.store(0, std::memory_order_relaxed);
+    slot.m_state.store(0, std::memory_order_release);
+  }
+
+  return start_sn + offset;
+}
+
 /** Acquires the log buffer s-lock.
 And reserve space in the log buffer.
 The corresponding unlock operation is adding link to log.recent_closed.
@@ -544,7 +654,10 @@ static inline sn_t log_buffer_s_lock_enter_reserve(log_t &log, size_t len) {
 #endif /* UNIV_PFS_RWLOCK */
 
   /* Reserve space in sequence of data bytes: */
-  sn_t start_sn = log.sn.fetch_add(len);
+  sn_t start_sn =
+      srv_log_reserve_combining && len <= LOG_RESERVE_COMBINE_MAX_LEN
+          ? log_buffer_reserve_combined(log, len)
+          : log.sn.fetch_add(len);
   if (UNIV_UNLIKELY((start_sn & SN_LOCKED) != 0)) {
     start_sn &= ~SN_LOCKED;
     /* log.sn is locked. Should wait for unlocked. */
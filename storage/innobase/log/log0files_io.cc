@@ -31,6 +31,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
 
 #ifndef WIN32
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <unistd.h>
 #else
 #include <windows.h>
@@ -75,6 +76,13 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
 /* srv_redo_log_encrypt */
 #include "srv0srv.h"
 
+#if defined(__x86_64__) && defined(MAP_SYNC) && defined(MAP_SHARED_VALIDATE)
+/* _mm_stream_si64, _mm_sfence */
+#include <emmintrin.h>
+
+#define LOG_PMEM_SUPPORTED
+#endif /* __x86_64__ && MAP_SYNC && MAP_SHARED_VALIDATE */
+
 Log_checksum_algorithm_atomic_ptr log_checksum_algorithm_ptr;
 
 bool log_header_checksum_is_ok(const byte *buf) {
@@ -181,6 +189,29 @@ std::atomic<size_t> Log_file_handle::s_n_open{0};
 std::atomic<uint64_t> Log_file_handle::s_total_fsyncs{0};
 std::atomic<uint64_t> Log_file_handle::s_fsyncs_in_progress{0};
 
+#ifdef LOG_PMEM_SUPPORTED
+/** Copies data to persistent memory with non-temporal stores, which bypass
+the CPU caches, so when the final store fence is done, the data has reached
+the persistence domain and no cache line needs to be written back.
+@param[out]  dst  destination in a file mapped with MAP_SYNC
+@param[in]   src  data to copy
+@param[in]   len  number of bytes to copy, multiple of 8 */
+static void log_pmem_copy(byte *dst, const byte *src, size_t len) {
+  ut_ad(reinterpret_cast<uintptr_t>(dst) % sizeof(long long) == 0);
+  ut_ad(len % sizeof(long long) == 0);
+
+  auto *to = reinterpret_cast<long long *>(dst);
+
+  for (size_t i = 0; i < len / sizeof(long long); ++i) {
+    long long word;
+    memcpy(&word, src + i * sizeof(long long), sizeof(long long));
+    _mm_stream_si64(to + i, word);
+  }
+
+  _mm_sfence();
+}
+#endif /* LOG_PMEM_SUPPORTED */
+
 Log_file_handle::Log_file_handle(Encryption_metadata &encryption_metadata)
     : m_file_id{},
       m_access_mode{},
@@ -188,6 +219,7 @@ Log_file_handle::Log_file_handle(Encryption_metadata &encryption_metadata)
       m_file_type{},
       m_is_open{},
       m_is_modified{},
+      m_pmem{},
       m_file_path{},
       m_raw_handle{},
       m_block_size{},
@@ -200,12 +232,14 @@ Log_file_handle::Log_file_handle(Log_file_handle &&other)
       m_file_type{other.m_file_type},
       m_is_open{other.m_is_open},
       m_is_modified{other.m_is_modified},
+      m_pmem{other.m_pmem},
       m_file_path{other.m_file_path},
       m_raw_handle{other.m_raw_handle},
       m_block_size{other.m_block_size},
       m_file_size{other.m_file_size} {
   other.m_is_modified = false;
   other.m_is_open = false;
+  other.m_pmem = nullptr;
   other.m_raw_handle = {};
 }
 
@@ -226,6 +260,8 @@ Log_file_handle &Log_file_handle::operator=(Log_file_handle &&rhs) {
   rhs.m_is_modified = false;
   m_is_open = rhs.m_is_open;
   rhs.m_is_open = false;
+  m_pmem = rhs.m_pmem;
+  rhs.m_pmem = nullptr;
   m_raw_handle = rhs.m_raw_handle;
   rhs.m_raw_handle = {};
   return *this;
@@ -241,6 +277,7 @@ Log_file_handle::Log_file_handle(const Log_files_context &ctx, Log_file_id id,
       m_file_type(file_type),
       m_is_open(false),
       m_is_modified(false),
+      m_pmem(nullptr),
       m_file_path(file_type == Log_file_type::UNUSED
                       ? log_file_path_for_unused_file(ctx, id)
                       : log_file_path(ctx, id)) {
@@ -280,6 +317,9 @@ dberr_t Log_file_handle::open() {
       os_file_create(innodb_log_file_key, m_file_path.c_str(), OS_FILE_OPEN,
                      OS_FILE_NORMAL, OS_LOG_FILE, read_only, &m_is_open);
   if (m_is_open) {
+    if (srv_log_pmem && !read_only && m_file_type == Log_file_type::NORMAL) {
+      pmem_map();
+    }
     return DB_SUCCESS;
   }
 
@@ -287,8 +327,57 @@ dberr_t Log_file_handle::open() {
   return DB_ERROR;
 }
 
+void Log_file_handle::pmem_map() {
+  ut_ad(is_open());
+  ut_ad(m_pmem == nullptr);
+
+#ifdef LOG_PMEM_SUPPORTED
+  if (m_file_size == 0) {
+    return;
+  }
+
+  /* MAP_SYNC is refused unless the file is on a DAX file system, and
+  guarantees that the file system metadata needed to reach the written
+  data is durable, before a page fault on the mapping is resolved. */
+  void *const ptr =
+      mmap(nullptr, m_file_size, PROT_READ | PROT_WRITE,
+           MAP_SHARED_VALIDATE | MAP_SYNC, m_raw_handle.m_file, 0);
+
+  if (ptr == MAP_FAILED) {
+    static bool warned = false;
+    if (!warned) {
+      warned = true;
+      ib::warn(ER_IB_MSG_829)
+          << "innodb_log_pmem is ON, but the redo log file " << m_file_path
+          << " cannot be mapped with MAP_SYNC (" << strerror(errno)
+          << "). Redo log files are written with write() and fsync().";
+    }
+    return;
+  }
+
+  m_pmem = static_cast<byte *>(ptr);
+#else
+  static bool warned = false;
+  if (!warned) {
+    warned = true;
+    ib::warn(ER_IB_MSG_829) << "innodb_log_pmem is not supported on this"
+                               " platform and is ignored.";
+  }
+#endif /* LOG_PMEM_SUPPORTED */
+}
+
+void Log_file_handle::pmem_unmap() {
+#ifdef LOG_PMEM_SUPPORTED
+  if (m_pmem != nullptr) {
+    munmap(m_pmem, m_file_size);
+    m_pmem = nullptr;
+  }
+#endif /* LOG_PMEM_SUPPORTED */
+}
+
 void Log_file_handle::close() {
   ut_ad(is_open());
+  pmem_unmap();
   if (m_is_modified) {
     fsync();
     m_is_modified = false;
@@ -309,6 +398,11 @@ void Log_file_handle::fsync() {
     return;
   }
 
+  if (m_pmem != nullptr && !m_is_modified) {
+    /* Everything has been written through the mapping and is durable. */
+    return;
+  }
+
   s_total_fsyncs.fetch_add(1, std::memory_order_relaxed);
   s_fsyncs_in_progress.fetch_add(1);
 
@@ -381,6 +475,14 @@ dberr_t Log_file_handle::write(os_offset_t write_offset, os_offset_t write_size,
     s_on_before_write(m_file_id, m_file_type, write_offset, write_size);
   }
 
+#ifdef LOG_PMEM_SUPPORTED
+  if (m_pmem != nullptr && !io_request.is_encrypted()) {
+    ut_a(write_offset + write_size <= m_file_size);
+    log_pmem_copy(m_pmem + write_offset, buf, write_size);
+    return DB_SUCCESS;
+  }
+#endif /* LOG_PMEM_SUPPORTED */
+
   m_is_modified = true;
 
   return os_file_write(io_request, m_file_path.c_str(), m_raw_handle, buf,
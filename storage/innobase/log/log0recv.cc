@@ -37,6 +37,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <sys/types.h>
 
 #include <array>
+#include <atomic>
 #include <iomanip>
 #include <map>
 #include <new>
@@ -201,6 +202,7 @@ static lsn_t recv_max_page_lsn;
 #ifndef UNIV_HOTBACKUP
 #ifdef UNIV_PFS_THREAD
 mysql_pfs_key_t recv_writer_thread_key;
+mysql_pfs_key_t recv_apply_thread_key;
 #endif /* UNIV_PFS_THREAD */
 
 static bool recv_writer_is_active() {
@@ -1114,6 +1116,92 @@ static void recv_apply_log_rec(recv_addr_t *recv_addr) {
   }
 }
 
+/** Pages with redo log records, applied by a single thread. */
+using Recv_pages = ut::vector<recv_addr_t *>;
+
+/** Reports the progress of applying a batch of redo log records to the
+error log. */
+class Recv_apply_progress {
+ public:
+  /** Constructor.
+  @param[in]  batch_size  number of pages in the batch */
+  explicit Recv_apply_progress(size_t batch_size) : m_batch_size(batch_size) {
+    m_unit = batch_size / PCT;
+    if (m_unit <= PCT) {
+      m_pct = 100;
+      m_unit = batch_size;
+    }
+    m_next = m_unit;
+  }
+
+  /** Reports the progress, if another PCT percent of the pages have been
+  processed, or nothing has been reported for PRINT_INTERVAL.
+  @param[in]  applied  number of pages processed so far */
+  void report(size_t applied) {
+    if (m_unit != 0 && applied >= m_next) {
+      size_t pct;
+
+      do {
+        pct = m_pct;
+        m_pct += PCT;
+        m_next += m_unit;
+      } while (applied >= m_next);
+
+      ib::info(ER_IB_MSG_708) << pct << "%";
+
+      m_start_time = std::chrono::steady_clock::now();
+
+    } else if (std::chrono::steady_clock::now() - m_start_time >=
+               PRINT_INTERVAL) {
+      m_start_time = std::chrono::steady_clock::now();
+
+      ib::info(ER_IB_MSG_709)
+          << std::setprecision(2)
+          << ((double)applied * 100) / (double)m_batch_size << "%";
+    }
+  }
+
+ private:
+  static constexpr size_t PCT = 10;
+
+  const size_t m_batch_size;
+
+  size_t m_pct{PCT};
+
+  /** Number of pages processed per PCT percent. */
+  size_t m_unit;
+
+  /** Number of processed pages at which m_pct is reported. */
+  size_t m_next;
+
+  std::chrono::steady_clock::time_point m_start_time{
+      std::chrono::steady_clock::now()};
+};
+
+/** Applies the redo log records to the pages owned by one thread. Pages
+which are not in the buffer pool are only read in, and the records are
+applied by the IO completion.
+@param[in]      pages     pages to process
+@param[in,out]  applied   incremented for each page processed
+@param[in,out]  progress  progress to report after each page, or nullptr */
+static void recv_apply_pages(const Recv_pages *pages,
+                             std::atomic<size_t> *applied,
+                             Recv_apply_progress *progress) {
+  mutex_enter(&recv_sys->mutex);
+
+  for (auto recv_addr : *pages) {
+    recv_apply_log_rec(recv_addr);
+
+    const size_t n = applied->fetch_add(1, std::memory_order_relaxed) + 1;
+
+    if (progress != nullptr) {
+      progress->report(n);
+    }
+  }
+
+  mutex_exit(&recv_sys->mutex);
+}
+
 void recv_apply_hashed_log_recs(log_t &log, bool allow_ibuf) {
   for (;;) {
     mutex_enter(&recv_sys->mutex);
@@ -1138,18 +1226,12 @@ void recv_apply_hashed_log_recs(log_t &log, bool allow_ibuf) {
 
   ib::info(ER_IB_MSG_707, ulonglong{batch_size});
 
-  static const size_t PCT = 10;
-
-  size_t pct = PCT;
-  size_t applied = 0;
-  auto unit = batch_size / PCT;
-
-  if (unit <= PCT) {
-    pct = 100;
-    unit = batch_size;
-  }
+  const size_t n_threads = std::max<size_t>(
+      1, std::min<size_t>(srv_recovery_apply_threads, batch_size));
 
-  auto start_time = std::chrono::steady_clock::now();
+  /* The pages are divided among the threads by read-ahead areas, so that
+  the pages read in together by recv_read_in_area() have a single owner. */
+  std::vector<Recv_pages> partitions(n_threads);
 
   for (const auto &space : *recv_sys->spaces) {
     bool dropped = false;
@@ -1182,28 +1264,53 @@ void recv_apply_hashed_log_recs(log_t &log, bool allow_ibuf) {
         pages.second->state = RECV_DISCARDED;
       }
 
-      recv_apply_log_rec(pages.second);
+      const auto area = space.first * 31 + pages.first / RECV_READ_AHEAD_AREA;
 
-      ++applied;
+      partitions[area % n_threads].push_back(pages.second);
+    }
+  }
 
-      if (unit == 0 || (applied % unit) == 0) {
-        ib::info(ER_IB_MSG_708) << pct << "%";
+  size_t n_pages = 0;
 
-        pct += PCT;
+  for (const auto &pages : partitions) {
+    n_pages += pages.size();
+  }
 
-        start_time = std::chrono::steady_clock::now();
+  Recv_apply_progress progress{n_pages};
 
-      } else if (std::chrono::steady_clock::now() - start_time >=
-                 PRINT_INTERVAL) {
-        start_time = std::chrono::steady_clock::now();
+  std::atomic<size_t> applied{0};
 
-        ib::info(ER_IB_MSG_709)
-            << std::setprecision(2)
-            << ((double)applied * 100) / (double)batch_size << "%";
-      }
+  mutex_exit(&recv_sys->mutex);
+
+  if (n_threads == 1) {
+    recv_apply_pages(&partitions[0], &applied, &progress);
+
+  } else {
+    ib::info(ER_IB_MSG_829)
+        << "Applying redo log records with " << n_threads << " threads";
+
+    std::vector<IB_thread> threads;
+
+    for (size_t i = 0; i < n_threads; ++i) {
+      threads.emplace_back(os_thread_create(recv_apply_thread_key, i,
+                                            recv_apply_pages, &partitions[i],
+                                            &applied, nullptr));
+      threads.back().start();
+    }
+
+    while (applied.load(std::memory_order_relaxed) < n_pages) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+      progress.report(applied.load(std::memory_order_relaxed));
+    }
+
+    for (auto &thread : threads) {
+      thread.join();
     }
   }
 
+  mutex_enter(&recv_sys->mutex);
+
   /* Wait until all the pages have been processed */
 
   while (recv_sys->n_addrs != 0) {
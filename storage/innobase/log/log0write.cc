@@ -281,6 +281,12 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
  [log flush_notifier thread](@ref sect_redo_log_flush_notifier) using
  os_event_set() on the _flush_notifier_event_.
 
+ When innodb_log_pmem is ON and the current log file is on persistent memory,
+ the log writer thread copies the log blocks to the file mapped with MAP_SYNC
+ using non-temporal stores, which are durable when the copy returns. Then the
+ fsync() is skipped and the log flusher thread only advances the
+ @ref subsect_redo_log_flushed_to_disk_lsn.
+
  @remarks
  Small optimization has been applied - if there was only a single log block
  flushed since the previous flush, then the log flusher thread notifies user
@@ -2453,6 +2459,11 @@ static void log_flush_low(log_t &log) {
     log.last_flush_start_time = log.last_flush_end_time;
   }
 
+  if (do_flush) {
+    srv_stats.log_fsync_latency.add(log.last_flush_end_time -
+                                    log.last_flush_start_time);
+  }
+
   log_sync_point("log_flush_before_flushed_to_disk_lsn");
 
   log.flushed_to_disk_lsn.store(flush_up_to_lsn);
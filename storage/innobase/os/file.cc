@@ -50,6 +50,7 @@ external tools. */
 
 #include <lz4.h>
 #include <zlib.h>
+#include <zstd.h>
 
 /** Convert to a "string".
 @param[in]      type            The compression type
@@ -62,6 +63,8 @@ const char *Compression::to_string(Type type) {
       return ("Zlib");
     case LZ4:
       return ("LZ4");
+    case ZSTD:
+      return ("Zstd");
   }
 
   ut_d(ut_error);
@@ -232,6 +235,24 @@ dberr_t Compression::deserialize(bool dblwr_read, byte *src, byte *dst,
 
       break;
 
+    case Compression::ZSTD: {
+      const size_t zlen = ZSTD_decompress(dst, header.m_original_size, ptr,
+                                          header.m_compressed_size);
+
+      if (ZSTD_isError(zlen)) {
+        if (allocated) {
+          ut::free(dst);
+        }
+
+        return (DB_IO_DECOMPRESS_FAIL);
+      }
+
+      ut_ad(zlen <= len);
+      len = static_cast<ulint>(zlen);
+
+      break;
+    }
+
     default:
 #ifdef UNIV_NO_ERR_MSGS
       ib::error()
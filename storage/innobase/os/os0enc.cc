@@ -1233,7 +1233,6 @@ dberr_t Encryption::decrypt(const IORequest &type, byte *src, ulint src_len,
   ulint remain_len;
   ulint original_type;
   byte remain_buf[MY_AES_BLOCK_SIZE * 2];
-  file::Block *block;
 
   /* If the page is encrypted, then we need key to decrypt it. */
   if (is_encrypted_page(src) && m_type == NONE) {
@@ -1292,14 +1291,8 @@ dberr_t Encryption::decrypt(const IORequest &type, byte *src, ulint src_len,
 
   byte *ptr = src + FIL_PAGE_DATA;
 
-  /* The caller doesn't know what to expect */
-  if (tmp == nullptr) {
-    block = os_alloc_block();
-    tmp = block->m_ptr;
-  } else {
-    ut_a(src_len <= tmp_len);
-    block = nullptr;
-  }
+  /* CBC decryption is done in place, the scratch area is not needed. */
+  ut_a(tmp == nullptr || src_len <= tmp_len);
 
   data_len = src_len - FIL_PAGE_DATA;
   main_len = (data_len / MY_AES_BLOCK_SIZE) * MY_AES_BLOCK_SIZE;
@@ -1319,47 +1312,35 @@ dberr_t Encryption::decrypt(const IORequest &type, byte *src, ulint src_len,
         /* Copy the last 2 blocks. */
         memcpy(remain_buf, ptr + data_len - remain_len, remain_len);
 
+        /* Decrypt them back into place. The bytes after main_len are
+        then plain data and the ones before it are the encrypted tail of
+        the main data. */
         elen = my_aes_decrypt(remain_buf, static_cast<uint32>(remain_len),
-                              tmp + data_len - remain_len, m_key,
+                              ptr + data_len - remain_len, m_key,
                               static_cast<uint32>(m_klen), my_aes_256_cbc, m_iv,
                               false);
 
         if (elen == MY_AES_BAD_DATA) {
-          if (block != nullptr) {
-            os_free_block(block);
-          }
-
           return (DB_IO_DECRYPT_FAIL);
         }
 
         ut_ad(static_cast<ulint>(elen) == remain_len);
-
-        /* Copy the other data bytes to temp area. */
-        memcpy(tmp, ptr, data_len - remain_len);
       } else {
         ut_ad(data_len == main_len);
-
-        /* Copy the data bytes to temp area. */
-        memcpy(tmp, ptr, data_len);
       }
 
-      /* Then decrypt the main data */
-      elen = my_aes_decrypt(tmp, static_cast<uint32>(main_len), ptr, m_key,
+      /* Then decrypt the main data in place, which OpenSSL supports for
+      CBC when the input and output are the same buffer. This avoids
+      copying the page to a scratch area first. */
+      elen = my_aes_decrypt(ptr, static_cast<uint32>(main_len), ptr, m_key,
                             static_cast<uint32>(m_klen), my_aes_256_cbc, m_iv,
                             false);
       if (elen == MY_AES_BAD_DATA) {
-        if (block != nullptr) {
-          os_free_block(block);
-        }
-
         return (DB_IO_DECRYPT_FAIL);
       }
 
       ut_ad(static_cast<ulint>(elen) == main_len);
 
-      /* Copy the remain bytes. */
-      memcpy(ptr + main_len, tmp + main_len, data_len - main_len);
-
       break;
     }
 
@@ -1369,10 +1350,6 @@ dberr_t Encryption::decrypt(const IORequest &type, byte *src, ulint src_len,
             << "Encryption algorithm support missing: " << to_string(m_type);
       }
 
-      if (block != nullptr) {
-        os_free_block(block);
-      }
-
       return (DB_UNSUPPORTED);
   }
 
@@ -1390,10 +1367,6 @@ dberr_t Encryption::decrypt(const IORequest &type, byte *src, ulint src_len,
     mach_write_to_2(src + FIL_PAGE_TYPE, FIL_PAGE_COMPRESSED);
   }
 
-  if (block != nullptr) {
-    os_free_block(block);
-  }
-
 #ifdef UNIV_DEBUG
   {
     /* Check if all the padding bytes are zeroes. */
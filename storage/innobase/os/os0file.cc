@@ -72,11 +72,19 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
 #ifdef LINUX_NATIVE_AIO
 #ifndef UNIV_HOTBACKUP
 #include <libaio.h>
+#ifdef HAVE_LIBURING
+#include <liburing.h>
+#endif /* HAVE_LIBURING */
 #else /* !UNIV_HOTBACKUP */
 #undef LINUX_NATIVE_AIO
 #endif /* !UNIV_HOTBACKUP */
 #endif /* LINUX_NATIVE_AIO */
 
+#if defined(HAVE_LIBURING) && !defined(LINUX_NATIVE_AIO)
+/* io_uring is only used as an alternative to libaio. */
+#undef HAVE_LIBURING
+#endif /* HAVE_LIBURING && !LINUX_NATIVE_AIO */
+
 #ifdef HAVE_FALLOC_PUNCH_HOLE_AND_KEEP_SIZE
 #include <fcntl.h>
 #include <linux/falloc.h>
@@ -84,6 +92,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
 
 #include <errno.h>
 #include <lz4.h>
+#include <zstd.h>
 #include "my_aes.h"
 #include "my_rnd.h"
 #include "mysql/service_mysql_keyring.h"
@@ -283,6 +292,18 @@ The io_handler_thread() thread then collects the completed IO request from the
 segment of 8 * OS_AIO_N_PENDING_IOS_PER_THREAD slots of the array it is
 responsible for with io_getevents() and calls completion routine on it.
 
+io_uring:
+=========
+
+If InnoDB is built with liburing and innodb_use_io_uring is set, each segment
+gets an io_uring instead of a libaio io_context. The slots and the handler
+threads work as above, but a request with IORequest::DO_NOT_WAKE is only
+queued on the ring; it is submitted to the kernel together with the other
+queued requests by os_aio_simulated_wake_handler_threads(), so that for
+example all the data page writes of a doublewrite batch are a single
+submission. os_file_write_and_flush() also uses io_uring, to link a write
+and the fsync after it into one submission.
+
 **********************************************************************/
 
 #ifdef UNIV_PFS_IO
@@ -546,6 +567,53 @@ class AIO {
   [[nodiscard]] static bool linux_create_io_ctx(ulint max_events,
                                                 io_context_t *io_ctx);
 
+#ifdef HAVE_LIBURING
+  /** Accessor for the io_uring of a segment
+  @param[in]    segment Segment for which to get the ring
+  @return the ring, or nullptr if the array uses libaio */
+  [[nodiscard]] io_uring *io_ring(ulint segment) {
+    ut_ad(segment < get_n_segments());
+
+    return (m_rings == nullptr ? nullptr : &m_rings[segment]);
+  }
+
+  /** Queue an AIO request on the io_uring of its segment. The caller must
+  own the mutex.
+  @param[in,out]        slot    an already reserved slot
+  @param[in]    submit  true to submit the queued requests of the segment,
+                        false to leave that to uring_submit_all() */
+  void uring_queue(Slot *slot, bool submit);
+
+  /** Submit the requests queued on the io_uring of a segment. The caller
+  must own the mutex.
+  @param[in]    segment Segment whose requests to submit */
+  void uring_submit(ulint segment);
+
+  /** Submit the requests queued on all the io_urings of all the arrays. */
+  static void uring_submit_all();
+
+  /** Register buffers with all the io_urings, replacing any buffers
+  registered before. See os_aio_register_buffers().
+  @param[in]    buffers Start and length of each buffer */
+  static void uring_register_buffers(const os_aio_buffers_t &buffers);
+
+  /** Unregister the buffers of all the io_urings. */
+  static void uring_unregister_buffers();
+
+  /** Find the registered buffer that a request reads into or writes from.
+  The caller must own the mutex.
+  @param[in]    ptr     Start of the request's buffer
+  @param[in]    len     Length of the request
+  @return index of the registered buffer, or -1 if it is not in one */
+  [[nodiscard]] int uring_buffer_index(const void *ptr, ulint len) const;
+
+  /** Checks if the kernel supports io_uring well enough for us: the
+  handler threads must be able to wait for completions with a timeout
+  without touching the submission queue, which they don't own.
+  @return true if supported, false otherwise. */
+  [[nodiscard]] static bool is_io_uring_supported();
+#endif /* HAVE_LIBURING */
+
   /** Checks if the system supports native linux aio. On some kernel
   versions where native aio is supported it won't work on tmpfs. In such
   cases we can't use native aio as it is not possible to mix simulated
@@ -711,6 +779,14 @@ class AIO {
   [[nodiscard]] dberr_t init_linux_native_aio();
 #endif /* LINUX_NATIVE_AIO */
 
+#ifdef HAVE_LIBURING
+  /** Create the io_urings, one per segment.
+  @param[in]    sqpoll  true to let a kernel thread poll the submission
+                        queues, shared by all the rings of the array
+  @return true on success, false to use libaio instead. */
+  [[nodiscard]] bool init_io_uring(bool sqpoll);
+#endif /* HAVE_LIBURING */
+
  private:
   typedef std::vector<Slot> Slots;
 
@@ -766,6 +842,23 @@ class AIO {
   IOEvents m_events;
 #endif /* LINUX_NATIV_AIO */
 
+#ifdef HAVE_LIBURING
+  /** The io_urings, one per segment, which replace m_aio_ctx if
+  srv_use_io_uring is set. Like with m_aio_ctx, each handler thread reaps
+  the completions of its own ring; submissions are protected by m_mutex. */
+  io_uring *m_rings{};
+
+  /** Number of requests queued on each ring but not submitted yet.
+  Protected by m_mutex. */
+  std::vector<ulint> m_n_queued;
+
+  /** The buffers registered with all the rings of the array, sorted by
+  address. Requests within them use IORING_OP_READ_FIXED and
+  IORING_OP_WRITE_FIXED, which spares the kernel mapping the pages for each
+  request. Protected by m_mutex. */
+  std::vector<struct iovec> m_registered;
+#endif /* HAVE_LIBURING */
+
   /** The aio arrays for non-ibuf i/o and ibuf i/o. These are NULL when the
   module has not yet been initialized. */
 
@@ -1367,6 +1460,24 @@ byte *os_file_compress_page(Compression compression, ulint block_size,
 
       break;
 
+    case Compression::ZSTD: {
+      /* Use the same level as ZLib does, which is within the range that
+      Zstandard compresses quickly. */
+      const size_t zlen =
+          ZSTD_compress(dst + FIL_PAGE_DATA, out_len, src + FIL_PAGE_DATA,
+                        content_len, static_cast<int>(compression_level));
+
+      if (ZSTD_isError(zlen) || zlen >= out_len) {
+        *dst_len = src_len;
+
+        return (src);
+      }
+
+      len = static_cast<ulint>(zlen);
+
+      break;
+    }
+
     default:
       *dst_len = src_len;
       return (src);
@@ -2138,6 +2249,18 @@ class LinuxAIOHandler {
   each wakeup and that is why we use timed wait in io_getevents(). */
   void collect();
 
+  /** Mark a request as completed. The error handling will be done in
+  the calling function.
+  @param[in,out]        slot    Request that has completed
+  @param[in]    res     Number of bytes read or written, or -errno */
+  void mark_completed(Slot *slot, ssize_t res);
+
+#ifdef HAVE_LIBURING
+  /** collect() for an array that uses io_uring.
+  @param[in,out]        ring    The ring of the segment */
+  void collect(io_uring *ring);
+#endif /* HAVE_LIBURING */
+
  private:
   /** Slot array */
   AIO *m_array;
@@ -2179,6 +2302,15 @@ dberr_t LinuxAIOHandler::resubmit(Slot *slot) {
 
   /* make sure that slot->offset fits in off_t */
   ut_ad(sizeof(off_t) >= sizeof(os_offset_t));
+
+#ifdef HAVE_LIBURING
+  if (m_array->io_ring(m_segment) != nullptr) {
+    m_array->uring_queue(slot, true);
+
+    return (DB_SUCCESS);
+  }
+#endif /* HAVE_LIBURING */
+
   struct iocb *iocb = &slot->control;
   if (slot->type.is_read()) {
     io_prep_pread(iocb, slot->file.m_file, slot->ptr, slot->len, slot->offset);
@@ -2283,6 +2415,13 @@ void LinuxAIOHandler::collect() {
   ut_ad(m_n_slots > 0);
   ut_ad(m_segment < m_array->get_n_segments());
 
+#ifdef HAVE_LIBURING
+  if (auto ring = m_array->io_ring(m_segment)) {
+    collect(ring);
+    return;
+  }
+#endif /* HAVE_LIBURING */
+
   /* Which io_context we are going to use. */
   io_context *io_ctx = m_array->io_ctx(m_segment);
 
@@ -2334,43 +2473,14 @@ void LinuxAIOHandler::collect() {
       /* We have not overstepped to next segment. */
       ut_a(slot->pos < end_pos);
 
-      /** If write of the page is compressed (compression is enabled, it is not
-      the first page, it is not a redolog, not a doublewrite buffer) and punch
-      holes are enabled, call AIOHandler::io_complete to check if hole punching
-      is needed.
-      Keep in sync with os_aio_windows_handler(). */
-      if (slot->offset > 0 && !slot->skip_punch_hole &&
-          slot->type.is_compression_enabled() && !slot->type.is_log() &&
-          slot->type.is_write() && slot->type.is_compressed() &&
-          slot->type.punch_hole() && !slot->type.is_dblwr()) {
-        slot->err = AIOHandler::io_complete(slot);
-      } else {
-        slot->err = DB_SUCCESS;
-      }
-
-      /* Mark this request as completed. The error handling
-      will be done in the calling function. */
-      m_array->acquire();
-
       /* events[i].res2 should always be ZERO */
       ut_ad(events[i].res2 == 0);
-      slot->io_already_done = true;
 
       /* Even though events[i].res is an unsigned number in libaio, it is
       used to return a negative value (negated errno value) to indicate
       error and a positive value to indicate number of bytes read or
       written. */
-
-      if (events[i].res > slot->len) {
-        /* failure */
-        slot->n_bytes = 0;
-        slot->ret = events[i].res;
-      } else {
-        /* success */
-        slot->n_bytes = events[i].res;
-        slot->ret = 0;
-      }
-      m_array->release();
+      mark_completed(slot, static_cast<ssize_t>(events[i].res));
     }
 
     if (srv_shutdown_state.load() == SRV_SHUTDOWN_EXIT_THREADS ||
@@ -2407,6 +2517,108 @@ void LinuxAIOHandler::collect() {
   }
 }
 
+void LinuxAIOHandler::mark_completed(Slot *slot, ssize_t res) {
+  /** If write of the page is compressed (compression is enabled, it is not
+  the first page, it is not a redolog, not a doublewrite buffer) and punch
+  holes are enabled, call AIOHandler::io_complete to check if hole punching
+  is needed.
+  Keep in sync with os_aio_windows_handler(). */
+  if (slot->offset > 0 && !slot->skip_punch_hole &&
+      slot->type.is_compression_enabled() && !slot->type.is_log() &&
+      slot->type.is_write() && slot->type.is_compressed() &&
+      slot->type.punch_hole() && !slot->type.is_dblwr()) {
+    slot->err = AIOHandler::io_complete(slot);
+  } else {
+    slot->err = DB_SUCCESS;
+  }
+
+  m_array->acquire();
+
+  slot->io_already_done = true;
+
+  if (res < 0 || static_cast<ulint>(res) > slot->len) {
+    /* failure */
+    slot->n_bytes = 0;
+    slot->ret = static_cast<int>(res);
+  } else {
+    /* success */
+    slot->n_bytes = res;
+    slot->ret = 0;
+  }
+
+  m_array->release();
+}
+
+#ifdef HAVE_LIBURING
+void LinuxAIOHandler::collect(io_uring *ring) {
+  /* Starting point of the m_segment we will be working on. */
+  const ulint start_pos = m_segment * m_n_slots;
+
+  /* End point. */
+  const ulint end_pos = start_pos + m_n_slots;
+
+  for (;;) {
+    struct __kernel_timespec timeout;
+
+    timeout.tv_sec = 0;
+    timeout.tv_nsec = OS_AIO_REAP_TIMEOUT;
+
+    struct io_uring_cqe *cqe;
+    ulint n_completed = 0;
+
+    auto ret = io_uring_wait_cqe_timeout(ring, &cqe, &timeout);
+
+    while (ret == 0) {
+      auto slot = static_cast<Slot *>(io_uring_cqe_get_data(cqe));
+      const auto res = cqe->res;
+
+      io_uring_cqe_seen(ring, cqe);
+
+      /* Some sanity checks. */
+      ut_a(slot != nullptr);
+      ut_a(slot->is_reserved);
+      ut_a(!slot->io_already_done);
+      ut_a(slot->pos >= start_pos);
+      ut_a(slot->pos < end_pos);
+
+      mark_completed(slot, res);
+
+      if (++n_completed == m_n_slots) {
+        break;
+      }
+
+      ret = io_uring_peek_cqe(ring, &cqe);
+    }
+
+    if (srv_shutdown_state.load() == SRV_SHUTDOWN_EXIT_THREADS ||
+        !buf_flush_page_cleaner_is_active() || n_completed > 0) {
+      break;
+    }
+
+    switch (ret) {
+      case -ETIME:
+        /* Nothing has completed for a while. Make sure that no request
+        is left queued, in case whoever queued it did not submit it. */
+        m_array->acquire();
+        m_array->uring_submit(m_segment);
+        m_array->release();
+
+        continue;
+
+      case -EAGAIN:
+      case -EINTR:
+        continue;
+    }
+
+    /* All other errors should cause a trap for now. */
+    ib::fatal(UT_LOCATION_HERE, ER_IB_MSG_755)
+        << "Unexpected ret_code[" << ret << "] from io_uring_wait_cqe()!";
+
+    break;
+  }
+}
+#endif /* HAVE_LIBURING */
+
 /** Process a Linux AIO request
 @param[out]     m1              the messages passed with the
 @param[out]     m2              AIO request; note that in case the
@@ -2529,6 +2741,16 @@ bool AIO::linux_dispatch(Slot *slot) {
   ut_a(slot->is_reserved);
   ut_ad(slot->type.validate());
 
+#ifdef HAVE_LIBURING
+  if (m_rings != nullptr) {
+    acquire();
+    uring_queue(slot, slot->type.is_wake());
+    release();
+
+    return (true);
+  }
+#endif /* HAVE_LIBURING */
+
   /* Find out what we are going to work with.
   The iocb struct is directly in the slot.
   The io_context is one per segment. */
@@ -2548,6 +2770,273 @@ bool AIO::linux_dispatch(Slot *slot) {
   return (ret == 1);
 }
 
+#ifdef HAVE_LIBURING
+void AIO::uring_queue(Slot *slot, bool submit) {
+  ut_ad(is_mutex_owned());
+
+  const ulint segment = (slot->pos * m_n_segments) / m_slots.size();
+  ut_a(segment < m_n_segments);
+
+  /* The ring has as many entries as the segment has slots, so there is
+  always room for the request of a reserved slot. */
+  auto sqe = io_uring_get_sqe(&m_rings[segment]);
+  ut_a(sqe != nullptr);
+
+  const auto len = static_cast<unsigned>(slot->len);
+  const auto buf_index = uring_buffer_index(slot->ptr, slot->len);
+
+  if (slot->type.is_read()) {
+    if (buf_index >= 0) {
+      io_uring_prep_read_fixed(sqe, slot->file.m_file, slot->ptr, len,
+                               slot->offset, buf_index);
+    } else {
+      io_uring_prep_read(sqe, slot->file.m_file, slot->ptr, len, slot->offset);
+    }
+  } else {
+    ut_a(slot->type.is_write());
+
+    if (buf_index >= 0) {
+      io_uring_prep_write_fixed(sqe, slot->file.m_file, slot->ptr, len,
+                                slot->offset, buf_index);
+    } else {
+      io_uring_prep_write(sqe, slot->file.m_file, slot->ptr, len,
+                          slot->offset);
+    }
+  }
+
+  io_uring_sqe_set_data(sqe, slot);
+
+  ++m_n_queued[segment];
+
+  if (submit) {
+    uring_submit(segment);
+  }
+}
+
+void AIO::uring_submit(ulint segment) {
+  ut_ad(is_mutex_owned());
+
+  while (m_n_queued[segment] > 0) {
+    const auto ret = io_uring_submit(&m_rings[segment]);
+
+    if (ret > 0) {
+      m_n_queued[segment] -=
+          std::min(static_cast<ulint>(ret), m_n_queued[segment]);
+    } else if (ret == -EAGAIN || ret == -EINTR) {
+      std::this_thread::yield();
+    } else {
+      ib::fatal(UT_LOCATION_HERE, ER_IB_MSG_755)
+          << "Unexpected ret_code[" << ret << "] from io_uring_submit()!";
+    }
+  }
+}
+
+void AIO::uring_submit_all() {
+  for (auto array : {s_reads, s_writes, s_ibuf}) {
+    if (array == nullptr || array->m_rings == nullptr) {
+      continue;
+    }
+
+    array->acquire();
+
+    for (ulint i = 0; i < array->m_n_segments; ++i) {
+      array->uring_submit(i);
+    }
+
+    array->release();
+  }
+}
+
+int AIO::uring_buffer_index(const void *ptr, ulint len) const {
+  ut_ad(is_mutex_owned());
+
+  const auto p = static_cast<const byte *>(ptr);
+
+  /* The first buffer that starts after ptr. */
+  auto it = std::upper_bound(m_registered.begin(), m_registered.end(), p,
+                             [](const byte *p, const struct iovec &iov) {
+                               return std::less<const byte *>{}(
+                                   p, static_cast<const byte *>(iov.iov_base));
+                             });
+
+  if (it == m_registered.begin()) {
+    return (-1);
+  }
+
+  --it;
+
+  const auto base = static_cast<const byte *>(it->iov_base);
+
+  if (p + len > base + it->iov_len) {
+    return (-1);
+  }
+
+  return (static_cast<int>(it - m_registered.begin()));
+}
+
+void AIO::uring_register_buffers(const os_aio_buffers_t &buffers) {
+  /* The kernel limits the size of a registered buffer to 1GiB. */
+  constexpr size_t max_len = 1024 * 1024 * 1024;
+
+  std::vector<struct iovec> iovs;
+
+  for (const auto &buffer : buffers) {
+    for (size_t done = 0; done < buffer.second; done += max_len) {
+      struct iovec iov;
+
+      iov.iov_base = buffer.first + done;
+      iov.iov_len = std::min(max_len, buffer.second - done);
+
+      iovs.push_back(iov);
+    }
+  }
+
+  std::sort(iovs.begin(), iovs.end(),
+            [](const struct iovec &a, const struct iovec &b) {
+              return std::less<void *>{}(a.iov_base, b.iov_base);
+            });
+
+  uring_unregister_buffers();
+
+  if (iovs.empty()) {
+    return;
+  }
+
+  for (auto array : {s_reads, s_writes, s_ibuf}) {
+    if (array == nullptr || array->m_rings == nullptr) {
+      continue;
+    }
+
+    array->acquire();
+
+    for (ulint i = 0; i < array->m_n_segments; ++i) {
+      const auto ret = io_uring_register_buffers(
+          &array->m_rings[i], iovs.data(), static_cast<unsigned>(iovs.size()));
+
+      if (ret != 0) {
+        /* Most likely RLIMIT_MEMLOCK is too low. The IO works the same
+        without the registration, only a little slower. */
+        array->release();
+
+        ib::warn(ER_IB_MSG_829)
+            << "io_uring_register_buffers() returned error[" << -ret
+            << "], the buffer pool is not registered with io_uring.";
+
+        uring_unregister_buffers();
+
+        return;
+      }
+    }
+
+    array->m_registered = iovs;
+
+    array->release();
+  }
+}
+
+void AIO::uring_unregister_buffers() {
+  for (auto array : {s_reads, s_writes, s_ibuf}) {
+    if (array == nullptr || array->m_rings == nullptr) {
+      continue;
+    }
+
+    array->acquire();
+
+    /* A queued request refers to its registered buffer by index, so it
+    must reach the kernel before the buffers go away. */
+    for (ulint i = 0; i < array->m_n_segments; ++i) {
+      array->uring_submit(i);
+      io_uring_unregister_buffers(&array->m_rings[i]);
+    }
+
+    array->m_registered.clear();
+
+    array->release();
+  }
+}
+
+bool AIO::is_io_uring_supported() {
+  io_uring ring;
+
+  const auto ret = io_uring_queue_init(1, &ring, 0);
+
+  if (ret != 0) {
+    ib::warn(ER_IB_MSG_829)
+        << "io_uring_queue_init() returned error[" << -ret << "]";
+
+    return (false);
+  }
+
+  const bool supported = (ring.features & IORING_FEAT_EXT_ARG) != 0;
+
+  io_uring_queue_exit(&ring);
+
+  if (!supported) {
+    ib::warn(ER_IB_MSG_829) << "io_uring is not supported by this kernel:"
+                               " IORING_FEAT_EXT_ARG is required.";
+  }
+
+  return (supported);
+}
+
+bool AIO::init_io_uring(bool sqpoll) {
+  ut_a(m_rings == nullptr);
+
+  m_rings = static_cast<io_uring *>(ut::zalloc_withkey(
+      UT_NEW_THIS_FILE_PSI_KEY, m_n_segments * sizeof(*m_rings)));
+
+  if (m_rings == nullptr) {
+    return (false);
+  }
+
+  const auto max_events = static_cast<unsigned>(slots_per_segment());
+
+  for (ulint i = 0; i < m_n_segments; ++i) {
+    struct io_uring_params params;
+
+    memset(&params, 0x0, sizeof(params));
+
+    if (sqpoll) {
+      params.flags = IORING_SETUP_SQPOLL;
+
+      /* Milliseconds the polling thread spins before it goes to sleep,
+      after which the next submission has to wake it up. */
+      params.sq_thread_idle = 1000;
+
+      if (i > 0) {
+        /* One polling thread for all the rings of the array. */
+        params.flags |= IORING_SETUP_ATTACH_WQ;
+        params.wq_fd = m_rings[0].ring_fd;
+      }
+    }
+
+    const auto ret =
+        io_uring_queue_init_params(max_events, &m_rings[i], &params);
+
+    if (ret != 0) {
+      /* Most likely RLIMIT_MEMLOCK is too low for the rings, or SQPOLL
+      is not permitted. */
+      ib::warn(ER_IB_MSG_829)
+          << "io_uring_queue_init() returned error[" << -ret << "]"
+          << (sqpoll ? " with SQPOLL." : ", using libaio instead.");
+
+      while (i > 0) {
+        io_uring_queue_exit(&m_rings[--i]);
+      }
+
+      ut::free(m_rings);
+      m_rings = nullptr;
+
+      return (false);
+    }
+  }
+
+  m_n_queued.assign(m_n_segments, 0);
+
+  return (true);
+}
+#endif /* HAVE_LIBURING */
+
 /** Creates an io_context for native linux AIO.
 @param[in]      max_events      number of events
 @param[out]     io_ctx          io_ctx to initialize.
@@ -6183,6 +6672,14 @@ dberr_t AIO::init() {
 #endif /* _WIN32 */
 
   if (srv_use_native_aio) {
+#ifdef HAVE_LIBURING
+    if (srv_use_io_uring &&
+        ((srv_io_uring_sqpoll && init_io_uring(true)) ||
+         init_io_uring(false))) {
+      return (init_slots());
+    }
+#endif /* HAVE_LIBURING */
+
 #ifdef LINUX_NATIVE_AIO
     dberr_t err = init_linux_native_aio();
 
@@ -6250,6 +6747,15 @@ AIO::~AIO() {
   }
 #endif /* LINUX_NATIVE_AIO */
 
+#ifdef HAVE_LIBURING
+  if (m_rings != nullptr) {
+    for (ulint i = 0; i < m_n_segments; ++i) {
+      io_uring_queue_exit(&m_rings[i]);
+    }
+    ut::free(m_rings);
+  }
+#endif /* HAVE_LIBURING */
+
   m_slots.clear();
 }
 
@@ -6263,6 +6769,19 @@ bool AIO::start(ulint n_per_seg, ulint n_readers, ulint n_writers) {
   }
 #endif /* LINUX_NATIVE_AIO */
 
+#ifdef HAVE_LIBURING
+  if (srv_use_io_uring) {
+    if (!srv_use_native_aio || !is_io_uring_supported()) {
+      ib::warn(ER_IB_MSG_829) << "io_uring disabled.";
+
+      srv_use_io_uring = false;
+    } else {
+      ib::info(ER_IB_MSG_541) << "Using io_uring for native AIO"
+                              << (srv_io_uring_sqpoll ? " with SQPOLL" : "");
+    }
+  }
+#endif /* HAVE_LIBURING */
+
   srv_reset_io_thread_op_info();
 
   const auto n_extra = number_of_extra_threads();
@@ -6536,6 +7055,22 @@ bool os_aio_init(ulint n_readers, ulint n_writers) {
 
 void os_aio_start_threads() { AIO::start_threads(); }
 
+void os_aio_register_buffers(const os_aio_buffers_t &buffers [[maybe_unused]]) {
+#ifdef HAVE_LIBURING
+  if (srv_use_io_uring) {
+    AIO::uring_register_buffers(buffers);
+  }
+#endif /* HAVE_LIBURING */
+}
+
+void os_aio_unregister_buffers() {
+#ifdef HAVE_LIBURING
+  if (srv_use_io_uring) {
+    AIO::uring_unregister_buffers();
+  }
+#endif /* HAVE_LIBURING */
+}
+
 /** Frees the asynchronous io system. */
 void os_aio_free() {
   AIO::shutdown();
@@ -6900,6 +7435,11 @@ void AIO::wake_simulated_handler_thread(ulint global_segment, ulint segment) {
 /** Wakes up simulated aio i/o-handler threads if they have something to do. */
 void os_aio_simulated_wake_handler_threads() {
   if (srv_use_native_aio) {
+#ifdef HAVE_LIBURING
+    /* Submit the requests queued with IORequest::DO_NOT_WAKE. */
+    AIO::uring_submit_all();
+#endif /* HAVE_LIBURING */
+
     /* We do not use simulated aio: do nothing */
 
     return;
@@ -7952,6 +8492,145 @@ dberr_t os_file_write_retry(IORequest &type, const char *name,
   return err;
 }
 
+#ifdef HAVE_LIBURING
+/** A small io_uring for os_file_uring_write_and_flush(), one per thread,
+so that the threads need not synchronize. */
+class Thread_io_uring {
+ public:
+  ~Thread_io_uring() {
+    if (m_initialized) {
+      io_uring_queue_exit(&m_ring);
+    }
+  }
+
+  /** @return the ring, or nullptr if it cannot be used */
+  io_uring *get() { return m_usable ? &m_ring : nullptr; }
+
+  /** Stop using the ring after an error, as it might still hold requests
+  that were not submitted. */
+  void disable() { m_usable = false; }
+
+ private:
+  io_uring m_ring;
+
+  /** True if io_uring_queue_init() succeeded. */
+  const bool m_initialized{io_uring_queue_init(2, &m_ring, 0) == 0};
+
+  bool m_usable{m_initialized};
+};
+
+/** Write to a file and flush it with one linked io_uring submission, so
+that the fsync starts as soon as the write has completed.
+@param[in]  file     handle to an open file
+@param[in]  buf      buffer from which to write
+@param[in]  offset   file offset where to write
+@param[in]  n        number of bytes to write
+@return true on success, false if the caller must write and flush the
+        ordinary way */
+static bool os_file_uring_write_and_flush(pfs_os_file_t file,
+                                          const void *buf, os_offset_t offset,
+                                          ulint n) {
+  thread_local Thread_io_uring thread_ring;
+
+  auto ring = thread_ring.get();
+
+  if (ring == nullptr) {
+    return (false);
+  }
+
+#ifdef UNIV_PFS_IO
+  PSI_file_locker_state state;
+  struct PSI_file_locker *locker = nullptr;
+
+  register_pfs_file_io_begin(&state, locker, file, n, PSI_FILE_WRITE,
+                             UT_LOCATION_HERE);
+#endif /* UNIV_PFS_IO */
+
+  auto sqe = io_uring_get_sqe(ring);
+  io_uring_prep_write(sqe, file.m_file, buf, static_cast<unsigned>(n),
+                      offset);
+  io_uring_sqe_set_data(sqe, nullptr);
+
+  /* The fsync must not start before the write has completed, and is
+  cancelled if the write fails or is short. */
+  sqe->flags |= IOSQE_IO_LINK;
+
+  sqe = io_uring_get_sqe(ring);
+#if defined(HAVE_FDATASYNC) && defined(HAVE_DECL_FDATASYNC)
+  io_uring_prep_fsync(sqe, file.m_file,
+                      srv_use_fdatasync ? IORING_FSYNC_DATASYNC : 0);
+#else
+  io_uring_prep_fsync(sqe, file.m_file, 0);
+#endif /* HAVE_FDATASYNC && HAVE_DECL_FDATASYNC */
+  io_uring_sqe_set_data(sqe, &thread_ring);
+
+  int n_submitted;
+
+  do {
+    n_submitted = io_uring_submit(ring);
+  } while (n_submitted == -EAGAIN || n_submitted == -EINTR);
+
+  bool success = n_submitted == 2;
+
+  if (!success) {
+    thread_ring.disable();
+  }
+
+  for (int i = 0; i < n_submitted; ++i) {
+    struct io_uring_cqe *cqe;
+    int ret;
+
+    do {
+      ret = io_uring_wait_cqe(ring, &cqe);
+    } while (ret == -EINTR);
+
+    if (ret != 0) {
+      /* We cannot tell what happened with the requests. */
+      thread_ring.disable();
+      success = false;
+      break;
+    }
+
+    if (io_uring_cqe_get_data(cqe) == nullptr) {
+      ++os_n_file_writes;
+      success &= cqe->res >= 0 && static_cast<ulint>(cqe->res) == n;
+    } else {
+      ++os_n_fsyncs;
+      success &= cqe->res == 0;
+    }
+
+    io_uring_cqe_seen(ring, cqe);
+  }
+
+#ifdef UNIV_PFS_IO
+  register_pfs_file_io_end(locker, n);
+#endif /* UNIV_PFS_IO */
+
+  return (success);
+}
+#endif /* HAVE_LIBURING */
+
+dberr_t os_file_write_and_flush(IORequest &type, const char *name,
+                                pfs_os_file_t file, const void *buf,
+                                os_offset_t offset, ulint n) {
+#ifdef HAVE_LIBURING
+  if (srv_use_io_uring && !type.is_compressed() && !type.is_encrypted() &&
+      os_file_uring_write_and_flush(file, buf, offset, n)) {
+    return (DB_SUCCESS);
+  }
+#endif /* HAVE_LIBURING */
+
+  /* Either io_uring is not used, or the linked write failed, in which case
+  we simply write everything again. */
+  const auto err = os_file_write_retry(type, name, file, buf, offset, n);
+
+  if (err == DB_SUCCESS) {
+    os_file_flush(file);
+  }
+
+  return (err);
+}
+
 std::string IORequest::type_str(const ulint type) {
   std::ostringstream os;
   if (type & READ) {
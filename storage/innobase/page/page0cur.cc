@@ -315,6 +315,23 @@ static bool page_cur_has_null(const rec_t *rec, const dict_index_t *index) {
   return (*nulls & null_mask);
 }
 
+/** Prefetches the records which the binary search over the page directory
+compares next, whichever way the comparison with the middle record goes, so
+that the cache misses of the next step overlap with the current comparison.
+@param[in]      page    index page
+@param[in]      low     lower limit slot
+@param[in]      mid     middle slot, which is being compared
+@param[in]      up      upper limit slot */
+static inline void page_cur_prefetch_next_mid(const page_t *page, ulint low,
+                                              ulint mid, ulint up) {
+  if (up - low > 2) {
+    UNIV_PREFETCH_R(
+        page_dir_slot_get_rec(page_dir_get_nth_slot(page, (low + mid) / 2)));
+    UNIV_PREFETCH_R(
+        page_dir_slot_get_rec(page_dir_get_nth_slot(page, (mid + up) / 2)));
+  }
+}
+
 /** Searches the right position for a page cursor.
 @param[in] block Buffer block
 @param[in] index Record descriptor
@@ -489,6 +506,8 @@ void page_cur_search_with_match(const buf_block_t *block,
     slot = page_dir_get_nth_slot(page, mid);
     mid_rec = page_dir_slot_get_rec(slot);
 
+    page_cur_prefetch_next_mid(page, low, mid, up);
+
     cur_matched_fields = std::min(low_matched_fields, up_matched_fields);
 
     auto offsets = get_mid_rec_offsets();
@@ -705,6 +724,8 @@ void page_cur_search_with_match_bytes(
     slot = page_dir_get_nth_slot(page, mid);
     mid_rec = page_dir_slot_get_rec(slot);
 
+    page_cur_prefetch_next_mid(page, low, mid, up);
+
     ut_pair_min(&cur_matched_fields, &cur_matched_bytes, low_matched_fields,
                 low_matched_bytes, up_matched_fields, up_matched_bytes);
 
@@ -34,6 +34,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "clone0clone.h"
 
 #include "srv0srv.h"
+#include "trx0purge.h"
 #include "trx0sys.h"
 
 /*
@@ -316,6 +317,8 @@ ReadView::ReadView()
       m_up_limit_id(),
       m_creator_trx_id(),
       m_ids(),
+      m_ids_version(),
+      m_snapshot_csn(),
       m_low_limit_no() {
   ut_d(::memset(&m_view_list, 0x0, sizeof(m_view_list)));
   ut_d(m_view_low_limit_no = 0);
@@ -454,14 +457,28 @@ void ReadView::prepare(trx_id_t id) {
 
   ut_a(m_low_limit_no <= m_low_limit_id);
 
-  if (!trx_sys->rw_trx_ids.empty()) {
-    copy_trx_ids(trx_sys->rw_trx_ids);
-  } else {
+  m_ids_version = trx_sys_get_rw_trx_ids_version();
+
+  if (srv_mvcc_csn) {
+    /* The active transactions will get a CSN >= m_snapshot_csn when they
+    are erased from rw_trx_ids. Nothing needs to be copied. */
+    m_snapshot_csn = trx_sys->next_csn.load();
+
     m_ids.clear();
-  }
 
-  /* The first active transaction has the smallest id. */
-  m_up_limit_id = !m_ids.empty() ? m_ids.front() : m_low_limit_id;
+    m_up_limit_id = !trx_sys->rw_trx_ids.empty()
+                        ? trx_sys->rw_trx_ids.front()
+                        : m_low_limit_id;
+  } else {
+    if (!trx_sys->rw_trx_ids.empty()) {
+      copy_trx_ids(trx_sys->rw_trx_ids);
+    } else {
+      m_ids.clear();
+    }
+
+    /* The first active transaction has the smallest id. */
+    m_up_limit_id = !m_ids.empty() ? m_ids.front() : m_low_limit_id;
+  }
 
   ut_a(m_up_limit_id <= m_low_limit_id);
 
@@ -469,6 +486,47 @@ void ReadView::prepare(trx_id_t id) {
   m_closed = false;
 }
 
+bool ReadView::csn_changes_visible(trx_id_t id) const {
+  ut_ad(m_snapshot_csn > 0);
+
+  /* The creator of a cloned view. */
+  if (!m_ids.empty() &&
+      std::binary_search(m_ids.data(), m_ids.data() + m_ids.size(), id)) {
+    return false;
+  }
+
+  for (;;) {
+    const auto n_moved = trx_sys->csn_map_n_moved.load();
+
+    auto csn = trx_sys_get_csn(id);
+
+    if (csn == 0) {
+      /* The transaction is still active, has not been added to the map yet,
+      or its entry was moved to the shard. */
+      csn = trx_sys->get_shard_by_trx_id(id).active_rw_trxs.latch_and_execute(
+          [&](const Trx_by_id_with_min &trx_by_id_with_min) {
+            return trx_by_id_with_min.get_csn(id);
+          },
+          UT_LOCATION_HERE);
+    }
+
+    if (csn == 0) {
+      /* It may have been added to the map after we looked. */
+      csn = trx_sys_get_csn(id);
+    }
+
+    if (csn != 0) {
+      return csn < m_snapshot_csn;
+    }
+
+    if (n_moved == trx_sys->csn_map_n_moved.load()) {
+      /* The entry was dropped, because it is not needed by any view: the
+      transaction committed before this view was created. */
+      return true;
+    }
+  }
+}
+
 /**
 Find a free view from the active list, if none found then allocate
 a new view.
@@ -509,18 +567,26 @@ void MVCC::view_open(ReadView *&view, trx_t *trx) {
 
     ut_ad(view->m_closed);
 
-    /* NOTE: This can be optimised further, for now we only
-    reuse the view if there are no active RW transactions.
+    /* Reuse the view if no RW transaction has been started or
+    has finished since the view was created. No trx id has been
+    allocated if the low limit id is unchanged, and no id has been
+    removed from rw_trx_ids if the version is unchanged, so the
+    view would get exactly the same active trx ids again. The
+    serialisation list can only have shrunk meanwhile, which makes
+    our low limit no more conservative than a new one.
 
     There is an inherent race here between purge and this
     thread. Purge will skip views that are marked as closed.
-    Therefore we must set the low limit id after we reset the
-    closed status after the check. */
+    Therefore we must check the limits after we reset the closed
+    status. A view that purge created while ours was closed holds
+    the same trx ids, so it cannot have purged anything that we
+    still need. */
 
-    if (trx_is_autocommit_non_locking(trx) && view->empty()) {
+    if (trx_is_autocommit_non_locking(trx)) {
       view->m_closed = false;
 
-      if (view->m_low_limit_id == trx_sys_get_next_trx_id_or_no()) {
+      if (view->m_low_limit_id == trx_sys_get_next_trx_id_or_no() &&
+          view->m_ids_version == trx_sys_get_rw_trx_ids_version()) {
         return;
       } else {
         view->m_closed = true;
@@ -592,6 +658,10 @@ void ReadView::copy_prepare(const ReadView &other) {
 
   m_low_limit_id = other.m_low_limit_id;
 
+  m_ids_version = other.m_ids_version;
+
+  m_snapshot_csn = other.m_snapshot_csn;
+
   m_creator_trx_id = other.m_creator_trx_id;
 }
 
@@ -646,6 +716,24 @@ void MVCC::clone_oldest_view(ReadView *view) {
   view->reduce_low_limit(gtid_oldest_trxno);
 }
 
+trx_id_t MVCC::oldest_snapshot_csn() const {
+  ut_ad(trx_sys_mutex_own());
+
+  auto csn = trx_sys->next_csn.load();
+
+  for (const ReadView *view : m_views) {
+    if (!view->is_closed() && view->m_snapshot_csn > 0) {
+      csn = std::min(csn, view->m_snapshot_csn);
+    }
+  }
+
+  if (purge_sys != nullptr && purge_sys->view.m_snapshot_csn > 0) {
+    csn = std::min(csn, purge_sys->view.m_snapshot_csn);
+  }
+
+  return csn;
+}
+
 /**
 @return the number of active views */
 
@@ -35,6 +35,7 @@ other files in library. The code in this file is used to make a library for
 external tools. */
 
 #include <stddef.h>
+#include <string.h>
 
 #include "dict0dict.h"
 #include "mem0mem.h"
@@ -62,6 +63,16 @@ static void rec_init_offsets_new(const rec_t *rec, const dict_index_t *index,
       n_node_ptr_field = dict_index_get_n_unique_in_tree_nonleaf(index);
       break;
     case REC_STATUS_ORDINARY:
+      if (index->rec_cache.leaf_offsets != nullptr &&
+          !index->has_instant_cols_or_row_versions()) {
+        /* All the fields are fixed length and NOT NULL: every leaf record
+        has the cached layout. */
+        const ulint *cached = index->rec_cache.leaf_offsets;
+        ut_ad(rec_offs_n_fields(offsets) <= rec_offs_n_fields(cached));
+        memcpy(rec_offs_base(offsets), rec_offs_base(cached),
+               (rec_offs_n_fields(offsets) + 1) * sizeof(ulint));
+        return;
+      }
       rec_init_offsets_comp_ordinary(rec, false, index, offsets);
       return;
   }
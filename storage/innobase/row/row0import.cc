@@ -1968,6 +1968,7 @@ dberr_t row_import::adjust_instant_metadata_in_taregt_table(
   first_index.row_versions = true;
   first_index.rec_cache.offsets = nullptr;
   first_index.rec_cache.nullable_cols = 0;
+  first_index.rec_cache.leaf_offsets = nullptr;
   /* Recreate fields array for clustered index */
   first_index.create_fields_array();
   first_index.create_nullables(m_table->current_row_version);
@@ -2103,6 +2104,7 @@ dberr_t row_import::set_instant_info(THD *thd,
   first_index.instant_cols = true;
   first_index.rec_cache.offsets = nullptr;
   first_index.rec_cache.nullable_cols = 0;
+  first_index.rec_cache.leaf_offsets = nullptr;
   first_index.set_instant_nullable(m_n_instant_nullable);
   /* FIXME: Force to discard the table, in case of any rollback later. */
   //    m_table->discard_after_ddl = true;
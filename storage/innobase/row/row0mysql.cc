@@ -43,6 +43,8 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <vector>
 
 #include "btr0sea.h"
+#include "buf0flu.h"
+#include "ddl0bulk.h"
 #include "ddl0ddl.h"
 #include "dict0boot.h"
 #include "dict0crea.h"
@@ -1701,6 +1703,238 @@ run_again:
   return (err);
 }
 
+/** Checks if the rows that a statement inserts into a table can be loaded
+bottom-up by row_bulk_insert_begin().
+@param[in]      prebuilt        prebuilt struct in MySQL handle
+@return true if the table qualifies */
+static bool row_bulk_insert_is_possible(const row_prebuilt_t *prebuilt) {
+  dict_table_t *table = prebuilt->table;
+  const dict_index_t *index = table->first_index();
+
+  if (srv_read_only_mode || srv_force_recovery > 0 || table->is_temporary() ||
+      dict_table_is_partition(table) ||
+      dict_table_in_shared_tablespace(table) ||
+      dict_table_is_discarded(table) || table->ibd_file_missing ||
+      table->is_corrupted()) {
+    return false;
+  }
+
+  /* The same restrictions as for LOAD DATA ... ALGORITHM=BULK, see
+  ha_innobase::bulk_load_check(). */
+  if (dict_tf_get_rec_format(table->flags) != REC_FORMAT_DYNAMIC ||
+      !table->has_pk() || table->get_index_count() > 1 ||
+      table->has_row_versions() || table->has_instant_cols() ||
+      dict_index_is_online_ddl(index)) {
+    return false;
+  }
+
+  /* The loader neither computes virtual columns, nor assigns FTS document
+  IDs, nor checks foreign keys. */
+  if (table->n_v_cols > 0 || table->fts != nullptr ||
+      DICT_TF2_FLAG_IS_SET(table, DICT_TF2_FTS_HAS_DOC_ID) ||
+      (prebuilt->trx->check_foreigns && !table->foreign_set.empty())) {
+    return false;
+  }
+
+  /* Nor does it handle column prefixes in the key. */
+  for (ulint i = 0; i < dict_index_get_n_unique(index); ++i) {
+    if (index->get_field(i)->prefix_len > 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+dberr_t row_bulk_insert_begin(row_prebuilt_t *prebuilt, size_t data_size,
+                              size_t memory) {
+  trx_t *trx = prebuilt->trx;
+  dict_table_t *table = prebuilt->table;
+  dict_index_t *index = table->first_index();
+  roll_ptr_t roll_ptr;
+  dberr_t err;
+
+  ut_ad(prebuilt->bulk_insert == nullptr);
+  ut_ad(prebuilt->template_type == ROW_MYSQL_WHOLE_ROW);
+
+  if (!row_bulk_insert_is_possible(prebuilt) || !btr_is_index_empty(index)) {
+    return (DB_UNSUPPORTED);
+  }
+
+  trx->op_info = "setting table lock";
+
+  row_get_prebuilt_insert_row(prebuilt);
+  ins_node_t *node = prebuilt->ins_node;
+
+  /* We use the insert query graph as the dummy graph needed
+  in the lock module call */
+
+  que_thr_t *thr = que_fork_get_first_thr(prebuilt->ins_graph);
+
+  que_thr_move_to_run_state_for_mysql(thr, trx);
+
+run_again:
+  thr->run_node = node;
+  thr->prev_node = node;
+
+  trx_start_if_not_started_xa(trx, true, UT_LOCATION_HERE);
+
+  err = lock_table(0, table, LOCK_X, thr);
+
+  trx->error_state = err;
+
+  if (err != DB_SUCCESS) {
+    que_thr_stop_for_mysql(thr);
+
+    auto was_lock_wait = row_mysql_handle_errors(&err, trx, thr, nullptr);
+
+    if (was_lock_wait) {
+      goto run_again;
+    }
+
+    trx->op_info = "";
+
+    return (err);
+  }
+
+  /* Nobody else can insert into the table now, check again that it is
+  empty. If it is, write the undo log record that empties it again. */
+  if (!btr_is_index_empty(index)) {
+    err = DB_UNSUPPORTED;
+  } else {
+    err = trx_undo_report_row_operation(
+        table->skip_alter_undo ? BTR_NO_UNDO_LOG_FLAG : 0, TRX_UNDO_INSERT_OP,
+        thr, index, nullptr, nullptr, 0, nullptr, nullptr, &roll_ptr);
+  }
+
+  que_thr_stop_for_mysql_no_error(thr, trx);
+
+  trx->op_info = "";
+
+  if (err != DB_SUCCESS) {
+    return (err);
+  }
+
+  /* The pages are written without redo logging, and flushed when the load
+  ends, like in ha_innobase::bulk_load_begin(). */
+  auto observer = ut::new_withkey<Flush_observer>(
+      ut::make_psi_memory_key(mem_key_ddl), table->space, trx, nullptr);
+
+  trx_set_flush_observer(trx, observer);
+
+  prebuilt->bulk_insert = ut::new_withkey<ddl_bulk::Loader>(
+      ut::make_psi_memory_key(mem_key_ddl), 1);
+
+  err = prebuilt->bulk_insert->begin(prebuilt, data_size, memory);
+
+  if (err != DB_SUCCESS) {
+    /* Nothing has been loaded yet, ending the load cannot fail. */
+    const auto end_err = row_bulk_insert_end(prebuilt);
+    ut_a(end_err == DB_SUCCESS);
+  }
+
+  return (err);
+}
+
+dberr_t row_bulk_insert_end(row_prebuilt_t *prebuilt) {
+  auto loader = prebuilt->bulk_insert;
+  trx_t *trx = prebuilt->trx;
+
+  if (loader == nullptr) {
+    return (DB_SUCCESS);
+  }
+
+  prebuilt->bulk_insert = nullptr;
+
+  /* If loading a row has failed, the statement is rolled back, and the table
+  is emptied anyway. */
+  bool is_error = loader->get_error() != DB_SUCCESS;
+
+  auto err = loader->end(prebuilt, is_error);
+
+  if (err != DB_SUCCESS) {
+    is_error = true;
+  }
+
+  auto observer = trx->flush_observer;
+  ut_a(observer != nullptr);
+
+  if (is_error) {
+    observer->interrupted();
+  }
+
+  observer->flush();
+
+  trx_set_flush_observer(trx, nullptr);
+
+  ut::delete_(observer);
+
+  if (!is_error) {
+    /* Sync all pages written without redo log, before they are modified with
+    redo logging or the transaction commits. */
+    fil_flush(prebuilt->table->space);
+  }
+
+  ut::delete_(loader);
+
+  return (err);
+}
+
+/** Does an insert for MySQL with the loader started by
+row_bulk_insert_begin(). If the row cannot be loaded, the load is ended, and
+this and the following rows are inserted the usual way.
+@param[in]      mysql_rec       row in the MySQL format
+@param[in,out]  prebuilt        prebuilt struct in MySQL handle
+@return error code or DB_SUCCESS */
+static dberr_t row_insert_for_mysql_using_bulk_load(const byte *mysql_rec,
+                                                    row_prebuilt_t *prebuilt) {
+  trx_t *trx = prebuilt->trx;
+  dict_table_t *table = prebuilt->table;
+  ins_node_t *node = prebuilt->ins_node;
+  mem_heap_t *temp_heap = nullptr;
+
+  trx->op_info = "inserting";
+
+  row_mysql_delay_if_needed();
+
+  row_mysql_convert_row_to_innobase(node->row, prebuilt, mysql_rec, &temp_heap);
+
+  auto err = prebuilt->bulk_insert->load_row(prebuilt, node->row);
+
+  if (temp_heap != nullptr) {
+    mem_heap_free(temp_heap);
+  }
+
+  trx->op_info = "";
+
+  switch (err) {
+    case DB_SUCCESS:
+      srv_stats.n_rows_inserted.inc();
+
+      dict_table_n_rows_inc(table);
+
+      return (DB_SUCCESS);
+
+    case DB_DATA_NOT_SORTED:
+    case DB_DUPLICATE_KEY:
+    case DB_BULK_TOO_BIG_RECORD:
+      break;
+
+    default:
+      return (err);
+  }
+
+  /* The rows loaded so far become the contents of the table. A duplicate key
+  is reported by the usual insert, the way the statement expects. */
+  err = row_bulk_insert_end(prebuilt);
+
+  if (err != DB_SUCCESS) {
+    return (err);
+  }
+
+  return (row_insert_for_mysql_using_ins_graph(mysql_rec, prebuilt));
+}
+
 /** Does an insert for MySQL.
 @param[in]      mysql_rec       row in the MySQL format
 @param[in,out]  prebuilt        prebuilt struct in MySQL handle
@@ -1711,6 +1945,8 @@ dberr_t row_insert_for_mysql(const byte *mysql_rec, row_prebuilt_t *prebuilt) {
   Use direct cursor interface for inserting to intrinsic tables. */
   if (prebuilt->table->is_intrinsic()) {
     return (row_insert_for_mysql_using_cursor(mysql_rec, prebuilt));
+  } else if (prebuilt->bulk_insert != nullptr) {
+    return (row_insert_for_mysql_using_bulk_load(mysql_rec, prebuilt));
   } else {
     return (row_insert_for_mysql_using_ins_graph(mysql_rec, prebuilt));
   }
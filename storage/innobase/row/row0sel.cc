@@ -72,6 +72,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "trx0undo.h"
 #include "ut0new.h"
 
+#include "my_byteorder.h"
 #include "my_dbug.h"
 
 /** Maximum number of rows to prefetch; MySQL interface has another parameter */
@@ -2529,15 +2530,28 @@ void row_sel_field_store_in_mysql_format_func(
       /* Convert integer data from Innobase to a little-endian
       format, sign bit restored to normal */
 
-      ptr = dest + len;
-
-      for (;;) {
-        ptr--;
-        *ptr = *data;
-        if (ptr == dest) {
+      switch (len) {
+        /* The common widths are converted with one byte swap. */
+        case 8:
+          int8store(dest, mach_read_from_8(data));
           break;
-        }
-        data++;
+        case 4:
+          int4store(dest, mach_read_from_4(data));
+          break;
+        case 2:
+          int2store(dest, mach_read_from_2(data));
+          break;
+        default:
+          ptr = dest + len;
+
+          for (;;) {
+            ptr--;
+            *ptr = *data;
+            if (ptr == dest) {
+              break;
+            }
+            data++;
+          }
       }
 
       if (!templ->is_unsigned) {
@@ -5570,8 +5584,18 @@ rec_loop:
     not cache rows because there the cursor is a scrollable
     cursor. */
 
+    /* A server-provided buffer is sized from the optimizer estimate,
+    which may be far off, e.g. when the consumer stops early because of
+    a LIMIT or a selective join. Fill it gradually: start with as many
+    rows as the legacy cache holds and then as many rows as the scan has
+    already returned, so that the batch doubles up to the buffer size as
+    long as the rows keep being consumed. */
     const auto max_rows_to_cache =
-        record_buffer ? record_buffer->max_records() : MYSQL_FETCH_CACHE_SIZE;
+        record_buffer
+            ? std::min<size_t>(record_buffer->max_records(),
+                               std::max<size_t>(MYSQL_FETCH_CACHE_SIZE,
+                                                prebuilt->n_rows_fetched))
+            : MYSQL_FETCH_CACHE_SIZE;
     ut_a(prebuilt->n_fetch_cached < max_rows_to_cache);
 
     /* We only convert from InnoDB row format to MySQL row
@@ -324,7 +324,7 @@ static void row_undo_ins_parse_undo_rec(undo_node_t *node, THD *thd,
 
   ptr = trx_undo_rec_get_pars(node->undo_rec, &type, &dummy, &dummy_extern,
                               &undo_no, &table_id, type_cmpl);
-  ut_ad(type == TRX_UNDO_INSERT_REC);
+  ut_ad(type == TRX_UNDO_INSERT_REC || type == TRX_UNDO_EMPTY_REC);
   node->rec_type = type;
 
   node->update = nullptr;
@@ -338,6 +338,8 @@ static void row_undo_ins_parse_undo_rec(undo_node_t *node, THD *thd,
     dd_table_close(node->table, thd, mdl, false);
 
     node->table = nullptr;
+  } else if (type == TRX_UNDO_EMPTY_REC) {
+    /* No row is logged: the whole table is emptied. */
   } else {
     ut_ad(!node->table->skip_alter_undo);
 
@@ -481,6 +483,22 @@ dberr_t row_undo_ins(undo_node_t *node, /*!< in: row undo node */
     return (DB_SUCCESS);
   }
 
+  if (node->rec_type == TRX_UNDO_EMPTY_REC) {
+    /* The rows were loaded bottom-up into the table while it was empty, see
+    row_bulk_insert_begin(). The table had no index but the clustered index,
+    and no index can have been added since, as the transaction has held an
+    exclusive lock on the table. */
+    log_free_check();
+
+    btr_truncate(node->table->first_index());
+
+    dd_table_close(node->table, thd, &mdl, false);
+
+    node->table = nullptr;
+
+    return (DB_SUCCESS);
+  }
+
   /* Iterate over all the indexes and undo the insert.*/
 
   node->index = node->table->first_index();
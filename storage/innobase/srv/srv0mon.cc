@@ -135,6 +135,12 @@ static monitor_info_t innodb_counter_info[] = {
      "Number of times a wait-for graph was scanned in search for deadlocks",
      MONITOR_DEFAULT_ON, MONITOR_DEFAULT_START, MONITOR_DEADLOCK_ROUNDS},
 
+    {"lock_deadlock_check_usec", "lock",
+     "Time (in microseconds) spent taking snapshots of the wait-for graph, "
+     "searching for deadlocks in it and updating schedule weights",
+     MONITOR_DEFAULT_ON, MONITOR_DEFAULT_START,
+     MONITOR_DEADLOCK_CHECK_MICROSECOND},
+
     {"lock_threads_waiting", "lock",
      "Number of query threads sleeping waiting for a lock",
      static_cast<monitor_type_t>(MONITOR_DEFAULT_ON | MONITOR_DISPLAY_CURRENT),
@@ -159,6 +159,10 @@ ulong srv_undo_tablespaces = FSP_IMPLICIT_UNDO_TABLESPACES;
 /* The number of rollback segments per tablespace */
 ulong srv_rollback_segments = TRX_SYS_N_RSEGS;
 
+/* If true, each thread keeps assigning the rollback segment it used last to
+its transactions. */
+bool srv_rollback_segment_affinity = false;
+
 /* Used for the deprecated setting innodb_undo_logs. This will still get
 put into srv_rollback_segments if it is set to a non-default value. */
 ulong srv_undo_logs = 0;
@@ -216,8 +220,14 @@ OS (provided we compiled Innobase with it in), otherwise we will
 use simulated aio we build below with threads. */
 bool srv_use_native_aio = false;
 
+bool srv_use_io_uring = false;
+
+bool srv_io_uring_sqpoll = false;
+
 bool srv_numa_interleave = false;
 
+bool srv_numa_local_buffer_pool = false;
+
 #ifdef UNIV_DEBUG
 /** Force all user tables to use page compression. */
 ulong srv_debug_compress;
@@ -258,6 +268,15 @@ ulong srv_log_write_ahead_size;
 /** Whether to activate/pause the log writer threads. */
 bool srv_log_writer_threads;
 
+/** Whether redo log files are memory mapped and written with non-temporal
+stores, when they are on persistent memory (DAX), instead of being written
+with write() and persisted with fsync(). */
+bool srv_log_pmem = false;
+
+/** Whether concurrent reservations of space in the log buffer are combined
+into a single update of log_t::sn. */
+bool srv_log_reserve_combining = false;
+
 /** Minimum absolute value of cpu time for which spin-delay is used. */
 uint srv_log_spin_cpu_abs_lwm;
 
@@ -507,6 +526,14 @@ ulong srv_adaptive_flushing_lwm = 10;
 /* Number of iterations over which adaptive flushing is averaged. */
 ulong srv_flushing_avg_loops = 30;
 
+/* Number of seconds of redo generation at the recent rate that adaptive
+flushing adds to the checkpoint age, 0 to use the current age only. */
+ulong srv_adaptive_flushing_lookahead = 0;
+
+/* If true, the page cleaner coordinator does not wait for slow buffer pool
+instances before starting the next round on the others. */
+bool srv_page_cleaner_independent = false;
+
 /* The number of purge threads to use.*/
 ulong srv_n_purge_threads = 4;
 
@@ -538,6 +565,9 @@ This is for testing and debugging only. */
 ulong srv_force_recovery_crash;
 #endif /* UNIV_DEBUG */
 
+/** Number of threads applying redo log records to pages during recovery. */
+ulong srv_recovery_apply_threads;
+
 /** Print all user-level transactions deadlocks to mysqld stderr */
 bool srv_print_all_deadlocks = false;
 
@@ -576,6 +606,9 @@ this many index pages, there are 2 ways to calculate statistics:
 unsigned long long srv_stats_transient_sample_pages = 8;
 bool srv_stats_persistent = true;
 bool srv_stats_include_delete_marked = false;
+/** Whether persistent statistics dive below the middle record of each
+segment instead of a random one, see dict_stats_analyze_index_for_n_prefix() */
+bool srv_stats_deterministic_sampling = false;
 unsigned long long srv_stats_persistent_sample_pages = 20;
 bool srv_stats_auto_recalc = true;
 
@@ -589,6 +622,8 @@ ulong srv_n_spin_wait_rounds = 30;
 ulong srv_spin_wait_delay = 6;
 bool srv_priority_boost = true;
 
+bool srv_mvcc_csn = false;
+
 #ifndef UNIV_HOTBACKUP
 static ulint srv_n_rows_inserted_old = 0;
 static ulint srv_n_rows_updated_old = 0;
@@ -1640,6 +1675,8 @@ void srv_export_innodb_status(void) {
   export_vars.innodb_buffer_pool_resize_status_progress =
       buf_pool_resize_status_progress.load();
 
+  buf_flush_update_exported_variables();
+
   export_vars.innodb_page_size = UNIV_PAGE_SIZE;
 
   export_vars.innodb_log_waits = srv_stats.log_waits;
@@ -2915,8 +2952,17 @@ static ulint srv_do_purge(ulint *n_total_purged) {
   }
 
   do {
-    if (trx_sys->rseg_history_len.load() > rseg_history_len ||
-        (srv_max_purge_lag > 0 && rseg_history_len > srv_max_purge_lag)) {
+    const auto history_len = trx_sys->rseg_history_len.load();
+
+    if ((srv_max_purge_lag > 0 && history_len > srv_max_purge_lag) ||
+        history_len > n_threads * srv_purge_batch_size) {
+      /* History is longer than what all the threads purge in one batch,
+      or than the configured lag: waiting for it to grow batch after batch
+      before adding one thread at a time only lets it grow further. */
+
+      n_use_threads = n_threads;
+
+    } else if (history_len > rseg_history_len) {
       /* History length is now longer than what it was
       when we took the last snapshot. Use more threads. */
 
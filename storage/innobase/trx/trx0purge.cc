@@ -34,6 +34,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <new>
 #include <unordered_map>
 
+#include "buf0rea.h"
 #include "clone0api.h"
 #include "clone0clone.h"
 #include "dict0dd.h"
@@ -65,6 +66,8 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "trx0rseg.h"
 #include "trx0trx.h"
 
+#include "sql_thd_internal_api.h"
+
 /** Maximum allowable purge history length.  <=0 means 'infinite'. */
 ulong srv_max_purge_lag = 0;
 
@@ -1609,7 +1612,13 @@ static void trx_purge_truncate_history(purge_iter_t *limit,
   /* Purge rollback segments in all undo tablespaces.  This may take
   some time and we do not want an undo DDL to attempt an x_lock during
   this time.  If it did, all other transactions seeking a short s_lock()
-  would line up behind it.  So get the ddl_mutex before this s_lock(). */
+  would line up behind it.  So get the ddl_mutex before this s_lock().
+  The undo truncate thread holds the ddl_mutex while it deletes and creates
+  files. Rather than waiting for that, leave the history of the undo
+  tablespaces to the next batch. */
+  if (purge_sys->undo_trunc.is_truncating()) {
+    goto truncate_system_rsegs;
+  }
   mutex_enter(&undo::ddl_mutex);
   undo::spaces->s_lock();
   for (auto undo_space : undo::spaces->m_spaces) {
@@ -1633,6 +1642,7 @@ static void trx_purge_truncate_history(purge_iter_t *limit,
   undo::spaces->s_unlock();
   mutex_exit(&undo::ddl_mutex);
 
+truncate_system_rsegs:
   /* Purge rollback segments in the system tablespace, if any.
   Use an s-lock for the whole list since it can have gaps and
   may be sorted when added to. */
@@ -1653,8 +1663,44 @@ static void trx_purge_truncate_history(purge_iter_t *limit,
                    counter_time_truncate_history);
 }
 
+/** The thread which truncates the marked undo tablespace in the background,
+see trx_purge_truncate_undo_spaces(). */
+static IB_thread undo_truncate_thread;
+
+/** Body of the undo truncate thread. */
+static void trx_purge_undo_truncate_thread() {
+  THD *thd = create_internal_thd();
+
+  trx_purge_truncate_marked_undo();
+
+  destroy_internal_thd(thd);
+
+  purge_sys->undo_trunc.set_truncating(false);
+}
+
+/** Checks if the tablespace marked for truncate was made inactive by
+ALTER UNDO TABLESPACE ... SET INACTIVE rather than by the purge coordinator.
+@return true if it was made inactive explicitly */
+static bool trx_purge_marked_undo_is_inactive_explicit() {
+  undo::spaces->s_lock();
+
+  undo::Tablespace *marked_space =
+      undo::spaces->find(purge_sys->undo_trunc.get_marked_space_num());
+
+  const bool explicit_inactive =
+      marked_space != nullptr && marked_space->rsegs()->is_inactive_explicit();
+
+  undo::spaces->s_unlock();
+
+  return explicit_inactive;
+}
+
 /** Select an undo tablespace to truncate, make sure it is empty of undo logs,
-then finally truncate it. */
+then finally truncate it.
+Deleting and re-creating the file can take long, so while the server is
+running, a tablespace marked by the purge coordinator is truncated by a
+separate thread, and purge batches go on meanwhile. A tablespace made inactive
+explicitly, or marked during shutdown, is truncated synchronously. */
 static void trx_purge_truncate_undo_spaces() {
   /* If the server has been started for the purpose of upgrading from a
   previous version, do not do undo truncation. */
@@ -1664,6 +1710,18 @@ static void trx_purge_truncate_undo_spaces() {
 
   auto &undo_trunc = purge_sys->undo_trunc;
 
+  if (undo_trunc.is_truncating() &&
+      srv_shutdown_state.load() == SRV_SHUTDOWN_NONE) {
+    return;
+  }
+
+  /* Reap the undo truncate thread. It has ended, unless we are shutting
+  down, in which case we wait for it. */
+  if (undo_truncate_thread.state() != IB_thread::State::INVALID) {
+    undo_truncate_thread.join();
+    undo_truncate_thread = IB_thread{};
+  }
+
   /* Truncate as many undo spaces as can be truncated.
   Break the loop and return whenever the process cannot be completed. */
   for (size_t i = 0; i < undo::spaces->size(); ++i) {
@@ -1685,6 +1743,15 @@ static void trx_purge_truncate_undo_spaces() {
     /* A space has been marked and is now empty. */
     ut_a(undo_trunc.is_marked_space_empty());
 
+    if (srv_shutdown_state.load() == SRV_SHUTDOWN_NONE &&
+        !trx_purge_marked_undo_is_inactive_explicit()) {
+      undo_trunc.set_truncating(true);
+      undo_truncate_thread = os_thread_create(srv_undo_truncate_thread_key, 0,
+                                              trx_purge_undo_truncate_thread);
+      undo_truncate_thread.start();
+      break;
+    }
+
     /* Truncate the marked space. */
     if (!trx_purge_truncate_marked_undo()) {
       /* If the marked and empty space did not get truncated due to a concurrent
@@ -1801,6 +1868,54 @@ static void trx_purge_rseg_get_next_history_log(
   rseg->unlatch();
 }
 
+/** The maximum number of pages of an undo log that the coordinator reads ahead
+when it starts to parse that log, see trx_purge_prefetch_undo_log(). */
+static constexpr page_no_t TRX_PURGE_UNDO_PREFETCH_PAGES = 64;
+
+/** Issues asynchronous reads of the pages of an undo log which the coordinator
+is about to parse, so that forming a batch out of a large undo log does not
+wait for one synchronous page read after another.
+We only know the pages of the log by following the page list, one page at a
+time. However, the log header is on the first page of its undo segment, and a
+segment which spans several pages holds a single log whose pages are allocated
+with the hint of the next page number, so they are usually consecutive. We
+check that from the length and the last page of the list, and read ahead only
+in that case.
+@param[in]      space_id        undo tablespace
+@param[in]      hdr_page_no     the page of the undo log header
+@param[in]      page_size       page size */
+static void trx_purge_prefetch_undo_log(space_id_t space_id,
+                                        page_no_t hdr_page_no,
+                                        const page_size_t &page_size) {
+  mtr_t mtr;
+
+  mtr_start(&mtr);
+
+  const page_t *hdr_page = trx_undo_page_get_s_latched(
+      page_id_t(space_id, hdr_page_no), page_size, &mtr);
+
+  const flst_base_node_t *page_list =
+      hdr_page + TRX_UNDO_SEG_HDR + TRX_UNDO_PAGE_LIST;
+
+  const ulint n_pages = flst_get_len(page_list);
+  const fil_addr_t first = flst_get_first(page_list, &mtr);
+  const fil_addr_t last = flst_get_last(page_list, &mtr);
+
+  mtr_commit(&mtr);
+
+  if (n_pages <= 1 || first.page != hdr_page_no || last.page <= hdr_page_no ||
+      last.page - hdr_page_no + 1 != n_pages) {
+    return;
+  }
+
+  const page_no_t end = std::min<page_no_t>(
+      last.page, hdr_page_no + TRX_PURGE_UNDO_PREFETCH_PAGES);
+
+  for (page_no_t page_no = hdr_page_no + 1; page_no <= end; ++page_no) {
+    buf_read_page_background(page_id_t(space_id, page_no), page_size, false);
+  }
+}
+
 /** Position the purge sys "iterator" on the undo record to use for purging.
 @param[in,out]  purge_sys       purge instance
 @param[in]      page_size       page size */
@@ -1819,6 +1934,9 @@ static void trx_purge_read_undo_rec(trx_purge_t *purge_sys,
     mtr_t mtr;
     trx_undo_rec_t *undo_rec = nullptr;
 
+    trx_purge_prefetch_undo_log(purge_sys->rseg->space_id,
+                                purge_sys->hdr_page_no, page_size);
+
     mtr_start(&mtr);
 
     undo_rec = trx_undo_get_first_rec(
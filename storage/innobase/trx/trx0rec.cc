@@ -482,7 +482,8 @@ static ulint trx_undo_page_report_insert(
     trx_t *trx,                  /*!< in: transaction */
     dict_index_t *index,         /*!< in: clustered index */
     const dtuple_t *clust_entry, /*!< in: index entry which will be
-                                 inserted to the clustered index */
+                                 inserted to the clustered index, or
+                                 NULL for TRX_UNDO_EMPTY_REC */
     mtr_t *mtr)                  /*!< in: mtr */
 {
   ulint first_free;
@@ -509,9 +510,14 @@ static ulint trx_undo_page_report_insert(
   ptr += 2;
 
   /* Store first some general parameters to the undo log */
-  *ptr++ = TRX_UNDO_INSERT_REC;
+  *ptr++ = clust_entry == nullptr ? TRX_UNDO_EMPTY_REC : TRX_UNDO_INSERT_REC;
   ptr += mach_u64_write_much_compressed(ptr, trx->undo_no);
   ptr += mach_u64_write_much_compressed(ptr, index->table->id);
+
+  if (clust_entry == nullptr) {
+    /* The rows inserted into the empty index are not logged. */
+    return (trx_undo_page_set_next_prev_and_add(undo_page, ptr, mtr));
+  }
   /*----------------------------------------*/
   /* Store then the fields required to uniquely determine the record
   to be inserted in the clustered index */
@@ -2120,7 +2126,8 @@ dberr_t trx_undo_report_row_operation(
     dict_index_t *index,         /*!< in: clustered index */
     const dtuple_t *clust_entry, /*!< in: in the case of an insert,
                                  index entry to insert into the
-                                 clustered index, otherwise NULL */
+                                 clustered index, or NULL to log
+                                 TRX_UNDO_EMPTY_REC; otherwise NULL */
     const upd_t *update,         /*!< in: in the case of an update,
                                  the update vector, otherwise NULL */
     ulint cmpl_info,             /*!< in: compiler info on secondary
@@ -2156,7 +2163,7 @@ dberr_t trx_undo_report_row_operation(
 
   ut_ad(thr);
   ut_ad(!srv_read_only_mode);
-  ut_ad((op_type != TRX_UNDO_INSERT_OP) || (clust_entry && !update && !rec));
+  ut_ad((op_type != TRX_UNDO_INSERT_OP) || (!update && !rec));
 
   trx = thr_get_trx(thr);
 
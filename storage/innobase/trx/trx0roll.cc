@@ -204,6 +204,9 @@ static dberr_t trx_rollback_low(trx_t *trx) {
       return (trx_rollback_for_mysql_low(trx));
 
     case TRX_STATE_PREPARED:
+      /* Other transactions may have modified the rows of a transaction which
+      released its locks early, so its changes cannot be undone. */
+      ut_a(!trx->lock.released_early.load());
       /* Check an validate that undo is available for GTID. */
       trx_undo_gtid_add_update_undo(trx, false, true);
       ut_ad(!trx_is_autocommit_non_locking(trx));
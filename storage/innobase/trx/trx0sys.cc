@@ -573,6 +573,17 @@ void trx_sys_create(void) {
 
   trx_sys->serialisation_min_trx_no.store(0);
 
+  trx_sys->rw_trx_ids_version.store(0);
+
+  trx_sys->next_csn.store(1);
+  trx_sys->csn_map_n_moved.store(0);
+  trx_sys->csn_min_snapshot = 1;
+
+  if (srv_mvcc_csn) {
+    trx_sys->csn_map = static_cast<Trx_csn_slot *>(ut::zalloc_withkey(
+        UT_NEW_THIS_FILE_PSI_KEY, TRX_CSN_MAP_SIZE * sizeof(Trx_csn_slot)));
+  }
+
   ut_d(trx_sys->rw_max_trx_no = 0);
 
   new (&trx_sys->rw_trx_ids)
@@ -589,6 +600,46 @@ void trx_sys_create(void) {
   trx_sys->tmp_rsegs.set_empty();
 }
 
+void trx_sys_assign_csn(trx_t *trx) {
+  ut_ad(trx_sys_mutex_own());
+  ut_ad(trx->id > 0);
+
+  const auto csn = trx_sys->next_csn.load();
+
+  trx->csn.store(csn);
+
+  auto &slot = trx_sys->csn_map[trx->id % TRX_CSN_MAP_SIZE];
+  const auto old_trx_id = slot.m_trx_id.load();
+  const auto old_csn = slot.m_csn.load();
+
+  if (old_trx_id != 0 && old_csn >= trx_sys->csn_min_snapshot) {
+    trx_sys->csn_min_snapshot = trx_sys->mvcc->oldest_snapshot_csn();
+  }
+
+  if (old_trx_id != 0 && old_csn >= trx_sys->csn_min_snapshot) {
+    /* A read view may still have to know whether old_trx_id committed
+    before or after it was created. Readers look for the entry in the shard
+    when they miss it in the map, and retry if the counter has changed. */
+    const auto min_csn = trx_sys->csn_min_snapshot;
+
+    trx_sys->get_shard_by_trx_id(old_trx_id)
+        .active_rw_trxs.latch_and_execute(
+            [&](Trx_by_id_with_min &trx_by_id_with_min) {
+              trx_by_id_with_min.add_csn(old_trx_id, old_csn, min_csn);
+            },
+            UT_LOCATION_HERE);
+
+    trx_sys->csn_map_n_moved.fetch_add(1);
+  }
+
+  slot.m_trx_id.store(0);
+  slot.m_csn.store(csn);
+  slot.m_trx_id.store(trx->id);
+
+  /* Views created from now on do not see the transaction as active. */
+  trx_sys->next_csn.store(csn + 1);
+}
+
 /** Creates and initializes the transaction system at the database creation. */
 void trx_sys_create_sys_pages(void) {
   mtr_t mtr;
@@ -653,6 +704,10 @@ void trx_sys_close(void) {
 
   trx_sys->rw_trx_ids.~trx_ids_t();
 
+  if (trx_sys->csn_map != nullptr) {
+    ut::free(trx_sys->csn_map);
+  }
+
   ut::free(trx_sys);
 
   trx_sys = nullptr;
@@ -199,6 +199,8 @@ static void trx_init(trx_t *trx) {
 
   trx->lock.inherit_all.store(false);
 
+  trx->lock.released_early.store(false);
+
   trx->internal = false;
 
   trx->in_truncate = false;
@@ -1124,6 +1126,10 @@ If an rseg is not marked for undo tablespace truncation, we assign
 it to a transaction. We increment trx_ref_count to keep the purge
 thread from truncating the undo tablespace that contains this rseg
 until the transaction is done with it.
+With innodb_rollback_segment_affinity, a thread instead starts from the rseg
+it used last. Its transactions then reuse the same cached undo segment, whose
+first page holds the headers of many small undo logs, rather than dirtying the
+cached undo pages of every rseg in turn.
 @return assigned rollback segment instance */
 static trx_rseg_t *get_next_redo_rseg_from_undo_spaces() {
   undo::Tablespace *undo_space;
@@ -1144,13 +1150,19 @@ static trx_rseg_t *get_next_redo_rseg_from_undo_spaces() {
   ulint target_rollback_segments = srv_rollback_segments;
 
   static std::atomic<ulint> rseg_counter{0};
+  /** The position of the rseg which this thread was assigned last. */
+  thread_local ulint thread_rseg_pos = ULINT_UNDEFINED;
+  const bool affinity =
+      srv_rollback_segment_affinity && thread_rseg_pos != ULINT_UNDEFINED;
   trx_rseg_t *rseg = nullptr;
-  ulint current = rseg_counter;
+  ulint current = affinity ? thread_rseg_pos : rseg_counter.load();
 
   while (rseg == nullptr) {
     /* Increment the static redo_rseg_slot so the next call from any thread
     starts with the next rseg. */
-    rseg_counter.fetch_add(1);
+    if (!affinity) {
+      rseg_counter.fetch_add(1);
+    }
 
     /* Traverse the rsegs like this: (space, rseg_id)
     (0,0), (1,0), ... (n,0), (0,1), (1,1), ... (n,1), ... */
@@ -1181,6 +1193,8 @@ static trx_rseg_t *get_next_redo_rseg_from_undo_spaces() {
     if (rseg == nullptr) {
       continue;
     }
+
+    thread_rseg_pos = window;
   }
 
   undo::spaces->s_unlock();
@@ -1830,8 +1844,17 @@ static void trx_erase_lists(trx_t *trx) {
                                             trx_sys->rw_trx_ids.end(), trx->id);
 
   ut_ad(*it == trx->id);
+
+  /* Invalidate the views that AC-NL-RO transactions may reuse, see
+  MVCC::view_open(). */
+  trx_sys->rw_trx_ids_version.fetch_add(1);
+
   trx_sys->rw_trx_ids.erase(it);
 
+  if (srv_mvcc_csn) {
+    trx_sys_assign_csn(trx);
+  }
+
   if (trx->read_only || trx->rsegs.m_redo.rseg == nullptr) {
     ut_ad(!trx->in_rw_trx_list);
   } else {
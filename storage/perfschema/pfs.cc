@@ -6435,6 +6435,18 @@ void pfs_start_statement_vc(PSI_statement_locker *locker, const char *db,
         pfs_flags |= STATE_FLAG_BASE;
       }
 
+      /*
+        Sampling: only instrument one statement out of
+        performance_schema_statement_sample_rate in each thread.
+      */
+      if (pfs_flags != 0 && pfs_param.m_statement_sample_rate > 1 &&
+          pfs_thread != nullptr &&
+          pfs_thread->m_statement_sample_count++ %
+                  pfs_param.m_statement_sample_rate !=
+              0) {
+        pfs_flags = 0;
+      }
+
       /*
         WHAT PFS data to collect.
       */
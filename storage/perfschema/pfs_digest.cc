@@ -250,6 +250,104 @@ static LF_PINS *get_digest_hash_pins(PFS_thread *thread) {
   return thread->m_digest_hash_pins;
 }
 
+static void purge_digest(PFS_thread *thread, PFS_digest_key *hash_key);
+
+/**
+  Number of records examined to pick one to evict,
+  @sa evict_digest().
+*/
+static const uint DIGEST_EVICT_CANDIDATES = 8;
+
+/**
+  Free a record of the full digest array for a new digest, when
+  performance_schema_digest_eviction is enabled.
+  The record with the lowest total latency among the next
+  DIGEST_EVICT_CANDIDATES records is reset, so that the digests with the
+  highest latency stay in the table in the long run.
+  Statements still running with the evicted digest aggregate their
+  statistics in the new digest of the record.
+  @return the index of the freed record, or 0 if none was freed.
+*/
+static size_t evict_digest(PFS_thread *thread) {
+  PFS_statements_digest_stat *victim = nullptr;
+  size_t victim_index = 0;
+
+  for (uint i = 0; i < DIGEST_EVICT_CANDIDATES; i++) {
+    const size_t index = digest_monotonic_index.m_u32++ % digest_max;
+    if (index == 0) {
+      /* Record [0] is reserved. */
+      continue;
+    }
+
+    PFS_statements_digest_stat *candidate =
+        &statements_digest_stat_array[index];
+    if (!candidate->m_lock.is_populated() ||
+        candidate->m_query_sample_refs.load() != 0) {
+      continue;
+    }
+
+    if (victim == nullptr || candidate->m_stat.m_timer1_stat.m_sum <
+                                 victim->m_stat.m_timer1_stat.m_sum) {
+      victim = candidate;
+      victim_index = index;
+    }
+  }
+
+  if (victim == nullptr) {
+    return 0;
+  }
+
+  pfs_dirty_state dirty_state;
+  if (!victim->m_lock.try_allocated_to_dirty(&dirty_state)) {
+    /* Another thread is reclaiming this record. */
+    return 0;
+  }
+
+  purge_digest(thread, &victim->m_digest_key);
+  victim->m_histogram.reset();
+  victim->reset_data(
+      statements_digest_token_array + victim_index * pfs_max_digest_length,
+      pfs_max_digest_length,
+      statements_digest_query_sample_text_array +
+          victim_index * pfs_max_sqltext);
+  return victim_index;
+}
+
+/**
+  Populate a free record, owned as dirty by the caller, with a new digest.
+  @return the result of lf_hash_insert(). On success the record is
+  allocated, otherwise it is free again.
+*/
+static int insert_digest(PFS_statements_digest_stat *pfs,
+                         pfs_dirty_state *dirty_state, LF_PINS *pins,
+                         const PFS_digest_key &hash_key,
+                         const sql_digest_storage *digest_storage,
+                         ulonglong now) {
+  /* Copy digest hash/LF Hash search key. */
+  pfs->m_digest_key = hash_key;
+
+  /*
+    Copy digest storage to statement_digest_stat_array so that it could be
+    used later to generate digest text.
+  */
+  pfs->m_digest_storage.copy(digest_storage);
+
+  pfs->m_first_seen = now;
+  pfs->m_last_seen = now;
+
+  pfs->m_query_sample_refs = 0;
+
+  pfs->m_histogram.reset();
+
+  const int res = lf_hash_insert(&digest_hash, pins, &pfs);
+  if (likely(res == 0)) {
+    pfs->m_lock.dirty_to_allocated(dirty_state);
+  } else {
+    pfs->m_lock.dirty_to_free(dirty_state);
+  }
+  return res;
+}
+
 PFS_statements_digest_stat *find_or_create_digest(
     PFS_thread *thread, const sql_digest_storage *digest_storage,
     const char *schema_name, uint schema_name_length) {
@@ -304,6 +402,25 @@ search:
   lf_hash_search_unpin(pins);
 
   if (digest_full) {
+    if (pfs_param.m_digest_eviction) {
+      /* Take the record of a digest with a low latency, if possible. */
+      safe_index = evict_digest(thread);
+      if (safe_index != 0) {
+        pfs = &statements_digest_stat_array[safe_index];
+        if (pfs->m_lock.free_to_dirty(&dirty_state)) {
+          res = insert_digest(pfs, &dirty_state, pins, hash_key,
+                              digest_storage, now);
+          if (likely(res == 0)) {
+            return pfs;
+          }
+          if (res > 0 && ++retry_count <= retry_max) {
+            /* Duplicate insert by another thread */
+            goto search;
+          }
+        }
+      }
+    }
+
     /* digest_stat array is full. Add stat at index 0 and return. */
     pfs = &statements_digest_stat_array[0];
     digest_lost++;
@@ -328,30 +445,12 @@ search:
 
     if (pfs->m_lock.is_free()) {
       if (pfs->m_lock.free_to_dirty(&dirty_state)) {
-        /* Copy digest hash/LF Hash search key. */
-        pfs->m_digest_key = hash_key;
-
-        /*
-          Copy digest storage to statement_digest_stat_array so that it could be
-          used later to generate digest text.
-        */
-        pfs->m_digest_storage.copy(digest_storage);
-
-        pfs->m_first_seen = now;
-        pfs->m_last_seen = now;
-
-        pfs->m_query_sample_refs = 0;
-
-        pfs->m_histogram.reset();
-
-        res = lf_hash_insert(&digest_hash, pins, &pfs);
+        res = insert_digest(pfs, &dirty_state, pins, hash_key, digest_storage,
+                            now);
         if (likely(res == 0)) {
-          pfs->m_lock.dirty_to_allocated(&dirty_state);
           return pfs;
         }
 
-        pfs->m_lock.dirty_to_free(&dirty_state);
-
         if (res > 0) {
           /* Duplicate insert by another thread */
           if (++retry_count > retry_max) {
@@ -695,6 +695,7 @@ PFS_thread *create_thread(PFS_thread_class *klass, PSI_thread_seqnum seqnum,
     child_stage->m_class = nullptr;
 
     pfs->m_events_statements_count = 0;
+    pfs->m_statement_sample_count = 0;
     pfs->m_transaction_current.m_event_id = 0;
 
     if (klass->is_singleton()) {
@@ -638,6 +638,11 @@ struct PFS_ALIGNED PFS_thread : PFS_connection_slice {
 
   /** Size of @c m_events_statements_stack. */
   uint m_events_statements_count;
+  /**
+    Statements started by this thread, used to instrument one statement
+    out of @c pfs_param.m_statement_sample_rate.
+  */
+  ulonglong m_statement_sample_count;
   PFS_events_statements *m_statement_stack;
 
   PFS_events_transactions m_transaction_current;
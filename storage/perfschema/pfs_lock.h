@@ -216,6 +216,32 @@ struct pfs_lock {
     return pass;
   }
 
+  /**
+    Execute an allocated to dirty transition, to reclaim a record owned by
+    no writer in particular.
+    This transition is safe to execute concurrently by multiple writers.
+    Only one writer will succeed to acquire the record.
+    @return true if the operation succeed
+  */
+  bool try_allocated_to_dirty(pfs_dirty_state *copy_ptr) {
+    uint32 old_val = m_version_state.load();
+
+    if ((old_val & STATE_MASK) != PFS_LOCK_ALLOCATED) {
+      return false;
+    }
+
+    const uint32 new_val = (old_val & VERSION_MASK) + PFS_LOCK_DIRTY;
+
+    const bool pass =
+        atomic_compare_exchange_strong(&m_version_state, &old_val, new_val);
+
+    if (pass) {
+      copy_ptr->m_version_state = new_val;
+    }
+
+    return pass;
+  }
+
   /**
     Execute an allocated to dirty transition.
     This transition should be executed by the writer that owns the record,
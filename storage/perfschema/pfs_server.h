@@ -301,6 +301,12 @@ struct PFS_global_param {
   /** Maximum age in seconds for a query sample. */
   ulong m_max_digest_sample_age;
 
+  /** Evict low latency digests when the digest table is full. */
+  bool m_digest_eviction;
+
+  /** Instrument one statement out of this many, per thread. */
+  ulong m_statement_sample_rate;
+
   /** Maximum number of error instrumented */
   ulong m_error_sizing;
 
@@ -148,7 +148,7 @@ void PFS_connection_iterator::visit_global(bool with_hosts, bool with_users,
 
   if (with_THDs) {
     All_THD_visitor_adapter adapter(visitor);
-    Global_THD_manager::get_instance()->do_for_all_thd(&adapter);
+    Global_THD_manager::get_instance()->do_for_all_thd_copy(&adapter);
   }
 }
 
@@ -220,7 +220,7 @@ void PFS_connection_iterator::visit_host(PFS_host *host, bool with_accounts,
 
   if (with_THDs) {
     All_host_THD_visitor_adapter adapter(visitor, host);
-    Global_THD_manager::get_instance()->do_for_all_thd(&adapter);
+    Global_THD_manager::get_instance()->do_for_all_thd_copy(&adapter);
   }
 }
 
@@ -292,7 +292,7 @@ void PFS_connection_iterator::visit_user(PFS_user *user, bool with_accounts,
 
   if (with_THDs) {
     All_user_THD_visitor_adapter adapter(visitor, user);
-    Global_THD_manager::get_instance()->do_for_all_thd(&adapter);
+    Global_THD_manager::get_instance()->do_for_all_thd_copy(&adapter);
   }
 }
 
@@ -339,7 +339,7 @@ void PFS_connection_iterator::visit_account(PFS_account *account,
 
   if (with_THDs) {
     All_account_THD_visitor_adapter adapter(visitor, account);
-    Global_THD_manager::get_instance()->do_for_all_thd(&adapter);
+    Global_THD_manager::get_instance()->do_for_all_thd_copy(&adapter);
   }
 }
 
@@ -445,6 +445,18 @@ class Allocator {
    * before other methods. */
   static void init();
 
+  /** Create a new block of the size suggested by the allocation scheme. If
+   * RAM and MMAP budgets cannot fit it anymore, fall back to the smallest
+   * block which can fit the request before giving up. This lets the table
+   * fill the remaining budget instead of being converted to an on-disk table
+   * early because of a large exponential block size.
+   * @return the new block */
+  static Block create_block(
+      /** [in] Block size suggested by the allocation scheme. */
+      size_t block_size,
+      /** [in] Number of bytes requested by the client code. */
+      size_t n_bytes_requested);
+
   /**
     Shared state between all the copies and rebinds of this allocator.
     See AllocatorState for details.
@@ -520,8 +532,7 @@ inline T *Allocator<T, AllocationScheme>::allocate(size_t n_elements) {
   if (m_shared_block && m_shared_block->is_empty()) {
     const size_t block_size =
         AllocationScheme::block_size(0, n_bytes_requested);
-    *m_shared_block =
-        Block(block_size, AllocationScheme::block_source(block_size));
+    *m_shared_block = create_block(block_size, n_bytes_requested);
     block = m_shared_block;
   } else if (m_shared_block &&
              m_shared_block->can_accommodate(n_bytes_requested)) {
@@ -530,8 +541,7 @@ inline T *Allocator<T, AllocationScheme>::allocate(size_t n_elements) {
              !m_state->current_block.can_accommodate(n_bytes_requested)) {
     const size_t block_size = AllocationScheme::block_size(
         m_state->number_of_blocks, n_bytes_requested);
-    m_state->current_block =
-        Block(block_size, AllocationScheme::block_source(block_size));
+    m_state->current_block = create_block(block_size, n_bytes_requested);
     block = &m_state->current_block;
     ++m_state->number_of_blocks;
   } else {
@@ -614,6 +624,23 @@ inline void Allocator<T, AllocationScheme>::init() {
   Block_PSI_init();
 }
 
+template <class T, class AllocationScheme>
+inline Block Allocator<T, AllocationScheme>::create_block(
+    size_t block_size, size_t n_bytes_requested) {
+  const size_t min_block_size = Block::size_hint(n_bytes_requested);
+  Source source;
+  try {
+    source = AllocationScheme::block_source(block_size);
+  } catch (Result result) {
+    if (result != Result::RECORD_FILE_FULL || block_size <= min_block_size) {
+      throw;
+    }
+    block_size = min_block_size;
+    source = AllocationScheme::block_source(block_size);
+  }
+  return Block(block_size, source);
+}
+
 } /* namespace temptable */
 
 #endif /* TEMPTABLE_ALLOCATOR_H */
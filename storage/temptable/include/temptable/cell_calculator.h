@@ -29,6 +29,7 @@ TempTable Cell_calculator declaration. */
 #include <algorithm>
 #include <cstdint>
 
+#include "my_byteorder.h"
 #include "my_dbug.h"
 #include "my_murmur3.h"
 #include "mysql/strings/m_ctype.h"
@@ -81,6 +82,14 @@ class Cell_calculator {
 
   static const CHARSET_INFO *field_charset(const Field &field);
 
+  /** Decide if the field is a fixed width integer which can be compared
+   * without calling into Field. Sets m_int_length and m_is_unsigned. */
+  void detect_integer(const Field &field);
+
+  /** Compare two integers of m_int_length bytes, as stored by Field. */
+  int compare_integers(const unsigned char *lhs,
+                       const unsigned char *rhs) const;
+
   /** Field for which this calculator was created. */
   const Field *m_mysql_field;
 
@@ -96,6 +105,13 @@ class Cell_calculator {
   /** True if the cell is right-padded with spaces (CHAR column). */
   bool m_is_space_padded;
 
+  /** True if an integer stored in m_int_length bytes is unsigned. */
+  bool m_is_unsigned;
+
+  /** Length of an integer cell, which is compared directly rather than by
+   * Field::key_cmp(). 0 for all other cells. Only used in BINARY mode. */
+  uint8_t m_int_length;
+
   /** Length in number of characters.
    * Only used in CHARSET_AND_CHAR_LENGTH mode. */
   uint32_t m_char_length;
@@ -115,6 +131,8 @@ inline Cell_calculator::Cell_calculator(const KEY_PART_INFO &mysql_key_part)
       m_is_floating_point(m_mysql_field->key_type() == HA_KEYTYPE_FLOAT ||
                           m_mysql_field->key_type() == HA_KEYTYPE_DOUBLE),
       m_is_space_padded(m_mysql_field->key_type() == HA_KEYTYPE_TEXT),
+      m_is_unsigned(false),
+      m_int_length(0),
       m_char_length(0) {
   /* Mimic hp_hashnr() from storage/heap/hp_hash.c. */
 
@@ -133,6 +151,7 @@ inline Cell_calculator::Cell_calculator(const KEY_PART_INFO &mysql_key_part)
     }
   } else {
     m_mode = Mode::BINARY;
+    detect_integer(*m_mysql_field);
   }
 }
 
@@ -142,6 +161,8 @@ inline Cell_calculator::Cell_calculator(const Field *mysql_field)
       m_is_floating_point(m_mysql_field->key_type() == HA_KEYTYPE_FLOAT ||
                           m_mysql_field->key_type() == HA_KEYTYPE_DOUBLE),
       m_is_space_padded(m_mysql_field->key_type() == HA_KEYTYPE_TEXT),
+      m_is_unsigned(false),
+      m_int_length(0),
       m_char_length(0) {
   /* Mimic hp_hashnr() from storage/heap/hp_hash.c. */
 
@@ -151,6 +172,7 @@ inline Cell_calculator::Cell_calculator(const Field *mysql_field)
     m_mode = Mode::CHARSET;
   } else {
     m_mode = Mode::BINARY;
+    detect_integer(*m_mysql_field);
   }
 }
 
@@ -173,6 +195,64 @@ inline const CHARSET_INFO *Cell_calculator::field_charset(const Field &field) {
   }
 }
 
+inline void Cell_calculator::detect_integer(const Field &field) {
+  /* Integer columns are the common GROUP BY and DISTINCT keys. Their Field
+   * comparison is a virtual call which only reads a little-endian integer, so
+   * decide here once and compare the stored bytes directly. */
+  switch (field.key_type()) {
+    case HA_KEYTYPE_SHORT_INT:
+    case HA_KEYTYPE_LONG_INT:
+    case HA_KEYTYPE_LONGLONG:
+      m_is_unsigned = false;
+      break;
+    case HA_KEYTYPE_USHORT_INT:
+    case HA_KEYTYPE_ULONG_INT:
+    case HA_KEYTYPE_ULONGLONG:
+      m_is_unsigned = true;
+      break;
+    default:
+      return;
+  }
+
+  const uint32_t length = field.pack_length();
+  if (length == 2 || length == 4 || length == 8) {
+    m_int_length = static_cast<uint8_t>(length);
+  }
+}
+
+inline int Cell_calculator::compare_integers(const unsigned char *lhs,
+                                             const unsigned char *rhs) const {
+  if (m_is_unsigned) {
+    uint64_t l;
+    uint64_t r;
+    if (m_int_length == 2) {
+      l = uint2korr(lhs);
+      r = uint2korr(rhs);
+    } else if (m_int_length == 4) {
+      l = uint4korr(lhs);
+      r = uint4korr(rhs);
+    } else {
+      l = uint8korr(lhs);
+      r = uint8korr(rhs);
+    }
+    return l < r ? -1 : (l > r ? 1 : 0);
+  }
+
+  int64_t l;
+  int64_t r;
+  if (m_int_length == 2) {
+    l = sint2korr(lhs);
+    r = sint2korr(rhs);
+  } else if (m_int_length == 4) {
+    l = sint4korr(lhs);
+    r = sint4korr(rhs);
+  } else {
+    l = sint8korr(lhs);
+    r = sint8korr(rhs);
+  }
+  return l < r ? -1 : (l > r ? 1 : 0);
+}
+
 inline size_t Cell_calculator::hash(const Cell &cell) const {
   if (cell.is_null()) {
     return 1;
@@ -278,6 +358,10 @@ inline int Cell_calculator::compare(const Cell &lhs, const Cell &rhs) const {
   /* Note: Using if-s instead of switch due to bug mentioned in hash(). */
 
   if (m_mode == Mode::BINARY) {
+    if (m_int_length != 0 && lhs_data_length == m_int_length &&
+        rhs_data_length == m_int_length) {
+      return compare_integers(lhs_data, rhs_data);
+    }
     return const_cast<Field *>(m_mysql_field)->key_cmp(lhs_data, rhs_data);
   } else if (m_mode == Mode::CHARSET) {
     lhs_length = lhs_data_length;
@@ -86,6 +86,10 @@ constexpr size_t KV_STORE_SHARDS_COUNT = 16 * 1024;
 /** Size of a pool containing shared-blocks. */
 constexpr size_t SHARED_BLOCK_POOL_SIZE = 16 * 1024;
 
+/** Largest shared-block which is kept in the pool when its THD releases it.
+ * Covers the first block created by `Allocator` (1 MiB plus metadata). */
+constexpr size_t SHARED_BLOCK_RETAIN_MAX_BYTES = 2_MiB;
+
 } /* namespace temptable */
 
 #endif /* TEMPTABLE_CONSTANTS_H */
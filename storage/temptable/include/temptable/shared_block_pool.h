@@ -95,6 +95,23 @@ class Lock_free_shared_block_pool {
   /** Lock-free slots. */
   Shared_block_slot m_slot{FREE_SLOT};
 
+  /** Decide if a released Block can be left in its slot for the next THD
+   * which maps to it. Connections which come and go would otherwise malloc()
+   * and free() a block each time they use a temporary table. Only the small
+   * RAM blocks are kept, and only while RAM consumption stays well below
+   * temptable_max_ram, so that idle blocks do not push tables which are in
+   * use to MMAP or to disk. Kept blocks stay accounted in MemoryMonitor.
+   *
+   * [in] block Block being released.
+   * @return true if the block can be kept. */
+  static bool can_retain(const Block &block) {
+    return block.type() == Source::RAM &&
+           block.number_of_used_chunks() == 0 &&
+           block.size() <= SHARED_BLOCK_RETAIN_MAX_BYTES &&
+           MemoryMonitor::RAM::consumption() <=
+               MemoryMonitor::RAM::threshold() / 2;
+  }
+
  public:
   /** Given the THD identifier, try to acquire an instance of Block. In the
    * event of success, non-nullptr instance of Block will be returned and
@@ -121,7 +138,8 @@ class Lock_free_shared_block_pool {
 
   /** Given the THD identifier, try to release an acquired instance of a
    * Block. In the event of success, slot will be marked as non-occupied.
-   * Assuming that Block is not empty, it will also be destroyed.
+   * Assuming that Block is not empty, it will also be destroyed, unless it
+   * can be retained for reuse (see can_retain()).
    *
    * Trying to release the Block/slot by using some other THD identifier is not
    * possible and will therefore render this operation as failed.
@@ -133,19 +151,38 @@ class Lock_free_shared_block_pool {
     auto slot_idx = thd_id & MODULO_MASK;
     if (m_slot.load(slot_idx) == thd_id) {
       auto &block = m_shared_block[slot_idx].block;
-      if (!block.is_empty()) {
-        if (block.type() == Source::RAM) {
-          MemoryMonitor::RAM::decrease(block.size());
-        } else if (block.type() == Source::MMAP_FILE) {
-          MemoryMonitor::MMAP::decrease(block.size());
-        }
-        block.destroy();
+      if (!block.is_empty() && !can_retain(block)) {
+        destroy(block);
       }
       m_slot.store(slot_idx, FREE_SLOT);
       return true;
     }
     return false;
   }
+
+  /** Destroy the Blocks which were retained in free slots. Must be called
+   * when no THD can acquire a slot anymore, e.g. at plugin shutdown. */
+  void destroy_retained() {
+    for (size_t slot_idx = 0; slot_idx < POOL_SIZE; ++slot_idx) {
+      auto &block = m_shared_block[slot_idx].block;
+      if (m_slot.load(slot_idx) == FREE_SLOT && !block.is_empty()) {
+        destroy(block);
+      }
+    }
+  }
+
+ private:
+  /** Destroy the Block and account for the memory it gave back.
+   *
+   * [in,out] block Non-empty Block to destroy. */
+  static void destroy(Block &block) {
+    if (block.type() == Source::RAM) {
+      MemoryMonitor::RAM::decrease(block.size());
+    } else if (block.type() == Source::MMAP_FILE) {
+      MemoryMonitor::MMAP::decrease(block.size());
+    }
+    block.destroy();
+  }
 };
 
 }  // namespace temptable
@@ -61,6 +61,13 @@ void shared_block_pool_release(THD *thd) {
   shared_block_pool.try_release(thd_thread_id(thd));
 }
 
+/** Small helper function which frees the Blocks which shared-block pool kept
+ * around for reuse after their THDs released them.
+ * */
+void shared_block_pool_destroy_retained() {
+  shared_block_pool.destroy_retained();
+}
+
 #if defined(HAVE_WINNUMA)
 /** Page size used in memory allocation. */
 DWORD win_page_size;
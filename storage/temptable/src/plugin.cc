@@ -63,6 +63,11 @@ static int init(void *p) {
   return 0;
 }
 
+static int deinit(void *) {
+  temptable::shared_block_pool_destroy_retained();
+  return 0;
+}
+
 // clang-format off
 mysql_declare_plugin(temptable) {
   MYSQL_STORAGE_ENGINE_PLUGIN,
@@ -75,7 +80,7 @@ mysql_declare_plugin(temptable) {
   /* check uninstall */
   nullptr,
   /* destroy */
-  nullptr,
+  deinit,
   /* 1.0 */
   0x0100,
   /* status variables */
@@ -4935,10 +4935,45 @@ static size_t my_strnxfrm_any_uca(const CHARSET_INFO *cs, uint8_t *dst,
                          flags);
 }
 
+/**
+  Find the length of the longest common prefix of two strings which consists
+  of ASCII characters only.
+*/
+static inline size_t common_ascii_prefix(const uint8_t *s, size_t slen,
+                                         const uint8_t *t, size_t tlen) {
+  const size_t len = std::min(slen, tlen);
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t)) {
+    uint64_t s8;
+    uint64_t t8;
+    memcpy(&s8, s + i, sizeof(s8));
+    memcpy(&t8, t + i, sizeof(t8));
+    if (s8 != t8 || (s8 & 0x8080808080808080ULL) != 0) break;
+  }
+  while (i < len && s[i] == t[i] && s[i] < 0x80) ++i;
+  return i;
+}
+
 static int my_strnncoll_uca_900(const CHARSET_INFO *cs, const uint8_t *s,
                                 size_t slen, const uint8_t *t, size_t tlen,
                                 bool t_is_prefix) {
   if (cs->cset->mb_wc == my_mb_wc_utf8mb4_thunk) {
+    /*
+      Without contractions and reordering, each code point gets its own
+      weights independently of its neighbours, so a common prefix of both
+      strings gives identical weights on every level and cannot decide the
+      comparison. Skip it, as long as it is plain ASCII so that it cannot end
+      in the middle of a character or hide an invalid byte sequence. Keys
+      next to each other in an index or in a sort often share long prefixes.
+    */
+    if (!my_uca_have_contractions(cs->uca) && cs->coll_param == nullptr) {
+      const size_t prefix = common_ascii_prefix(s, slen, t, tlen);
+      s += prefix;
+      slen -= prefix;
+      t += prefix;
+      tlen -= prefix;
+    }
+
     switch (cs->levels_for_compare) {
       case 1:
         return my_strnncoll_uca<uca_scanner_900<Mb_wc_utf8mb4, 1>, 1>(
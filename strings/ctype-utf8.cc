@@ -5692,12 +5692,37 @@ static size_t my_strnxfrmlen_utf8mb3(const CHARSET_INFO *cs [[maybe_unused]],
 }
 }  // extern "C"
 
+/**
+  Skips whole 8-byte words of ASCII characters at the start of [b, e), but no
+  more than max_chars characters. Every ASCII character is well-formed in
+  both utf8mb3 and utf8mb4, so validation can resume after them.
+
+  @return The number of bytes (and characters) skipped.
+*/
+static inline size_t skip_ascii_words(const char *b, const char *e,
+                                      size_t max_chars) {
+  const char *start = b;
+  const size_t limit = std::min<size_t>(e - b, max_chars);
+  const char *safe_end = b + (limit & ~size_t{7});
+  while (b < safe_end) {
+    uint64_t data;
+    memcpy(&data, b, sizeof(data));
+    if (data & 0x8080808080808080ULL) break;
+    b += sizeof(data);
+  }
+  return b - start;
+}
+
 extern "C" {
 static size_t my_well_formed_len_utf8mb3(const CHARSET_INFO *, const char *b,
                                          const char *e, size_t pos,
                                          int *error) {
   const char *b_start = b;
   *error = 0;
+  // Fast path as long as we see ASCII characters only.
+  const size_t ascii_length = skip_ascii_words(b, e, pos);
+  b += ascii_length;
+  pos -= ascii_length;
   while (pos) {
     int mb_len;
 
@@ -7664,6 +7689,10 @@ static size_t my_well_formed_len_utf8mb4(const CHARSET_INFO *cs, const char *b,
                                          int *error) {
   const char *b_start = b;
   *error = 0;
+  // Fast path as long as we see ASCII characters only.
+  const size_t ascii_length = skip_ascii_words(b, e, pos);
+  b += ascii_length;
+  pos -= ascii_length;
   while (pos) {
     int mb_len;
 
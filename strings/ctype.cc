@@ -33,7 +33,6 @@
 #include <cstring>
 #include <memory>
 
-#include "my_byteorder.h"
 #include "my_sys.h"
 #include "my_xml.h"
 #include "mysql/my_loglevel.h"
@@ -923,19 +922,17 @@ size_t my_convert(char *to, size_t to_length, const CHARSET_INFO *to_cs,
 
   length = length2 = std::min(to_length, from_length);
 
-#if defined(__i386__) || defined(_WIN32) || defined(__x86_64__)
   /*
-    Special loop for i386, it allows to refer to a
-    non-aligned memory block as UINT32, which makes
-    it possible to copy four bytes at once. This
-    gives about 10% performance improvement comparing
-    to byte-by-byte loop.
+    Copy eight bytes at once as long as they are all ASCII. Going through
+    memcpy() keeps unaligned access portable, and the compiler turns it
+    into plain 64-bit loads and stores.
   */
-  for (; length >= 4; length -= 4, from += 4, to += 4) {
-    if (uint4korr(from) & 0x80808080) break;
-    int4store(to, uint4korr(from));
+  for (; length >= 8; length -= 8, from += 8, to += 8) {
+    uint64_t data;
+    memcpy(&data, from, sizeof(data));
+    if (data & 0x8080808080808080ULL) break;
+    memcpy(to, &data, sizeof(data));
   }
-#endif /* __i386__ */
 
   for (;; *to++ = *from++, length--) {
     if (!length) {
@@ -56,6 +56,8 @@
 #include <cassert>
 #include <cerrno>
 #include <cfloat>
+#include <charconv>
+#include <cmath>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
@@ -82,6 +84,7 @@
 static double my_strtod_int(const char *, const char **, int *, char *, size_t);
 static char *dtoa(double, int, int, int *, int *, char **, char *, size_t);
 static void dtoa_free(char *, char *, size_t);
+static int shortest_digits(double, int, char *, int *);
 
 /**
    @brief
@@ -309,15 +312,21 @@ size_t my_gcvt(double x, my_gcvt_arg_type type, int width, char *to,
   /* We want to remove '-' from equations early */
   if (x < 0.) width--;
 
-  res =
-      dtoa(x, 4, type == MY_GCVT_ARG_DOUBLE ? width : std::min(width, FLT_DIG),
-           &decpt, &sign, &end, buf, sizeof(buf));
-  if (decpt == DTOA_OVERFLOW) {
-    dtoa_free(res, buf, sizeof(buf));
-    *to++ = '0';
-    *to = '\0';
-    if (error != nullptr) *error = true;
-    return 1;
+  const int ndigits =
+      type == MY_GCVT_ARG_DOUBLE ? width : std::min(width, FLT_DIG);
+  if ((len = shortest_digits(x, ndigits, buf, &decpt)) > 0) {
+    res = buf;
+    end = buf + len;
+    sign = x < 0.;
+  } else {
+    res = dtoa(x, 4, ndigits, &decpt, &sign, &end, buf, sizeof(buf));
+    if (decpt == DTOA_OVERFLOW) {
+      dtoa_free(res, buf, sizeof(buf));
+      *to++ = '0';
+      *to = '\0';
+      if (error != nullptr) *error = true;
+      return 1;
+    }
   }
 
   if (error != nullptr) *error = false;
@@ -764,6 +773,54 @@ static void dtoa_free(char *gptr, char *buf, size_t buf_size) {
   if (gptr < buf || gptr >= buf + buf_size) free(gptr);
 }
 
+/**
+  Computes the shortest digit string which rounds to x, like dtoa() in
+  mode 0, with std::to_chars() which uses a much faster algorithm than the
+  bignum arithmetic in dtoa(). If the string has at most ndigits digits,
+  it is also what dtoa() returns in mode 4.
+
+  @param x       The number to convert
+  @param ndigits The maximum number of digits wanted
+  @param buf     Where the digits are stored, not zero-terminated
+  @param decpt   Where the position of the decimal point is stored
+
+  @return The number of digits stored in buf, or 0 if x is zero, infinite
+  or NaN, if the shortest string is longer than ndigits, or if
+  std::to_chars() does not support floating-point numbers. dtoa() must
+  be used then.
+*/
+static int shortest_digits(double x [[maybe_unused]],
+                           int ndigits [[maybe_unused]],
+                           char *buf [[maybe_unused]],
+                           int *decpt [[maybe_unused]]) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  if (x == 0. || !std::isfinite(x)) return 0;
+
+  /* "d[.ddd]e[+-]dd[d]", without trailing zeros in the significand. */
+  char sci[32];
+  const std::to_chars_result res = std::to_chars(
+      sci, sci + sizeof(sci), std::fabs(x), std::chars_format::scientific);
+  if (res.ec != std::errc()) return 0;
+
+  const char *src = sci;
+  int len = 0;
+  buf[len++] = *src++;
+  if (*src == '.')
+    for (src++; *src != 'e'; src++) buf[len++] = *src;
+  if (len > ndigits) return 0;
+
+  src++; /* 'e' */
+  const bool negative_exp = *src++ == '-';
+  int exp = 0;
+  for (; src < res.ptr; src++) exp = exp * 10 + (*src - '0');
+
+  *decpt = (negative_exp ? -exp : exp) + 1;
+  return len;
+#else
+  return 0;
+#endif
+}
+
 /* Bigint arithmetic functions */
 
 /* Multiply by m and add a */
@@ -21,6 +21,7 @@
    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
 #include <gtest/gtest.h>
 #include "sql/rpl_gtid.h"
+#include "unittest/gunit/benchmark.h"
 
 class GtidSetTest : public ::testing::Test {
  public:
@@ -597,3 +598,156 @@ TEST_F(GtidSetTest, GtidSetParsingTestFormat) {
         (gtid_sets_expected.at(gtid_set_verification.at(id++)).get())));
   }
 }
+
+TEST_F(GtidSetTest, Compact_gtid_set) {
+  Checkable_rwlock smap_lock;
+  Tsid_map sm(&smap_lock);
+  mysql::gtid::Tsid tsid1, tsid2;
+
+  smap_lock.wrlock();
+  ASSERT_TRUE(tsid1.from_cstring("d3a98502-756b-4b08-bdd2-a3d3938ba90f") > 0);
+  ASSERT_TRUE(tsid2.from_cstring("e3a98502-756b-4b08-bdd2-a3d3938ba90f") > 0);
+  rpl_sidno sidno1 = sm.add_tsid(tsid1);
+  rpl_sidno sidno2 = sm.add_tsid(tsid2);
+
+  Gtid_set set1(&sm, nullptr);
+  Gtid_set set2(&sm, nullptr);
+  Gtid_set set3(&sm, nullptr);
+  set1.add_gtid_text(
+      "d3a98502-756b-4b08-bdd2-a3d3938ba90f:1:3-6:8,"
+      "e3a98502-756b-4b08-bdd2-a3d3938ba90f:10-20");
+  set2.add_gtid_text("d3a98502-756b-4b08-bdd2-a3d3938ba90f:1-10");
+  set3.add_gtid_text("d3a98502-756b-4b08-bdd2-a3d3938ba90f:4-5");
+
+  Compact_gtid_set compact1(&set1);
+  Compact_gtid_set compact2(&set2);
+  Compact_gtid_set compact3(&set3);
+  smap_lock.unlock();
+
+  for (rpl_gno gno = 1; gno <= 25; gno++) {
+    ASSERT_EQ(set1.contains_gtid(sidno1, gno),
+              compact1.contains_gtid(sidno1, gno));
+    ASSERT_EQ(set1.contains_gtid(sidno2, gno),
+              compact1.contains_gtid(sidno2, gno));
+  }
+  ASSERT_FALSE(compact1.contains_gtid(sidno2 + 1, 1));
+  ASSERT_EQ(5U, compact1.get_n_intervals());
+
+  ASSERT_TRUE(compact3.is_subset(compact1));
+  ASSERT_TRUE(compact3.is_subset(compact2));
+  ASSERT_FALSE(compact1.is_subset(compact2));
+  ASSERT_FALSE(compact2.is_subset(compact1));
+  ASSERT_TRUE(compact1.is_intersection_nonempty(compact3));
+  ASSERT_TRUE(compact2.is_intersection_nonempty(compact1));
+
+  compact3.clear();
+  ASSERT_TRUE(compact3.is_empty());
+  ASSERT_TRUE(compact3.is_subset(compact1));
+  ASSERT_FALSE(compact3.is_intersection_nonempty(compact1));
+}
+
+/*
+  Membership tests on a set with many holes, as searched by a dump thread
+  for each GTID event.
+*/
+static const rpl_gno GAPPY_SET_INTERVALS = 10000;
+
+static void fill_gappy_set(Gtid_set *set, rpl_sidno sidno) {
+  set->ensure_sidno(sidno);
+  for (rpl_gno gno = 1; gno <= 2 * GAPPY_SET_INTERVALS; gno += 2)
+    set->_add_gtid(sidno, gno);
+}
+
+static void BM_Gtid_set_contains_gtid(size_t num_iterations) {
+  StopBenchmarkTiming();
+  Checkable_rwlock smap_lock;
+  Tsid_map sm(&smap_lock);
+  mysql::gtid::Tsid tsid;
+  smap_lock.wrlock();
+  tsid.from_cstring("d3a98502-756b-4b08-bdd2-a3d3938ba90f");
+  rpl_sidno sidno = sm.add_tsid(tsid);
+  Gtid_set set(&sm, nullptr);
+  fill_gappy_set(&set, sidno);
+  StartBenchmarkTiming();
+
+  size_t found = 0;
+  for (size_t i = 0; i < num_iterations; i++)
+    found += set.contains_gtid(sidno, 1 + i % (2 * GAPPY_SET_INTERVALS));
+
+  StopBenchmarkTiming();
+  smap_lock.unlock();
+  EXPECT_NE(0U, found);
+}
+BENCHMARK(BM_Gtid_set_contains_gtid)
+
+static void BM_Compact_gtid_set_contains_gtid(size_t num_iterations) {
+  StopBenchmarkTiming();
+  Checkable_rwlock smap_lock;
+  Tsid_map sm(&smap_lock);
+  mysql::gtid::Tsid tsid;
+  smap_lock.wrlock();
+  tsid.from_cstring("d3a98502-756b-4b08-bdd2-a3d3938ba90f");
+  rpl_sidno sidno = sm.add_tsid(tsid);
+  Gtid_set set(&sm, nullptr);
+  fill_gappy_set(&set, sidno);
+  Compact_gtid_set compact(&set);
+  StartBenchmarkTiming();
+
+  size_t found = 0;
+  for (size_t i = 0; i < num_iterations; i++)
+    found += compact.contains_gtid(sidno, 1 + i % (2 * GAPPY_SET_INTERVALS));
+
+  StopBenchmarkTiming();
+  smap_lock.unlock();
+  EXPECT_NE(0U, found);
+}
+BENCHMARK(BM_Compact_gtid_set_contains_gtid)
+
+/*
+  Adding committed GTIDs one at a time in order, as done for
+  gtid_executed, followed by merging one set into another.
+*/
+static void BM_Gtid_set_add_gtid(size_t num_iterations) {
+  StopBenchmarkTiming();
+  Checkable_rwlock smap_lock;
+  Tsid_map sm(&smap_lock);
+  mysql::gtid::Tsid tsid;
+  smap_lock.wrlock();
+  tsid.from_cstring("d3a98502-756b-4b08-bdd2-a3d3938ba90f");
+  rpl_sidno sidno = sm.add_tsid(tsid);
+  Gtid_set set(&sm, nullptr);
+  set.ensure_sidno(sidno);
+  StartBenchmarkTiming();
+
+  for (size_t i = 0; i < num_iterations; i++)
+    set._add_gtid(sidno, static_cast<rpl_gno>(i + 1));
+
+  StopBenchmarkTiming();
+  EXPECT_TRUE(set.contains_gtid(sidno, static_cast<rpl_gno>(num_iterations)));
+  smap_lock.unlock();
+}
+BENCHMARK(BM_Gtid_set_add_gtid)
+
+static void BM_Gtid_set_add_gtid_set(size_t num_iterations) {
+  StopBenchmarkTiming();
+  Checkable_rwlock smap_lock;
+  Tsid_map sm(&smap_lock);
+  mysql::gtid::Tsid tsid;
+  smap_lock.wrlock();
+  tsid.from_cstring("d3a98502-756b-4b08-bdd2-a3d3938ba90f");
+  rpl_sidno sidno = sm.add_tsid(tsid);
+  Gtid_set gappy(&sm, nullptr);
+  fill_gappy_set(&gappy, sidno);
+
+  for (size_t i = 0; i < num_iterations; i++) {
+    Gtid_set set(&sm, nullptr);
+    set.ensure_sidno(sidno);
+    set._add_gtid(sidno, 2);
+    StartBenchmarkTiming();
+    set.add_gtid_set(&gappy);
+    StopBenchmarkTiming();
+    EXPECT_TRUE(set.contains_gtid(sidno, 2));
+  }
+  smap_lock.unlock();
+}
+BENCHMARK(BM_Gtid_set_add_gtid_set)
@@ -27,8 +27,11 @@
 
 #include "my_inttypes.h"
 #include "my_pointer_arithmetic.h"
+#include "myisampack.h"
 #include "sql/filesort_utils.h"
+#include "sql/sort_param.h"
 #include "sql/table.h"
+#include "unittest/gunit/benchmark.h"
 
 namespace filesort_buffer_unittest {
 
@@ -162,4 +165,101 @@ TEST_F(FileSortBufferTest, PreallocateRecords) {
   }
 }
 
+/**
+  Fill the buffer with "num_records" records of "key_length" bytes, where
+  the first 4 bytes have many duplicates and the rest are zero, each
+  followed by its position in the input as a 4-byte "row ID", and set up
+  "param" to sort them with "num_threads" threads.
+ */
+static void Fill(Filesort_buffer *fs_info, uint num_records, uint key_length,
+                 uint num_threads, Sort_param *param) {
+  const uint record_length = key_length + 4;
+  fs_info->set_max_size(10485760, record_length);
+  for (uint ix = 0; ix < num_records; ++ix) {
+    Bounds_checked_array<uchar> buf =
+        fs_info->get_next_record_pointer(record_length);
+    ASSERT_GE(buf.size(), record_length);
+    memset(buf.array(), 0, key_length);
+    mi_int4store(buf.array(), (ix * 7919) % 1000);
+    mi_int4store(buf.array() + key_length, ix);
+    fs_info->commit_used_memory(record_length);
+  }
+
+  param->set_max_compare_length(record_length);
+  param->sum_ref_length = 4;
+  param->m_num_sort_threads = num_threads;
+}
+
+/**
+  Fill the buffer as Fill() does, sort it, and verify the result.
+ */
+static void FillAndSort(Filesort_buffer *fs_info, uint num_records,
+                        uint key_length, uint num_threads,
+                        Sort_param *param) {
+  Fill(fs_info, num_records, key_length, num_threads, param);
+  EXPECT_EQ(num_records,
+            fs_info->sort_buffer(param, num_records, num_records));
+
+  // Sorted on the key, and stable, so that equal keys keep the input order.
+  for (uint ix = 1; ix < num_records; ++ix) {
+    const uchar *prev = fs_info->get_sorted_record(ix - 1);
+    const uchar *cur = fs_info->get_sorted_record(ix);
+    ASSERT_LE(mi_uint4korr(prev), mi_uint4korr(cur)) << "index:" << ix;
+    if (mi_uint4korr(prev) == mi_uint4korr(cur)) {
+      ASSERT_LT(mi_uint4korr(prev + key_length),
+                mi_uint4korr(cur + key_length))
+          << "index:" << ix;
+    }
+  }
+}
+
+TEST_F(FileSortBufferTest, SortInParallel) {
+  // Too long for radix sort.
+  Sort_param param;
+  FillAndSort(&fs_info, 100000, 20, 4, &param);
+  EXPECT_EQ(Sort_param::FILESORT_ALG_STD_STABLE, param.m_sort_algorithm);
+}
+
+TEST_F(FileSortBufferTest, RadixSort) {
+  Sort_param param;
+  FillAndSort(&fs_info, 100000, 4, 1, &param);
+  EXPECT_EQ(Sort_param::FILESORT_ALG_RADIX, param.m_sort_algorithm);
+}
+
+TEST_F(FileSortBufferTest, RadixSortInParallel) {
+  Sort_param param;
+  FillAndSort(&fs_info, 100000, 8, 4, &param);
+  EXPECT_EQ(Sort_param::FILESORT_ALG_RADIX, param.m_sort_algorithm);
+}
+
+/*
+  Timings of sort_buffer() alone, refilling the buffer outside the timed
+  region before each sort.
+*/
+static void BenchmarkSort(size_t num_iterations, uint key_length,
+                          uint num_threads) {
+  StopBenchmarkTiming();
+  const uint num_records = 10000;
+  for (size_t i = 0; i < num_iterations; ++i) {
+    Filesort_buffer fs_info;
+    Sort_param param;
+    Fill(&fs_info, num_records, key_length, num_threads, &param);
+    StartBenchmarkTiming();
+    size_t sorted = fs_info.sort_buffer(&param, num_records, num_records);
+    StopBenchmarkTiming();
+    EXPECT_EQ(num_records, sorted);
+    fs_info.free_sort_buffer();
+  }
+}
+
+static void BM_SortBufferStable(size_t num_iterations) {
+  BenchmarkSort(num_iterations, 20, 1);
+}
+BENCHMARK(BM_SortBufferStable)
+
+static void BM_SortBufferRadix(size_t num_iterations) {
+  BenchmarkSort(num_iterations, 4, 1);
+}
+BENCHMARK(BM_SortBufferRadix)
+
 }  // namespace filesort_buffer_unittest
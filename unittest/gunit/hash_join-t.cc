@@ -20,6 +20,7 @@
    along with this program; if not, write to the Free Software
    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -43,18 +44,22 @@
 #include "sql/field.h"
 #include "sql/item.h"
 #include "sql/item_cmpfunc.h"
+#include "sql/iterators/composite_iterators.h"
 #include "sql/iterators/hash_join_iterator.h"
 #include "sql/iterators/row_iterator.h"
 #include "sql/join_type.h"
 #include "sql/mem_root_array.h"
 #include "sql/pack_rows.h"
+#include "sql/parse_tree_helpers.h"
 #include "sql/sql_class.h"
 #include "sql/sql_executor.h"
+#include "sql/sql_lex.h"
 #include "sql/sql_opt_exec_shared.h"
 #include "sql/sql_optimizer.h"
 #include "sql/table.h"
 #include "sql_string.h"
 #include "template_utils.h"
+#include "thr_lock.h"
 #include "unittest/gunit/benchmark.h"
 #include "unittest/gunit/fake_integer_iterator.h"
 #include "unittest/gunit/fake_string_iterator.h"
@@ -482,6 +487,259 @@ TEST(HashJoinTest, InnerJoinIntOneToManyMatch) {
               ElementsAre(2, 2));
 }
 
+TEST(HashJoinTest, InnerJoinIntBatchedBuild) {
+  my_testing::Server_initializer initializer;
+  initializer.SetUp();
+  THD *thd = initializer.thd();
+  thd->lex->sql_command = SQLCOM_SELECT;
+  thd->variables.iterator_batch_size = 2;
+
+  // Five build rows do not fill a whole number of batches.
+  HashJoinTestHelper test_helper(initializer, {1, 2, 3, 4, 5}, {5, 3, 1});
+  test_helper.left_qep_tab->table()->reginfo.lock_type = TL_READ;
+  FakeIntegerIterator *build_iterator =
+      down_cast<FakeIntegerIterator *>(test_helper.left_iterator.get());
+
+  HashJoinIterator hash_join_iterator(
+      thd, std::move(test_helper.left_iterator), test_helper.left_tables(),
+      /*estimated_build_rows=*/1000, std::move(test_helper.right_iterator),
+      test_helper.right_tables(), /*store_rowids=*/false,
+      /*tables_to_get_rowid_for=*/0, 10 * 1024 * 1024 /* 10 MB */,
+      {*test_helper.join_condition}, true, JoinType::INNER,
+      test_helper.extra_conditions, HashJoinInput::kBuild,
+      /*probe_input_batch_mode=*/false, nullptr);
+
+  ASSERT_FALSE(hash_join_iterator.Init());
+  EXPECT_THAT(CollectIntResults(&hash_join_iterator,
+                                test_helper.left_qep_tab->table()->field[0]),
+              ElementsAre(5, 3, 1));
+
+  // Five rows and one EOF; the build input must not be read past EOF.
+  EXPECT_EQ(6, build_iterator->num_read_calls());
+
+  thd->variables.iterator_batch_size = 0;
+}
+
+TEST(HashJoinTest, InnerJoinIntBatchedBuildWithBatchFilter) {
+  my_testing::Server_initializer initializer;
+  initializer.SetUp();
+  THD *thd = initializer.thd();
+  thd->lex->sql_command = SQLCOM_SELECT;
+  thd->variables.iterator_batch_size = 4;
+
+  HashJoinTestHelper test_helper(initializer, {1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                 {1, 3, 5, 6, 7, 8});
+  test_helper.left_qep_tab->table()->reginfo.lock_type = TL_READ;
+  Field *build_field = test_helper.left_qep_tab->table()->field[0];
+
+  // column1 BETWEEN 2 AND 6 AND column1 IN (1, 3, 4, 6, 8)
+  Parse_context pc(thd, thd->lex->current_query_block());
+  Item *between =
+      new Item_func_between(POS(), new Item_field(build_field),
+                            new Item_int(2), new Item_int(6), false);
+  ASSERT_FALSE(between->itemize(&pc, &between));
+  ASSERT_FALSE(between->fix_fields(thd, &between));
+
+  PT_item_list *in_list = new (thd->mem_root) PT_item_list(POS());
+  in_list->push_back(new Item_field(build_field));
+  for (int value : {1, 3, 4, 6, 8}) in_list->push_back(new Item_int(value));
+  Item *in = new Item_func_in(POS(), in_list, false);
+  ASSERT_FALSE(in->itemize(&pc, &in));
+  ASSERT_FALSE(in->fix_fields(thd, &in));
+
+  Item_cond_and *condition = new Item_cond_and(between, in);
+  condition->quick_fix_field();
+  condition->update_used_tables();
+
+  // Both conjuncts are evaluated on entire batches.
+  Batch_filter batch_filter(thd->mem_root);
+  for (Item *conjunct : {between, in}) {
+    Batch_int_predicate *predicate =
+        Batch_int_predicate::Create(thd->mem_root, conjunct);
+    ASSERT_NE(nullptr, predicate);
+    batch_filter.predicates.push_back(predicate);
+  }
+
+  unique_ptr_destroy_only<RowIterator> filter(
+      new (thd->mem_root) FilterIterator(
+          thd, std::move(test_helper.left_iterator), condition,
+          &batch_filter));
+
+  HashJoinIterator hash_join_iterator(
+      thd, std::move(filter), test_helper.left_tables(),
+      /*estimated_build_rows=*/1000, std::move(test_helper.right_iterator),
+      test_helper.right_tables(), /*store_rowids=*/false,
+      /*tables_to_get_rowid_for=*/0, 10 * 1024 * 1024 /* 10 MB */,
+      {*test_helper.join_condition}, true, JoinType::INNER,
+      test_helper.extra_conditions, HashJoinInput::kBuild,
+      /*probe_input_batch_mode=*/false, nullptr);
+
+  ASSERT_FALSE(hash_join_iterator.Init());
+  EXPECT_THAT(CollectIntResults(&hash_join_iterator, build_field),
+              ElementsAre(3, 6));
+
+  thd->variables.iterator_batch_size = 0;
+}
+
+TEST(HashJoinTest, InnerJoinIntPartitionedBuild) {
+  my_testing::Server_initializer initializer;
+  initializer.SetUp();
+  THD *thd = initializer.thd();
+  thd->variables.hash_join_build_threads = 4;
+
+  // Enough rows for the partitions to be filled by worker threads. Each key
+  // is stored twice, so that the rows must be chained correctly.
+  constexpr int kNumKeys = 35000;
+  vector<optional<int>> build_rows;
+  for (int i = 0; i < 2 * kNumKeys; ++i) build_rows.emplace_back(i % kNumKeys);
+
+  HashJoinTestHelper test_helper(initializer, std::move(build_rows),
+                                 {0, 5, kNumKeys - 1, kNumKeys});
+
+  HashJoinIterator hash_join_iterator(
+      thd, std::move(test_helper.left_iterator), test_helper.left_tables(),
+      /*estimated_build_rows=*/1000, std::move(test_helper.right_iterator),
+      test_helper.right_tables(), /*store_rowids=*/false,
+      /*tables_to_get_rowid_for=*/0, 64 * 1024 * 1024 /* 64 MB */,
+      {*test_helper.join_condition}, true, JoinType::INNER,
+      test_helper.extra_conditions, HashJoinInput::kBuild,
+      /*probe_input_batch_mode=*/false, nullptr);
+
+  ASSERT_FALSE(hash_join_iterator.Init());
+  EXPECT_THAT(CollectIntResults(&hash_join_iterator,
+                                test_helper.left_qep_tab->table()->field[0]),
+              ElementsAre(0, 0, 5, 5, kNumKeys - 1, kNumKeys - 1));
+
+  thd->variables.hash_join_build_threads = 1;
+}
+
+TEST(HashJoinTest, HashJoinHashTable) {
+  // Keys of different lengths, enough to make the table grow several times.
+  constexpr int kNumKeys = 5000;
+  vector<string> keys;
+  for (int i = 0; i < kNumKeys; ++i) {
+    keys.push_back(i % 2 == 0 ? std::to_string(i)
+                              : "long key number " + std::to_string(i));
+  }
+  keys.emplace_back();  // The empty key.
+
+  MEM_ROOT mem_root(PSI_NOT_INSTRUMENTED, 4096);
+  hash_join_buffer::HashJoinHashTable table;
+  EXPECT_TRUE(table.empty());
+  EXPECT_EQ(nullptr, table.find("0"));
+  EXPECT_EQ(nullptr, table.first());
+
+  for (const string &key : keys) {
+    char *ptr = static_cast<char *>(mem_root.Alloc(
+        ImmutableStringWithLength::RequiredBytesForEncode(key.size())));
+    const ImmutableStringWithLength encoded =
+        ImmutableStringWithLength::Encode(key.data(), key.size(), &ptr);
+    const auto [entry, inserted] = table.emplace(encoded);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(key, entry->key.Decode());
+
+    // Inserting the same key again finds the existing entry.
+    EXPECT_EQ(std::make_pair(entry, false), table.emplace(encoded));
+  }
+  EXPECT_EQ(keys.size(), table.size());
+  EXPECT_NE(nullptr, table.first());
+  EXPECT_LE(table.num_bytes(),
+            hash_join_buffer::HashJoinHashTable::BytesForEntries(keys.size()));
+
+  for (const string &key : keys) {
+    const hash_join_buffer::HashJoinHashTable::Entry *entry = table.find(key);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ(key, entry->key.Decode());
+  }
+  EXPECT_EQ(nullptr, table.find("-1"));
+  EXPECT_EQ(nullptr, table.find("long key number 0"));
+  EXPECT_EQ(nullptr, table.find(std::to_string(kNumKeys)));
+}
+
+TEST(HashJoinTest, HashTableProbeCounters) {
+  my_testing::Server_initializer initializer;
+  initializer.SetUp();
+
+  HashJoinTestHelper test_helper(initializer, {2, 4, 6}, {1, 2, 3, 4});
+
+  HashJoinIterator hash_join_iterator(
+      initializer.thd(), std::move(test_helper.left_iterator),
+      test_helper.left_tables(), /*estimated_build_rows=*/1000,
+      std::move(test_helper.right_iterator), test_helper.right_tables(),
+      /*store_rowids=*/false,
+      /*tables_to_get_rowid_for=*/0, 10 * 1024 * 1024 /* 10 MB */,
+      {*test_helper.join_condition}, true, JoinType::INNER,
+      test_helper.extra_conditions, HashJoinInput::kBuild,
+      /*probe_input_batch_mode=*/false, nullptr);
+
+  ASSERT_FALSE(hash_join_iterator.Init());
+  EXPECT_THAT(CollectIntResults(&hash_join_iterator,
+                                test_helper.left_qep_tab->table()->field[0]),
+              ElementsAre(2, 4));
+  EXPECT_EQ(4U, hash_join_iterator.num_hash_table_probes());
+  EXPECT_EQ(2U, hash_join_iterator.num_hash_table_probe_misses());
+}
+
+TEST(HashJoinTest, BloomFilter) {
+  std::mt19937_64 generator(42);
+  vector<uint64_t> hashes;
+  for (int i = 0; i < 10000; ++i) hashes.push_back(generator());
+
+  BloomFilter filter;
+  ASSERT_FALSE(filter.Init(hashes.size()));
+  for (uint64_t hash : hashes) filter.Insert(hash);
+  EXPECT_FALSE(filter.overfull());
+  for (uint64_t hash : hashes) EXPECT_TRUE(filter.MayContain(hash));
+
+  int false_positives = 0;
+  for (int i = 0; i < 100000; ++i) {
+    if (filter.MayContain(generator())) ++false_positives;
+  }
+  EXPECT_LT(false_positives, 2000);
+
+  // Reinitializing clears the filter.
+  ASSERT_FALSE(filter.Init(hashes.size()));
+  EXPECT_FALSE(filter.MayContain(hashes[0]));
+}
+
+TEST(HashJoinTest, InnerJoinIntBloomFilter) {
+  my_testing::Server_initializer initializer;
+  initializer.SetUp();
+  THD *thd = initializer.thd();
+  thd->variables.hash_join_bloom_filter = true;
+
+  constexpr int kNumProbeRows = 10000;
+  vector<optional<int>> probe_rows;
+  for (int i = 0; i < kNumProbeRows; ++i) probe_rows.emplace_back(i);
+  HashJoinTestHelper test_helper(initializer, {2, 4, 6},
+                                 std::move(probe_rows));
+
+  HashJoinIterator hash_join_iterator(
+      thd, std::move(test_helper.left_iterator), test_helper.left_tables(),
+      /*estimated_build_rows=*/3, std::move(test_helper.right_iterator),
+      test_helper.right_tables(), /*store_rowids=*/false,
+      /*tables_to_get_rowid_for=*/0, 10 * 1024 * 1024 /* 10 MB */,
+      {*test_helper.join_condition}, true, JoinType::INNER,
+      test_helper.extra_conditions, HashJoinInput::kBuild,
+      /*probe_input_batch_mode=*/false, nullptr);
+
+  ASSERT_FALSE(hash_join_iterator.Init());
+  EXPECT_THAT(CollectIntResults(&hash_join_iterator,
+                                test_helper.left_qep_tab->table()->field[0]),
+              ElementsAre(2, 4, 6));
+
+  // All but a few false positives are rejected by the filter, and the rest
+  // are looked up in the hash table.
+  EXPECT_GT(hash_join_iterator.num_bloom_filter_rejections(),
+            ha_rows{kNumProbeRows * 98 / 100});
+  EXPECT_EQ(ha_rows{kNumProbeRows},
+            hash_join_iterator.num_bloom_filter_rejections() +
+                hash_join_iterator.num_hash_table_probes());
+
+  thd->variables.hash_join_bloom_filter = false;
+}
+
 TEST(HashJoinTest, InnerJoinStringOneToOneMatch) {
   my_testing::Server_initializer initializer;
   initializer.SetUp();
@@ -835,22 +1093,62 @@ TEST(HashJoinTest, HashJoinChunkFiles) {
   ASSERT_FALSE(hash_join_iterator.Init());
 
   // We hash 1000 rows (64-bit arch) or 2000 rows (32-bit arch). The hash
-  // table can normally hold about 410 rows on 64-bit machines and 820 rows on
-  // 32-bit machines (verified experimentally). To get the required number of
+  // table can normally hold about 448 rows on 64-bit machines and 896 rows on
+  // 32-bit machines (7/8 of its capacity). To get the required number of
   // chunks, the number of remaining rows should be divided by the number of
   // hash table rows. But as a safeguard, this calculation is adjusted to yield
   // a few extra chunks rather than risk having too few chunks. So the number
   // of remaining rows is instead divided by a reduced count of hash table rows
   // The reduced count is obtained by multiplying the hash table row count by
   // a 'reduction factor' of 0.9. E.g. for 64-bit rows:
-  // reduced_rows_in_hash_table = 410 * 0.9 = 369
-  // remaining_rows = 1000 - 410 = 590
+  // reduced_rows_in_hash_table = 448 * 0.9 = 403
+  // remaining_rows = 1000 - 448 = 552
   // required number of chunks = remaining_rows / reduced_rows_in_hash_table
-  //                           = 590 / 369 = 1.59, rounded up to 2
+  //                           = 552 / 403 = 1.37, rounded up to 2
   // So a count of 2 chunks is expected.
   EXPECT_EQ(2, hash_join_iterator.ChunkCount());
 }
 
+TEST(HashJoinTest, HashJoinRepartitionChunks) {
+  my_testing::Server_initializer initializer;
+  initializer.SetUp();
+
+  vector<optional<int>> dataset;
+  constexpr int dataset_sz = 1000;
+  for (int i = 0; i < dataset_sz; ++i) {
+    dataset.emplace_back(i);
+  }
+
+  HashJoinTestHelper test_helper(initializer, dataset, dataset);
+
+  // With an estimate of one row, all the rows that do not fit in the hash
+  // table go to a single chunk pair, which is too large to be read back into
+  // the hash table, and must be split.
+  HashJoinIterator hash_join_iterator(
+      initializer.thd(), std::move(test_helper.left_iterator),
+      test_helper.left_tables(), /*estimated_build_rows=*/1,
+      std::move(test_helper.right_iterator), test_helper.right_tables(),
+      /*store_rowids=*/false,
+      /*tables_to_get_rowid_for=*/0, 1024 /* 1 KB */,
+      {*test_helper.join_condition}, true, JoinType::INNER,
+      test_helper.extra_conditions, HashJoinInput::kBuild,
+      /*probe_input_batch_mode=*/false, nullptr);
+
+  ASSERT_FALSE(hash_join_iterator.Init());
+  EXPECT_EQ(1, hash_join_iterator.ChunkCount());
+
+  vector<optional<int>> results = CollectIntResults(
+      &hash_join_iterator, test_helper.left_qep_tab->table()->field[0]);
+  std::sort(results.begin(), results.end());
+  EXPECT_EQ(dataset, results);
+
+  const HashJoinSpillStats &stats = hash_join_iterator.spill_stats();
+  EXPECT_LT(ha_rows{0}, stats.repartitioned_chunks);
+  EXPECT_EQ(0U, stats.hash_table_refills);
+  EXPECT_EQ(stats.build_rows, stats.probe_rows);
+  EXPECT_GT(ha_rows{dataset_sz}, stats.build_rows);
+}
+
 TEST(HashJoinTest, InnerJoinIntNullable) {
   my_testing::Server_initializer initializer;
   initializer.SetUp();
@@ -4743,6 +4743,62 @@ TEST_F(HypergraphOptimizerTest, IndexDistanceScanMulti) {
   query_block->cleanup(/*full=*/true);
 }
 
+TEST_F(HypergraphOptimizerTest, ParallelTableScan) {
+  Query_block *query_block =
+      ParseAndResolve("SELECT SUM(t1.x) FROM t1", /*nullable=*/true);
+
+  Fake_TABLE *t1 = m_fake_tables["t1"];
+  t1->reginfo.lock_type = TL_READ;
+  auto hton = new (m_thd->mem_root) Fake_handlerton;
+  hton->db_type = DB_TYPE_INNODB;
+  t1->file->ht = hton;
+  m_thd->variables.parallel_table_scan_threads = 4;
+
+  // Large enough that the parallel scan pays for starting the threads.
+  t1->file->stats.records = 1000000;
+  t1->file->stats.data_file_length = 1e8;
+
+  string trace;
+  AccessPath *root = FindBestQueryPlanAndFinalize(m_thd, query_block, &trace);
+  SCOPED_TRACE(trace);  // Prints out the trace on failure.
+  // Prints out the query plan on failure.
+  SCOPED_TRACE(PrintQueryPlan(0, root, query_block->join,
+                              /*is_root_of_join=*/true));
+
+  ASSERT_EQ(AccessPath::AGGREGATE, root->type);
+  AccessPath *child = root->aggregate().child;
+  ASSERT_EQ(AccessPath::TABLE_SCAN, child->type);
+  EXPECT_EQ(4U, child->table_scan().num_parallel_threads);
+
+  query_block->cleanup(/*full=*/true);
+  m_thd->variables.parallel_table_scan_threads = 1;
+}
+
+TEST_F(HypergraphOptimizerTest, NoParallelTableScanForSmallTable) {
+  Query_block *query_block =
+      ParseAndResolve("SELECT SUM(t1.x) FROM t1", /*nullable=*/true);
+
+  Fake_TABLE *t1 = m_fake_tables["t1"];
+  t1->reginfo.lock_type = TL_READ;
+  auto hton = new (m_thd->mem_root) Fake_handlerton;
+  hton->db_type = DB_TYPE_INNODB;
+  t1->file->ht = hton;
+  m_thd->variables.parallel_table_scan_threads = 4;
+  t1->file->stats.records = 100;
+
+  string trace;
+  AccessPath *root = FindBestQueryPlanAndFinalize(m_thd, query_block, &trace);
+  SCOPED_TRACE(trace);  // Prints out the trace on failure.
+
+  ASSERT_EQ(AccessPath::AGGREGATE, root->type);
+  AccessPath *child = root->aggregate().child;
+  ASSERT_EQ(AccessPath::TABLE_SCAN, child->type);
+  EXPECT_EQ(0U, child->table_scan().num_parallel_threads);
+
+  query_block->cleanup(/*full=*/true);
+  m_thd->variables.parallel_table_scan_threads = 1;
+}
+
 TEST_F(HypergraphOptimizerTest, ElideConstSort) {
   Query_block *query_block =
       ParseAndResolve("SELECT t1.x FROM t1 ORDER BY 'a', 'b', CONCAT('c')",
@@ -23,6 +23,7 @@
 #include "univ.i"
 
 #include <atomic>
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <string>
@@ -114,6 +115,10 @@ constexpr size_t LOG_TEST_N_THREADS = 8;
 
 constexpr int LOG_TEST_N_STEPS = 20;
 
+/** Number of mini-transactions committed by each thread, when measuring
+the throughput of commits. */
+constexpr size_t LOG_TEST_N_BENCH_COMMITS = 20000;
+
 fil_space_t *log_space;
 
 extern SERVICE_TYPE_NO_CONST(registry) * srv_registry;
@@ -473,6 +478,41 @@ static void log_test_run() {
       LOG_TEST_N_THREADS);
 }
 
+/** Commits LOG_TEST_N_BENCH_COMMITS mini-transactions with a single record
+in each of n_threads threads. The keys cover all the pages expected by
+log_test_close().
+@param[in]  n_threads  number of committing threads
+@return number of commits per second */
+static double log_test_commit_throughput(size_t n_threads) {
+  const lsn_t max_dirty_page_age = 10 * 1024;
+
+  const auto start_time = std::chrono::steady_clock::now();
+
+  run_threads(
+      [n_threads, max_dirty_page_age](size_t thread_no) {
+        log_t &log = *log_sys;
+
+        for (size_t j = 0; j < LOG_TEST_N_BENCH_COMMITS; ++j) {
+          const size_t key = (j * n_threads + thread_no) %
+                             (LOG_TEST_N_THREADS * LOG_TEST_N_STEPS);
+
+          const lsn_t end_lsn = write_single_mlog_test(key);
+
+          if (j % log_test->flush_every() == 0) {
+            log_test->purge(max_dirty_page_age);
+
+            log_write_up_to(log, end_lsn, false);
+          }
+        }
+      },
+      n_threads);
+
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start_time;
+
+  return n_threads * LOG_TEST_N_BENCH_COMMITS / elapsed.count();
+}
+
 static void log_test_general_close() {
   clone_free();
 
@@ -747,3 +787,28 @@ TEST(log0log, log_users) { test_single("log_users"); }
 TEST(log0log, log_closer) { test_single("log_closer"); }
 
 TEST(log0log, log_checkpointer) { test_single("log_checkpointer"); }
+
+TEST(log0log, log_buffer_reserve_combining) {
+  srv_log_reserve_combining = true;
+  test_single("log_buffer_reserve");
+  srv_log_reserve_combining = false;
+}
+
+TEST(log0log, log_buffer_reserve_throughput) {
+  for (const bool combining : {false, true}) {
+    for (size_t n_threads = 1; n_threads <= 16; n_threads *= 2) {
+      srv_log_reserve_combining = combining;
+      log_test.reset(new Log_test);
+      ASSERT_TRUE(log_test_init());
+
+      const double commits_per_sec = log_test_commit_throughput(n_threads);
+
+      log_test_close();
+
+      std::cout << "combining = " << combining << " threads = " << n_threads
+                << " commits/s = " << static_cast<uint64_t>(commits_per_sec)
+                << std::endl;
+    }
+  }
+  srv_log_reserve_combining = false;
+}
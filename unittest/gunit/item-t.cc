@@ -438,6 +438,49 @@ TEST_F(ItemTest, ItemRollupSwitcher) {
   EXPECT_TRUE(sw1->is_rollup_sum_wrapper());
 }
 
+TEST_F(ItemTest, ItemSumPartialState) {
+  Item_sum_partial_state state;
+  state.count = 42;
+  state.int_value = -7;
+  state.real_value = 2.5;
+  int2my_decimal(E_DEC_FATAL_ERROR, 123456789012345LL, false,
+                 &state.decimal_value);
+
+  String buffer;
+  EXPECT_FALSE(state.serialize(&buffer));
+  EXPECT_FALSE(state.serialize(&buffer));
+
+  // Two states back-to-back, and then nothing more.
+  const uchar *ptr = pointer_cast<const uchar *>(buffer.ptr());
+  const uchar *end = ptr + buffer.length();
+  for (int i = 0; i < 2; ++i) {
+    Item_sum_partial_state copy;
+    EXPECT_FALSE(copy.deserialize(&ptr, end));
+    EXPECT_EQ(42U, copy.count);
+    EXPECT_EQ(-7, copy.int_value);
+    EXPECT_EQ(2.5, copy.real_value);
+    EXPECT_EQ(0, my_decimal_cmp(&state.decimal_value, &copy.decimal_value));
+  }
+  EXPECT_EQ(end, ptr);
+  Item_sum_partial_state truncated;
+  EXPECT_TRUE(truncated.deserialize(&ptr, end));
+
+  // Merging the states of two subsets gives the state of the union.
+  Mock_field_long f_field1(true);
+  POS p;
+  Item_sum_count *count = new Item_sum_count(p, new Item_field(&f_field1),
+                                             /*w=*/nullptr);
+  ASSERT_TRUE(count->supports_partial_state());
+  Item_sum_partial_state part;
+  part.count = 10;
+  count->merge_partial_state(part);
+  part.count = 5;
+  count->merge_partial_state(part);
+  Item_sum_partial_state merged;
+  count->get_partial_state(&merged);
+  EXPECT_EQ(15U, merged.count);
+}
+
 TEST_F(ItemTest, ItemEqualEq) {
   Mock_field_timestamp field1;
   field1.field_name = "field1";
@@ -27,6 +27,7 @@
 #include "mysql/gcs/gcs_message.h"
 #include "template_utils.h"
 
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -159,6 +160,36 @@ TEST_F(MessageDataTest, EncodeTest) {
   delete message_data;
 }
 
+TEST_F(MessageDataTest, EncodeInPlaceTest) {
+  std::string test_header("header");
+  std::string test_payload("payload");
+  Gcs_message_data *message_data =
+      new Gcs_message_data(test_header.length(), test_payload.length());
+
+  message_data->append_to_payload(
+      pointer_cast<const uchar *>(test_payload.c_str()), test_payload.length());
+
+  const uchar *buffer = nullptr;
+  uint64_t buffer_len = 0;
+
+  /* The header does not fill its capacity, so it is not contiguous. */
+  EXPECT_TRUE(message_data->encode_in_place(&buffer, &buffer_len));
+
+  message_data->append_to_header(
+      pointer_cast<const uchar *>(test_header.c_str()), test_header.length());
+
+  EXPECT_FALSE(message_data->encode_in_place(&buffer, &buffer_len));
+  EXPECT_EQ(message_data->get_encode_size(), buffer_len);
+
+  uint64_t copy_len = message_data->get_encode_size();
+  uchar *copy = static_cast<uchar *>(malloc(copy_len));
+  EXPECT_FALSE(message_data->encode(copy, &copy_len));
+  EXPECT_EQ(0, memcmp(copy, buffer, buffer_len));
+
+  free(copy);
+  delete message_data;
+}
+
 TEST_F(MessageDataTest, EncodeNullTest) {
   std::string test_header("header");
   std::string test_payload("payload");
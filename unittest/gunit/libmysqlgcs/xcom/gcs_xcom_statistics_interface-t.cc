@@ -174,6 +174,18 @@ TEST_F(XcomStatisticsTest, AllMessagesSentTest) {
   ASSERT_EQ(message_count, message_count_ret);
 }
 
+TEST_F(XcomStatisticsTest, AllBatchedProposalsTest) {
+  constexpr auto batched_count = 4567;
+
+  EXPECT_CALL(stats_mgr_mock, get_count_var_value(kBatchedProposals))
+      .Times(1)
+      .WillOnce(Return(batched_count));
+
+  auto batched_count_ret = xcom_stats_if->get_all_batched_proposals();
+
+  ASSERT_EQ(batched_count, batched_count_ret);
+}
+
 TEST_F(XcomStatisticsTest, AllMessageBytesReceivedTest) {
   constexpr uint64_t received_bytes = 23456;
 
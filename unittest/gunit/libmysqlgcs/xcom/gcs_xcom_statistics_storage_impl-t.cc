@@ -122,6 +122,12 @@ TEST_F(XcomStatisticsStorageImplTest, AddMessageTest) {
   xcom_stats_storage_if->add_message();
 }
 
+TEST_F(XcomStatisticsStorageImplTest, AddBatchedProposalTest) {
+  EXPECT_CALL(stats_mgr_mock, set_count_var_value(kBatchedProposals)).Times(1);
+
+  xcom_stats_storage_if->add_batched_proposal();
+}
+
 TEST_F(XcomStatisticsStorageImplTest, AddBytesReceivedTest) {
   uint64_t received_bytes = 23456;
 
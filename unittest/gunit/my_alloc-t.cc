@@ -174,6 +174,30 @@ TEST_F(MyAllocTest, ExceptionalBlocksAreNotReusedForLargerAllocations) {
   EXPECT_NE(ptr, ptr2);
 }
 
+TEST_F(MyAllocTest, ClearForReuseKeepsLargestSmallBlock) {
+  MEM_ROOT alloc(PSI_NOT_INSTRUMENTED, 512);
+  alloc.Alloc(500);
+  alloc.Alloc(1000);
+  alloc.Alloc(5000);
+
+  alloc.ClearForReuse(2000);
+  if (alloc.allocated_size() == 0) {
+    // Running under Valgrind/ASAN, so no reuse (see above).
+    return;
+  }
+
+  // The 5000-byte block is freed, the 1000-byte one is kept for reuse.
+  EXPECT_GE(alloc.allocated_size(), 1000U);
+  EXPECT_LE(alloc.allocated_size(), 2000U);
+  std::pair<char *, char *> block = alloc.Peek();
+  EXPECT_EQ(alloc.allocated_size(),
+            static_cast<size_t>(block.second - block.first));
+
+  // Nothing is small enough, so everything is freed.
+  alloc.ClearForReuse(100);
+  EXPECT_EQ(0U, alloc.allocated_size());
+}
+
 TEST_F(MyAllocTest, RawInterface) {
   MEM_ROOT alloc(PSI_NOT_INSTRUMENTED, 512);
 
@@ -21,6 +21,9 @@
    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
 
 #include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <random>
 
 #include "my_sys.h"
 #include "mysql/strings/dtoa.h"
@@ -72,4 +75,34 @@ TEST_P(GcvtTest, Convert) {
   EXPECT_EQ(test_input, nr) << "buff[" << buff << "]" << std::endl;
 }
 
+/*
+  my_gcvt() takes the shortest digits from std::to_chars() when they fit,
+  and falls back to dtoa() otherwise. Random bit patterns cover both, and
+  must convert back to the same double.
+*/
+TEST(GcvtRandomTest, RoundTrip) {
+  const int width = MAX_DOUBLE_STR_LENGTH + 2;
+  std::mt19937_64 generator(20231015);
+
+  for (int i = 0; i < 100000; i++) {
+    const uint64_t bits = generator();
+    double test_input;
+    memcpy(&test_input, &bits, sizeof(test_input));
+    if (!std::isfinite(test_input)) continue;
+
+    char buff[MAX_DOUBLE_STR_LENGTH * 2] = {};
+    bool error{false};
+    const size_t len =
+        my_gcvt(test_input, MY_GCVT_ARG_DOUBLE, width, buff, &error);
+    EXPECT_LE(len, width);
+    EXPECT_FALSE(error) << "buff[" << buff << "]";
+
+    int int_error{0};
+    const char *str_end = buff + len;
+    const double result = my_strtod(buff, &str_end, &int_error);
+    EXPECT_EQ(0, int_error) << "buff[" << buff << "]";
+    EXPECT_EQ(test_input, result) << "buff[" << buff << "]";
+  }
+}
+
 }  // namespace double_to_string_to_double_unittest
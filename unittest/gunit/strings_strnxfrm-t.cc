@@ -2144,6 +2144,38 @@ TEST(PadCollationTest, BasicTest) {
       0);
 }
 
+// strnncoll skips common ASCII prefixes; it must still agree with strnxfrm.
+TEST(PadCollationTest, CommonPrefix) {
+  static constexpr const char *pairs[][2] = {
+      {"customer_name_0001", "customer_name_0002"},
+      {"customer_name_Abc", "customer_name_abd"},
+      {"customer_name_abc", "customer_name_ABC"},
+      {"customer_name_\xC3\xA9", "customer_name_e"},
+      {"customer_name_\xC3\xA9", "customer_name_\xC3\xA8"},
+      {"customer_name", "customer_name_"},
+      {"customer_name", "customer_name"},
+      {"", ""},
+  };
+
+  for (const char *name :
+       {"utf8mb4_0900_ai_ci", "utf8mb4_0900_as_ci", "utf8mb4_0900_as_cs"}) {
+    CHARSET_INFO *cs = init_collation(name);
+    for (const auto &pair : pairs) {
+      for (int i = 0; i < 2; ++i) {
+        const char *a = pair[i];
+        const char *b = pair[1 - i];
+        const int expected = compare_through_strxfrm(cs, a, b);
+        const int actual = cs->coll->strnncollsp(
+            cs, pointer_cast<const uchar *>(a), strlen(a),
+            pointer_cast<const uchar *>(b), strlen(b));
+        EXPECT_EQ(expected < 0, actual < 0) << name << ": " << a << ", " << b;
+        EXPECT_EQ(expected == 0, actual == 0)
+            << name << ": " << a << ", " << b;
+      }
+    }
+  }
+}
+
 TEST(StrxfrmTest, NoPadCollation) {
   CHARSET_INFO *ai_ci = init_collation("utf8mb4_0900_ai_ci");
   CHARSET_INFO *as_cs = init_collation("utf8mb4_0900_as_cs");
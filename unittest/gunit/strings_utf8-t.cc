@@ -518,6 +518,41 @@ TEST_F(StringsUTF8mb4Test, MyWellFormedLenUtf8mb4) {
   ASSERT_EQ(1, error);
 }
 
+TEST_F(StringsUTF8mb4Test, MyWellFormedLenUtf8mb4Ascii) {
+  const char ascii_src[] = "abcdefghijklmnopqrstuvwxyz";
+  int error;
+
+  /* the character limit stops inside and after whole ASCII words */
+  EXPECT_EQ(11U, system_charset_info->cset->well_formed_len(
+                     system_charset_info, ascii_src, ascii_src + 26, 11,
+                     &error));
+  ASSERT_EQ(0, error);
+  EXPECT_EQ(16U, system_charset_info->cset->well_formed_len(
+                     system_charset_info, ascii_src, ascii_src + 26, 16,
+                     &error));
+  ASSERT_EQ(0, error);
+  EXPECT_EQ(26U, system_charset_info->cset->well_formed_len(
+                     system_charset_info, ascii_src, ascii_src + 26, 100,
+                     &error));
+  ASSERT_EQ(0, error);
+
+  /* multibyte characters and illegal bytes after ASCII words */
+  char mixed_src[32] = "abcdefghijklmnop\xc2\x80qrstuvw\xff";
+  EXPECT_EQ(25U, system_charset_info->cset->well_formed_len(
+                     system_charset_info, mixed_src, mixed_src + 26, 100,
+                     &error));
+  ASSERT_EQ(1, error);
+  EXPECT_EQ(18U, system_charset_info->cset->well_formed_len(
+                     system_charset_info, mixed_src, mixed_src + 26, 17,
+                     &error));
+  ASSERT_EQ(0, error);
+  mixed_src[3] = '\x80';
+  EXPECT_EQ(3U, system_charset_info->cset->well_formed_len(
+                    system_charset_info, mixed_src, mixed_src + 26, 100,
+                    &error));
+  ASSERT_EQ(1, error);
+}
+
 TEST_F(StringsUTF8mb4Test, MyIsmbcharUtf8mb4) {
   char utf8_src[8] = {0};
 
@@ -249,4 +249,33 @@ TEST(Allocator, Casts) {
   EXPECT_NO_THROW(allocator1.deallocate(items1[1], 1));
 }
 
+TEST(Allocator, FallbackToMinimalBlock) {
+  init_allocator_once();
+
+  /* Leave room for a 1 MiB block and a small one, but not for the 2 MiB block
+   * the exponential policy asks for next. */
+  const bool use_mmap = temptable_use_mmap;
+  temptable_use_mmap = false;
+  Allocator_helper::set_allocator_max_ram(
+      temptable::MemoryMonitor::RAM::consumption() + 1792 * 1024);
+
+  const size_t ITEM_SIZE = 600 * 1024;
+
+  temptable::TableResourceMonitor table_resource_monitor(16 * 1024 * 1024);
+  temptable::Allocator<char> allocator(nullptr, table_resource_monitor);
+
+  char *items[3] = {};
+
+  EXPECT_NO_THROW(items[0] = allocator.allocate(ITEM_SIZE));
+  EXPECT_NO_THROW(items[1] = allocator.allocate(ITEM_SIZE));
+  EXPECT_THROW(items[2] = allocator.allocate(ITEM_SIZE),
+               temptable::Result);
+
+  EXPECT_NO_THROW(allocator.deallocate(items[1], ITEM_SIZE));
+  EXPECT_NO_THROW(allocator.deallocate(items[0], ITEM_SIZE));
+
+  temptable_use_mmap = use_mmap;
+  Allocator_helper::set_allocator_max_ram_default();
+}
+
 }  // namespace temptable_test
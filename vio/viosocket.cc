@@ -68,6 +68,9 @@
 #ifdef HAVE_SYS_IOCTL_H
 #include <sys/ioctl.h>
 #endif
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
 
 #include "mysql/psi/mysql_socket.h"
 
@@ -243,6 +246,60 @@ size_t vio_write(Vio *vio, const uchar *buf, size_t size) {
   return ret;
 }
 
+/**
+  Write a buffer followed by a range of a file to the socket.
+
+  The head is sent with MSG_MORE, so that the kernel can put it in the same
+  segment as the start of the file data, which is transferred with
+  sendfile(2). sendfile(2) has no MSG_DONTWAIT, so the write timeout is only
+  honoured if the socket is in non-blocking mode.
+
+  @return The number of bytes written, which may be less than
+          head_size + size, or -1 on error.
+*/
+size_t vio_sendfile(Vio *vio [[maybe_unused]],
+                    const uchar *head [[maybe_unused]],
+                    size_t head_size [[maybe_unused]],
+                    File file [[maybe_unused]],
+                    my_off_t offset [[maybe_unused]],
+                    size_t size [[maybe_unused]]) {
+  DBUG_TRACE;
+#ifdef __linux__
+  ssize_t ret;
+
+  if (head_size > 0) {
+    int flags = MSG_MORE;
+    if (vio->write_timeout >= 0) flags |= VIO_DONTWAIT;
+
+    while ((ret = mysql_socket_send(vio->mysql_socket,
+                                    pointer_cast<const SOCKBUF_T *>(head),
+                                    head_size, flags)) == -1) {
+      int error = socket_errno;
+      if (error != SOCKET_EAGAIN && error != SOCKET_EWOULDBLOCK) return -1;
+      if (!vio_is_blocking(vio)) return -1;
+      if (vio_socket_io_wait(vio, VIO_IO_EVENT_WRITE)) return -1;
+    }
+    if (static_cast<size_t>(ret) < head_size || size == 0) return ret;
+  }
+
+  off_t file_offset = static_cast<off_t>(offset);
+  while ((ret = sendfile(mysql_socket_getfd(vio->mysql_socket), file,
+                         &file_offset, size)) == -1) {
+    int error = socket_errno;
+    if (error != SOCKET_EAGAIN && error != SOCKET_EWOULDBLOCK) break;
+    if (!vio_is_blocking(vio)) break;
+    if (vio_socket_io_wait(vio, VIO_IO_EVENT_WRITE)) break;
+  }
+
+  /* Report the head as written even if the file data could not be. */
+  if (ret == -1) return head_size > 0 ? head_size : -1;
+  return head_size + ret;
+#else
+  errno = ENOSYS;
+  return -1;
+#endif
+}
+
 // WL#4896: Not covered
 int vio_set_blocking(Vio *vio, bool status) {
   DBUG_TRACE;